@@ -130,6 +130,11 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 		return CHIP_NO_ERROR;
 	}
 
+	/* Restoring the devices refreshes their records, so group all of them to write the storage at most once and
+	 * publish all restored endpoints together. The devices are restored in the Matter thread, so the stack does not
+	 * need to be locked. */
+	Nrf::BridgeManager::Instance().StartBulkUpdate();
+
 	/* Load all devices based on the read count number. */
 	for (size_t i = 0; i < indexesCount; i++) {
 		Nrf::BridgeStorageManager::BridgedDevice device;
@@ -140,6 +145,9 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 #endif
 
 		if (!Nrf::BridgeStorageManager::Instance().LoadBridgedDevice(device, indexes[i])) {
+			if (Nrf::BridgeManager::Instance().FinishBulkUpdate() != CHIP_NO_ERROR) {
+				LOG_ERR("Failed to store restored bridged devices");
+			}
 			return CHIP_ERROR_NOT_FOUND;
 		}
 
@@ -154,6 +162,11 @@ CHIP_ERROR AppTask::RestoreBridgedDevices()
 							    chip::Optional<uint16_t>(device.mEndpointId));
 #endif
 	}
+
+	if (Nrf::BridgeManager::Instance().FinishBulkUpdate() != CHIP_NO_ERROR) {
+		LOG_ERR("Failed to store restored bridged devices");
+	}
+
 	return CHIP_NO_ERROR;
 }
 #ifdef CONFIG_BRIDGE_SMART_PLUG_SUPPORT
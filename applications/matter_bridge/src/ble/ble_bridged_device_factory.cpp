@@ -72,16 +72,8 @@ CHIP_ERROR BleServiceToMatterDeviceType(BleBridgedDeviceFactory::ServiceUuid ser
 
 CHIP_ERROR StoreDevice(MatterBridgedDevice *device, BridgedDeviceDataProvider *provider, uint8_t index)
 {
-	uint8_t count = 0;
-	uint8_t indexes[BridgeManager::kMaxBridgedDevices] = { 0 };
-	bool deviceRefresh = false;
 	BridgeStorageManager::BridgedDevice bridgedDevice;
 
-	/* Check if a device is already present in the storage. */
-	if (BridgeStorageManager::Instance().LoadBridgedDevice(bridgedDevice, index)) {
-		deviceRefresh = true;
-	}
-
 	BLEBridgedDeviceProvider *bleProvider = static_cast<BLEBridgedDeviceProvider *>(provider);
 	bt_addr_le_t addr = bleProvider->GetBtAddress();
 
@@ -101,26 +93,6 @@ CHIP_ERROR StoreDevice(MatterBridgedDevice *device, BridgedDeviceDataProvider *p
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	/* If a device was not present in the storage before, put new index on the end of list and increment the count
-	 * number of stored devices. */
-	if (!deviceRefresh) {
-		CHIP_ERROR err = BridgeManager::Instance().GetDevicesIndexes(indexes, sizeof(indexes), count);
-		if (CHIP_NO_ERROR != err) {
-			LOG_ERR("Failed to get bridged devices indexes");
-			return err;
-		}
-
-		if (!BridgeStorageManager::Instance().StoreBridgedDevicesIndexes(indexes, count)) {
-			LOG_ERR("Failed to store bridged devices indexes.");
-			return CHIP_ERROR_INTERNAL;
-		}
-
-		if (!BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-			LOG_ERR("Failed to store bridged devices count.");
-			return CHIP_ERROR_INTERNAL;
-		}
-	}
-
 	return CHIP_NO_ERROR;
 }
 
@@ -176,12 +148,18 @@ CHIP_ERROR AddMatterDevices(MatterBridgedDevice::DeviceType deviceTypes[], uint8
 	}
 
 	if (err == CHIP_NO_ERROR) {
+		/* Store all devices of the provider using a single storage write. */
+		BridgeStorageManager::Instance().StartTransaction();
 		for (uint8_t i = 0; i < count; i++) {
 			err = StoreDevice(newBridgedDevices[i], providerPtr.get(), deviceIndexes[i]);
 			if (err != CHIP_NO_ERROR) {
 				break;
 			}
 		}
+		if (!BridgeStorageManager::Instance().CommitTransaction() && err == CHIP_NO_ERROR) {
+			LOG_ERR("Failed to store bridged devices");
+			err = CHIP_ERROR_INTERNAL;
+		}
 	}
 
 	/* The ownership was transferred unconditionally to the BridgeManager, release the pointer. */
@@ -440,8 +418,6 @@ exit:
 CHIP_ERROR BleBridgedDeviceFactory::RemoveDevice(int endpointId)
 {
 	uint8_t index;
-	uint8_t count = 0;
-	uint8_t indexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 
 	CHIP_ERROR err = BridgeManager::Instance().RemoveBridgedDevice(endpointId, index);
 
@@ -450,23 +426,6 @@ CHIP_ERROR BleBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return err;
 	}
 
-	err = BridgeManager::Instance().GetDevicesIndexes(indexes, sizeof(indexes), count);
-	if (CHIP_NO_ERROR != err) {
-		LOG_ERR("Failed to get bridged devices indexes");
-		return err;
-	}
-
-	/* Update the current indexes list. */
-	if (!BridgeStorageManager::Instance().StoreBridgedDevicesIndexes(indexes, count)) {
-		LOG_ERR("Failed to store bridged devices indexes.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
-	if (!BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-		LOG_ERR("Failed to store bridged devices count.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
 	if (!BridgeStorageManager::Instance().RemoveBridgedDevice(index)) {
 		LOG_ERR("Failed to remove bridged device from the storage.");
 		return CHIP_ERROR_INTERNAL;
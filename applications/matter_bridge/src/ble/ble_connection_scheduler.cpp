@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_connection_scheduler.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+namespace Nrf
+{
+
+bool BLEConnectionScheduler::Enqueue(BLEBridgedDeviceProvider *provider)
+{
+	if (!provider) {
+		return false;
+	}
+
+	if (Find(provider)) {
+		return true;
+	}
+
+	Entry *entry = Find(nullptr);
+
+	if (!entry) {
+		return false;
+	}
+
+	entry->mProvider = provider;
+	entry->mState = State::Queued;
+	entry->mSequence = mSequence++;
+	mCount++;
+
+	Schedule();
+
+	return true;
+}
+
+void BLEConnectionScheduler::Remove(BLEBridgedDeviceProvider *provider)
+{
+	Entry *entry = Find(provider);
+
+	if (!entry) {
+		return;
+	}
+
+	*entry = Entry{};
+	mCount--;
+
+	if (IsIdle()) {
+		mOperations.mIdle(mContext);
+	}
+
+	Schedule();
+}
+
+void BLEConnectionScheduler::OnConnected(BLEBridgedDeviceProvider *provider, bool success)
+{
+	Entry *entry = Find(provider);
+
+	/* The result of an aborted attempt only means that the stack is ready for the next one. */
+	if (entry && entry->mState == State::Connecting) {
+		if (success) {
+			entry->mState = State::Connected;
+			mStatistics.mConnected++;
+		} else {
+			Finish(*entry, false);
+		}
+	}
+
+	Schedule();
+}
+
+void BLEConnectionScheduler::OnDiscovered(BLEBridgedDeviceProvider *provider, bool success)
+{
+	Entry *entry = Find(provider);
+
+	if (entry && entry->mState == State::Discovering) {
+		if (success) {
+			mStatistics.mDiscovered++;
+		}
+
+		Finish(*entry, success);
+	}
+
+	Schedule();
+}
+
+void BLEConnectionScheduler::OnDisconnected(BLEBridgedDeviceProvider *provider)
+{
+	Entry *entry = Find(provider);
+
+	if (entry && entry->mState != State::Queued) {
+		Finish(*entry, false);
+	}
+
+	Schedule();
+}
+
+void BLEConnectionScheduler::OnTimer()
+{
+	const int64_t now = k_uptime_get();
+
+	for (auto &entry : mEntries) {
+		if ((entry.mState != State::Connecting && entry.mState != State::Discovering) || entry.mDeadline > now) {
+			continue;
+		}
+
+		LOG_WRN("Bluetooth LE device did not respond on time, skipping it");
+
+		mStatistics.mTimedOut++;
+		Finish(entry, false);
+	}
+
+	Schedule();
+}
+
+BLEConnectionScheduler::Entry *BLEConnectionScheduler::Find(BLEBridgedDeviceProvider *provider)
+{
+	for (auto &entry : mEntries) {
+		if (entry.mProvider == provider) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+BLEConnectionScheduler::Entry *BLEConnectionScheduler::FindOldest(State state)
+{
+	Entry *oldest = nullptr;
+
+	for (auto &entry : mEntries) {
+		if (entry.mState == state && (!oldest || entry.mSequence < oldest->mSequence)) {
+			oldest = &entry;
+		}
+	}
+
+	return oldest;
+}
+
+uint8_t BLEConnectionScheduler::CountInState(State state) const
+{
+	uint8_t count = 0;
+
+	for (const auto &entry : mEntries) {
+		if (entry.mState == state) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+void BLEConnectionScheduler::Finish(Entry &entry, bool success)
+{
+	BLEBridgedDeviceProvider *provider = entry.mProvider;
+
+	/* Release the slot before calling the operation, so it can be reused right away. */
+	entry = Entry{};
+	mCount--;
+
+	if (!success) {
+		mStatistics.mFailed++;
+	}
+
+	mOperations.mFinished(provider, success, mContext);
+
+	if (IsIdle()) {
+		mOperations.mIdle(mContext);
+	}
+}
+
+void BLEConnectionScheduler::Schedule()
+{
+	mBusyRetry = false;
+
+	/* Discoveries are started first, as they release the connected devices from the queue. */
+	StartDiscovering();
+	StartConnecting();
+	StartTimer();
+}
+
+void BLEConnectionScheduler::StartConnecting()
+{
+	uint8_t inFlight = CountInState(State::Connecting) + CountInState(State::Connected) +
+			   CountInState(State::Discovering);
+
+	while (inFlight < mLimits.mInFlight && CountInState(State::Connecting) < mLimits.mConnecting) {
+		Entry *entry = FindOldest(State::Queued);
+
+		if (!entry) {
+			break;
+		}
+
+		Result result = mOperations.mConnect(entry->mProvider, mContext);
+
+		if (result == Result::Busy) {
+			mBusyRetry = true;
+			break;
+		}
+
+		if (result == Result::Failed) {
+			Finish(*entry, false);
+			continue;
+		}
+
+		entry->mState = State::Connecting;
+		entry->mDeadline = k_uptime_get() + mLimits.mConnectTimeoutMs;
+		inFlight++;
+	}
+
+	if (inFlight > mStatistics.mMaxInFlight) {
+		mStatistics.mMaxInFlight = inFlight;
+	}
+}
+
+void BLEConnectionScheduler::StartDiscovering()
+{
+	while (CountInState(State::Discovering) < mLimits.mDiscovering) {
+		Entry *entry = FindOldest(State::Connected);
+
+		if (!entry) {
+			break;
+		}
+
+		Result result = mOperations.mDiscover(entry->mProvider, mContext);
+
+		if (result == Result::Busy) {
+			mBusyRetry = true;
+			break;
+		}
+
+		if (result == Result::Failed) {
+			Finish(*entry, false);
+			continue;
+		}
+
+		entry->mState = State::Discovering;
+		entry->mDeadline = k_uptime_get() + mLimits.mDiscoveryTimeoutMs;
+	}
+}
+
+void BLEConnectionScheduler::StartTimer()
+{
+	const int64_t now = k_uptime_get();
+	int64_t deadline = mBusyRetry ? now + mLimits.mBusyRetryMs : INT64_MAX;
+
+	for (const auto &entry : mEntries) {
+		if ((entry.mState == State::Connecting || entry.mState == State::Discovering) &&
+		    entry.mDeadline < deadline) {
+			deadline = entry.mDeadline;
+		}
+	}
+
+	if (deadline != INT64_MAX) {
+		mOperations.mStartTimer(deadline > now ? static_cast<uint32_t>(deadline - now) : 0, mContext);
+	}
+}
+
+} /* namespace Nrf */
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Nrf
+{
+
+/* Forward declarations. */
+class BLEBridgedDeviceProvider;
+
+/*
+   BLEConnectionScheduler drives connection and GATT discovery of several Bluetooth LE bridged devices at a time.
+   Every device added to the bounded queue goes through the Queued -> Connecting -> Connected -> Discovering states
+   and leaves the queue once the discovery is finished or any of the steps fails. The scheduler does not access the
+   Bluetooth stack on its own, it starts the operations using the Operations callbacks and is notified about their
+   results by the On* methods, so the number of operations of each kind that run in parallel is limited by the
+   Limits passed in the constructor. A device that does not complete the current step within the configured timeout
+   is removed from the queue as failed, so an unresponsive peer cannot hold a slot needed by the remaining ones.
+   All methods must be called from the same thread.
+*/
+class BLEConnectionScheduler {
+public:
+	static constexpr uint8_t kMaxEntries = CONFIG_BT_MAX_CONN - 1;
+
+	enum class Result : uint8_t { Started, Busy, Failed };
+
+	struct Operations {
+		/* Start connecting to the device. */
+		Result (*mConnect)(BLEBridgedDeviceProvider *provider, void *context);
+		/* Start GATT discovery of the connected device. */
+		Result (*mDiscover)(BLEBridgedDeviceProvider *provider, void *context);
+		/* The device has left the queue, either fully discovered or after failing one of the steps. On failure, the
+		 * connection of the device shall be released, also if the device did not complete the step on time. */
+		void (*mFinished)(BLEBridgedDeviceProvider *provider, bool success, void *context);
+		/* The last device has left the queue. */
+		void (*mIdle)(void *context);
+		/* Call OnTimer() after the specified time, replacing the previously requested call. */
+		void (*mStartTimer)(uint32_t timeoutMs, void *context);
+	};
+
+	struct Limits {
+		/* Maximum number of devices that are connecting, connected or being discovered at a time. */
+		uint8_t mInFlight;
+		/* Maximum number of connection attempts at a time. */
+		uint8_t mConnecting;
+		/* Maximum number of GATT discoveries at a time. */
+		uint8_t mDiscovering;
+		uint32_t mConnectTimeoutMs;
+		uint32_t mDiscoveryTimeoutMs;
+		/* Time after which an operation rejected with Result::Busy is retried. */
+		uint32_t mBusyRetryMs;
+	};
+
+	struct Statistics {
+		uint32_t mConnected;
+		uint32_t mDiscovered;
+		uint32_t mFailed;
+		uint32_t mTimedOut;
+		uint8_t mMaxInFlight;
+	};
+
+	BLEConnectionScheduler(const Operations &operations, const Limits &limits, void *context)
+		: mOperations(operations), mLimits(limits), mContext(context)
+	{
+	}
+
+	/**
+	 * @brief Add the device to the queue.
+	 *
+	 * @param provider address of a valid provider object
+	 * @return true if the device has been added or it already was in the queue
+	 * @return false if the queue is full
+	 */
+	bool Enqueue(BLEBridgedDeviceProvider *provider);
+
+	/**
+	 * @brief Remove the device from the queue without calling the mFinished operation.
+	 *
+	 * @param provider address of the provider object to be removed
+	 */
+	void Remove(BLEBridgedDeviceProvider *provider);
+
+	/**
+	 * @brief Notify that the connection attempt started by the mConnect operation is finished.
+	 *
+	 * @param provider address of the provider object
+	 * @param success true if the connection has been established
+	 */
+	void OnConnected(BLEBridgedDeviceProvider *provider, bool success);
+
+	/**
+	 * @brief Notify that the GATT discovery started by the mDiscover operation is finished.
+	 *
+	 * @param provider address of the provider object
+	 * @param success true if the discovery has succeeded
+	 */
+	void OnDiscovered(BLEBridgedDeviceProvider *provider, bool success);
+
+	/**
+	 * @brief Notify that the device has been disconnected.
+	 *
+	 * @param provider address of the provider object
+	 */
+	void OnDisconnected(BLEBridgedDeviceProvider *provider);
+
+	/**
+	 * @brief Handle the timer requested by the mStartTimer operation.
+	 */
+	void OnTimer();
+
+	bool IsIdle() const { return mCount == 0; }
+	bool Contains(BLEBridgedDeviceProvider *provider) { return Find(provider) != nullptr; }
+	const Statistics &GetStatistics() const { return mStatistics; }
+	void ResetStatistics() { mStatistics = {}; }
+
+private:
+	enum class State : uint8_t { Free, Queued, Connecting, Connected, Discovering };
+
+	struct Entry {
+		BLEBridgedDeviceProvider *mProvider{ nullptr };
+		State mState{ State::Free };
+		/* Deadline of the current step in the system uptime, valid in the Connecting and Discovering states. */
+		int64_t mDeadline{ 0 };
+		/* Order of adding to the queue, so the devices are handled in the FIFO order. */
+		uint32_t mSequence{ 0 };
+	};
+
+	Entry *Find(BLEBridgedDeviceProvider *provider);
+	Entry *FindOldest(State state);
+	uint8_t CountInState(State state) const;
+	void Finish(Entry &entry, bool success);
+	void Schedule();
+	void StartConnecting();
+	void StartDiscovering();
+	void StartTimer();
+
+	Operations mOperations;
+	Limits mLimits;
+	void *mContext;
+	Entry mEntries[kMaxEntries];
+	uint8_t mCount{ 0 };
+	uint32_t mSequence{ 0 };
+	bool mBusyRetry{ false };
+	Statistics mStatistics{};
+};
+
+} /* namespace Nrf */
@@ -6,6 +6,11 @@
 
 #include "ble_connectivity_manager.h"
 #include "ble_bridged_device.h"
+#include "ble_notification_queue.h"
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+#include "bridge_storage_manager.h"
+#endif
 
 #include <bluetooth/gatt_dm.h>
 #include <bluetooth/scan.h>
@@ -13,6 +18,7 @@
 #include <platform/CHIPDeviceLayer.h>
 
 #include <zephyr/logging/log.h>
+#include <zephyr/random/random.h>
 
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
@@ -48,9 +54,50 @@ static const struct bt_gatt_dm_cb discovery_cb = { .completed = Nrf::BLEConnecti
 
 static struct bt_conn_le_create_param *create_param = BT_CONN_LE_CREATE_CONN;
 
+namespace
+{
+/* The Bluetooth host allows only one pending connection attempt and the GATT Discovery Manager handles only one
+ * discovery at a time, so the scheduler overlaps connecting of the next device with the discovery of the previous one,
+ * while the other connected devices wait for their discovery. */
+constexpr Nrf::BLEConnectionScheduler::Limits kSchedulerLimits = {
+	.mInFlight = Nrf::BLEConnectivityManager::kMaxConnectedDevices,
+	.mConnecting = 1,
+	.mDiscovering = 1,
+	.mConnectTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_CONNECT_TIMEOUT_MS,
+	.mDiscoveryTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_DISCOVERY_TIMEOUT_MS,
+	.mBusyRetryMs = 100,
+};
+
+Nrf::BLEConnectionScheduler::Result ToSchedulerResult(int err)
+{
+	switch (err) {
+	case 0:
+		return Nrf::BLEConnectionScheduler::Result::Started;
+	case -EALREADY:
+	case -EAGAIN:
+	case -EBUSY:
+	case -ENOMEM:
+		/* The stack is still busy with the previous operation or it has not released its connection object yet. */
+		return Nrf::BLEConnectionScheduler::Result::Busy;
+	default:
+		return Nrf::BLEConnectionScheduler::Result::Failed;
+	}
+}
+} /* namespace */
+
 namespace Nrf
 {
 
+BLEConnectivityManager::BLEConnectivityManager()
+	: mScheduler({ .mConnect = SchedulerConnect,
+		       .mDiscover = SchedulerDiscover,
+		       .mFinished = SchedulerFinished,
+		       .mIdle = SchedulerIdle,
+		       .mStartTimer = SchedulerStartTimer },
+		     kSchedulerLimits, this)
+{
+}
+
 void BLEConnectivityManager::FilterMatch(bt_scan_device_info *device_info, bt_scan_filter_match *filter_match,
 					 bool connectable)
 {
@@ -98,28 +145,262 @@ int BLEConnectivityManager::StartGattDiscovery(bt_conn *conn, BLEBridgedDevicePr
 	return err;
 }
 
-void BLEConnectivityManager::UpdateRecovery()
+void BLEConnectivityManager::PostSchedulerEvent(BLEBridgedDeviceProvider *provider, SchedulerEvent event)
 {
-	if (!sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
-		/* There is another provider to re-connect, schedule this operation. */
-		BLEBridgedDeviceProvider *providerToRecover =
-			Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-		DeviceLayer::PlatformMgr().ScheduleWork(
-			[](intptr_t context) {
-				Instance().Reconnect(reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-			},
-			reinterpret_cast<intptr_t>(providerToRecover));
-		/* We have still a device to recover, keep the LostDevice state active */
-		Instance().UpdateStateFlag(State::LostDevice, true);
-	} else if (!sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
+	if (!provider) {
+		return;
+	}
+
+	Platform::UniquePtr<SchedulerEventCtx> eventCtx(Platform::New<SchedulerEventCtx>());
+	if (!eventCtx) {
+		/* The scheduler will skip the device once its current step times out. */
+		LOG_ERR("Cannot allocate the connection scheduler event");
+		return;
+	}
+
+	eventCtx->mProvider = provider;
+	eventCtx->mEvent = event;
+
+	CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t context) {
+			Platform::UniquePtr<SchedulerEventCtx> ctx(reinterpret_cast<SchedulerEventCtx *>(context));
+			BLEConnectionScheduler &scheduler = Instance().mScheduler;
+
+			switch (ctx->mEvent) {
+			case SchedulerEvent::Connected:
+			case SchedulerEvent::ConnectionFailed:
+				scheduler.OnConnected(ctx->mProvider, ctx->mEvent == SchedulerEvent::Connected);
+				break;
+			case SchedulerEvent::Discovered:
+			case SchedulerEvent::DiscoveryFailed:
+				scheduler.OnDiscovered(ctx->mProvider, ctx->mEvent == SchedulerEvent::Discovered);
+				break;
+			case SchedulerEvent::Disconnected:
+				scheduler.OnDisconnected(ctx->mProvider);
+				break;
+			}
+		},
+		reinterpret_cast<intptr_t>(eventCtx.get()));
+
+	if (CHIP_NO_ERROR == err) {
+		eventCtx.release();
+	}
+}
+
+BLEConnectionScheduler::Result BLEConnectivityManager::SchedulerConnect(BLEBridgedDeviceProvider *provider,
+									 void *context)
+{
+	return ToSchedulerResult(reinterpret_cast<BLEConnectivityManager *>(context)->CreateConnection(provider));
+}
+
+BLEConnectionScheduler::Result BLEConnectivityManager::SchedulerDiscover(BLEBridgedDeviceProvider *provider,
+									  void *context)
+{
+	if (!provider->GetConnectionObject()) {
+		return BLEConnectionScheduler::Result::Failed;
+	}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* The full discovery is started only if the cached handles are outdated. */
+	return ToSchedulerResult(reinterpret_cast<BLEConnectivityManager *>(context)->ReadDatabaseHash(provider));
+#else
+	return ToSchedulerResult(StartGattDiscovery(provider->GetConnectionObject(), provider));
+#endif
+}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+static_assert(BLEConnectivityManager::kDatabaseHashSize == BridgeStorageManager::kGattDatabaseHashSize);
+
+int BLEConnectivityManager::ReadDatabaseHash(BLEBridgedDeviceProvider *provider, bool afterDiscovery)
+{
+	if (mDatabaseHashReadProvider) {
+		return -EBUSY;
+	}
+
+	mDatabaseHashReadParams = {};
+	mDatabaseHashReadParams.func = DatabaseHashReadCallback;
+	mDatabaseHashReadParams.handle_count = 0;
+	mDatabaseHashReadParams.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	mDatabaseHashReadParams.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+	mDatabaseHashReadParams.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	mDatabaseHashReadProvider = provider;
+	mDatabaseHashReadAfterDiscovery = afterDiscovery;
+
+	int err = bt_gatt_read(provider->GetConnectionObject(), &mDatabaseHashReadParams);
+	if (err) {
+		LOG_ERR("Could not read the GATT Database Hash, error code: %d", err);
+		mDatabaseHashReadProvider = nullptr;
+	}
+
+	return err;
+}
+
+uint8_t BLEConnectivityManager::DatabaseHashReadCallback(bt_conn *conn, uint8_t att_err, bt_gatt_read_params *params,
+							 const void *data, uint16_t length)
+{
+	Platform::UniquePtr<DatabaseHashCtx> hashCtx(Platform::New<DatabaseHashCtx>());
+
+	if (hashCtx) {
+		hashCtx->mProvider = Instance().mDatabaseHashReadProvider;
+		hashCtx->mAfterDiscovery = Instance().mDatabaseHashReadAfterDiscovery;
+		/* Peers that do not support GATT Caching do not expose the hash, so they are always fully discovered. */
+		hashCtx->mValid = !att_err && data && length == sizeof(hashCtx->mHash);
+		if (hashCtx->mValid) {
+			memcpy(hashCtx->mHash, data, sizeof(hashCtx->mHash));
+		}
+	}
+
+	/* The read is finished, so the parameters can be reused. */
+	Instance().mDatabaseHashReadProvider = nullptr;
+
+	if (!hashCtx) {
+		/* The scheduler will skip the device once its discovery times out. */
+		LOG_ERR("Cannot allocate the GATT Database Hash context");
+		return BT_GATT_ITER_STOP;
+	}
+
+	CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(
+		[](intptr_t context) {
+			Platform::UniquePtr<DatabaseHashCtx> ctx(reinterpret_cast<DatabaseHashCtx *>(context));
+			Instance().HandleDatabaseHash(*ctx);
+		},
+		reinterpret_cast<intptr_t>(hashCtx.get()));
+
+	if (CHIP_NO_ERROR == err) {
+		hashCtx.release();
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+void BLEConnectivityManager::HandleDatabaseHash(const DatabaseHashCtx &ctx)
+{
+	BLEBridgedDeviceProvider *provider = ctx.mProvider;
+
+	/* The device might have been removed or disconnected in the meantime. */
+	if (ctx.mAfterDiscovery ? !IsConnectedProvider(provider) : !mScheduler.Contains(provider)) {
+		return;
+	}
+
+	if (!provider->GetConnectionObject()) {
+		return;
+	}
+
+	BLEBridgedDevice &device = provider->GetBLEBridgedDevice();
+	BridgeStorageManager::GattCacheEntry entry;
+
+	device.mDatabaseHashValid = ctx.mValid;
+	memcpy(device.mDatabaseHash, ctx.mHash, sizeof(device.mDatabaseHash));
+
+	if (ctx.mAfterDiscovery) {
+		/* The device has just been discovered, so only its handles need to be cached. */
+		StoreGattCache(provider);
+		return;
+	}
+
+	if (ctx.mValid && BridgeStorageManager::Instance().LoadGattCache(device.mAddr, entry) &&
+	    memcmp(entry.mDatabaseHash, ctx.mHash, sizeof(ctx.mHash)) == 0 &&
+	    provider->RestoreAttributeHandles(entry.mHandles, entry.mHandlesCount) == 0) {
+		LOG_INF("The GATT database did not change, using the cached handles");
+
+		if (CHIP_NO_ERROR != provider->NotifyReachableStatusChange(true)) {
+			LOG_WRN("The device has not been notified about the status change.");
+		}
+
+		mScheduler.OnDiscovered(provider, true);
+		return;
+	}
+
+	if (StartGattDiscovery(provider->GetConnectionObject(), provider) != 0) {
+		mScheduler.OnDiscovered(provider, false);
+	}
+}
+
+void BLEConnectivityManager::StoreGattCache(BLEBridgedDeviceProvider *provider)
+{
+	BLEBridgedDevice &device = provider->GetBLEBridgedDevice();
+	BridgeStorageManager::GattCacheEntry entry = {};
+
+	if (!device.mDatabaseHashValid) {
+		return;
+	}
+
+	device.mDatabaseHashValid = false;
+
+	const int count = provider->GetAttributeHandles(entry.mHandles, BridgeStorageManager::kGattCacheMaxHandles);
+	if (count < 0) {
+		if (count != -ENOTSUP) {
+			LOG_ERR("Cannot get the GATT attribute handles (%d)", count);
+		}
+		return;
+	}
+
+	entry.mAddr = device.mAddr;
+	entry.mHandlesCount = static_cast<uint8_t>(count);
+	memcpy(entry.mDatabaseHash, device.mDatabaseHash, sizeof(entry.mDatabaseHash));
+
+	if (!BridgeStorageManager::Instance().StoreGattCache(entry)) {
+		LOG_ERR("Cannot store the GATT attribute handles");
+	}
+}
+
+bool BLEConnectivityManager::IsConnectedProvider(const BLEBridgedDeviceProvider *provider)
+{
+	for (auto i = 0; i < kMaxConnectedDevices; i++) {
+		if (mConnectedProviders[i] == provider) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
+void BLEConnectivityManager::SchedulerFinished(BLEBridgedDeviceProvider *provider, bool success, void *context)
+{
+	auto *manager = reinterpret_cast<BLEConnectivityManager *>(context);
+
+	if (success) {
+		/* The device was successfully recovered. */
+		manager->mRecovery.RemoveRecovered(provider);
+		provider->NotifySuccessfulRecovery();
+		return;
+	}
+
+	provider->NotifyFailedRecovery();
+	manager->mRecovery.ScheduleNextAttempt(provider);
+
+	/* Release the connection, so the device is found by the next recovery scan. If the connection attempt is still
+	 * pending, it is cancelled and the connection object is released in the connection callback. */
+	if (provider->GetConnectionObject()) {
+		bt_conn_disconnect(provider->GetConnectionObject(), BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	}
+}
+
+void BLEConnectivityManager::SchedulerIdle(void *context)
+{
+	auto *manager = reinterpret_cast<BLEConnectivityManager *>(context);
+
+	if (manager->mRecovery.IsNeeded()) {
 		/* There are pending providers to recover and no more scanned ones, schedule next scan operation. */
-		Instance().mRecovery.StartTimer();
+		manager->mRecovery.StartTimer();
 	} else {
 		/* All devices have been recovered, disable LostDevice state */
-		Instance().UpdateStateFlag(State::LostDevice, false);
+		manager->UpdateStateFlag(State::LostDevice, false);
 	}
 }
 
+void BLEConnectivityManager::SchedulerStartTimer(uint32_t timeoutMs, void *context)
+{
+	k_timer_start(&reinterpret_cast<BLEConnectivityManager *>(context)->mSchedulerTimer, K_MSEC(timeoutMs),
+		      K_NO_WAIT);
+}
+
+void BLEConnectivityManager::SchedulerTimerCallback(k_timer *timer)
+{
+	DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t context) { Instance().mScheduler.OnTimer(); }, 0);
+}
+
 void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 {
 	const bt_addr_le_t *dstAddr = bt_conn_get_dst(conn);
@@ -149,6 +430,17 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 	bool firstConnFailed = (conn_err && !provider->IsInitiallyConnected());
 	VerifyOrExit(!firstConnFailed, err = conn_err);
 
+	if (conn_err) {
+		/* The recovery connection attempt failed or it has been cancelled by the connection scheduler. */
+		LOG_ERR("The connection failed (%d)", conn_err);
+		if (provider->GetConnectionObject() == conn) {
+			bt_conn_unref(conn);
+			provider->SetConnectionObject(nullptr);
+		}
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::ConnectionFailed);
+		return;
+	}
+
 	char addrStr[BT_ADDR_LE_STR_LEN];
 	bt_addr_le_to_str(dstAddr, addrStr, sizeof(addrStr));
 	LOG_INF("Connected: %s", addrStr);
@@ -162,12 +454,17 @@ void BLEConnectivityManager::ConnectionHandler(bt_conn *conn, uint8_t conn_err)
 	/* Start GATT discovery only if this specific device was successfully connected before. Otherwise, it will be
 	 * called after a successful pairing. */
 	if (provider->IsInitiallyConnected()) {
+		/* The discovery of the recovered device is started by the connection scheduler. */
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::Connected);
+	}
+#else
+	if (provider->IsInitiallyConnected()) {
+		/* The discovery of the recovered device is started by the connection scheduler. */
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::Connected);
+	} else {
 		err = StartGattDiscovery(conn, provider);
 		VerifyOrExit(err == 0, );
 	}
-#else
-	err = StartGattDiscovery(conn, provider);
-	VerifyOrExit(err == 0, );
 #endif
 
 	return;
@@ -187,9 +484,9 @@ exit:
 		/* Trigger the connection callback to inform the application that the connection procedure failed. */
 		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
+	} else {
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::ConnectionFailed);
 	}
-
-	Instance().UpdateRecovery();
 }
 
 void BLEConnectivityManager::DisconnectionHandler(bt_conn *conn, uint8_t reason)
@@ -202,8 +499,12 @@ void BLEConnectivityManager::DisconnectionHandler(bt_conn *conn, uint8_t reason)
 	BLEBridgedDeviceProvider *provider = Instance().FindBLEProvider(*bt_conn_get_dst(conn));
 
 	if (provider) {
-		bt_conn_unref(provider->GetBLEBridgedDevice().mConn);
+		/* The connection object may have already been released, for example when the provider was removed. */
+		if (provider->GetBLEBridgedDevice().mConn) {
+			bt_conn_unref(provider->GetBLEBridgedDevice().mConn);
+		}
 		provider->SetConnectionObject(nullptr);
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::Disconnected);
 
 		/* Verify whether the device should be recovered. */
 		if (reason == BT_HCI_ERR_CONN_TIMEOUT) {
@@ -356,12 +657,6 @@ void BLEConnectivityManager::DiscoveryCompletedHandler(bt_gatt_dm *dm, void *con
 
 	discoveryResult = true;
 
-	/* The device was successfully recovered. */
-	if (provider->IsInitiallyConnected()) {
-		Instance().mRecovery.RemoveRecovered(provider);
-		provider->NotifySuccessfulRecovery();
-	}
-
 exit:
 
 	Platform::UniquePtr<DiscoveryHandlerCtx> discoveryCtx(Platform::New<DiscoveryHandlerCtx>());
@@ -375,7 +670,9 @@ exit:
 	CHIP_ERROR err = chip::DeviceLayer::PlatformMgr().ScheduleWork(
 		[](intptr_t context) {
 			Platform::UniquePtr<DiscoveryHandlerCtx> ctx(reinterpret_cast<DiscoveryHandlerCtx *>(context));
-			if (!ctx->mProvider->IsInitiallyConnected()) {
+			const bool initialDiscovery = !ctx->mProvider->IsInitiallyConnected();
+
+			if (initialDiscovery) {
 				/* Provider is not initalized, so we need to call the first connection callback. */
 				CHIP_ERROR err = ctx->mProvider->GetBLEBridgedDevice().mFirstConnectionCallback(
 					ctx->mDiscoveryData,
@@ -392,6 +689,16 @@ exit:
 			if (0 != ctx->mProvider->ParseDiscoveredData(ctx->mDiscoveryData)) {
 				LOG_ERR("Cannot parse the GATT discovered data.");
 			}
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+			else if (initialDiscovery) {
+				/* The hash is read before the discovery of the recovered devices only. Read it
+				 * now, so that the handles of the newly added device are cached too. If the read
+				 * is busy, the handles are cached after the first recovery of the device. */
+				Instance().ReadDatabaseHash(ctx->mProvider, true);
+			} else {
+				StoreGattCache(ctx->mProvider);
+			}
+#endif
 			bt_gatt_dm_data_release(ctx->mDiscoveryData);
 		},
 		reinterpret_cast<intptr_t>(discoveryCtx.get()));
@@ -402,7 +709,9 @@ exit:
 		bt_gatt_dm_data_release(dm);
 	}
 
-	Instance().UpdateRecovery();
+	/* Posted after the discovered data handling, so the next discovery starts once the data has been released. */
+	Instance().PostSchedulerEvent(provider,
+				      discoveryResult ? SchedulerEvent::Discovered : SchedulerEvent::DiscoveryFailed);
 }
 
 void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
@@ -415,11 +724,9 @@ void BLEConnectivityManager::DiscoveryNotFound(bt_conn *conn, void *context)
 			provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 				false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
 		} else {
-			Instance().mRecovery.NotifyProviderToRecover(provider);
+			Instance().PostSchedulerEvent(provider, SchedulerEvent::DiscoveryFailed);
 		}
 	}
-
-	Instance().UpdateRecovery();
 }
 
 void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *context)
@@ -431,9 +738,9 @@ void BLEConnectivityManager::DiscoveryError(bt_conn *conn, int err, void *contex
 	if (!provider->IsInitiallyConnected()) {
 		provider->GetBLEBridgedDevice().mFirstConnectionCallback(
 			false, provider->GetBLEBridgedDevice().mFirstConnectionCallbackContext);
+	} else {
+		Instance().PostSchedulerEvent(provider, SchedulerEvent::DiscoveryFailed);
 	}
-
-	Instance().UpdateRecovery();
 }
 
 CHIP_ERROR BLEConnectivityManager::Init(const bt_uuid **serviceUuids, uint8_t serviceUuidsCount)
@@ -450,6 +757,8 @@ CHIP_ERROR BLEConnectivityManager::Init(const bt_uuid **serviceUuids, uint8_t se
 
 	k_timer_init(&mScanTimer, BLEConnectivityManager::ScanTimeoutCallback, nullptr);
 	k_timer_user_data_set(&mScanTimer, this);
+	k_timer_init(&mSchedulerTimer, BLEConnectivityManager::SchedulerTimerCallback, nullptr);
+	mRecovery.Init();
 
 #ifdef CONFIG_BT_SMP
 	int err = bt_conn_auth_cb_register(&auth_callbacks);
@@ -597,13 +906,13 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 {
 	DeviceLayer::PlatformMgr().ScheduleWork(
 		[](intptr_t context) {
-			BLEBridgedDeviceProvider *provider;
 			ScanResult result = *reinterpret_cast<ScanResult *>(context);
 			sys_snode_t *node;
 			sys_snode_t *tmpNodeSafe;
 			Recovery::ListItem *item;
 			bool providerFound = false;
 			bt_addr_le_t providerAddress;
+			const int64_t now = k_uptime_get();
 
 			/* Filter out devices to recover from a scan result and put them to the queue to reconnect. */
 			SYS_SLIST_FOR_EACH_NODE_SAFE (&Instance().mRecovery.mListToRecover, node, tmpNodeSafe) {
@@ -619,28 +928,28 @@ void BLEConnectivityManager::ReScanCallback(ScanResult &result, void *context)
 					providerAddress = item->mProvider->GetBtAddress();
 					if (memcmp(&providerAddress, &result.mDevices[i].mAddr,
 						   sizeof(result.mDevices[i].mAddr)) == 0) {
-						providerFound = true;
-						Instance().mRecovery.PutProvider(
-							item->mProvider, &Instance().mRecovery.mListToReconnect);
+						providerFound = Instance().mScheduler.Enqueue(item->mProvider);
 					}
 				}
 
-				/* Increase failed attempts counter of all devices to recover that were not detected. */
-				if (!providerFound) {
+				if (providerFound) {
+					Instance().mRecovery.mStatistics.mDevicesFound++;
+					continue;
+				}
+
+				/* Back off only the devices that the scan was looking for, the remaining ones were not
+				 * due yet. */
+				if (item->mNextAttemptMs <= now) {
+					Instance().mRecovery.mStatistics.mDevicesMissed++;
 					item->mProvider->NotifyFailedRecovery();
+					item->mNextAttemptMs = now + Instance().mRecovery.GetBackoffMs(*item, now);
 				}
 			}
 
-			if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect)) {
+			/* If any device has been queued, the next scan is scheduled once the connection scheduler handles
+			 * all of them. */
+			if (Instance().mScheduler.IsIdle()) {
 				Instance().mRecovery.StartTimer();
-			} else {
-				provider = Instance().mRecovery.GetProvider(&Instance().mRecovery.mListToReconnect);
-				DeviceLayer::PlatformMgr().ScheduleWork(
-					[](intptr_t context) {
-						Instance().Reconnect(
-							reinterpret_cast<BLEBridgedDeviceProvider *>(context));
-					},
-					reinterpret_cast<intptr_t>(provider));
 			}
 		},
 		reinterpret_cast<intptr_t>(&result));
@@ -695,6 +1004,11 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 		return CHIP_ERROR_INVALID_ARGUMENT;
 	}
 
+	return System::MapErrorZephyr(CreateConnection(provider));
+}
+
+int BLEConnectivityManager::CreateConnection(BLEBridgedDeviceProvider *provider)
+{
 	StopScan();
 
 	bt_conn *conn{};
@@ -703,7 +1017,7 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 
 	if (!connParams) {
 		LOG_ERR("Failed to get conn params");
-		return CHIP_ERROR_INTERNAL;
+		return -ENOENT;
 	}
 
 #ifdef CONFIG_BRIDGE_FORCE_BT_CONNECTION_PARAMS
@@ -719,12 +1033,12 @@ CHIP_ERROR BLEConnectivityManager::Reconnect(BLEBridgedDeviceProvider *provider)
 
 	if (err) {
 		LOG_ERR("Creating reconnection failed (err %d) to %s", err, addrStr);
-		return System::MapErrorZephyr(err);
-	} else {
-		provider->SetConnectionObject(conn);
+		return err;
 	}
 
-	return CHIP_NO_ERROR;
+	provider->SetConnectionObject(conn);
+
+	return 0;
 }
 
 CHIP_ERROR BLEConnectivityManager::Connect(BLEBridgedDeviceProvider *provider, ConnectionSecurityRequest *request)
@@ -823,6 +1137,16 @@ CHIP_ERROR BLEConnectivityManager::RemoveBLEProvider(bt_addr_le_t address)
 		return CHIP_ERROR_NOT_FOUND;
 	}
 
+	mScheduler.Remove(provider);
+	mRecovery.RemoveRecovered(provider);
+	BLENotificationQueue::Instance().RemoveProvider(provider);
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	if (!BridgeStorageManager::Instance().RemoveGattCache(address)) {
+		LOG_ERR("Cannot remove the GATT attribute handles");
+	}
+#endif
+
 	if (!provider->GetBLEBridgedDevice().mConn) {
 		return CHIP_ERROR_INTERNAL;
 	}
@@ -893,13 +1217,24 @@ bt_le_conn_param *BLEConnectivityManager::GetScannedDeviceConnParams(bt_addr_le_
 }
 
 BLEConnectivityManager::Recovery::Recovery()
+	: mPolicy({ .mIntervalMs = kRecoveryIntervalMs,
+		    .mMaxIntervalMs = kRecoveryMaxIntervalMs,
+		    .mRecentlyLostMs = kRecentlyLostMs,
+		    .mDutyCycleWindowMs = kDutyCycleWindowMs,
+		    .mDutyCycleBudgetMs = kDutyCycleBudgetMs })
 {
 	sys_slist_init(&mListToRecover);
-	sys_slist_init(&mListToReconnect);
 	k_timer_init(&mRecoveryTimer, TimerTimeoutCallback, nullptr);
 	k_timer_user_data_set(&mRecoveryTimer, this);
 }
 
+void BLEConnectivityManager::Recovery::Init()
+{
+	/* The statistics and the first duty cycle window start when the manager is initialized, not at the boot. */
+	ResetStatistics();
+	mPolicy.Init(k_uptime_get());
+}
+
 void BLEConnectivityManager::Recovery::NotifyProviderToRecover(BLEBridgedDeviceProvider *provider)
 {
 	if (provider) {
@@ -911,33 +1246,43 @@ void BLEConnectivityManager::Recovery::NotifyProviderToRecover(BLEBridgedDeviceP
 void BLEConnectivityManager::Recovery::TimerTimeoutCallback(k_timer *timer)
 {
 	if (!Instance().mScanActive) {
-		/* Schedule scan only if there is any device to be recovered and there is no device to be
-		 * re-connected.*/
-		if (sys_slist_is_empty(&Instance().mRecovery.mListToReconnect) &&
-		    !sys_slist_is_empty(&Instance().mRecovery.mListToRecover)) {
-			DeviceLayer::PlatformMgr().ScheduleWork(
-				[](intptr_t context) {
-					Instance().Scan(ReScanCallback, nullptr, kRecoveryScanTimeoutMs);
-				},
-				0);
-		}
-	}
-}
+		DeviceLayer::PlatformMgr().ScheduleWork(
+			[](intptr_t context) {
+				Recovery &recovery = Instance().mRecovery;
+				const int64_t now = k_uptime_get();
+				uint32_t waitMs = 0;
 
-BLEBridgedDeviceProvider *BLEConnectivityManager::Recovery::GetProvider(sys_slist_t *list)
-{
-	ListItem *item = reinterpret_cast<ListItem *>(sys_slist_get(list));
-	BLEBridgedDeviceProvider *provider = nullptr;
+				/* Schedule scan only if there is any device to be recovered and the connection
+				 * scheduler is not busy with the devices found by the previous scan. */
+				if (!Instance().mScheduler.IsIdle() || !recovery.IsNeeded()) {
+					return;
+				}
 
-	if (item) {
-		provider = item->mProvider;
-		Platform::Delete(item);
-	}
+				if (!recovery.IsAttemptDue(now)) {
+					recovery.StartTimer();
+					return;
+				}
 
-	return provider;
+				if (!recovery.mPolicy.ConsumeScanBudget(now, kRecoveryScanTimeoutMs, waitMs)) {
+					recovery.mStatistics.mDeferredScans++;
+					recovery.StartTimer(waitMs);
+					return;
+				}
+
+				if (Instance().Scan(ReScanCallback, nullptr, kRecoveryScanTimeoutMs) != CHIP_NO_ERROR) {
+					recovery.StartTimer(kRecoveryIntervalMs);
+					return;
+				}
+
+				recovery.mStatistics.mScans++;
+				recovery.mStatistics.mScanTimeMs += kRecoveryScanTimeoutMs;
+			},
+			0);
+	}
 }
 
-bool BLEConnectivityManager::Recovery::EntryExists(BLEBridgedDeviceProvider *provider, sys_slist_t *list)
+BLEConnectivityManager::Recovery::ListItem *
+BLEConnectivityManager::Recovery::FindEntry(BLEBridgedDeviceProvider *provider, sys_slist_t *list)
 {
 	sys_snode_t *node;
 	sys_snode_t *tmpNodeSafe;
@@ -947,22 +1292,22 @@ bool BLEConnectivityManager::Recovery::EntryExists(BLEBridgedDeviceProvider *pro
 			ListItem *item = reinterpret_cast<ListItem *>(node);
 
 			if (!item) {
-				return false;
+				return nullptr;
 			}
 
 			bt_addr_le_t addr = provider->GetBtAddress();
 			bt_addr_le_t storedAddr = item->mProvider->GetBtAddress();
 			if (bt_addr_le_cmp(&addr, &storedAddr) == 0) {
-				return true;
+				return item;
 			}
 		}
 	}
-	return false;
+	return nullptr;
 }
 
 bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list)
 {
-	if (EntryExists(provider, list)) {
+	if (FindEntry(provider, list)) {
 		return true;
 	}
 
@@ -976,46 +1321,65 @@ bool BLEConnectivityManager::Recovery::PutProvider(BLEBridgedDeviceProvider *pro
 		return false;
 	}
 
+	const int64_t now = k_uptime_get();
+
 	item->mProvider = provider;
+	item->mLostTimeMs = now;
+	item->mNextAttemptMs = now + GetBackoffMs(*item, now);
 	sys_slist_append(list, item);
 
 	return true;
 }
 
-uint16_t BLEConnectivityManager::Recovery::GetFailedRecoveryAttempts()
+uint32_t BLEConnectivityManager::Recovery::GetBackoffMs(const ListItem &item, int64_t now)
+{
+	return mPolicy.GetBackoffMs(item.mProvider->GetFailedRecoveryAttempts(), item.mLostTimeMs, now,
+				    sys_rand32_get());
+}
+
+bool BLEConnectivityManager::Recovery::IsAttemptDue(int64_t now)
 {
 	sys_snode_t *node;
 	sys_snode_t *tmpNodeSafe;
-	ListItem *item;
-	uint16_t attempts = UINT16_MAX;
-
-	/* Find the smallest number or failed recovery attempts from all providers. */
-	SYS_SLIST_FOR_EACH_NODE_SAFE (&Instance().mRecovery.mListToRecover, node, tmpNodeSafe) {
-		item = reinterpret_cast<ListItem *>(node);
 
-		if (!item) {
-			return 0;
+	SYS_SLIST_FOR_EACH_NODE_SAFE (&mListToRecover, node, tmpNodeSafe) {
+		if (reinterpret_cast<ListItem *>(node)->mNextAttemptMs <= now) {
+			return true;
 		}
+	}
 
-		uint16_t newAttempts = item->mProvider->GetFailedRecoveryAttempts();
+	return false;
+}
 
-		attempts = newAttempts < attempts ? newAttempts : attempts;
-	}
+void BLEConnectivityManager::Recovery::ScheduleNextAttempt(BLEBridgedDeviceProvider *provider)
+{
+	ListItem *item = FindEntry(provider, &mListToRecover);
 
-	return attempts;
+	if (item) {
+		const int64_t now = k_uptime_get();
+
+		item->mNextAttemptMs = now + GetBackoffMs(*item, now);
+	}
 }
 
 void BLEConnectivityManager::Recovery::StartTimer()
 {
-	uint16_t attempts = GetFailedRecoveryAttempts();
-	/* Calculate next recovery time as a quadratic function of failed attempts number.
-	 * This allows to scan the less frequently, the longer no devices are detected.
-	 */
-	uint32_t time = ((attempts * attempts) + 1) * kRecoveryIntervalSec;
+	sys_snode_t *node;
+	sys_snode_t *tmpNodeSafe;
+	int64_t nextAttemptMs = INT64_MAX;
+
+	/* Wake up when the first of the devices to recover is due. */
+	SYS_SLIST_FOR_EACH_NODE_SAFE (&mListToRecover, node, tmpNodeSafe) {
+		nextAttemptMs = MIN(nextAttemptMs, reinterpret_cast<ListItem *>(node)->mNextAttemptMs);
+	}
+
+	if (nextAttemptMs == INT64_MAX) {
+		return;
+	}
 
-	time = time < kRecoveryMaxIntervalSec ? time : kRecoveryMaxIntervalSec;
+	const int64_t now = k_uptime_get();
 
-	k_timer_start(&mRecoveryTimer, K_SECONDS(time), K_NO_WAIT);
+	StartTimer(nextAttemptMs > now ? static_cast<uint32_t>(nextAttemptMs - now) : 0);
 }
 
 BLEConnectivityManager::State BLEConnectivityManager::GetCurrentState()
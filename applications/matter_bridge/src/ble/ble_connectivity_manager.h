@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "ble_connection_scheduler.h"
+#include "ble_recovery_policy.h"
 #include "bridged_device_data_provider.h"
 
 #include <bluetooth/gatt_dm.h>
@@ -66,40 +68,71 @@ public:
 		uint8_t mCount = 0;
 	};
 
+	struct RecoveryStatistics {
+		/* Number of recovery scans and the radio time spent on them. */
+		uint32_t mScans;
+		uint64_t mScanTimeMs;
+		/* Number of recovery scans postponed because the scan duty cycle budget was used up. */
+		uint32_t mDeferredScans;
+		/* Number of lost devices found and not found by the recovery scans. */
+		uint32_t mDevicesFound;
+		uint32_t mDevicesMissed;
+		/* Uptime at which the statistics were reset. */
+		int64_t mStartTimeMs;
+	};
+
 private:
 	class Recovery {
 		friend class BLEConnectivityManager;
 
-		/* Recovery intervals in seconds. */
-		constexpr static auto kRecoveryIntervalSec = 1;
-		constexpr static auto kRecoveryMaxIntervalSec = CONFIG_BRIDGE_BT_RECOVERY_MAX_INTERVAL;
+		/* Recovery intervals in milliseconds. */
+		constexpr static uint32_t kRecoveryIntervalMs = 1000;
+		constexpr static uint32_t kRecoveryMaxIntervalMs = CONFIG_BRIDGE_BT_RECOVERY_MAX_INTERVAL * 1000;
+		/* Devices lost for a shorter time are looked for with the base interval, as they are likely to be back. */
+		constexpr static int64_t kRecentlyLostMs = CONFIG_BRIDGE_BT_RECOVERY_RECENTLY_LOST_WINDOW * 1000;
+
+		/* At most the given percent of every duty cycle window is spent on the recovery scans. */
+		constexpr static uint32_t kDutyCycleWindowMs = 60000;
+		constexpr static uint32_t kDutyCycleBudgetMs =
+			kDutyCycleWindowMs * CONFIG_BRIDGE_BT_RECOVERY_SCAN_DUTY_CYCLE / 100;
 
 		constexpr static auto kRecoveryScanTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_SCAN_TIMEOUT_MS;
+		constexpr static auto kRecoveryConnectTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_CONNECT_TIMEOUT_MS;
+		constexpr static auto kRecoveryDiscoveryTimeoutMs = CONFIG_BRIDGE_BT_RECOVERY_DISCOVERY_TIMEOUT_MS;
 
 		struct ListItem : public sys_snode_t {
 			BLEBridgedDeviceProvider *mProvider = nullptr;
+			/* Uptime at which the connection to the device was lost. */
+			int64_t mLostTimeMs = 0;
+			/* Uptime after which the device shall be looked for by the next recovery scan. */
+			int64_t mNextAttemptMs = 0;
 		};
 
 	public:
 		Recovery();
 		~Recovery() { CancelTimer(); }
+		void Init();
 		void NotifyProviderToRecover(BLEBridgedDeviceProvider *provider);
 
 	private:
-		static bool EntryExists(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
-		static BLEBridgedDeviceProvider *GetProvider(sys_slist_t *list);
-		static bool PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
+		static ListItem *FindEntry(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
+		bool PutProvider(BLEBridgedDeviceProvider *provider, sys_slist_t *list);
+		uint32_t GetBackoffMs(const ListItem &item, int64_t now);
 		bool IsNeeded() { return !sys_slist_is_empty(&mListToRecover); }
+		bool IsAttemptDue(int64_t now);
 		void StartTimer();
+		void StartTimer(uint32_t timeoutMs) { k_timer_start(&mRecoveryTimer, K_MSEC(timeoutMs), K_NO_WAIT); }
 		void CancelTimer() { k_timer_stop(&mRecoveryTimer); }
 		void RemoveRecovered(BLEBridgedDeviceProvider *provider);
-		uint16_t GetFailedRecoveryAttempts();
+		void ScheduleNextAttempt(BLEBridgedDeviceProvider *provider);
+		void ResetStatistics() { mStatistics = { .mStartTimeMs = k_uptime_get() }; }
 
 		static void TimerTimeoutCallback(k_timer *timer);
 
 		sys_slist_t mListToRecover;
-		sys_slist_t mListToReconnect;
 		k_timer mRecoveryTimer;
+		BLERecoveryPolicy mPolicy;
+		RecoveryStatistics mStatistics{};
 	};
 
 	struct DiscoveryHandlerCtx {
@@ -107,7 +140,27 @@ private:
 		bt_gatt_dm *mDiscoveryData;
 	};
 
+	enum class SchedulerEvent : uint8_t { Connected, ConnectionFailed, Discovered, DiscoveryFailed, Disconnected };
+
+	struct SchedulerEventCtx {
+		BLEBridgedDeviceProvider *mProvider;
+		SchedulerEvent mEvent;
+	};
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	static constexpr size_t kDatabaseHashSize = 16;
+
+	struct DatabaseHashCtx {
+		BLEBridgedDeviceProvider *mProvider;
+		uint8_t mHash[kDatabaseHashSize];
+		bool mValid;
+		bool mAfterDiscovery;
+	};
+#endif
+
 public:
+	BLEConnectivityManager();
+
 	using DeviceConnectedCallback = CHIP_ERROR (*)(bool success, void *context);
 	using ScanDoneCallback = void (*)(ScanResult &result, void *context);
 	using ConnectionSecurityRequestCallback = void (*)(void *context);
@@ -160,7 +213,7 @@ public:
 	CHIP_ERROR Connect(BLEBridgedDeviceProvider *provider, ConnectionSecurityRequest *request = nullptr);
 
 	/**
-	 * @brief Create connection to the first Bluetooth LE device on the mProvidersToRecover recovery list.
+	 * @brief Create connection to the Bluetooth LE device that is being recovered.
 	 *
 	 * @return CHIP_NO_ERROR on success
 	 * @return other error code on failure
@@ -232,6 +285,29 @@ public:
 	 */
 	void RegisterStateCallback(StateChangedCallback callback) { mStateChangedCb = callback; }
 
+	/**
+	 * @brief Get the statistics of the lost devices recovery.
+	 *
+	 * Must be called from the Matter thread or with the Matter stack locked.
+	 */
+	const RecoveryStatistics &GetRecoveryStatistics() const { return mRecovery.mStatistics; }
+
+	/**
+	 * @brief Get the statistics of the connection scheduler used to reconnect the lost devices.
+	 *
+	 * Must be called from the Matter thread or with the Matter stack locked.
+	 */
+	const BLEConnectionScheduler::Statistics &GetSchedulerStatistics() const { return mScheduler.GetStatistics(); }
+
+	/**
+	 * @brief Clear the recovery and connection scheduler statistics.
+	 */
+	void ResetRecoveryStatistics()
+	{
+		mRecovery.ResetStatistics();
+		mScheduler.ResetStatistics();
+	}
+
 	CHIP_ERROR PrepareFilterForUuid();
 	CHIP_ERROR PrepareFilterForAddress(bt_addr_le_t *addr);
 
@@ -276,7 +352,25 @@ private:
 	bt_le_conn_param *GetScannedDeviceConnParams(bt_addr_le_t address);
 	State GetCurrentState();
 	void UpdateStateFlag(State state, bool enabled);
-	void UpdateRecovery();
+	int CreateConnection(BLEBridgedDeviceProvider *provider);
+	void PostSchedulerEvent(BLEBridgedDeviceProvider *provider, SchedulerEvent event);
+
+	/* Operations of the connection scheduler used to recover the lost devices. */
+	static BLEConnectionScheduler::Result SchedulerConnect(BLEBridgedDeviceProvider *provider, void *context);
+	static BLEConnectionScheduler::Result SchedulerDiscover(BLEBridgedDeviceProvider *provider, void *context);
+	static void SchedulerFinished(BLEBridgedDeviceProvider *provider, bool success, void *context);
+	static void SchedulerIdle(void *context);
+	static void SchedulerStartTimer(uint32_t timeoutMs, void *context);
+	static void SchedulerTimerCallback(k_timer *timer);
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	int ReadDatabaseHash(BLEBridgedDeviceProvider *provider, bool afterDiscovery = false);
+	void HandleDatabaseHash(const DatabaseHashCtx &ctx);
+	static uint8_t DatabaseHashReadCallback(bt_conn *conn, uint8_t att_err, bt_gatt_read_params *params,
+						const void *data, uint16_t length);
+	static void StoreGattCache(BLEBridgedDeviceProvider *provider);
+	bool IsConnectedProvider(const BLEBridgedDeviceProvider *provider);
+#endif
 
 	StateChangedCallback mStateChangedCb = nullptr;
 	uint8_t mStateBitmask = 0;
@@ -295,6 +389,15 @@ private:
 	ConnectionSecurityRequest mConnectionSecurityRequest;
 #endif /* CONFIG_BT_SMP */
 	Recovery mRecovery;
+	BLEConnectionScheduler mScheduler;
+	k_timer mSchedulerTimer;
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* Only one Database Hash read at a time, the recovered devices are discovered one by one anyway. */
+	bt_gatt_read_params mDatabaseHashReadParams{};
+	BLEBridgedDeviceProvider *mDatabaseHashReadProvider = nullptr;
+	/* The hash is read after the discovery of the newly added device, to cache its discovered handles. */
+	bool mDatabaseHashReadAfterDiscovery = false;
+#endif
 };
 
 } /* namespace Nrf */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_notification_queue.h"
+#include "ble_bridged_device.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+
+#include <cstring>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+
+namespace Nrf
+{
+
+bool BLENotificationQueue::Push(BLEBridgedDeviceProvider *provider, ClusterId clusterId, AttributeId attributeId,
+				const void *data, size_t dataSize)
+{
+	if (!provider || !data || dataSize > kMaxValueSize) {
+		return false;
+	}
+
+	const bool pushed = mQueue.Push([&](Entry &entry) {
+		entry.mProvider = provider;
+		entry.mClusterId = clusterId;
+		entry.mAttributeId = attributeId;
+		entry.mValueSize = static_cast<uint8_t>(dataSize);
+		memcpy(entry.mValue, data, dataSize);
+	});
+
+	if (!pushed) {
+		/* The Matter thread does not keep up, the next notification will bring the up-to-date value anyway. */
+		mStatistics.mDropped++;
+		return false;
+	}
+
+	mStatistics.mPushed++;
+	ScheduleDrain();
+
+	return true;
+}
+
+void BLENotificationQueue::RemoveProvider(BLEBridgedDeviceProvider *provider)
+{
+	mQueue.ForEach([provider](Entry &entry) {
+		if (entry.mProvider == provider) {
+			entry.mProvider = nullptr;
+		}
+	});
+}
+
+void BLENotificationQueue::ScheduleDrain()
+{
+	/* Only one work is scheduled at a time, it handles all values queued until it runs. */
+	if (mDrainScheduled.exchange(true, std::memory_order_acq_rel)) {
+		return;
+	}
+
+	if (DeviceLayer::PlatformMgr().ScheduleWork(DrainWork, reinterpret_cast<intptr_t>(this)) != CHIP_NO_ERROR) {
+		LOG_ERR("Cannot schedule the Bluetooth LE notifications handling");
+		mDrainScheduled.store(false, std::memory_order_release);
+	}
+}
+
+void BLENotificationQueue::Drain()
+{
+	/* Clear the flag before draining, so a value queued after the last check schedules a new work. */
+	mDrainScheduled.store(false, std::memory_order_release);
+
+	const size_t count = mQueue.Pop(
+		[](Entry &entry) {
+			if (entry.mProvider) {
+				entry.mProvider->NotifyUpdateState(entry.mClusterId, entry.mAttributeId, entry.mValue,
+								   entry.mValueSize);
+			}
+		},
+		kMaxBatch);
+
+	mStatistics.mBatches++;
+	if (count > mStatistics.mMaxBatch) {
+		mStatistics.mMaxBatch = count;
+	}
+
+	if (!mQueue.IsEmpty()) {
+		/* The batch limit has been reached, let other Matter work run before handling the rest. */
+		ScheduleDrain();
+	}
+}
+
+void BLENotificationQueue::DrainWork(intptr_t context)
+{
+	reinterpret_cast<BLENotificationQueue *>(context)->Drain();
+}
+
+} /* namespace Nrf */
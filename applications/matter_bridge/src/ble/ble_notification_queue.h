@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include "spsc_queue.h"
+
+#include <lib/core/DataModelTypes.h>
+
+#include <atomic>
+
+namespace Nrf
+{
+
+/* Forward declarations. */
+class BLEBridgedDeviceProvider;
+
+/*
+   BLENotificationQueue passes the attribute values received from the Bluetooth LE bridged devices from the Bluetooth
+   RX thread to the Matter thread. The values are stored inline in a lock-free queue and handed over to the providers'
+   NotifyUpdateState() in batches, so a notification costs neither a heap allocation nor a separate Matter work item.
+   The work draining the queue is scheduled only when the first value is added to the empty queue.
+   Push() must be called only from the Bluetooth RX thread, the remaining methods only from the Matter thread.
+*/
+class BLENotificationQueue {
+public:
+	static constexpr size_t kMaxValueSize = 8;
+
+	struct Statistics {
+		uint32_t mPushed;
+		uint32_t mDropped;
+		uint32_t mBatches;
+		uint32_t mMaxBatch;
+	};
+
+	/**
+	 * @brief Queue the new value of the attribute of the bridged device.
+	 *
+	 * @param provider address of the provider that received the value
+	 * @param clusterId cluster of the changed attribute
+	 * @param attributeId changed attribute
+	 * @param data new value of the attribute
+	 * @param dataSize size of the new value, at most kMaxValueSize
+	 * @return true if the value has been queued
+	 * @return false if the value is too big or the queue is full
+	 */
+	bool Push(BLEBridgedDeviceProvider *provider, chip::ClusterId clusterId, chip::AttributeId attributeId,
+		  const void *data, size_t dataSize);
+
+	/**
+	 * @brief Drop the queued values of the provider that is being removed.
+	 *
+	 * @param provider address of the removed provider
+	 */
+	void RemoveProvider(BLEBridgedDeviceProvider *provider);
+
+	const Statistics &GetStatistics() const { return mStatistics; }
+
+	static BLENotificationQueue &Instance()
+	{
+		static BLENotificationQueue sInstance;
+		return sInstance;
+	}
+
+private:
+	static constexpr size_t kCapacity = CONFIG_BRIDGE_BT_NOTIFICATION_QUEUE_SIZE;
+	/* Maximum number of values handled by a single work, so the Matter thread is not blocked for too long. */
+	static constexpr size_t kMaxBatch = kCapacity / 2;
+
+	struct Entry {
+		BLEBridgedDeviceProvider *mProvider;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+		uint8_t mValueSize;
+		alignas(uint32_t) uint8_t mValue[kMaxValueSize];
+	};
+
+	void ScheduleDrain();
+	void Drain();
+
+	static void DrainWork(intptr_t context);
+
+	SpscQueue<Entry, kCapacity> mQueue;
+	std::atomic<bool> mDrainScheduled{ false };
+	Statistics mStatistics{};
+};
+
+} /* namespace Nrf */
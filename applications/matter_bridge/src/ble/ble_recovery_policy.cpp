@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_recovery_policy.h"
+
+#include <zephyr/sys/util.h>
+
+namespace Nrf
+{
+
+void BLERecoveryPolicy::Init(int64_t now)
+{
+	mDutyCycleWindowStartMs = now;
+	mDutyCycleUsedMs = 0;
+}
+
+uint32_t BLERecoveryPolicy::GetBackoffMs(uint16_t failedAttempts, int64_t lostTimeMs, int64_t now,
+					 uint32_t random) const
+{
+	uint32_t backoff = mConfig.mIntervalMs;
+
+	/* Recently lost devices are likely to come back soon, so they are looked for with the base interval. Other
+	 * devices are looked for less frequently, the longer they are not detected. */
+	if (now - lostTimeMs >= mConfig.mRecentlyLostMs) {
+		/* Limit the shift, so it does not overflow before the maximum interval is applied. */
+		const uint16_t shift = MIN(failedAttempts, 16);
+
+		backoff = MIN(static_cast<uint64_t>(mConfig.mIntervalMs) << shift, mConfig.mMaxIntervalMs);
+	}
+
+	/* Randomize the second half of the interval, so that devices lost at the same time are not looked for in
+	 * lockstep and do not keep the radio busy in bursts. */
+	return backoff / 2 + random % (backoff / 2 + 1);
+}
+
+bool BLERecoveryPolicy::ConsumeScanBudget(int64_t now, uint32_t scanTimeMs, uint32_t &waitMs)
+{
+	if (now - mDutyCycleWindowStartMs >= mConfig.mDutyCycleWindowMs) {
+		mDutyCycleWindowStartMs = now;
+		mDutyCycleUsedMs = 0;
+	}
+
+	/* A single scan is always allowed in a new window, even if it is longer than the whole budget. */
+	if (mDutyCycleUsedMs > 0 && mDutyCycleUsedMs + scanTimeMs > mConfig.mDutyCycleBudgetMs) {
+		waitMs = static_cast<uint32_t>(mDutyCycleWindowStartMs + mConfig.mDutyCycleWindowMs - now);
+		return false;
+	}
+
+	mDutyCycleUsedMs += scanTimeMs;
+	return true;
+}
+
+} /* namespace Nrf */
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Nrf
+{
+
+/*
+   BLERecoveryPolicy decides when the lost Bluetooth LE bridged devices are looked for. Every device is looked for
+   after a randomized backoff that grows with the number of failed recovery attempts, unless the device was lost only
+   recently. The radio time spent on the recovery scans is limited to the given budget in every duty cycle window.
+   The policy does not read the time or the random numbers on its own, so its decisions depend only on the arguments.
+*/
+class BLERecoveryPolicy {
+public:
+	struct Config {
+		/* Base interval, used for the recently lost devices and for the first attempt. */
+		uint32_t mIntervalMs;
+		/* Maximum interval the backoff can grow to. */
+		uint32_t mMaxIntervalMs;
+		/* Devices lost for a shorter time are looked for with the base interval. */
+		int64_t mRecentlyLostMs;
+		/* At most mDutyCycleBudgetMs of every mDutyCycleWindowMs is spent on the recovery scans. */
+		uint32_t mDutyCycleWindowMs;
+		uint32_t mDutyCycleBudgetMs;
+	};
+
+	explicit BLERecoveryPolicy(const Config &config) : mConfig(config) {}
+
+	/**
+	 * @brief Start the first duty cycle window.
+	 *
+	 * @param now current uptime in milliseconds
+	 */
+	void Init(int64_t now);
+
+	/**
+	 * @brief Get the time after which the lost device shall be looked for again.
+	 *
+	 * @param failedAttempts number of failed recovery attempts of the device
+	 * @param lostTimeMs uptime at which the connection to the device was lost
+	 * @param now current uptime in milliseconds
+	 * @param random random number used to spread the attempts of devices lost at the same time
+	 * @return backoff in milliseconds, between half and the whole of the interval
+	 */
+	uint32_t GetBackoffMs(uint16_t failedAttempts, int64_t lostTimeMs, int64_t now, uint32_t random) const;
+
+	/**
+	 * @brief Take the time of the recovery scan from the duty cycle budget.
+	 *
+	 * @param now current uptime in milliseconds
+	 * @param scanTimeMs duration of the scan
+	 * @param waitMs time after which the next window starts, set if the budget is used up
+	 * @return true if the scan can be started
+	 * @return false if the budget of the current window is used up
+	 */
+	bool ConsumeScanBudget(int64_t now, uint32_t scanTimeMs, uint32_t &waitMs);
+
+private:
+	const Config mConfig;
+	int64_t mDutyCycleWindowStartMs = 0;
+	uint32_t mDutyCycleUsedMs = 0;
+};
+
+} /* namespace Nrf */
@@ -9,6 +9,10 @@
 #include "ble_connectivity_manager.h"
 #include "bridged_device_data_provider.h"
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+#include "bridge_storage_manager.h"
+#endif
+
 #include <bluetooth/gatt_dm.h>
 #include <zephyr/bluetooth/addr.h>
 #include <zephyr/bluetooth/conn.h>
@@ -27,6 +31,11 @@ struct BLEBridgedDevice {
 					     has been successfully added to the Bridge. */
 	bt_conn *mConn;
 	BLEBridgedDeviceProvider *mProvider;
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* Database Hash read before the GATT discovery, used to store the discovered handles. */
+	uint8_t mDatabaseHash[BridgeStorageManager::kGattDatabaseHashSize];
+	bool mDatabaseHashValid;
+#endif
 };
 
 class BLEBridgedDeviceProvider : public BridgedDeviceDataProvider {
@@ -40,6 +49,31 @@ public:
 	virtual const bt_uuid *GetServiceUuid() = 0;
 	virtual int ParseDiscoveredData(bt_gatt_dm *discoveredData) = 0;
 
+	/**
+	 * @brief Get the GATT attribute handles found by the last successful ParseDiscoveredData() call.
+	 *
+	 * The handles are stored by the bridge, so they can be restored using RestoreAttributeHandles() when the device
+	 * is reconnected and its GATT database did not change.
+	 *
+	 * @param handles buffer to be filled with the handles
+	 * @param maxCount capacity of the buffer
+	 * @return number of handles written to the buffer on success
+	 * @return -ENOTSUP if the provider does not support restoring the handles
+	 * @return other negative error code if the handles do not fit in the buffer
+	 */
+	virtual int GetAttributeHandles(uint16_t *handles, uint8_t maxCount) { return -ENOTSUP; }
+
+	/**
+	 * @brief Restore the GATT attribute handles returned by GetAttributeHandles() and subscribe to the
+	 * characteristics, in the same way as ParseDiscoveredData() does after the GATT discovery.
+	 *
+	 * @param handles handles to be restored
+	 * @param count number of the handles
+	 * @return 0 on success
+	 * @return negative error code otherwise
+	 */
+	virtual int RestoreAttributeHandles(const uint16_t *handles, uint8_t count) { return -ENOTSUP; }
+
 	BLEBridgedDevice &GetBLEBridgedDevice() { return mDevice; }
 	void SetConnectionObject(bt_conn *conn) { mDevice.mConn = conn; }
 	bt_conn *GetConnectionObject() { return mDevice.mConn; }
@@ -5,6 +5,7 @@
  */
 
 #include "ble_environmental_data_provider.h"
+#include "ble_notification_queue.h"
 
 #include <bluetooth/gatt_dm.h>
 #include <zephyr/bluetooth/conn.h>
@@ -43,11 +44,12 @@ uint8_t BleEnvironmentalDataProvider::GattTemperatureNotifyCallback(bt_conn *con
 
 	VerifyOrExit(provider, );
 	VerifyOrExit(data, );
-	VerifyOrExit(length == sizeof(mTemperatureValue), );
+	VerifyOrExit(length == sizeof(int16_t), );
 
-	/* Save data received in notification. */
-	memcpy(&provider->mTemperatureValue, data, length);
-	DeviceLayer::PlatformMgr().ScheduleWork(NotifyTemperatureAttributeChange, reinterpret_cast<intptr_t>(provider));
+	/* Pass the value received in the notification to the Matter thread. */
+	BLENotificationQueue::Instance().Push(provider, Clusters::TemperatureMeasurement::Id,
+					      Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id, data,
+					      length);
 
 exit:
 
@@ -64,7 +66,7 @@ uint8_t BleEnvironmentalDataProvider::GattHumidityNotifyCallback(bt_conn *conn,
 
 	/* Save data received in notification. */
 	memcpy(&provider->mHumidityValue, data, length);
-	DeviceLayer::PlatformMgr().ScheduleWork(NotifyHumidityAttributeChange, reinterpret_cast<intptr_t>(provider));
+	provider->PushHumidity();
 
 exit:
 
@@ -123,6 +125,33 @@ int BleEnvironmentalDataProvider::ParseDiscoveredData(bt_gatt_dm *discoveredData
 	return 0;
 }
 
+int BleEnvironmentalDataProvider::GetAttributeHandles(uint16_t *handles, uint8_t maxCount)
+{
+	VerifyOrReturnError(maxCount >= kAttributeHandlesCount, -ENOMEM);
+
+	handles[0] = mTemperatureCharacteristicHandle;
+	handles[1] = mCccTemperatureHandle;
+	handles[2] = mHumidityCharacteristicHandle;
+	/* Zero if the humidity characteristic does not support notifications and the subscription is emulated. */
+	handles[3] = mCccHumidityHandle;
+
+	return kAttributeHandlesCount;
+}
+
+int BleEnvironmentalDataProvider::RestoreAttributeHandles(const uint16_t *handles, uint8_t count)
+{
+	VerifyOrReturnError(count == kAttributeHandlesCount, -EINVAL);
+
+	mTemperatureCharacteristicHandle = handles[0];
+	mCccTemperatureHandle = handles[1];
+	mHumidityCharacteristicHandle = handles[2];
+	mCccHumidityHandle = handles[3];
+
+	Subscribe();
+
+	return 0;
+}
+
 CHIP_ERROR BleEnvironmentalDataProvider::ParseTemperatureCharacteristic(bt_gatt_dm *discoveredData)
 {
 	const bt_gatt_dm_attr *gatt_chrc = bt_gatt_dm_char_by_uuid(discoveredData, sUuidTemperature);
@@ -232,22 +261,11 @@ bool BleEnvironmentalDataProvider::CheckSubscriptionParameters(bt_gatt_subscribe
 	return true;
 }
 
-void BleEnvironmentalDataProvider::NotifyTemperatureAttributeChange(intptr_t context)
-{
-	BleEnvironmentalDataProvider *provider = reinterpret_cast<BleEnvironmentalDataProvider *>(context);
-
-	provider->NotifyUpdateState(Clusters::TemperatureMeasurement::Id,
-				    Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id,
-				    &provider->mTemperatureValue, sizeof(provider->mTemperatureValue));
-}
-
-void BleEnvironmentalDataProvider::NotifyHumidityAttributeChange(intptr_t context)
+void BleEnvironmentalDataProvider::PushHumidity()
 {
-	BleEnvironmentalDataProvider *provider = reinterpret_cast<BleEnvironmentalDataProvider *>(context);
-
-	provider->NotifyUpdateState(Clusters::RelativeHumidityMeasurement::Id,
-				    Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id,
-				    &provider->mHumidityValue, sizeof(provider->mHumidityValue));
+	BLENotificationQueue::Instance().Push(this, Clusters::RelativeHumidityMeasurement::Id,
+					      Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id,
+					      &mHumidityValue, sizeof(mHumidityValue));
 }
 
 void BleEnvironmentalDataProvider::StartHumidityTimer()
@@ -290,8 +308,7 @@ uint8_t BleEnvironmentalDataProvider::HumidityGATTReadCallback(bt_conn *conn, ui
 		memcpy(&newValue, data, sizeof(newValue));
 		if (newValue != provider->mHumidityValue) {
 			provider->mHumidityValue = newValue;
-			DeviceLayer::PlatformMgr().ScheduleWork(NotifyHumidityAttributeChange,
-								reinterpret_cast<intptr_t>(provider));
+			provider->PushHumidity();
 		}
 	} else {
 		LOG_ERR("Unsuccessful GATT read operation (err %d)", att_err);
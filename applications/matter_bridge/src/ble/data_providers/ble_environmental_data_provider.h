@@ -21,8 +21,12 @@ public:
 	CHIP_ERROR UpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, uint8_t *buffer) override;
 	const bt_uuid *GetServiceUuid() override;
 	int ParseDiscoveredData(bt_gatt_dm *discoveredData) override;
+	int GetAttributeHandles(uint16_t *handles, uint8_t maxCount) override;
+	int RestoreAttributeHandles(const uint16_t *handles, uint8_t count) override;
 
 private:
+	static constexpr uint8_t kAttributeHandlesCount{ 4 };
+
 	static constexpr uint32_t kMeasurementsIntervalMs{ CONFIG_BRIDGE_BLE_DEVICE_POLLING_INTERVAL };
 
 	void StartHumidityTimer();
@@ -38,15 +42,15 @@ private:
 						     uint16_t length);
 	static uint8_t GattHumidityNotifyCallback(bt_conn *conn, bt_gatt_subscribe_params *params, const void *data,
 						  uint16_t length);
-	static void NotifyTemperatureAttributeChange(intptr_t context);
-	static void NotifyHumidityAttributeChange(intptr_t context);
+	/* Pass the humidity value to the Matter thread, must be called from the Bluetooth RX thread. */
+	void PushHumidity();
 
 	static void ReadGATTHumidity(intptr_t context);
 	static void HumidityTimerTimeoutCallback(k_timer *timer);
 	static uint8_t HumidityGATTReadCallback(bt_conn *conn, uint8_t att_err, bt_gatt_read_params *params,
 						const void *data, uint16_t read_len);
 
-	uint16_t mTemperatureValue{};
+	/* Last humidity value, accessed only from the Bluetooth RX thread to detect changes of the polled value. */
 	uint16_t mHumidityValue{};
 
 	uint16_t mTemperatureCharacteristicHandle{};
@@ -5,6 +5,7 @@
  */
 
 #include "ble_lbs_data_provider.h"
+#include "ble_notification_queue.h"
 
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE
 #include "binding/binding_handler.h"
@@ -81,12 +82,11 @@ uint8_t BleLBSDataProvider::GattNotifyCallback(bt_conn *conn, bt_gatt_subscribe_
 	VerifyOrExit(provider, );
 
 #ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-	VerifyOrExit(length == sizeof(mCurrentSwitchPosition), );
+	VerifyOrExit(length == sizeof(uint8_t), );
 
-	/* Save data received in the notification. */
-	memcpy(&provider->mCurrentSwitchPosition, data, length);
-	DeviceLayer::PlatformMgr().ScheduleWork(NotifySwitchCurrentPositionAttributeChange,
-						reinterpret_cast<intptr_t>(provider));
+	/* Pass the value received in the notification to the Matter thread. */
+	BLENotificationQueue::Instance().Push(provider, Clusters::Switch::Id,
+					      Clusters::Switch::Attributes::CurrentPosition::Id, data, length);
 #endif
 
 #ifdef CONFIG_BRIDGE_ONOFF_LIGHT_SWITCH_BRIDGED_DEVICE
@@ -258,23 +258,41 @@ int BleLBSDataProvider::ParseDiscoveredData(bt_gatt_dm *discoveredData)
 	return 0;
 }
 
-void BleLBSDataProvider::NotifyOnOffAttributeChange(intptr_t context)
+int BleLBSDataProvider::GetAttributeHandles(uint16_t *handles, uint8_t maxCount)
 {
-	BleLBSDataProvider *provider = reinterpret_cast<BleLBSDataProvider *>(context);
+	if (maxCount < kAttributeHandlesCount) {
+		return -ENOMEM;
+	}
 
-	provider->NotifyUpdateState(Clusters::OnOff::Id, Clusters::OnOff::Attributes::OnOff::Id, &provider->mOnOff,
-				    sizeof(provider->mOnOff));
+	handles[0] = mLedCharacteristicHandle;
+	handles[1] = mButtonCharacteristicHandle;
+	handles[2] = mCccHandle;
+
+	return kAttributeHandlesCount;
 }
 
-#ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-void BleLBSDataProvider::NotifySwitchCurrentPositionAttributeChange(intptr_t context)
+int BleLBSDataProvider::RestoreAttributeHandles(const uint16_t *handles, uint8_t count)
+{
+	if (count != kAttributeHandlesCount) {
+		return -EINVAL;
+	}
+
+	mLedCharacteristicHandle = handles[0];
+	mButtonCharacteristicHandle = handles[1];
+	mCccHandle = handles[2];
+
+	Subscribe();
+
+	return 0;
+}
+
+void BleLBSDataProvider::NotifyOnOffAttributeChange(intptr_t context)
 {
 	BleLBSDataProvider *provider = reinterpret_cast<BleLBSDataProvider *>(context);
 
-	provider->NotifyUpdateState(Clusters::Switch::Id, Clusters::Switch::Attributes::CurrentPosition::Id,
-				    &provider->mCurrentSwitchPosition, sizeof(provider->mCurrentSwitchPosition));
+	provider->NotifyUpdateState(Clusters::OnOff::Id, Clusters::OnOff::Attributes::OnOff::Id, &provider->mOnOff,
+				    sizeof(provider->mOnOff));
 }
-#endif
 
 bool BleLBSDataProvider::CheckSubscriptionParameters(bt_gatt_subscribe_params *params)
 {
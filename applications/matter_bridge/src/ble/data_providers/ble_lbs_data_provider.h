@@ -25,9 +25,6 @@ public:
 	CHIP_ERROR UpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, uint8_t *buffer) override;
 
 	static void NotifyOnOffAttributeChange(intptr_t context);
-#ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-	static void NotifySwitchCurrentPositionAttributeChange(intptr_t context);
-#endif
 
 	static void GattWriteCallback(bt_conn *conn, uint8_t err, bt_gatt_write_params *params);
 	static uint8_t GattNotifyCallback(bt_conn *conn, bt_gatt_subscribe_params *params, const void *data,
@@ -35,15 +32,16 @@ public:
 
 	const bt_uuid *GetServiceUuid() override;
 	int ParseDiscoveredData(bt_gatt_dm *discoveredData) override;
+	int GetAttributeHandles(uint16_t *handles, uint8_t maxCount) override;
+	int RestoreAttributeHandles(const uint16_t *handles, uint8_t count) override;
 
 private:
+	static constexpr uint8_t kAttributeHandlesCount = 3;
+
 	void Subscribe();
 	bool CheckSubscriptionParameters(bt_gatt_subscribe_params *params);
 
 	bool mOnOff = false;
-#ifdef CONFIG_BRIDGE_GENERIC_SWITCH_BRIDGED_DEVICE
-	uint8_t mCurrentSwitchPosition = false;
-#endif
 	uint16_t mLedCharacteristicHandle;
 	bt_gatt_write_params mGattWriteParams{};
 	uint16_t mButtonCharacteristicHandle;
@@ -7,6 +7,10 @@
 #include "bridge_manager.h"
 #include "platform/ConfigurationManager.h"
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+#include "attribute_report_coalescer.h"
+#endif
+
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 #include "ble_bridged_device_factory.h"
 #include "ble_connectivity_manager.h"
@@ -127,6 +131,182 @@ static int RemoveBridgedDeviceHandler(const struct shell *shell, size_t argc, ch
 	return 0;
 }
 
+#ifdef CONFIG_BRIDGED_DEVICE_SIMULATED
+/* Bridged device described by the add_bulk manifest, prepared before the Matter stack is locked. */
+struct StagedBridgedDevice {
+	int mDeviceType;
+	char *mNodeLabel;
+	char mUniqueID[chip::DeviceLayer::ConfigurationManager::kMaxUniqueIDLength];
+};
+
+static int AddBridgedDevicesBulkHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	static StagedBridgedDevice staged[Nrf::BridgeManager::kMaxBridgedDevices];
+	uint8_t stagedCount = 0;
+	uint16_t added = 0;
+	uint16_t failed = 0;
+	char *savePtr = nullptr;
+	const int64_t startTime = k_uptime_get();
+
+	/* Parse the whole manifest and generate the unique IDs first, so the Matter stack is locked only while the
+	 * endpoints are created. */
+	for (char *entry = strtok_r(argv[1], ",", &savePtr); entry; entry = strtok_r(nullptr, ",", &savePtr)) {
+		/* Every manifest entry has the form of <device_type>[*<count>][:<node_label>]. */
+		char *nodeLabel = strchr(entry, ':');
+		char *end = nullptr;
+
+		if (nodeLabel) {
+			*nodeLabel++ = '\0';
+		}
+
+		const int deviceType = strtoul(entry, &end, 0);
+		unsigned long count = 1;
+
+		if (*end == '*') {
+			count = strtoul(end + 1, &end, 0);
+		}
+
+		if (end == entry || *end != '\0' || count == 0) {
+			shell_fprintf(shell, SHELL_ERROR, "Invalid manifest entry: %s\n", entry);
+			failed++;
+			continue;
+		}
+
+		for (unsigned long i = 0; i < count; i++) {
+			if (stagedCount == ARRAY_SIZE(staged)) {
+				failed++;
+				continue;
+			}
+
+			StagedBridgedDevice &device = staged[stagedCount++];
+
+			device.mDeviceType = deviceType;
+			device.mNodeLabel = nodeLabel;
+			chip::DeviceLayer::ConfigurationMgrImpl().GenerateUniqueId(device.mUniqueID,
+										  sizeof(device.mUniqueID));
+		}
+	}
+
+	CHIP_ERROR result;
+
+	{
+		/* Create all endpoints under a single stack lock and store all devices with a single write of the list. */
+		chip::DeviceLayer::StackLock lock;
+
+		Nrf::BridgeManager::Instance().StartBulkUpdate();
+
+		for (uint8_t i = 0; i < stagedCount; i++) {
+			if (SimulatedBridgedDeviceFactory::CreateDevice(staged[i].mDeviceType, staged[i].mUniqueID,
+									staged[i].mNodeLabel) == CHIP_NO_ERROR) {
+				added++;
+			} else {
+				failed++;
+			}
+		}
+
+		result = Nrf::BridgeManager::Instance().FinishBulkUpdate();
+	}
+
+	const int64_t elapsedMs = k_uptime_get() - startTime;
+
+	shell_fprintf(shell, SHELL_INFO, "Added %u device(s) in %lld ms\n", added, static_cast<long long>(elapsedMs));
+
+	if (failed > 0) {
+		shell_fprintf(shell, SHELL_ERROR, "Failed to add %u device(s)\n", failed);
+	}
+
+	if (result != CHIP_NO_ERROR) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: storing the devices failed\n");
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BRIDGED_DEVICE_SIMULATED */
+
+static int RemoveBridgedDevicesBulkHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	/* Ranges of endpoint ids, parsed before the Matter stack is locked. */
+	static uint16_t ranges[Nrf::BridgeManager::kMaxBridgedDevices][2];
+	uint8_t rangesCount = 0;
+	/* Number of endpoint ids in all ranges, limited to the number of bridged devices, so a wide range does not keep
+	 * the Matter stack locked. */
+	size_t endpointsCount = 0;
+	uint16_t removed = 0;
+	uint16_t failed = 0;
+	char *savePtr = nullptr;
+	const int64_t startTime = k_uptime_get();
+
+	for (char *entry = strtok_r(argv[1], ",", &savePtr); entry; entry = strtok_r(nullptr, ",", &savePtr)) {
+		/* Every entry is either a single endpoint id or a range of endpoint ids, e.g. 3-10. */
+		char *end = nullptr;
+		const unsigned long first = strtoul(entry, &end, 0);
+		unsigned long last = first;
+
+		if (*end == '-') {
+			last = strtoul(end + 1, &end, 0);
+		}
+
+		if (end == entry || *end != '\0' || last < first || last > UINT16_MAX ||
+		    rangesCount == ARRAY_SIZE(ranges)) {
+			shell_fprintf(shell, SHELL_ERROR, "Invalid endpoint range: %s\n", entry);
+			failed++;
+			continue;
+		}
+
+		if (last - first + 1 > Nrf::BridgeManager::kMaxBridgedDevices - endpointsCount) {
+			shell_fprintf(shell, SHELL_ERROR, "Too many endpoints, at most %u can be removed: %s\n",
+				      Nrf::BridgeManager::kMaxBridgedDevices, entry);
+			failed++;
+			continue;
+		}
+
+		ranges[rangesCount][0] = static_cast<uint16_t>(first);
+		ranges[rangesCount][1] = static_cast<uint16_t>(last);
+		rangesCount++;
+		endpointsCount += last - first + 1;
+	}
+
+	CHIP_ERROR result;
+
+	{
+		chip::DeviceLayer::StackLock lock;
+
+		Nrf::BridgeManager::Instance().StartBulkUpdate();
+
+		for (uint8_t i = 0; i < rangesCount; i++) {
+			for (uint32_t endpointId = ranges[i][0]; endpointId <= ranges[i][1]; endpointId++) {
+#if defined(CONFIG_BRIDGED_DEVICE_BT)
+				const CHIP_ERROR err = BleBridgedDeviceFactory::RemoveDevice(endpointId);
+#else
+				const CHIP_ERROR err = SimulatedBridgedDeviceFactory::RemoveDevice(endpointId);
+#endif
+				if (err == CHIP_NO_ERROR) {
+					removed++;
+				} else {
+					failed++;
+				}
+			}
+		}
+
+		result = Nrf::BridgeManager::Instance().FinishBulkUpdate();
+	}
+
+	const int64_t elapsedMs = k_uptime_get() - startTime;
+
+	shell_fprintf(shell, SHELL_INFO, "Removed %u device(s) in %lld ms\n", removed,
+		      static_cast<long long>(elapsedMs));
+
+	if (failed > 0) {
+		shell_fprintf(shell, SHELL_ERROR, "Failed to remove %u device(s)\n", failed);
+	}
+
+	if (result != CHIP_NO_ERROR) {
+		shell_fprintf(shell, SHELL_ERROR, "Error: storing the devices failed\n");
+	}
+
+	return 0;
+}
+
 static const char *GetDeviceTypeString(uint16_t deviceType)
 {
 	using DeviceType = Nrf::MatterBridgedDevice::DeviceType;
@@ -184,6 +364,30 @@ static int ListBridgedDevicesHandler(const struct shell *shell, size_t argc, cha
 	return 0;
 }
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+static int ReportStatisticsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	auto &coalescer = Nrf::AttributeReportCoalescer::Instance();
+
+	chip::DeviceLayer::StackLock lock;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		coalescer.ResetStatistics();
+		shell_fprintf(shell, SHELL_INFO, "Done\n");
+		return 0;
+	}
+
+	const auto &stats = coalescer.GetStatistics();
+
+	shell_fprintf(shell, SHELL_INFO, "Attribute updates:       %u\n", stats.mUpdates);
+	shell_fprintf(shell, SHELL_INFO, "Reports:                 %u\n", stats.mReports);
+	shell_fprintf(shell, SHELL_INFO, "Coalesced updates:       %u\n", stats.mCoalesced);
+	shell_fprintf(shell, SHELL_INFO, "Suppressed by delta:     %u\n", stats.mSuppressedByDelta);
+
+	return 0;
+}
+#endif /* CONFIG_BRIDGE_REPORT_COALESCING */
+
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 static int SimulatedBridgedDeviceOnOffWriteHandler(const struct shell *shell, size_t argc, char **argv)
 {
@@ -290,6 +494,40 @@ static int InsertBridgedDevicePincodeHandler(const struct shell *shell, size_t a
 }
 #endif /* CONFIG_BT_SMP */
 
+static int RecoveryStatisticsHandler(const struct shell *shell, size_t argc, char **argv)
+{
+	auto &manager = Nrf::BLEConnectivityManager::Instance();
+
+	chip::DeviceLayer::StackLock lock;
+
+	if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+		manager.ResetRecoveryStatistics();
+		shell_fprintf(shell, SHELL_INFO, "Done\n");
+		return 0;
+	}
+
+	const auto &stats = manager.GetRecoveryStatistics();
+	const auto &schedulerStats = manager.GetSchedulerStatistics();
+	const int64_t elapsedMs = k_uptime_get() - stats.mStartTimeMs;
+	const uint32_t dutyCyclePermille =
+		elapsedMs > 0 ? static_cast<uint32_t>(MIN(stats.mScanTimeMs * 1000 / elapsedMs, 1000)) : 0;
+
+	shell_fprintf(shell, SHELL_INFO, "Recovery scans:          %u\n", stats.mScans);
+	shell_fprintf(shell, SHELL_INFO, "Deferred scans:          %u\n", stats.mDeferredScans);
+	shell_fprintf(shell, SHELL_INFO, "Scan time:               %llu ms\n",
+		      static_cast<unsigned long long>(stats.mScanTimeMs));
+	shell_fprintf(shell, SHELL_INFO, "Scan duty cycle:         %u.%u %%\n", dutyCyclePermille / 10,
+		      dutyCyclePermille % 10);
+	shell_fprintf(shell, SHELL_INFO, "Devices found:           %u\n", stats.mDevicesFound);
+	shell_fprintf(shell, SHELL_INFO, "Devices missed:          %u\n", stats.mDevicesMissed);
+	shell_fprintf(shell, SHELL_INFO, "Connected:               %u\n", schedulerStats.mConnected);
+	shell_fprintf(shell, SHELL_INFO, "Discovered:              %u\n", schedulerStats.mDiscovered);
+	shell_fprintf(shell, SHELL_INFO, "Failed:                  %u\n", schedulerStats.mFailed);
+	shell_fprintf(shell, SHELL_INFO, "Timed out:               %u\n", schedulerStats.mTimedOut);
+
+	return 0;
+}
+
 static int ScanBridgedDeviceHandler(const struct shell *shell, size_t argc, char **argv)
 {
 	shell_fprintf(shell, SHELL_INFO, "Scanning for %d s ...\n", CONFIG_BRIDGE_BT_SCAN_TIMEOUT_MS / 1000);
@@ -324,11 +562,33 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		"Usage: remove <bridged_device_endpoint_id>\n"
 		"* bridged_device_endpoint_id - the bridged device's endpoint on which it was previously created\n",
 		RemoveBridgedDeviceHandler, 2, 0),
+#ifdef CONFIG_BRIDGED_DEVICE_SIMULATED
+	SHELL_CMD_ARG(
+		add_bulk, NULL,
+		"Adds multiple bridged devices described by a manifest, using a single storage write. \n"
+		"Usage: add_bulk <manifest>\n"
+		"* manifest - comma-separated list of <bridged_device_type>[*<count>][:<node_label>] entries, e.g. 256*10:Light,770,775\n",
+		AddBridgedDevicesBulkHandler, 2, 0),
+#endif /* CONFIG_BRIDGED_DEVICE_SIMULATED */
+	SHELL_CMD_ARG(
+		remove_bulk, NULL,
+		"Removes multiple bridged devices, using a single storage write. \n"
+		"Usage: remove_bulk <bridged_device_endpoint_ids>\n"
+		"* bridged_device_endpoint_ids - comma-separated list of endpoint ids or ranges of endpoint ids, e.g. 3,5-10. "
+		"The list can include at most as many endpoint ids as the maximum number of bridged devices.\n",
+		RemoveBridgedDevicesBulkHandler, 2, 0),
 	SHELL_CMD_ARG(list, NULL,
 		      "Lists all currently connected bridged devices. \n"
 		      "Usage: list\n"
 		      "Displays endpoint ID, node label (name), and device type for all bridged devices.\n",
 		      ListBridgedDevicesHandler, 1, 0),
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+	SHELL_CMD_ARG(report_stats, NULL,
+		      "Displays attribute reporting statistics. \n"
+		      "Usage: report_stats [reset]\n"
+		      "* reset - the optional argument that clears the statistics\n",
+		      ReportStatisticsHandler, 1, 1),
+#endif /* CONFIG_BRIDGE_REPORT_COALESCING */
 #ifdef CONFIG_BRIDGED_DEVICE_SIMULATED_ONOFF_SHELL
 	SHELL_CMD_ARG(
 		onoff, NULL,
@@ -352,6 +612,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Scan for Bluetooth LE devices to bridge. \n"
 		      "Usage: scan\n",
 		      ScanBridgedDeviceHandler, 1, 0),
+	SHELL_CMD_ARG(recovery_stats, NULL,
+		      "Displays statistics of the lost Bluetooth LE devices recovery. \n"
+		      "Usage: recovery_stats [reset]\n"
+		      "* reset - the optional argument that clears the statistics\n",
+		      RecoveryStatisticsHandler, 1, 1),
 #ifdef CONFIG_BT_SMP
 	SHELL_CMD_ARG(pincode, NULL,
 		      "Insert pincode for Bluetooth LE device pairing. \n"
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "attribute_report_coalescer.h"
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+
+#include <cstdlib>
+#include <cstring>
+
+LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+
+namespace
+{
+/* Returns the minimum change of the value that is worth reporting, or 0 if every change shall be reported. */
+int32_t GetDeltaThreshold(ClusterId clusterId, AttributeId attributeId)
+{
+	if (clusterId == Clusters::TemperatureMeasurement::Id &&
+	    attributeId == Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id) {
+		return CONFIG_BRIDGE_REPORT_TEMPERATURE_DELTA;
+	}
+
+	if (clusterId == Clusters::RelativeHumidityMeasurement::Id &&
+	    attributeId == Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Id) {
+		return CONFIG_BRIDGE_REPORT_HUMIDITY_DELTA;
+	}
+
+	return 0;
+}
+
+/* Decodes the measured value passed by the data provider. Returns false if the value is null or cannot be decoded. */
+bool DecodeMeasuredValue(ClusterId clusterId, const void *data, size_t dataSize, int32_t &value)
+{
+	if (clusterId == Clusters::TemperatureMeasurement::Id && dataSize == sizeof(int16_t)) {
+		int16_t raw;
+		memcpy(&raw, data, sizeof(raw));
+		value = raw;
+		return raw != INT16_MIN;
+	}
+
+	if (clusterId == Clusters::RelativeHumidityMeasurement::Id && dataSize == sizeof(uint16_t)) {
+		uint16_t raw;
+		memcpy(&raw, data, sizeof(raw));
+		value = raw;
+		return raw != UINT16_MAX;
+	}
+
+	return false;
+}
+} /* namespace */
+
+namespace Nrf
+{
+
+void AttributeReportCoalescer::MarkDirty(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
+					 const void *data, size_t dataSize)
+{
+	mStatistics.mUpdates++;
+
+	TrackedAttribute *attribute = FindOrAdd(endpointId, clusterId, attributeId);
+
+	if (!attribute) {
+		/* No space to track the attribute, so fall back to reporting it directly. */
+		MatterReportingAttributeChangeCallback(endpointId, clusterId, attributeId);
+		mStatistics.mReports++;
+		return;
+	}
+
+	int32_t value = 0;
+
+	if (IsBelowDelta(*attribute, data, dataSize, value)) {
+		mStatistics.mSuppressedByDelta++;
+		return;
+	}
+
+	if (attribute->mDirty) {
+		/* The previous change has not been reported yet, it will be covered by the pending report. */
+		mStatistics.mCoalesced++;
+	}
+
+	attribute->mDirty = true;
+	attribute->mReportedValue = value;
+
+	ScheduleFlush();
+}
+
+void AttributeReportCoalescer::RemoveEndpoint(EndpointId endpointId)
+{
+	for (auto &attribute : mAttributes) {
+		if (attribute.mEndpointId == endpointId) {
+			attribute = TrackedAttribute{};
+		}
+	}
+}
+
+void AttributeReportCoalescer::Flush()
+{
+	for (auto &attribute : mAttributes) {
+		if (attribute.mDirty) {
+			attribute.mDirty = false;
+			MatterReportingAttributeChangeCallback(attribute.mEndpointId, attribute.mClusterId,
+							       attribute.mAttributeId);
+			mStatistics.mReports++;
+		}
+	}
+
+	mLastFlush = System::SystemClock().GetMonotonicTimestamp();
+}
+
+AttributeReportCoalescer::TrackedAttribute *
+AttributeReportCoalescer::FindOrAdd(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+	TrackedAttribute *freeSlot = nullptr;
+
+	for (auto &attribute : mAttributes) {
+		if (attribute.mEndpointId == endpointId && attribute.mClusterId == clusterId &&
+		    attribute.mAttributeId == attributeId) {
+			return &attribute;
+		}
+
+		if (!freeSlot && attribute.mEndpointId == kInvalidEndpointId) {
+			freeSlot = &attribute;
+		}
+	}
+
+	if (freeSlot) {
+		freeSlot->mEndpointId = endpointId;
+		freeSlot->mClusterId = clusterId;
+		freeSlot->mAttributeId = attributeId;
+	}
+
+	return freeSlot;
+}
+
+bool AttributeReportCoalescer::IsBelowDelta(TrackedAttribute &attribute, const void *data, size_t dataSize,
+					    int32_t &value)
+{
+	int32_t threshold = GetDeltaThreshold(attribute.mClusterId, attribute.mAttributeId);
+
+	if (threshold == 0 || !data || !DecodeMeasuredValue(attribute.mClusterId, data, dataSize, value)) {
+		attribute.mHasReportedValue = false;
+		return false;
+	}
+
+	/* The delta is computed against the last value that was accepted for reporting, so slow drifts are still
+	 * reported once they accumulate. */
+	if (attribute.mHasReportedValue && abs(value - attribute.mReportedValue) < threshold) {
+		return true;
+	}
+
+	attribute.mHasReportedValue = true;
+	return false;
+}
+
+void AttributeReportCoalescer::ScheduleFlush()
+{
+	if (mFlushScheduled) {
+		return;
+	}
+
+	System::Clock::Timestamp elapsed = System::SystemClock().GetMonotonicTimestamp() - mLastFlush;
+	System::Clock::Timestamp minInterval = System::Clock::Milliseconds64(kMinIntervalMs);
+	System::Clock::Timeout delay =
+		elapsed >= minInterval ? System::Clock::kZero
+				       : std::chrono::duration_cast<System::Clock::Timeout>(minInterval - elapsed);
+
+	CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(delay, FlushTimerCallback, this);
+
+	if (err != CHIP_NO_ERROR) {
+		LOG_ERR("Cannot schedule attribute reports flush: %" CHIP_ERROR_FORMAT, err.Format());
+		Flush();
+		return;
+	}
+
+	mFlushScheduled = true;
+}
+
+void AttributeReportCoalescer::FlushTimerCallback(System::Layer *layer, void *context)
+{
+	auto *coalescer = reinterpret_cast<AttributeReportCoalescer *>(context);
+
+	coalescer->mFlushScheduled = false;
+	coalescer->Flush();
+}
+
+} /* namespace Nrf */
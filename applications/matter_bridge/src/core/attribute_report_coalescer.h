@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <app/util/attribute-storage.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace Nrf
+{
+
+/*
+   AttributeReportCoalescer collects attribute changes of the bridged devices in a set of dirty
+   (endpoint, cluster, attribute) paths and marks them as changed for the Matter reporting engine in batches
+   on the Matter thread. The first change after a quiet period is flushed right away, while the following
+   changes are flushed no more often than once per CONFIG_BRIDGE_REPORT_MIN_INTERVAL_MS, so N rapid updates of
+   the same attribute result in a single report. Measured values changed by less than the configured delta
+   since the last report are not reported at all.
+   All methods must be called from the Matter thread.
+*/
+class AttributeReportCoalescer {
+public:
+	struct Statistics {
+		uint32_t mUpdates;
+		uint32_t mReports;
+		uint32_t mCoalesced;
+		uint32_t mSuppressedByDelta;
+	};
+
+	/**
+	 * @brief Mark the attribute as changed.
+	 *
+	 * @param endpointId endpoint of the bridged device
+	 * @param clusterId cluster of the changed attribute
+	 * @param attributeId changed attribute
+	 * @param data new value of the attribute, as passed by the data provider
+	 * @param dataSize size of the new value
+	 */
+	void MarkDirty(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId,
+		       const void *data, size_t dataSize);
+
+	/**
+	 * @brief Drop all pending changes and stored values of the specified endpoint.
+	 *
+	 * @param endpointId endpoint of the removed bridged device
+	 */
+	void RemoveEndpoint(chip::EndpointId endpointId);
+
+	/**
+	 * @brief Mark all pending changes for the Matter reporting engine immediately.
+	 */
+	void Flush();
+
+	const Statistics &GetStatistics() const { return mStatistics; }
+	void ResetStatistics() { mStatistics = {}; }
+
+	static AttributeReportCoalescer &Instance()
+	{
+		static AttributeReportCoalescer sInstance;
+		return sInstance;
+	}
+
+private:
+	static constexpr size_t kMaxTrackedAttributes = CONFIG_BRIDGE_REPORT_MAX_TRACKED_ATTRIBUTES;
+	static constexpr uint32_t kMinIntervalMs = CONFIG_BRIDGE_REPORT_MIN_INTERVAL_MS;
+
+	struct TrackedAttribute {
+		chip::EndpointId mEndpointId{ chip::kInvalidEndpointId };
+		chip::ClusterId mClusterId{ chip::kInvalidClusterId };
+		chip::AttributeId mAttributeId{ chip::kInvalidAttributeId };
+		int32_t mReportedValue{ 0 };
+		bool mHasReportedValue{ false };
+		bool mDirty{ false };
+	};
+
+	TrackedAttribute *FindOrAdd(chip::EndpointId endpointId, chip::ClusterId clusterId,
+				    chip::AttributeId attributeId);
+	bool IsBelowDelta(TrackedAttribute &attribute, const void *data, size_t dataSize, int32_t &value);
+	void ScheduleFlush();
+	static void FlushTimerCallback(chip::System::Layer *layer, void *context);
+
+	TrackedAttribute mAttributes[kMaxTrackedAttributes];
+	chip::System::Clock::Timestamp mLastFlush{ 0 };
+	bool mFlushScheduled{ false };
+	Statistics mStatistics{};
+};
+
+} /* namespace Nrf */
@@ -7,6 +7,10 @@
 #include "bridge_manager.h"
 #include "bridge_storage_manager.h"
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+#include "attribute_report_coalescer.h"
+#endif
+
 #include "binding/binding_handler.h"
 
 #include <app-common/zap-generated/ids/Clusters.h>
@@ -120,60 +124,57 @@ CHIP_ERROR BridgeManager::DoAddBridgedDevices(MatterBridgedDevice *devices[], Br
 
 CHIP_ERROR BridgeManager::RemoveBridgedDevice(uint16_t endpoint, uint8_t &devicesPairIndex)
 {
-	uint8_t index = 0;
-
 	DeviceLayer::StackLock lock;
 
-	while (index < kMaxBridgedDevices) {
-		if (mDevicesMap.Contains(index)) {
-			auto &devicePair = mDevicesMap[index];
-			if (devicePair.mDevice->GetEndpointId() == endpoint) {
-				LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
-				/* Free dynamically allocated memory */
-				emberAfClearDynamicEndpoint(index);
-				devicesPairIndex = index;
-				return SafelyRemoveDevice(index);
-			}
-		}
-		index++;
+	/* The dynamic endpoint index is the key of the devices table, so no lookup is needed. */
+	uint16_t index = emberAfGetDynamicIndexFromEndpoint(endpoint);
+	BridgedDevicePair *devicePair = mIndex.GetDevicePair(index);
+
+	if (!devicePair || !devicePair->mDevice || devicePair->mDevice->GetEndpointId() != endpoint) {
+		return CHIP_ERROR_NOT_FOUND;
 	}
-	return CHIP_ERROR_NOT_FOUND;
+
+	LOG_INF("Removed dynamic endpoint %d (index=%d)", endpoint, index);
+	/* Free dynamically allocated memory */
+	emberAfClearDynamicEndpoint(index);
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+	AttributeReportCoalescer::Instance().RemoveEndpoint(endpoint);
+#endif
+	devicesPairIndex = static_cast<uint8_t>(index);
+	return SafelyRemoveDevice(static_cast<uint8_t>(index));
 }
 
-CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
+void BridgeManager::StartBulkUpdate()
 {
-	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
-	bool removeProvider = true;
-	auto &devicePair = mDevicesMap[index];
-
-	uint8_t duplicatesNumber = mDevicesMap.GetDuplicatesCount(devicePair, duplicatedItemKeys);
-	/* There must be at least 2 duplicates in the map to determine the real duplicate,
-       as the one under the current index is also contained in the map. */
-	bool realDuplicatePresent = duplicatesNumber >= 2;
-
-	if (realDuplicatePresent) {
-		for (uint8_t i = 0; i < duplicatesNumber; i++) {
-			/* We must consider only true duplicates, so skip the current index, as
-			 * it would lead to comparing the same values each time. */
-			if (duplicatedItemKeys[i] != index) {
-				auto &duplicate = mDevicesMap[duplicatedItemKeys[i]];
-				if (duplicate.mDevice == devicePair.mDevice) {
-					devicePair.mDevice = nullptr;
-				}
-				if (duplicate.mProvider == devicePair.mProvider) {
-					devicePair.mProvider = nullptr;
-					removeProvider = false;
-				}
-				/* At least one real duplicate found. */
-				break;
-			}
-		}
-	}
-	if (mDevicesMap.Erase(index)) {
-		if (removeProvider) {
-			mNumberOfProviders--;
-		}
+	/* The reporting engine runs on the Matter thread only once the stack is released, so the PartsList attribute
+	 * marked as changed by every added or removed endpoint is reported once, after all endpoints are in place. */
+	Nrf::BridgeStorageManager::Instance().StartTransaction();
+	mBulkUpdateDepth++;
+}
+
+CHIP_ERROR BridgeManager::FinishBulkUpdate()
+{
+	VerifyOrReturnError(mBulkUpdateDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+	mBulkUpdateDepth--;
+	const bool stored = Nrf::BridgeStorageManager::Instance().CommitTransaction();
+
+	VerifyOrReturnError(stored, CHIP_ERROR_INTERNAL, LOG_ERR("Failed to store bridged devices"));
 
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BridgeManager::RegisterProvider(BridgedDeviceDataProvider *dataProvider)
+{
+	VerifyOrReturnError(mIndex.RegisterProvider(dataProvider), CHIP_ERROR_NO_MEMORY,
+			    LOG_ERR("Maximum number of providers exceeded"));
+
+	return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BridgeManager::SafelyRemoveDevice(uint8_t index)
+{
+	if (mIndex.EraseDevicePair(index)) {
 		/* Find the required index on the list, remove it and move all following indexes one position earlier.
 		 */
 		bool indexFound = false;
@@ -205,16 +206,13 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 {
 	uint8_t index{ 0 };
 	CHIP_ERROR err;
-	uint16_t duplicatedItemKeys[kMaxBridgedDevices];
 	BridgedDevicePair pair(device, dataProvider);
 
-	/* Check if the current provider is already contained in the map - if so, there is at least one duplicate */
-	bool isNewProvider = (Instance().mDevicesMap.GetDuplicatesCount(pair, duplicatedItemKeys) == 0);
+	/* Check if the current provider is already bound with other bridged devices. */
+	bool isNewProvider = (mIndex.GetProviderEntry(*dataProvider) == nullptr);
 
 	if (isNewProvider) {
-		VerifyOrReturnError(mNumberOfProviders + 1 <= kMaxDataProviders, CHIP_ERROR_NO_MEMORY,
-				    LOG_ERR("Maximum number of providers exceeded"));
-		mNumberOfProviders++;
+		ReturnErrorOnFailure(RegisterProvider(dataProvider));
 		dataProvider->Init();
 	}
 
@@ -226,11 +224,8 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 	if (devicesPairIndex.HasValue()) {
 		index = devicesPairIndex.Value();
 		/* The requested index is already used. */
-		if (mDevicesMap.Contains(index)) {
-			return CHIP_ERROR_INTERNAL;
-		}
-
-		if (!mDevicesMap.Insert(index, std::move(pair))) {
+		if (mIndex.GetDevicePair(index) || !mIndex.InsertDevicePair(index, std::move(pair))) {
+			mIndex.ReleaseUnboundProvider(pair);
 			return CHIP_ERROR_INTERNAL;
 		}
 
@@ -250,15 +245,15 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 			if (err == CHIP_ERROR_NO_MEMORY) {
 				LOG_ERR("The device object was not constructed properly due to the lack of memory");
 			}
-			mDevicesMap.Erase(index);
+			mIndex.EraseDevicePair(index);
 		}
 
 		return err;
 	} else {
 		while (index < kMaxBridgedDevices) {
 			/* Find the first empty index in the bridged devices list */
-			if (!mDevicesMap.Contains(index)) {
-				if (mDevicesMap.Insert(index, std::move(pair))) {
+			if (!mIndex.GetDevicePair(index)) {
+				if (mIndex.InsertDevicePair(index, std::move(pair))) {
 					/* Assign the free endpoint ID. */
 					do {
 						err = CreateEndpoint(index, mCurrentDynamicEndpointId);
@@ -269,7 +264,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 							}
 							/* The pair was added to a map, so we have to take care about
 							 * removing it in case of failure. */
-							mDevicesMap.Erase(index);
+							mIndex.EraseDevicePair(index);
 						}
 
 						/* Handle wrap condition */
@@ -288,6 +283,7 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 				} else {
 					/* Failing Insert method means the BridgedDevicePair destructor will be called
 					 * and pointers wiped out. It's not safe to iterate further. */
+					mIndex.ReleaseUnboundProvider(pair);
 					return CHIP_ERROR_INTERNAL;
 				}
 			}
@@ -296,17 +292,20 @@ CHIP_ERROR BridgeManager::AddSingleDevice(MatterBridgedDevice *device, BridgedDe
 	}
 
 	LOG_ERR("Failed to add dynamic endpoint: No endpoints or indexes available!");
+	mIndex.ReleaseUnboundProvider(pair);
 	return CHIP_ERROR_NO_MEMORY;
 }
 
 CHIP_ERROR BridgeManager::CreateEndpoint(uint8_t index, uint16_t endpointId)
 {
-	if (!mDevicesMap.Contains(index)) {
+	BridgedDevicePair *devicePair = mIndex.GetDevicePair(index);
+
+	if (!devicePair) {
 		LOG_ERR("Cannot retrieve bridged device from index %d", index);
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	auto *storedDevice = mDevicesMap[index].mDevice;
+	auto *storedDevice = devicePair->mDevice;
 
 	/* Make sure that data that is going to be wrapped in the Span objects is valid,
 	   otherwise, the Span may make the application abort(). */
@@ -348,10 +347,10 @@ CHIP_ERROR BridgeManager::AddDevices(MatterBridgedDevice *devices[], BridgedDevi
 	VerifyOrExit(devices, err = CHIP_ERROR_INVALID_ARGUMENT);
 	VerifyOrExit(dataProvider, err = CHIP_ERROR_INVALID_ARGUMENT);
 
-	/* Maximum number of Matter bridged devices is controlled inside mDevicesMap,
+	/* Maximum number of Matter bridged devices is controlled by the size of the devices table,
 	   but the data providers may be created independently, so let's ensure we do not
 	   violate the maximum number of supported instances. */
-	VerifyOrExit(mDevicesMap.FreeSlots() >= deviceListSize, err = CHIP_ERROR_NO_MEMORY);
+	VerifyOrExit(kMaxBridgedDevices - mDevicesIndexesCounter >= deviceListSize, err = CHIP_ERROR_NO_MEMORY);
 
 	for (auto i = 0; i < deviceListSize; ++i) {
 		err = AddSingleDevice(devices[i], dataProvider, devicesPairIndexes[i], endpointIds[i]);
@@ -381,9 +380,11 @@ CHIP_ERROR BridgeManager::HandleRead(uint16_t index, ClusterId clusterId,
 				     uint16_t maxReadLength)
 {
 	VerifyOrReturnError(attributeMetadata && buffer, CHIP_ERROR_INVALID_ARGUMENT);
-	VerifyOrReturnValue(Instance().mDevicesMap.Contains(index), CHIP_ERROR_INTERNAL);
 
-	auto *device = Instance().mDevicesMap[index].mDevice;
+	BridgedDevicePair *devicePair = Instance().mIndex.GetDevicePair(index);
+	VerifyOrReturnValue(devicePair && devicePair->mDevice, CHIP_ERROR_INTERNAL);
+
+	auto *device = devicePair->mDevice;
 
 	/* Handle reads for the generic information for all bridged devices. Provide a valid answer even if device state
 	 * is unreachable. */
@@ -407,9 +408,11 @@ CHIP_ERROR BridgeManager::HandleWrite(uint16_t index, ClusterId clusterId,
 				      const EmberAfAttributeMetadata *attributeMetadata, uint8_t *buffer)
 {
 	VerifyOrReturnError(attributeMetadata && buffer, CHIP_ERROR_INVALID_ARGUMENT);
-	VerifyOrReturnValue(Instance().mDevicesMap.Contains(index), CHIP_ERROR_INTERNAL);
 
-	auto *device = Instance().mDevicesMap[index].mDevice;
+	BridgedDevicePair *devicePair = Instance().mIndex.GetDevicePair(index);
+	VerifyOrReturnValue(devicePair && devicePair->mDevice && devicePair->mProvider, CHIP_ERROR_INTERNAL);
+
+	auto *device = devicePair->mDevice;
 
 	/* Verify if the device is reachable or we should return prematurely. */
 	VerifyOrReturnError(device->GetIsReachable(), CHIP_ERROR_INCORRECT_STATE);
@@ -447,7 +450,7 @@ CHIP_ERROR BridgeManager::HandleWrite(uint16_t index, ClusterId clusterId,
 
 	/* After updating MatterBridgedDevice state, forward request to the non-Matter device. */
 	if (err == CHIP_NO_ERROR) {
-		CHIP_ERROR updateError = Instance().mDevicesMap[index].mProvider->UpdateState(
+		CHIP_ERROR updateError = devicePair->mProvider->UpdateState(
 			clusterId, attributeMetadata->attributeId, buffer);
 		/* This is acceptable that not all writable attributes can be reflected in the provider device. */
 		if (updateError != CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE) {
@@ -462,16 +465,22 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 {
 	VerifyOrReturn(data);
 
-	/* The state update was triggered by non-Matter device, find bridged Matter device to update it as well.
+	/* The state update was triggered by non-Matter device, find bridged Matter devices to update them as well
+	 * using the provider's reverse index.
 	 */
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			/* If the Bridged Device state was updated successfully, schedule sending Matter data
-			 * report. */
-			auto *device = item.value.mDevice;
-			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
-				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
-			}
+	DeviceIndex::ProviderEntry *entry = Instance().mIndex.GetProviderEntry(dataProvider);
+	VerifyOrReturn(entry);
+
+	for (uint8_t i = 0; i < entry->mDevicesCount; i++) {
+		auto *device = Instance().mIndex.At(entry->mDeviceIndexes[i]).mDevice;
+		/* If the Bridged Device state was updated successfully, schedule sending Matter data report. */
+		if (device && CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+			AttributeReportCoalescer::Instance().MarkDirty(device->GetEndpointId(), clusterId, attributeId,
+								       data, dataSize);
+#else
+			MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
+#endif
 		}
 	}
 }
@@ -490,11 +499,13 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 	bindingData->ClusterId = clusterId;
 	bindingData->InvokeCommandFunc = invokeCommand;
 
-	for (auto &item : Instance().mDevicesMap.mMap) {
-		if (item.value.mProvider == &dataProvider) {
-			auto *device = item.value.mDevice;
+	DeviceIndex::ProviderEntry *entry = Instance().mIndex.GetProviderEntry(dataProvider);
 
-			if (emberAfContainsClient(device->GetEndpointId(), clusterId)) {
+	if (entry) {
+		for (uint8_t i = 0; i < entry->mDevicesCount; i++) {
+			auto *device = Instance().mIndex.At(entry->mDeviceIndexes[i]).mDevice;
+
+			if (device && emberAfContainsClient(device->GetEndpointId(), clusterId)) {
 				bindingData->EndpointId = device->GetEndpointId();
 			}
 		}
@@ -505,25 +516,19 @@ void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, Clust
 
 BridgedDeviceDataProvider *BridgeManager::GetProvider(EndpointId endpoint, uint16_t &deviceType)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
-	if (Instance().mDevicesMap.Contains(endpointIndex)) {
-		BridgedDevicePair &bridgedDevices = Instance().mDevicesMap[endpointIndex];
-		if (bridgedDevices.mDevice) {
-			deviceType = bridgedDevices.mDevice->GetDeviceType();
-			return bridgedDevices.mProvider;
-		}
+	BridgedDevicePair *bridgedDevices = Instance().mIndex.GetDevicePair(emberAfGetDynamicIndexFromEndpoint(endpoint));
+	if (bridgedDevices && bridgedDevices->mDevice) {
+		deviceType = bridgedDevices->mDevice->GetDeviceType();
+		return bridgedDevices->mProvider;
 	}
 	return nullptr;
 }
 
 const char *BridgeManager::GetNodeLabel(EndpointId endpoint)
 {
-	uint16_t endpointIndex = emberAfGetDynamicIndexFromEndpoint(endpoint);
-	if (Instance().mDevicesMap.Contains(endpointIndex)) {
-		BridgedDevicePair &bridgedDevices = Instance().mDevicesMap[endpointIndex];
-		if (bridgedDevices.mDevice) {
-			return bridgedDevices.mDevice->GetNodeLabel();
-		}
+	BridgedDevicePair *bridgedDevices = Instance().mIndex.GetDevicePair(emberAfGetDynamicIndexFromEndpoint(endpoint));
+	if (bridgedDevices && bridgedDevices->mDevice) {
+		return bridgedDevices->mDevice->GetNodeLabel();
 	}
 	return nullptr;
 }
@@ -8,8 +8,8 @@
 
 #include "binding/binding_handler.h"
 #include "bridge_util.h"
-#include "util/finite_map.h"
 #include "bridged_device_data_provider.h"
+#include "bridged_device_index.h"
 #include "matter_bridged_device.h"
 
 namespace Nrf
@@ -76,6 +76,27 @@ public:
 	 */
 	CHIP_ERROR RemoveBridgedDevice(uint16_t endpoint, uint8_t &devicesPairIndex);
 
+	/**
+	 * @brief Start a bulk update of the bridged devices. The list of the bridged devices is written to the storage
+	 * only once, when the matching FinishBulkUpdate() is called. Bulk updates can be nested.
+	 *
+	 * The function does not lock the Matter stack. It must be called from the Matter thread or with the Matter
+	 * stack locked, and the stack must not be released until FinishBulkUpdate() is called, so all dynamic endpoints
+	 * added or removed in the meantime are reported with a single change of the PartsList attribute. Prepare the
+	 * devices before starting the update to keep the stack locked as briefly as possible.
+	 */
+	void StartBulkUpdate();
+
+	/**
+	 * @brief Finish the bulk update started using StartBulkUpdate(). Once the outermost bulk update is finished,
+	 * the list of the bridged devices is written to the storage.
+	 *
+	 * @return CHIP_NO_ERROR on success
+	 * @return CHIP_ERROR_INCORRECT_STATE if there is no bulk update in progress
+	 * @return other error code if the bridged devices could not be stored
+	 */
+	CHIP_ERROR FinishBulkUpdate();
+
 	/**
 	 * @brief Get bridged devices indexes.
 	 *
@@ -186,7 +207,20 @@ private:
 
 	static constexpr uint8_t kMaxDataProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
 
-	using DeviceMap = FiniteMap<uint16_t, BridgedDevicePair, kMaxBridgedDevices>;
+	static_assert(kMaxDataProviders < BridgedDeviceDataProvider::kInvalidBridgeSlot,
+		      "The number of data providers must fit in the provider slot type");
+
+	using DeviceIndex = BridgedDeviceIndex<BridgedDevicePair, BridgedDeviceDataProvider, kMaxBridgedDevices,
+					       kMaxDataProviders, kMaxBridgedDevicesPerProvider>;
+
+	/**
+	 * @brief Assign a reverse index entry to the data provider.
+	 *
+	 * @param dataProvider data provider object
+	 * @return CHIP_NO_ERROR on success
+	 * @return CHIP_ERROR_NO_MEMORY if the maximum number of providers was exceeded
+	 */
+	CHIP_ERROR RegisterProvider(BridgedDeviceDataProvider *dataProvider);
 
 	/**
 	 * @brief Add pair of single bridged device and its data provider using optional index and endpoint id.
@@ -256,13 +290,14 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
-	DeviceMap mDevicesMap;
-	uint16_t mNumberOfProviders{ 0 };
+	/* Bridged devices indexed by the dynamic endpoint index and by the slot stored in the data provider. */
+	DeviceIndex mIndex;
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
 	uint8_t mDevicesIndexesCounter;
 
 	chip::EndpointId mFirstDynamicEndpointId;
 	chip::EndpointId mCurrentDynamicEndpointId;
+	uint8_t mBulkUpdateDepth{ 0 };
 	bool mIsInitialized = false;
 };
 
@@ -5,10 +5,18 @@
  */
 
 #include "bridge_storage_manager.h"
-#include "bridge_manager.h"
+
+#if defined(CONFIG_BRIDGE_MIGRATE_PRE_2_7_0) || defined(CONFIG_BRIDGE_MIGRATE_VERSION_1)
 #include "platform/ConfigurationManager.h"
+#endif
 
 #include <zephyr/logging/log.h>
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+#include <zephyr/sys/byteorder.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
 
 LOG_MODULE_DECLARE(app, CONFIG_CHIP_APP_LOG_LEVEL);
 
@@ -31,6 +39,238 @@ Nrf::PersistentStorageNode CreateIndexNode(uint8_t bridgedDeviceIndex, Nrf::Pers
 	return Nrf::PersistentStorageNode(index, strnlen(index,sizeof(index)), parent);
 }
 
+/* Serializes the bridged device into the packed record. Returns the record size or 0 if the device does not fit. */
+size_t EncodeRecord(const Nrf::BridgeStorageManager::BridgedDevice &device, uint8_t *record)
+{
+	uint8_t userDataSize = 0;
+	size_t counter = 0;
+
+	if (device.mUniqueIDLength > Nrf::MatterBridgedDevice::kUniqueIDSize ||
+	    device.mNodeLabelLength > Nrf::MatterBridgedDevice::kNodeLabelSize) {
+		return 0;
+	}
+
+	/* Check if there are any user data to save. mUserData can be nullptr if not needed. */
+	if (device.mUserData && device.mUserDataSize > 0) {
+		if (device.mUserDataSize > Nrf::BridgeStorageManager::kMaxRecordUserDataSize) {
+			return 0;
+		}
+		userDataSize = static_cast<uint8_t>(device.mUserDataSize);
+	}
+
+	const uint8_t uniqueIDLength = static_cast<uint8_t>(device.mUniqueIDLength);
+	const uint8_t nodeLabelLength = static_cast<uint8_t>(device.mNodeLabelLength);
+
+	memcpy(record + counter, &device.mEndpointId, sizeof(device.mEndpointId));
+	counter += sizeof(device.mEndpointId);
+	memcpy(record + counter, &device.mDeviceType, sizeof(device.mDeviceType));
+	counter += sizeof(device.mDeviceType);
+	record[counter++] = uniqueIDLength;
+	memcpy(record + counter, device.mUniqueID, uniqueIDLength);
+	counter += uniqueIDLength;
+	record[counter++] = nodeLabelLength;
+	memcpy(record + counter, device.mNodeLabel, nodeLabelLength);
+	counter += nodeLabelLength;
+	record[counter++] = userDataSize;
+	memcpy(record + counter, device.mUserData, userDataSize);
+	counter += userDataSize;
+
+	return counter;
+}
+
+/* Deserializes the packed record into the bridged device object. */
+bool DecodeRecord(const uint8_t *record, size_t recordSize, Nrf::BridgeStorageManager::BridgedDevice &device)
+{
+	size_t counter = 0;
+	uint8_t length;
+
+	/* Validate that the record is big enough to include the fixed size fields and the unique id length. */
+	if (recordSize < sizeof(device.mEndpointId) + sizeof(device.mDeviceType) + sizeof(length)) {
+		return false;
+	}
+
+	memcpy(&device.mEndpointId, record + counter, sizeof(device.mEndpointId));
+	counter += sizeof(device.mEndpointId);
+	memcpy(&device.mDeviceType, record + counter, sizeof(device.mDeviceType));
+	counter += sizeof(device.mDeviceType);
+
+	length = record[counter++];
+	if (length > sizeof(device.mUniqueID) || recordSize < counter + length + sizeof(length)) {
+		return false;
+	}
+	device.mUniqueIDLength = length;
+	memcpy(device.mUniqueID, record + counter, length);
+	counter += length;
+
+	length = record[counter++];
+	if (length > sizeof(device.mNodeLabel) || recordSize < counter + length + sizeof(length)) {
+		return false;
+	}
+	device.mNodeLabelLength = length;
+	memcpy(device.mNodeLabel, record + counter, length);
+	counter += length;
+
+	length = record[counter++];
+	if (recordSize < counter + length) {
+		return false;
+	}
+
+	/* Check if user prepared a buffer for reading user data. It can be nullptr if not needed. */
+	if (!device.mUserData) {
+		device.mUserDataSize = 0;
+		return true;
+	}
+
+	/* Validate that user data size value read from the storage is not bigger than the one expected by the user. */
+	if (device.mUserDataSize < length) {
+		return false;
+	}
+
+	device.mUserDataSize = length;
+	memcpy(device.mUserData, record + counter, length);
+
+	return true;
+}
+
+/* Values of the bridge keys collected during a single pass over the bridge subtree. */
+struct BridgeKeys {
+	uint8_t *mList;
+	size_t mListMaxCount;
+	size_t mListCount;
+	uint8_t *mRecords;
+	size_t mRecordsMaxSize;
+	size_t mRecordsSize;
+	uint8_t *mIndexes;
+	size_t mIndexesMaxCount;
+	size_t mIndexesCount;
+	uint8_t mVersion;
+	uint8_t mCount;
+	bool mLoadError;
+	bool mVersionPresent;
+	bool mCountPresent;
+	bool mIndexesPresent;
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	void *mGattCache;
+	size_t mGattCacheMaxSize;
+	size_t mGattCacheSize;
+#endif
+};
+
+/* Reads the value only if it fits in the destination. Reading exactly the expected size is required if requested. */
+bool ReadValue(size_t dataSize, Nrf::PSReadFunction read, void *readContext, void *destination, size_t maxSize,
+	       bool exactSize, size_t &readSize)
+{
+	if (dataSize > maxSize || (exactSize && dataSize != maxSize)) {
+		return false;
+	}
+
+	const ssize_t result = read(readContext, destination, dataSize);
+
+	if (result != static_cast<ssize_t>(dataSize)) {
+		return false;
+	}
+
+	readSize = dataSize;
+	return true;
+}
+
+/* Returns the index part of the key name of a bridged device record, or nullptr for the other keys. */
+const char *RecordIndexName(const char *name)
+{
+	const size_t prefixLength = strlen(Nrf::BridgeStorageManager::kBridgedDeviceRecordPrefix);
+
+	if (strncmp(name, Nrf::BridgeStorageManager::kBridgedDeviceRecordPrefix, prefixLength) != 0 ||
+	    name[prefixLength] != '/') {
+		return nullptr;
+	}
+
+	return name + prefixLength + 1;
+}
+
+void DropLoadedRecord(BridgeKeys &keys, unsigned long index)
+{
+	for (size_t offset = 0; offset < keys.mRecordsSize;
+	     offset += Nrf::BridgeStorageManager::kRecordHeaderSize + keys.mRecords[offset + 1]) {
+		if (keys.mRecords[offset] == index) {
+			const size_t end = offset + Nrf::BridgeStorageManager::kRecordHeaderSize + keys.mRecords[offset + 1];
+
+			memmove(keys.mRecords + offset, keys.mRecords + end, keys.mRecordsSize - end);
+			keys.mRecordsSize -= end - offset;
+			return;
+		}
+	}
+}
+
+bool LoadBridgeKey(const char *name, size_t dataSize, Nrf::PSReadFunction read, void *readContext, void *context)
+{
+	BridgeKeys &keys = *static_cast<BridgeKeys *>(context);
+	size_t readSize = 0;
+
+	if (strcmp(name, Nrf::BridgeStorageManager::kVersionPrefix) == 0) {
+		keys.mVersionPresent =
+			ReadValue(dataSize, read, readContext, &keys.mVersion, sizeof(keys.mVersion), true, readSize);
+	} else if (strcmp(name, Nrf::BridgeStorageManager::kBridgedDevicesListPrefix) == 0) {
+		if (!ReadValue(dataSize, read, readContext, keys.mList, keys.mListMaxCount, false, readSize)) {
+			LOG_ERR("Cannot load the list of %zu bridged devices", dataSize);
+			keys.mLoadError = true;
+		}
+		keys.mListCount = readSize;
+	} else if (const char *indexName = RecordIndexName(name)) {
+		char *end = nullptr;
+		const unsigned long index = strtoul(indexName, &end, 10);
+
+		/* Backends that append the values can report an older value of the record first, keep the last one. */
+		DropLoadedRecord(keys, index);
+
+		uint8_t *header = keys.mRecords + keys.mRecordsSize;
+		const size_t freeSize = keys.mRecordsMaxSize - keys.mRecordsSize;
+
+		if (end == indexName || *end != '\0' || index > UINT8_MAX ||
+		    freeSize < Nrf::BridgeStorageManager::kRecordHeaderSize ||
+		    !ReadValue(dataSize, read, readContext, header + Nrf::BridgeStorageManager::kRecordHeaderSize,
+			       std::min(freeSize - Nrf::BridgeStorageManager::kRecordHeaderSize,
+					Nrf::BridgeStorageManager::kMaxRecordSize),
+			       false, readSize)) {
+			LOG_ERR("Cannot load bridged device record %s of size %zu", indexName, dataSize);
+			keys.mLoadError = true;
+		} else {
+			header[0] = static_cast<uint8_t>(index);
+			header[1] = static_cast<uint8_t>(readSize);
+			keys.mRecordsSize += Nrf::BridgeStorageManager::kRecordHeaderSize + readSize;
+		}
+	} else if (strcmp(name, Nrf::BridgeStorageManager::kBridgedDevicesCountPrefix) == 0) {
+		keys.mCountPresent =
+			ReadValue(dataSize, read, readContext, &keys.mCount, sizeof(keys.mCount), true, readSize);
+	} else if (strcmp(name, Nrf::BridgeStorageManager::kBridgedDevicesIndexesPrefix) == 0) {
+		keys.mIndexesPresent =
+			ReadValue(dataSize, read, readContext, keys.mIndexes, keys.mIndexesMaxCount, false, readSize);
+		keys.mIndexesCount = readSize;
+	}
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	else if (strcmp(name, Nrf::BridgeStorageManager::kGattCachePrefix) == 0) {
+		if (!ReadValue(dataSize, read, readContext, keys.mGattCache, keys.mGattCacheMaxSize, false, readSize)) {
+			LOG_ERR("Cannot load GATT cache of size %zu", dataSize);
+		}
+		keys.mGattCacheSize = readSize;
+	}
+#endif
+
+	/* The remaining keys are bridged devices stored using the legacy schemes, they are loaded only if migrated. */
+	return true;
+}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+/* Compares only the used handles, so the unused part of the entry does not affect the result. */
+bool GattCacheEntriesEqual(const Nrf::BridgeStorageManager::GattCacheEntry &first,
+			   const Nrf::BridgeStorageManager::GattCacheEntry &second)
+{
+	return bt_addr_le_eq(&first.mAddr, &second.mAddr) &&
+	       memcmp(first.mDatabaseHash, second.mDatabaseHash, sizeof(first.mDatabaseHash)) == 0 &&
+	       first.mHandlesCount == second.mHandlesCount &&
+	       memcmp(first.mHandles, second.mHandles, first.mHandlesCount * sizeof(first.mHandles[0])) == 0;
+}
+#endif
+
 } /* namespace */
 
 namespace Nrf
@@ -104,7 +344,7 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV1 &device
 }
 #endif
 
-template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device, uint8_t index)
+bool BridgeStorageManager::LoadBridgedDeviceVersion2(BridgedDeviceV2 &device, uint8_t index)
 {
 	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
 	size_t readSize = 0;
@@ -186,6 +426,100 @@ template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device
 	return true;
 }
 
+template <> bool BridgeStorageManager::LoadBridgedDevice(BridgedDeviceV2 &device, uint8_t index)
+{
+	size_t offset = FindRecord(index);
+
+	if (offset == kRecordNotFound) {
+		return false;
+	}
+
+	return DecodeRecord(mRecords + offset + kRecordHeaderSize, mRecords[offset + 1], device);
+}
+
+size_t BridgeStorageManager::FindRecord(uint8_t index)
+{
+	for (size_t offset = 0; offset < mRecordsSize; offset += kRecordHeaderSize + mRecords[offset + 1]) {
+		if (mRecords[offset] == index) {
+			return offset;
+		}
+	}
+
+	return kRecordNotFound;
+}
+
+void BridgeStorageManager::RemoveCachedRecord(size_t offset)
+{
+	const size_t end = offset + kRecordHeaderSize + mRecords[offset + 1];
+
+	memmove(mRecords + offset, mRecords + end, mRecordsSize - end);
+	mRecordsSize -= end - offset;
+}
+
+void BridgeStorageManager::ValidateLoadedRecords()
+{
+	for (uint8_t i = 0; i < mListCount;) {
+		if (FindRecord(mList[i]) != kRecordNotFound) {
+			i++;
+			continue;
+		}
+
+		LOG_ERR("Bridged device %u has no record, dropping it", mList[i]);
+		memmove(&mList[i], &mList[i + 1], mListCount - i - 1);
+		mListCount--;
+		mListDirty = true;
+	}
+
+	for (size_t offset = 0; offset < mRecordsSize;) {
+		const uint8_t index = mRecords[offset];
+
+		if (memchr(mList, index, mListCount)) {
+			offset += kRecordHeaderSize + mRecords[offset + 1];
+			continue;
+		}
+
+		/* The device was not added to the list, or was removed from it, before the operation was interrupted. */
+		Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDeviceRecord);
+
+		Nrf::GetPersistentStorage().NonSecureRemove(&id);
+		RemoveCachedRecord(offset);
+	}
+
+	if (!WriteList()) {
+		LOG_ERR("Cannot write the list of bridged devices");
+	}
+}
+
+bool BridgeStorageManager::WriteList()
+{
+	if (mTransactionDepth > 0 || !mListDirty) {
+		return true;
+	}
+
+	if (mListCount == 0) {
+		/* The list may have never been stored, for example if the devices were added and removed within a single
+		 * transaction, so a missing key is not an error. */
+		Nrf::GetPersistentStorage().NonSecureRemove(&mBridgedDevicesList);
+	} else if (Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesList, mList, mListCount) !=
+		   PSErrorCode::Success) {
+		return false;
+	}
+
+	mListDirty = false;
+	return true;
+}
+
+bool BridgeStorageManager::CommitTransaction()
+{
+	if (mTransactionDepth == 0) {
+		return false;
+	}
+
+	mTransactionDepth--;
+
+	return WriteList();
+}
+
 bool BridgeStorageManager::Init()
 {
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureInit(&mBridge);
@@ -201,6 +535,14 @@ bool BridgeStorageManager::Init()
 void BridgeStorageManager::FactoryReset()
 {
 	Nrf::GetPersistentStorage().NonSecureFactoryReset();
+
+	mListCount = 0;
+	mListDirty = false;
+	mRecordsSize = 0;
+	mTransactionDepth = 0;
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	mGattCacheCount = 0;
+#endif
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -310,93 +652,183 @@ bool BridgeStorageManager::MigrateData()
 	 * 1) If the version key is missing - it means that the pre-2.7.0 release structure is used.
 	 * 2) If the version key is present but the version number does not match kCurrentVersion.
 	 */
-	uint8_t version;
-	const bool versionPresent = LoadDataToObject(&mVersion, version);
+	uint8_t indexes[CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT] = { 0 };
+	BridgeKeys keys{};
+
+	keys.mList = mList;
+	keys.mListMaxCount = sizeof(mList);
+	keys.mRecords = mRecords;
+	keys.mRecordsMaxSize = sizeof(mRecords);
+	keys.mIndexes = indexes;
+	keys.mIndexesMaxCount = sizeof(indexes);
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	keys.mGattCache = mGattCacheRecord;
+	keys.mGattCacheMaxSize = sizeof(mGattCacheRecord);
+#endif
+
+	/* Load the version, the records and the legacy keys using a single pass over the bridge subtree, instead of
+	 * scanning the storage once for every key. */
+	if (Nrf::GetPersistentStorage().NonSecureLoadSubtree(&mBridge, LoadBridgeKey, &keys) != PSErrorCode::Success) {
+		return false;
+	}
+
+	/* Treating an unreadable list or record as a missing one would lose the bridged devices, and the next store
+	 * would overwrite the list. */
+	if (keys.mLoadError) {
+		mListCount = 0;
+		mRecordsSize = 0;
+		return false;
+	}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* The cache only speeds up reconnecting, so a damaged one is dropped instead of failing the initialization. */
+	if (keys.mGattCacheSize > 0 && !ParseGattCache(mGattCacheRecord, keys.mGattCacheSize)) {
+		LOG_ERR("GATT cache is corrupted");
+	}
+#endif
+
+	uint8_t version = keys.mVersion;
+	const bool versionPresent = keys.mVersionPresent;
 	const bool migrationNeeded = !versionPresent || version != kCurrentVersion;
 
 	if (!migrationNeeded) {
-		/* No migration needed */
+		mListCount = static_cast<uint8_t>(keys.mListCount);
+		mRecordsSize = keys.mRecordsSize;
+		ValidateLoadedRecords();
+
 		return true;
 	}
 
+	/* The records are built from scratch during the migration. */
+	mListCount = 0;
+	mRecordsSize = 0;
+
 	if (versionPresent && (version < 1 || version > kCurrentVersion)) {
 		/* Not supported version */
 		return false;
 	}
 
-	uint8_t count;
-	uint8_t indexes[BridgeManager::kMaxBridgedDevices] = { 0 };
-	size_t indexesCount = 0;
+	const size_t indexesCount = keys.mIndexesCount;
+	const bool legacyDataPresent = keys.mCountPresent && keys.mIndexesPresent;
+
+	if (legacyDataPresent) {
+		/* Migrate all devices into the records and write the list once all of them are converted. */
+		bool migrated = true;
+
+		StartTransaction();
 
-	if (LoadBridgedDevicesCount(count) &&
-	    LoadBridgedDevicesIndexes(indexes, BridgeManager::kMaxBridgedDevices, indexesCount)) {
-		/* Migrate all devices */
-		for (size_t i = 0; i < indexesCount; i++) {
+		for (size_t i = 0; i < indexesCount && migrated; i++) {
 			if (!versionPresent) {
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 				if (!MigrateDataOldScheme(indexes[i])) {
-					return false;
+					migrated = false;
 				}
 #else
 				/* Migration not enabled */
 				LOG_ERR("Migration of old data scheme not enabled.");
-				return false;
+				migrated = false;
 #endif
 			} else if (version == 1) {
 #ifdef CONFIG_BRIDGE_MIGRATE_VERSION_1
 				if (!MigrateDataVersion1(indexes[i])) {
-					return false;
+					migrated = false;
 				}
 #else
 				/* Migration not enabled */
 				LOG_ERR("Migration of data scheme version 1 not enabled.");
-				return false;
+				migrated = false;
 #endif
+			} else if (version == 2) {
+				if (!MigrateDataVersion2(indexes[i])) {
+					migrated = false;
+				}
 			}
 		}
+
+		if (!migrated) {
+			/* Drop the partially migrated devices, they will be migrated again on the next boot. */
+			mTransactionDepth--;
+			mListCount = 0;
+			mListDirty = false;
+			mRecordsSize = 0;
+			return false;
+		}
+
+		if (!CommitTransaction()) {
+			return false;
+		}
 	}
 
 	/* Store current version */
 	version = kCurrentVersion;
 	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mVersion, &version, sizeof(version));
 
-	return status == PSErrorCode::Success;
-}
+	if (status != PSErrorCode::Success) {
+		return false;
+	}
 
-bool BridgeStorageManager::StoreBridgedDevicesCount(uint8_t count)
-{
-	const PSErrorCode status =
-		Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesCount, &count, sizeof(count));
+	/* Remove the old keys only once the devices and the version are stored, so the migration can be repeated if it
+	 * was interrupted. */
+	if (legacyDataPresent) {
+		RemoveLegacyKeys(indexes, indexesCount);
+	}
 
-	return status == PSErrorCode::Success;
+	return true;
 }
 
-bool BridgeStorageManager::LoadBridgedDevicesCount(uint8_t &count)
+bool BridgeStorageManager::MigrateDataVersion2(uint8_t bridgedDeviceIndex)
 {
-	return LoadDataToObject(&mBridgedDevicesCount, count);
+	BridgedDevice device;
+	uint8_t userData[kMaxUserDataSize];
+
+	device.mUserDataSize = sizeof(userData);
+	device.mUserData = userData;
+
+	if (!LoadBridgedDeviceVersion2(device, bridgedDeviceIndex)) {
+		return false;
+	}
+
+	/* Version 2 allowed more user data than the record fits. Migrate such a device without its user data, instead of
+	 * rejecting all bridged devices. */
+	if (device.mUserDataSize > kMaxRecordUserDataSize) {
+		LOG_WRN("Dropping %u B of user data of bridged device %u, increase "
+			"CONFIG_BRIDGE_STORAGE_MAX_RECORD_USER_DATA_SIZE to keep them",
+			static_cast<unsigned>(device.mUserDataSize), bridgedDeviceIndex);
+		device.mUserData = nullptr;
+		device.mUserDataSize = 0;
+	}
+
+	return StoreBridgedDevice(device, bridgedDeviceIndex);
 }
 
-bool BridgeStorageManager::StoreBridgedDevicesIndexes(uint8_t *indexes, uint8_t count)
+void BridgeStorageManager::RemoveLegacyKeys(uint8_t *indexes, size_t count)
 {
-	if (!indexes) {
-		return false;
+	for (size_t i = 0; i < count; i++) {
+		Nrf::PersistentStorageNode id = CreateIndexNode(indexes[i], &mBridgedDevice);
+		Nrf::GetPersistentStorage().NonSecureRemove(&id);
 	}
 
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&mBridgedDevicesIndexes, indexes, count);
+	Nrf::GetPersistentStorage().NonSecureRemove(&mBridgedDevicesIndexes);
+	Nrf::GetPersistentStorage().NonSecureRemove(&mBridgedDevicesCount);
+}
 
-	return status == PSErrorCode::Success;
+bool BridgeStorageManager::LoadBridgedDevicesCount(uint8_t &count)
+{
+	count = mListCount;
+
+	return count > 0;
 }
 
 bool BridgeStorageManager::LoadBridgedDevicesIndexes(uint8_t *indexes, uint8_t maxCount, size_t &count)
 {
-	if (!indexes) {
+	if (!indexes || maxCount < mListCount) {
 		return false;
 	}
 
-	const PSErrorCode status =
-		Nrf::GetPersistentStorage().NonSecureLoad(&mBridgedDevicesIndexes, indexes, maxCount, count);
+	memcpy(indexes, mList, mListCount);
+	count = mListCount;
 
-	return status == PSErrorCode::Success;
+	return true;
 }
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
@@ -450,49 +882,219 @@ bool BridgeStorageManager::RemoveBridgedDeviceType(uint8_t bridgedDeviceIndex)
 
 bool BridgeStorageManager::StoreBridgedDevice(BridgedDevice &device, uint8_t index)
 {
-	uint8_t buffer[sizeof(BridgedDevice) + kMaxUserDataSize];
-	uint16_t counter = 0;
-	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
+	uint8_t record[kMaxRecordSize];
+	const size_t recordSize = EncodeRecord(device, record);
 
-	/* Serialize data structure and insert it into buffer. */
-	memcpy(buffer, &device.mEndpointId, sizeof(device.mEndpointId));
-	counter += sizeof(device.mEndpointId);
-	memcpy(buffer + counter, &device.mDeviceType, sizeof(device.mDeviceType));
-	counter += sizeof(device.mDeviceType);
-	memcpy(buffer + counter, &device.mUniqueIDLength, sizeof(device.mUniqueIDLength));
-	counter += sizeof(device.mUniqueIDLength);
-	memcpy(buffer + counter, device.mUniqueID, device.mUniqueIDLength);
-	counter += device.mUniqueIDLength;
-	memcpy(buffer + counter, &device.mNodeLabelLength, sizeof(device.mNodeLabelLength));
-	counter += sizeof(device.mNodeLabelLength);
-	memcpy(buffer + counter, device.mNodeLabel, device.mNodeLabelLength);
-	counter += device.mNodeLabelLength;
+	if (recordSize == 0) {
+		return false;
+	}
 
-	/* Check if there are any user data to save. mUserData can be nullptr if not needed. */
-	if (device.mUserData && device.mUserDataSize > 0) {
-		if (device.mUserDataSize > kMaxUserDataSize) {
+	const size_t offset = FindRecord(index);
+
+	if (offset != kRecordNotFound && mRecords[offset + 1] == recordSize &&
+	    memcmp(mRecords + offset + kRecordHeaderSize, record, recordSize) == 0) {
+		/* The device did not change, so there is no need to write the storage. */
+		return true;
+	}
+
+	const size_t oldRecordSize = offset != kRecordNotFound ? kRecordHeaderSize + mRecords[offset + 1] : 0;
+
+	if ((offset == kRecordNotFound && mListCount >= kMaxDevicesCount) ||
+	    mRecordsSize - oldRecordSize + kRecordHeaderSize + recordSize > sizeof(mRecords)) {
+		return false;
+	}
+
+	/* Only the record of the device is written, the other devices are not affected. */
+	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDeviceRecord);
+
+	if (Nrf::GetPersistentStorage().NonSecureStore(&id, record, recordSize) != PSErrorCode::Success) {
+		return false;
+	}
+
+	if (offset != kRecordNotFound) {
+		RemoveCachedRecord(offset);
+	} else {
+		mList[mListCount++] = index;
+		mListDirty = true;
+	}
+
+	mRecords[mRecordsSize] = index;
+	mRecords[mRecordsSize + 1] = static_cast<uint8_t>(recordSize);
+	memcpy(mRecords + mRecordsSize + kRecordHeaderSize, record, recordSize);
+	mRecordsSize += kRecordHeaderSize + recordSize;
+
+	return WriteList();
+}
+
+bool BridgeStorageManager::RemoveBridgedDevice(uint8_t index)
+{
+	const size_t offset = FindRecord(index);
+
+	if (offset == kRecordNotFound) {
+		return false;
+	}
+
+	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDeviceRecord);
+
+	if (Nrf::GetPersistentStorage().NonSecureRemove(&id) != PSErrorCode::Success) {
+		return false;
+	}
+
+	RemoveCachedRecord(offset);
+
+	uint8_t *listed = static_cast<uint8_t *>(memchr(mList, index, mListCount));
+
+	if (listed) {
+		memmove(listed, listed + 1, mListCount - (listed - mList) - 1);
+		mListCount--;
+		mListDirty = true;
+	}
+
+	return WriteList();
+}
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+BridgeStorageManager::GattCacheEntry *BridgeStorageManager::FindGattCacheEntry(const bt_addr_le_t &addr)
+{
+	for (uint8_t i = 0; i < mGattCacheCount; i++) {
+		if (bt_addr_le_eq(&mGattCacheEntries[i].mAddr, &addr)) {
+			return &mGattCacheEntries[i];
+		}
+	}
+
+	return nullptr;
+}
+
+bool BridgeStorageManager::WriteGattCache()
+{
+	if (mGattCacheCount == 0) {
+		return Nrf::GetPersistentStorage().NonSecureRemove(&mGattCache) == PSErrorCode::Success;
+	}
+
+	size_t size = 0;
+
+	mGattCacheRecord[size++] = kGattCacheVersion;
+	mGattCacheRecord[size++] = mGattCacheCount;
+
+	for (uint8_t i = 0; i < mGattCacheCount; i++) {
+		const GattCacheEntry &entry = mGattCacheEntries[i];
+
+		mGattCacheRecord[size++] = entry.mAddr.type;
+		memcpy(&mGattCacheRecord[size], entry.mAddr.a.val, sizeof(entry.mAddr.a.val));
+		size += sizeof(entry.mAddr.a.val);
+		memcpy(&mGattCacheRecord[size], entry.mDatabaseHash, sizeof(entry.mDatabaseHash));
+		size += sizeof(entry.mDatabaseHash);
+		mGattCacheRecord[size++] = entry.mHandlesCount;
+
+		for (uint8_t j = 0; j < entry.mHandlesCount; j++) {
+			sys_put_le16(entry.mHandles[j], &mGattCacheRecord[size]);
+			size += sizeof(uint16_t);
+		}
+	}
+
+	return Nrf::GetPersistentStorage().NonSecureStore(&mGattCache, mGattCacheRecord, size) ==
+	       PSErrorCode::Success;
+}
+
+bool BridgeStorageManager::ParseGattCache(const uint8_t *record, size_t size)
+{
+	size_t offset = kGattCacheHeaderSize;
+
+	mGattCacheCount = 0;
+
+	if (size < kGattCacheHeaderSize || record[0] != kGattCacheVersion || record[1] > kGattCacheMaxEntries) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < record[1]; i++) {
+		GattCacheEntry &entry = mGattCacheEntries[i];
+
+		if (size - offset < kGattCacheEntryHeaderSize) {
 			return false;
 		}
 
-		memcpy(buffer + counter, &device.mUserDataSize, sizeof(device.mUserDataSize));
-		counter += sizeof(device.mUserDataSize);
-		memcpy(buffer + counter, device.mUserData, device.mUserDataSize);
-		counter += device.mUserDataSize;
+		entry = GattCacheEntry{};
+		entry.mAddr.type = record[offset++];
+		memcpy(entry.mAddr.a.val, &record[offset], sizeof(entry.mAddr.a.val));
+		offset += sizeof(entry.mAddr.a.val);
+		memcpy(entry.mDatabaseHash, &record[offset], sizeof(entry.mDatabaseHash));
+		offset += sizeof(entry.mDatabaseHash);
+		entry.mHandlesCount = record[offset++];
+
+		if (entry.mHandlesCount > kGattCacheMaxHandles ||
+		    size - offset < entry.mHandlesCount * sizeof(uint16_t)) {
+			return false;
+		}
+
+		for (uint8_t j = 0; j < entry.mHandlesCount; j++) {
+			entry.mHandles[j] = sys_get_le16(&record[offset]);
+			offset += sizeof(uint16_t);
+		}
 	}
 
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureStore(&id, buffer, counter);
+	/* Trailing data means that the record does not match the declared number of entries. */
+	if (offset != size) {
+		return false;
+	}
 
-	return status == PSErrorCode::Success;
+	mGattCacheCount = record[1];
+	return true;
 }
 
-bool BridgeStorageManager::RemoveBridgedDevice(uint8_t index)
+bool BridgeStorageManager::LoadGattCache(const bt_addr_le_t &addr, GattCacheEntry &entry)
 {
-	Nrf::PersistentStorageNode id = CreateIndexNode(index, &mBridgedDevice);
-	const PSErrorCode status = Nrf::GetPersistentStorage().NonSecureRemove(&id);
+	const GattCacheEntry *cached = FindGattCacheEntry(addr);
 
-	return status == PSErrorCode::Success;
+	if (!cached) {
+		return false;
+	}
+
+	entry = *cached;
+	return true;
 }
 
+bool BridgeStorageManager::StoreGattCache(const GattCacheEntry &entry)
+{
+	if (entry.mHandlesCount > kGattCacheMaxHandles) {
+		return false;
+	}
+
+	GattCacheEntry *cached = FindGattCacheEntry(entry.mAddr);
+
+	if (cached && GattCacheEntriesEqual(*cached, entry)) {
+		/* The handles did not change, so there is no need to write the storage. */
+		return true;
+	}
+
+	if (!cached) {
+		if (mGattCacheCount >= kGattCacheMaxEntries) {
+			return false;
+		}
+
+		cached = &mGattCacheEntries[mGattCacheCount++];
+	}
+
+	*cached = entry;
+
+	return WriteGattCache();
+}
+
+bool BridgeStorageManager::RemoveGattCache(const bt_addr_le_t &addr)
+{
+	GattCacheEntry *cached = FindGattCacheEntry(addr);
+
+	if (!cached) {
+		return true;
+	}
+
+	/* The order of the entries does not matter, so the last one is moved to the released slot. */
+	*cached = mGattCacheEntries[--mGattCacheCount];
+	mGattCacheEntries[mGattCacheCount] = GattCacheEntry{};
+
+	return WriteGattCache();
+}
+#endif
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 bool BridgeStorageManager::LoadBtAddress(bt_addr_le_t &addr, uint8_t bridgedDeviceIndex)
@@ -20,6 +20,38 @@ namespace Nrf
  * The class implements the following key-values storage structure:
  *
  * /br/
+ *		/brd_idx/ /<uint8_t index[n]>/
+ *		/brd_rec/
+ *			/<index_1>/ /<BridgedDeviceRecord>/
+ *			.
+ *			.
+ *			/<index_n>/ /<BridgedDeviceRecord>/
+ *		/ver/ <uint8_t>
+ *
+ * Every bridged device is kept in a single record, so that storing a device costs a single storage operation.
+ * The record consists of the following packed fields:
+ *
+ *	<uint16_t endpoint id><uint16_t device type><uint8_t unique id length><unique id>
+ *	<uint8_t node label length><node label><uint8_t user data size><user data>
+ *
+ * The brd_idx entry lists the indexes of the stored devices in the order in which they were added. It is written
+ * only when a device is added or removed, and only once for all operations grouped using StartTransaction() and
+ * CommitTransaction(). All records are loaded on init using a single pass over the bridge subtree and cached in RAM.
+ *
+ * If CONFIG_BRIDGE_BT_GATT_CACHE is enabled, the handles of the GATT attributes discovered on the Bluetooth LE bridged
+ * devices are kept in a separate table, cached in RAM as well:
+ *
+ * /br/
+ *		/gatt/ /<uint8_t version><uint8_t n><entry_1>...<entry_n>/
+ *
+ * Every entry is packed without padding, and the handles are stored in the little-endian byte order:
+ *
+ *	<uint8_t address type><uint8_t address[6]><uint8_t database hash[16]><uint8_t handles count>
+ *	<uint16_t handles[handles count]>
+ *
+ * Versions 1 and 2 of the scheme used the following structure, that is migrated to the current one on init:
+ *
+ * /br/
  *		/brd_cnt/ /<uint8_t>/
  *		/brd_ids/ /<uint8_t[brd_cnt]>/
  * 		/brd/
@@ -33,12 +65,18 @@ namespace Nrf
 class BridgeStorageManager {
 public:
 	static inline constexpr auto kMaxUserDataSize = 128u;
+	static inline constexpr auto kMaxRecordUserDataSize = CONFIG_BRIDGE_STORAGE_MAX_RECORD_USER_DATA_SIZE;
 
 	constexpr static auto kBridgePrefix = "br";
+	constexpr static auto kBridgedDevicesListPrefix = "brd_idx";
+	constexpr static auto kBridgedDeviceRecordPrefix = "brd_rec";
 	constexpr static auto kBridgedDevicesCountPrefix = "brd_cnt";
 	constexpr static auto kBridgedDevicesIndexesPrefix = "brd_ids";
 	constexpr static auto kBridgedDevicePrefix = "brd";
 	constexpr static auto kVersionPrefix = "ver";
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	constexpr static auto kGattCachePrefix = "gatt";
+#endif
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	constexpr static auto kBridgedDeviceEndpointIdPrefix = "eid";
@@ -72,28 +110,100 @@ public:
 		uint8_t *mUserData = nullptr;
 	};
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	static constexpr size_t kGattDatabaseHashSize = 16;
+	static constexpr uint8_t kGattCacheMaxHandles = CONFIG_BRIDGE_BT_GATT_CACHE_MAX_HANDLES;
+	/* One BT connection is reserved for the Matter service purposes. */
+	static constexpr uint8_t kGattCacheMaxEntries = CONFIG_BT_MAX_CONN - 1;
+
+	/* Attribute handles used by the provider of the Bluetooth LE device, valid as long as its GATT database hash
+	 * does not change. */
+	struct GattCacheEntry {
+		bt_addr_le_t mAddr{};
+		uint8_t mDatabaseHash[kGattDatabaseHashSize] = { 0 };
+		uint8_t mHandlesCount{ 0 };
+		uint16_t mHandles[kGattCacheMaxHandles] = { 0 };
+	};
+
+	/* Version of the stored GATT cache record, the record of a different version is dropped on init. */
+	static constexpr uint8_t kGattCacheVersion = 1;
+	/* Size of the record header (version and number of entries) and the entry fields preceding the handles. */
+	static constexpr size_t kGattCacheHeaderSize = 2 * sizeof(uint8_t);
+	static constexpr size_t kGattCacheEntryHeaderSize =
+		sizeof(uint8_t) + sizeof(bt_addr_t) + kGattDatabaseHashSize + sizeof(uint8_t);
+	static constexpr size_t kGattCacheMaxRecordSize =
+		kGattCacheHeaderSize +
+		kGattCacheMaxEntries * (kGattCacheEntryHeaderSize + kGattCacheMaxHandles * sizeof(uint16_t));
+#endif
+
 	using BridgedDevice = BridgedDeviceV2;
-	static constexpr uint8_t kCurrentVersion = 2;
+	static constexpr uint8_t kCurrentVersion = 3;
 
 	static constexpr auto kMaxIndexLength = 3;
 
+	static constexpr uint8_t kMaxDevicesCount = CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
+
+	/* Size of the record fields, and of the header (index and record size) preceding every record cached in RAM. */
+	static constexpr size_t kRecordHeaderSize = 2 * sizeof(uint8_t);
+	static constexpr size_t kMaxRecordSize = sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+						 MatterBridgedDevice::kUniqueIDSize + sizeof(uint8_t) +
+						 MatterBridgedDevice::kNodeLabelSize + sizeof(uint8_t) +
+						 kMaxRecordUserDataSize;
+	static constexpr size_t kMaxRecordsCacheSize = kMaxDevicesCount * (kRecordHeaderSize + kMaxRecordSize);
+
+	static_assert(kMaxRecordSize <= UINT8_MAX, "The record size must fit in the record header");
+
+	/* Complete keys of the static nodes, built at compile time. */
+	static constexpr PersistentStorageNode::Key kBridgedDevicesListKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicesListPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDeviceRecordKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDeviceRecordPrefix });
+	static constexpr PersistentStorageNode::Key kVersionKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kVersionPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDevicesCountKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicesCountPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDevicesIndexesKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicesIndexesPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDeviceKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicePrefix });
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	static constexpr PersistentStorageNode::Key kGattCacheKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kGattCachePrefix });
+#endif
+#ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
+	static constexpr PersistentStorageNode::Key kBridgedDeviceEndpointIdKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicePrefix, kBridgedDeviceEndpointIdPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDeviceLabelKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicePrefix, kBridgedDeviceLabelPrefix });
+	static constexpr PersistentStorageNode::Key kBridgedDeviceTypeKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicePrefix, kBridgedDeviceTypePrefix });
+#ifdef CONFIG_BRIDGED_DEVICE_BT
+	static constexpr PersistentStorageNode::Key kBtAddrKey =
+		PersistentStorageNode::BuildKey({ kBridgePrefix, kBridgedDevicePrefix, kBtPrefix, kBtAddrPrefix });
+#endif
+#endif
+
+	static_assert(kBridgedDevicesListKey.IsValid() && kBridgedDeviceRecordKey.IsValid() && kVersionKey.IsValid() &&
+			      kBridgedDevicesCountKey.IsValid() && kBridgedDevicesIndexesKey.IsValid() &&
+			      kBridgedDeviceKey.IsValid(),
+		      "Bridge storage keys do not fit in CONFIG_NCS_SAMPLE_MATTER_STORAGE_MAX_KEY_LEN");
+
 	BridgeStorageManager()
-		: mBridge(kBridgePrefix, strlen(kBridgePrefix)),
-		  mBridgedDevicesCount(kBridgedDevicesCountPrefix, strlen(kBridgedDevicesCountPrefix), &mBridge),
-		  mBridgedDevicesIndexes(kBridgedDevicesIndexesPrefix, strlen(kBridgedDevicesIndexesPrefix), &mBridge),
-		  mBridgedDevice(kBridgedDevicePrefix, strlen(kBridgedDevicePrefix), &mBridge),
-		  mVersion(kVersionPrefix, strlen(kVersionPrefix), &mBridge)
+		: mBridge(kBridgePrefix, strlen(kBridgePrefix)), mBridgedDevicesList(kBridgedDevicesListKey),
+		  mBridgedDeviceRecord(kBridgedDeviceRecordKey), mVersion(kVersionKey),
+		  mBridgedDevicesCount(kBridgedDevicesCountKey), mBridgedDevicesIndexes(kBridgedDevicesIndexesKey),
+		  mBridgedDevice(kBridgedDeviceKey)
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+		  ,
+		  mGattCache(kGattCacheKey)
+#endif
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 		  ,
-		  mBridgedDeviceEndpointId(kBridgedDeviceEndpointIdPrefix, strlen(kBridgedDeviceEndpointIdPrefix),
-					   &mBridgedDevice),
-		  mBridgedDeviceNodeLabel(kBridgedDeviceLabelPrefix, strlen(kBridgedDeviceLabelPrefix),
-					  &mBridgedDevice),
-		  mBridgedDeviceType(kBridgedDeviceTypePrefix, strlen(kBridgedDeviceTypePrefix), &mBridgedDevice)
+		  mBridgedDeviceEndpointId(kBridgedDeviceEndpointIdKey), mBridgedDeviceNodeLabel(kBridgedDeviceLabelKey),
+		  mBridgedDeviceType(kBridgedDeviceTypeKey)
 #ifdef CONFIG_BRIDGED_DEVICE_BT
 		  ,
-		  mBt(kBtPrefix, strlen(kBtPrefix), &mBridgedDevice),
-		  mBtAddress(kBtAddrPrefix, strlen(kBtAddrPrefix), &mBt)
+		  mBtAddress(kBtAddrKey)
 #endif
 #endif
 	{
@@ -119,46 +229,43 @@ public:
 	void FactoryReset();
 
 	/**
-	 * @brief Store bridged devices count into settings
-	 *
-	 * @param count count value to be stored
-	 * @return true if key has been written successfully
-	 * @return false an error occurred
+	 * @brief Start a transaction grouping store and remove operations. The records of the bridged devices are
+	 * written right away, but the list of the stored devices is not written until the transaction is committed.
+	 * Transactions can be nested.
 	 */
-	bool StoreBridgedDevicesCount(uint8_t count);
+	void StartTransaction() { mTransactionDepth++; }
 
 	/**
-	 * @brief Load bridged devices count from settings
+	 * @brief Commit the transaction started using StartTransaction(). The list of the stored devices is written
+	 * with a single storage operation once the outermost transaction is committed, if it was modified.
 	 *
-	 * @param count reference to the count object to be filled with loaded data
-	 * @return true if key has been loaded successfully
+	 * @return true if the list has been written successfully or there was nothing to write
 	 * @return false an error occurred
 	 */
-	bool LoadBridgedDevicesCount(uint8_t &count);
+	bool CommitTransaction();
 
 	/**
-	 * @brief Store bridged devices indexes into settings
+	 * @brief Load bridged devices count
 	 *
-	 * @param indexes address of array containing indexes to be stored
-	 * @param count size of indexes array to be stored
-	 * @return true if key has been written successfully
-	 * @return false an error occurred
+	 * @param count reference to the count object to be filled with loaded data
+	 * @return true if there is at least one bridged device stored
+	 * @return false there are no bridged devices stored
 	 */
-	bool StoreBridgedDevicesIndexes(uint8_t *indexes, uint8_t count);
+	bool LoadBridgedDevicesCount(uint8_t &count);
 
 	/**
-	 * @brief Load bridged devices indexes from settings
+	 * @brief Load bridged devices indexes in the order in which the devices were stored
 	 *
 	 * @param indexes address of indexes array to be filled with loaded data
 	 * @param maxCount maximum size that can be used for indexes array
 	 * @param count reference to the count object to be filled with size of actually loaded data
-	 * @return true if key has been loaded successfully
+	 * @return true if indexes have been loaded successfully
 	 * @return false an error occurred
 	 */
 	bool LoadBridgedDevicesIndexes(uint8_t *indexes, uint8_t maxCount, size_t &count);
 
 	/**
-	 * @brief Load bridged device from settings
+	 * @brief Load bridged device
 	 *
 	 * If the caller wants to load the optional user data, the mUserData must be set to the valid buffer to store
 	 * data and mUserDataSize must be set to this data size. On success, the method overrides mUserDataSize with
@@ -172,26 +279,104 @@ public:
 	template <typename T = BridgedDevice> bool LoadBridgedDevice(T &device, uint8_t index);
 
 	/**
-	 * @brief Store bridged device into settings. Helper method allowing to store endpoint id, node label and device
-	 * type of specific bridged device using a single call.
+	 * @brief Store bridged device. If the device under the given index is already stored, its record is replaced,
+	 * otherwise the device is appended at the end of the list of the stored devices.
 	 *
 	 * @param device instance of bridged device object to be stored
 	 * @param index index describing specific bridged device
-	 * @return true if key has been written successfully
+	 * @return true if the device has been stored successfully
 	 * @return false an error occurred
 	 */
 	bool StoreBridgedDevice(BridgedDevice &device, uint8_t index);
 
 	/**
-	 * @brief Remove bridged device entry from settings
+	 * @brief Remove bridged device entry
 	 *
 	 * @param bridgedDeviceIndex index describing specific bridged device to be removed
-	 * @return true if key entry has been removed successfully
+	 * @return true if the device has been removed successfully
 	 * @return false an error occurred
 	 */
 	bool RemoveBridgedDevice(uint8_t bridgedDeviceIndex);
 
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/**
+	 * @brief Load the cached GATT attribute handles of the Bluetooth LE device.
+	 *
+	 * @param addr Bluetooth LE address of the device
+	 * @param entry reference to the entry object to be filled with loaded data
+	 * @return true if the entry has been found
+	 * @return false there is no entry for the device
+	 */
+	bool LoadGattCache(const bt_addr_le_t &addr, GattCacheEntry &entry);
+
+	/**
+	 * @brief Store the GATT attribute handles of the Bluetooth LE device. If the entry for the device is already
+	 * stored, it is replaced. The storage is written only if the entry has changed.
+	 *
+	 * @param entry instance of the entry object to be stored
+	 * @return true if the entry has been stored successfully
+	 * @return false an error occurred
+	 */
+	bool StoreGattCache(const GattCacheEntry &entry);
+
+	/**
+	 * @brief Remove the cached GATT attribute handles of the Bluetooth LE device.
+	 *
+	 * @param addr Bluetooth LE address of the device
+	 * @return true if the entry has been removed successfully or it was not stored
+	 * @return false an error occurred
+	 */
+	bool RemoveGattCache(const bt_addr_le_t &addr);
+#endif
+
 private:
+	/* Offset returned by FindRecord() if the record is not cached. */
+	static constexpr size_t kRecordNotFound = SIZE_MAX;
+
+	/**
+	 * @brief Find the record of the specified bridged device in the records cache.
+	 *
+	 * @param index index describing specific bridged device
+	 * @return offset of the record header in the cache, or kRecordNotFound if the record was not found
+	 */
+	size_t FindRecord(uint8_t index);
+
+	/**
+	 * @brief Remove the record at the given offset from the records cache.
+	 *
+	 * @param offset offset of the record header in the cache
+	 */
+	void RemoveCachedRecord(size_t offset);
+
+	/**
+	 * @brief Check the loaded list of the stored devices against the loaded records. Devices without a record are
+	 * dropped from the list, and records of devices missing from the list, left by an interrupted operation, are
+	 * removed from the storage.
+	 */
+	void ValidateLoadedRecords();
+
+	/**
+	 * @brief Write the list of the stored devices if it was modified and no transaction is pending.
+	 *
+	 * @return true if the list has been written successfully or there was nothing to write
+	 * @return false an error occurred
+	 */
+	bool WriteList();
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	GattCacheEntry *FindGattCacheEntry(const bt_addr_le_t &addr);
+	bool WriteGattCache();
+
+	/**
+	 * @brief Parse the stored GATT cache record into the cached entries.
+	 *
+	 * @param record serialized record
+	 * @param size size of the record
+	 * @return true if the record is valid
+	 * @return false the record is corrupted or uses a different version, no entries are loaded
+	 */
+	bool ParseGattCache(const uint8_t *record, size_t size);
+#endif
+
 	/**
 	 * @brief Provides backward compatibility between non-compatible data scheme versions.
 	 *
@@ -204,6 +389,24 @@ private:
 	 */
 	bool MigrateData();
 
+	/**
+	 * @brief Remove the keys of the version 1 and 2 scheme after the bridged devices were migrated to the table.
+	 *
+	 * @param indexes address of array containing indexes of the migrated bridged devices
+	 * @param count size of indexes array
+	 */
+	void RemoveLegacyKeys(uint8_t *indexes, size_t count);
+
+	/**
+	 * @brief Load bridged device stored using the version 2 scheme.
+	 *
+	 * @param device instance of bridged device object to be filled with loaded data.
+	 * @param index index describing specific bridged device
+	 * @return true if key has been loaded successfully
+	 * @return false an error occurred
+	 */
+	bool LoadBridgedDeviceVersion2(BridgedDeviceV2 &device, uint8_t index);
+
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	/**
 	 * @brief Migrate bridged device data at given index.
@@ -231,6 +434,17 @@ private:
 	bool MigrateDataVersion1(uint8_t bridgedDeviceIndex);
 #endif
 
+	/**
+	 * @brief Migrate bridged device data at given index.
+	 *
+	 * It migrates bridge device structure from version 2 to current one.
+	 *
+	 * @param bridgedDeviceIndex index describing specific bridged device to be migrated
+	 * @return true if migration was successful
+	 * @return false an error occurred
+	 */
+	bool MigrateDataVersion2(uint8_t bridgedDeviceIndex);
+
 	/* The below methods are deprecated and used only for the migration purposes between the older scheme versions.
 	 */
 
@@ -318,10 +532,18 @@ private:
 #endif
 
 	Nrf::PersistentStorageNode mBridge;
+	Nrf::PersistentStorageNode mBridgedDevicesList;
+	Nrf::PersistentStorageNode mBridgedDeviceRecord;
+	Nrf::PersistentStorageNode mVersion;
+
+	/* The below fields describe the version 1 and 2 scheme and are used only for the migration purposes. */
 	Nrf::PersistentStorageNode mBridgedDevicesCount;
 	Nrf::PersistentStorageNode mBridgedDevicesIndexes;
 	Nrf::PersistentStorageNode mBridgedDevice;
-	Nrf::PersistentStorageNode mVersion;
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	Nrf::PersistentStorageNode mGattCache;
+#endif
 
 #ifdef CONFIG_BRIDGE_MIGRATE_PRE_2_7_0
 	/* The below fields are deprecated and used only for the migration purposes between the older scheme versions.
@@ -330,9 +552,25 @@ private:
 	Nrf::PersistentStorageNode mBridgedDeviceNodeLabel;
 	Nrf::PersistentStorageNode mBridgedDeviceType;
 #ifdef CONFIG_BRIDGED_DEVICE_BT
-	Nrf::PersistentStorageNode mBt;
 	Nrf::PersistentStorageNode mBtAddress;
 #endif
+#endif
+
+	/* Indexes of the stored devices in the order in which they were added. */
+	uint8_t mList[kMaxDevicesCount] = { 0 };
+	uint8_t mListCount = 0;
+	bool mListDirty = false;
+	uint8_t mTransactionDepth = 0;
+
+	/* Cached records of the stored devices, every record is preceded by the index and the record size. */
+	uint8_t mRecords[kMaxRecordsCacheSize] = { 0 };
+	size_t mRecordsSize = 0;
+
+#ifdef CONFIG_BRIDGE_BT_GATT_CACHE
+	/* Cached GATT attribute handles table and the buffer for its serialized record. */
+	GattCacheEntry mGattCacheEntries[kGattCacheMaxEntries] = {};
+	uint8_t mGattCacheCount = 0;
+	uint8_t mGattCacheRecord[kGattCacheMaxRecordSize] = { 0 };
 #endif
 };
 
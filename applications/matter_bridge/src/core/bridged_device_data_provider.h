@@ -40,11 +40,18 @@ public:
 
 	CHIP_ERROR NotifyReachableStatusChange(bool isReachable);
 
+	static constexpr uint8_t kInvalidBridgeSlot = UINT8_MAX;
+
 protected:
 	UpdateAttributeCallback mUpdateAttributeCallback;
 	InvokeCommandCallback mInvokeCommandCallback;
 
 private:
+	template <typename, typename, uint8_t, uint8_t, uint8_t> friend class BridgedDeviceIndex;
+
+	/* Index of the provider entry in the BridgedDeviceIndex, assigned when the provider is bridged. */
+	uint8_t mBridgeSlot{ kInvalidBridgeSlot };
+
 	struct ReachableContext {
 		bool mIsReachable;
 		BridgedDeviceDataProvider *mProvider;
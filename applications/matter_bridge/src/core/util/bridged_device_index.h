@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace Nrf
+{
+/*
+   BridgedDeviceIndex template container keeps the pairs of bridged devices and their data providers in a table
+   indexed directly by the dynamic endpoint index, and a reverse index binding every data provider with the dynamic
+   endpoint indexes of its bridged devices. The slot of the provider's reverse index entry is stored in the provider,
+   so both lookups take constant time.
+   BridgedDeviceIndex owns inserted pairs, so a pair is released when it is erased or replaced.
+   Prerequisites:
+     * TPair must have move semantics, bool() operator and the TProvider *mProvider member.
+     * TProvider must have the uint8_t mBridgeSlot member accessible to BridgedDeviceIndex.
+*/
+template <typename TPair, typename TProvider, uint8_t kMaxDevices, uint8_t kMaxProviders,
+	  uint8_t kMaxDevicesPerProvider>
+class BridgedDeviceIndex {
+public:
+	/* Reverse index entry binding a data provider with the dynamic endpoint indexes of its bridged devices. */
+	struct ProviderEntry {
+		TProvider *mProvider{ nullptr };
+		uint8_t mDeviceIndexes[kMaxDevicesPerProvider] = { 0 };
+		uint8_t mDevicesCount{ 0 };
+	};
+
+	/**
+	 * @brief Get the pair stored under the specified dynamic endpoint index.
+	 *
+	 * @param index dynamic endpoint index
+	 * @return pointer to the pair, or nullptr if the index is out of range or not used
+	 */
+	TPair *GetDevicePair(uint16_t index)
+	{
+		if (index >= kMaxDevices || !mDevices[index]) {
+			return nullptr;
+		}
+		return &mDevices[index];
+	}
+
+	/**
+	 * @brief Get the pair stored under the dynamic endpoint index taken from a reverse index entry.
+	 *
+	 * @param index dynamic endpoint index, it must be in range
+	 * @return reference to the pair
+	 */
+	TPair &At(uint8_t index) { return mDevices[index]; }
+
+	/**
+	 * @brief Get the reverse index entry of the specified data provider.
+	 *
+	 * @param provider data provider object
+	 * @return pointer to the entry, or nullptr if the provider is not registered
+	 */
+	ProviderEntry *GetProviderEntry(const TProvider &provider)
+	{
+		uint8_t slot = provider.mBridgeSlot;
+
+		if (slot >= kMaxProviders || mProviders[slot].mProvider != &provider) {
+			return nullptr;
+		}
+		return &mProviders[slot];
+	}
+
+	/**
+	 * @brief Assign a reverse index entry to the data provider.
+	 *
+	 * @param provider data provider object
+	 * @return true on success
+	 * @return false if the maximum number of providers was exceeded
+	 */
+	bool RegisterProvider(TProvider *provider)
+	{
+		for (uint8_t slot = 0; slot < kMaxProviders; slot++) {
+			if (!mProviders[slot].mProvider) {
+				mProviders[slot].mProvider = provider;
+				mProviders[slot].mDevicesCount = 0;
+				provider->mBridgeSlot = slot;
+				mProvidersCount++;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Store the pair under the specified dynamic endpoint index and bind it with the provider's reverse
+	 * index entry. The provider must have been registered using RegisterProvider().
+	 *
+	 * @param index dynamic endpoint index
+	 * @param pair pair of bridged device and its data provider
+	 * @return true on success
+	 * @return false if the index is already used or the provider cannot take more devices
+	 */
+	bool InsertDevicePair(uint8_t index, TPair &&pair)
+	{
+		if (index >= kMaxDevices || mDevices[index] || !pair.mProvider) {
+			return false;
+		}
+
+		ProviderEntry *entry = GetProviderEntry(*pair.mProvider);
+
+		if (!entry || entry->mDevicesCount >= kMaxDevicesPerProvider) {
+			return false;
+		}
+
+		entry->mDeviceIndexes[entry->mDevicesCount++] = index;
+		mDevices[index] = std::move(pair);
+
+		return true;
+	}
+
+	/**
+	 * @brief Release the pair stored under the specified dynamic endpoint index. The data provider is released
+	 * only if no other bridged device is bound with it.
+	 *
+	 * @param index dynamic endpoint index
+	 * @return true on success
+	 * @return false if the index is not used
+	 */
+	bool EraseDevicePair(uint8_t index)
+	{
+		TPair *devicePair = GetDevicePair(index);
+
+		if (!devicePair) {
+			return false;
+		}
+
+		ProviderEntry *entry = devicePair->mProvider ? GetProviderEntry(*devicePair->mProvider) : nullptr;
+
+		if (entry) {
+			/* Remove the index from the provider's list by moving the last one in its place. */
+			for (uint8_t i = 0; i < entry->mDevicesCount; i++) {
+				if (entry->mDeviceIndexes[i] == index) {
+					entry->mDeviceIndexes[i] = entry->mDeviceIndexes[--entry->mDevicesCount];
+					break;
+				}
+			}
+
+			if (entry->mDevicesCount > 0) {
+				/* The provider is still used by other bridged devices, so it must not be released. */
+				devicePair->mProvider = nullptr;
+			} else {
+				entry->mProvider = nullptr;
+				mProvidersCount--;
+			}
+		}
+
+		/* Move-assigning an empty pair releases the objects owned by the stored one. */
+		*devicePair = TPair();
+
+		return true;
+	}
+
+	/**
+	 * @brief Prepare the pair that could not be stored for destruction. The reverse index entry of its data provider
+	 * is released if no bridged device is bound with it, otherwise the provider is detached from the pair so that it
+	 * is not released.
+	 *
+	 * @param pair pair of bridged device and its data provider
+	 */
+	void ReleaseUnboundProvider(TPair &pair)
+	{
+		ProviderEntry *entry = pair.mProvider ? GetProviderEntry(*pair.mProvider) : nullptr;
+
+		if (!entry) {
+			return;
+		}
+
+		if (entry->mDevicesCount == 0) {
+			/* The provider was registered for this pair only, so it can be released together with the pair. */
+			entry->mProvider = nullptr;
+			mProvidersCount--;
+		} else {
+			/* The provider is still used by other bridged devices. */
+			pair.mProvider = nullptr;
+		}
+	}
+
+	uint8_t GetProvidersCount() const { return mProvidersCount; }
+
+private:
+	/* Bridged devices indexed directly by the dynamic endpoint index. */
+	TPair mDevices[kMaxDevices];
+	/* Providers indexed by the slot stored in the provider. */
+	ProviderEntry mProviders[kMaxProviders];
+	uint8_t mProvidersCount{ 0 };
+};
+
+} /* namespace Nrf */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Nrf
+{
+
+/*
+   SpscQueue is a bounded, lock-free queue of elements of type T, that can be used by exactly one producer thread and
+   exactly one consumer thread at a time. The elements are constructed in place by the producer and handled in place
+   by the consumer, so passing an element through the queue does not copy it nor allocate memory. The capacity must be
+   a power of two.
+*/
+template <typename T, size_t N> class SpscQueue {
+	static_assert(N > 0 && (N & (N - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	/**
+	 * @brief Add an element to the queue. Must be called only by the producer.
+	 *
+	 * @param fill callable invoked with a reference to the element slot, that shall fill the element
+	 * @return true if the element has been added
+	 * @return false if the queue is full
+	 */
+	template <typename Fill> bool Push(Fill &&fill)
+	{
+		const uint32_t tail = mTail.load(std::memory_order_relaxed);
+
+		if (tail - mHead.load(std::memory_order_acquire) >= N) {
+			return false;
+		}
+
+		fill(mElements[tail & (N - 1)]);
+		/* Publish the element only once it has been filled. */
+		mTail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	/**
+	 * @brief Handle and remove the elements from the queue, in the order in which they were added. Must be called
+	 * only by the consumer.
+	 *
+	 * @param handle callable invoked with a reference to every handled element
+	 * @param maxCount maximum number of elements to be handled
+	 * @return number of the handled elements
+	 */
+	template <typename Handle> size_t Pop(Handle &&handle, size_t maxCount = N)
+	{
+		uint32_t head = mHead.load(std::memory_order_relaxed);
+		const uint32_t tail = mTail.load(std::memory_order_acquire);
+		size_t count = 0;
+
+		while (head != tail && count < maxCount) {
+			handle(mElements[head & (N - 1)]);
+			head++;
+			count++;
+			/* Release every slot right away, so the producer can reuse it while the batch is being handled. */
+			mHead.store(head, std::memory_order_release);
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief Call the function for every element in the queue without removing it, for example to invalidate the
+	 * elements that refer to a removed object. Must be called only by the consumer.
+	 */
+	template <typename Visit> void ForEach(Visit &&visit)
+	{
+		const uint32_t tail = mTail.load(std::memory_order_acquire);
+
+		for (uint32_t head = mHead.load(std::memory_order_relaxed); head != tail; head++) {
+			visit(mElements[head & (N - 1)]);
+		}
+	}
+
+	bool IsEmpty() const
+	{
+		return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+	}
+
+	static constexpr size_t Capacity() { return N; }
+
+private:
+	T mElements[N]{};
+	/* Indexes grow freely and wrap around, the slot is selected by masking them with the capacity. */
+	std::atomic<uint32_t> mHead{ 0 };
+	std::atomic<uint32_t> mTail{ 0 };
+};
+
+} /* namespace Nrf */
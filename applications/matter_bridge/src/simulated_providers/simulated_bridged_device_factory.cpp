@@ -16,16 +16,8 @@ namespace
 {
 CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataProvider *provider, uint8_t index)
 {
-	uint8_t count = 0;
-	uint8_t indexes[Nrf::BridgeManager::kMaxBridgedDevices] = { 0 };
-	bool deviceRefresh = false;
 	Nrf::BridgeStorageManager::BridgedDevice bridgedDevice;
 
-	/* Check if a device is already present in the storage. */
-	if (Nrf::BridgeStorageManager::Instance().LoadBridgedDevice(bridgedDevice, index)) {
-		deviceRefresh = true;
-	}
-
 	bridgedDevice.mEndpointId = device->GetEndpointId();
 	bridgedDevice.mDeviceType = device->GetDeviceType();
 	bridgedDevice.mUniqueIDLength = strlen(device->GetUniqueID());
@@ -38,26 +30,6 @@ CHIP_ERROR StoreDevice(Nrf::MatterBridgedDevice *device, Nrf::BridgedDeviceDataP
 		return CHIP_ERROR_INTERNAL;
 	}
 
-	/* If a device was not present in the storage before, put new index on the end of list and increment the count
-	 * number of stored devices. */
-	if (!deviceRefresh) {
-		CHIP_ERROR err = Nrf::BridgeManager::Instance().GetDevicesIndexes(indexes, sizeof(indexes), count);
-		if (CHIP_NO_ERROR != err) {
-			LOG_ERR("Failed to get bridged devices indexes");
-			return err;
-		}
-
-		if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesIndexes(indexes, count)) {
-			LOG_ERR("Failed to store bridged devices indexes.");
-			return CHIP_ERROR_INTERNAL;
-		}
-
-		if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-			LOG_ERR("Failed to store bridged devices count.");
-			return CHIP_ERROR_INTERNAL;
-		}
-	}
-
 	return CHIP_NO_ERROR;
 }
 } /* namespace */
@@ -224,8 +196,6 @@ CHIP_ERROR SimulatedBridgedDeviceFactory::CreateDevice(int deviceType, const cha
 CHIP_ERROR SimulatedBridgedDeviceFactory::RemoveDevice(int endpointId)
 {
 	uint8_t index;
-	uint8_t count = 0;
-	uint8_t indexes[Nrf::BridgeManager::kMaxBridgedDevices] = { 0 };
 
 	CHIP_ERROR err = Nrf::BridgeManager::Instance().RemoveBridgedDevice(endpointId, index);
 
@@ -234,23 +204,6 @@ CHIP_ERROR SimulatedBridgedDeviceFactory::RemoveDevice(int endpointId)
 		return err;
 	}
 
-	err = Nrf::BridgeManager::Instance().GetDevicesIndexes(indexes, sizeof(indexes), count);
-	if (CHIP_NO_ERROR != err) {
-		LOG_ERR("Failed to get bridged devices indexes");
-		return err;
-	}
-
-	/* Update the current indexes list. */
-	if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesIndexes(indexes, count)) {
-		LOG_ERR("Failed to store bridged devices indexes.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
-	if (!Nrf::BridgeStorageManager::Instance().StoreBridgedDevicesCount(count)) {
-		LOG_ERR("Failed to store bridged devices count.");
-		return CHIP_ERROR_INTERNAL;
-	}
-
 	if (!Nrf::BridgeStorageManager::Instance().RemoveBridgedDevice(index)) {
 		LOG_ERR("Failed to remove bridged device from the storage.");
 		return CHIP_ERROR_INTERNAL;
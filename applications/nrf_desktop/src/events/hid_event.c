@@ -63,12 +63,28 @@ APP_EVENT_INFO_DEFINE(hid_report_event,
 		  ENCODE("report_id", "source", "subscriber"),
 		  profile_hid_report_event);
 
-APP_EVENT_TYPE_DEFINE(hid_report_event,
+/* HID report events are submitted for every HID report. If events are allocated from memory
+ * slabs, the slab blocks fit the report ID and the biggest HID input report. On a dongle, every
+ * HID report queue can hold enqueued reports of every input report ID and one report being sent.
+ */
+#define HID_REPORT_EVENT_SLAB_DYNDATA_SIZE (sizeof(uint8_t) + REPORT_BUFFER_SIZE_INPUT_REPORT)
+
+#if CONFIG_DESKTOP_HID_REPORTQ
+#define HID_REPORT_EVENT_SLAB_BLOCK_CNT						\
+	(CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT *				\
+	 (ARRAY_SIZE(input_reports) * CONFIG_DESKTOP_HID_REPORTQ_MAX_ENQUEUED_REPORTS + 1))
+#else
+#define HID_REPORT_EVENT_SLAB_BLOCK_CNT 4
+#endif
+
+APP_EVENT_TYPE_SLAB_DEFINE(hid_report_event,
 		  log_hid_report_event,
 		  &hid_report_event_info,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_HID_REPORT_EVENT,
-				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
+				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))),
+		  HID_REPORT_EVENT_SLAB_BLOCK_CNT,
+		  HID_REPORT_EVENT_SLAB_DYNDATA_SIZE);
 
 static void log_hid_report_subscriber_event(const struct app_event_header *aeh)
 {
@@ -14,6 +14,7 @@
 #include <zephyr/drivers/sensor.h>
 
 #include "motion_sensor.h"
+#include "motion_sample_align.h"
 
 #include <app_event_manager.h>
 #include "motion_event.h"
@@ -36,6 +37,12 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_MOTION_LOG_LEVEL);
 
 #define MAX_KEY_LEN 20
 
+#ifdef CONFIG_DESKTOP_MOTION_SENSOR_SAMPLE_ALIGN
+#define SAMPLE_ALIGN_LEAD_US		CONFIG_DESKTOP_MOTION_SENSOR_SAMPLE_ALIGN_LEAD_US
+#else
+#define SAMPLE_ALIGN_LEAD_US		0
+#endif
+
 enum state {
 	STATE_DISABLED,
 	STATE_DISABLED_SUSPENDED,
@@ -74,6 +81,10 @@ static const struct device *sensor_dev =
 	DEVICE_DT_GET_ONE(MOTION_SENSOR_COMPATIBLE);
 
 static struct sensor_state state;
+static struct motion_sample_align sample_align;
+
+static void sample_timer_fn(struct k_timer *timer);
+static K_TIMER_DEFINE(sample_timer, sample_timer_fn, NULL);
 
 static const char * const opt_descr[] = {
 	[SENSOR_OPT_VARIANT] = OPT_DESCR_MODULE_VARIANT,
@@ -563,6 +574,42 @@ static void send_empty_motion_event(void)
 	APP_EVENT_SUBMIT(event);
 }
 
+static void request_sample(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&state.lock);
+
+	if (state.state == STATE_FETCHING) {
+		state.sample = true;
+		k_sem_give(&sem);
+	}
+	k_spin_unlock(&state.lock, key);
+}
+
+static void sample_timer_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	request_sample();
+}
+
+static void handle_hid_report_sent(void)
+{
+	uint32_t delay_us = 0;
+
+	if (IS_ENABLED(CONFIG_DESKTOP_MOTION_SENSOR_SAMPLE_ALIGN)) {
+		delay_us = motion_sample_align_delay_get(&sample_align,
+							 k_ticks_to_us_floor64(k_uptime_ticks()),
+							 SAMPLE_ALIGN_LEAD_US);
+	}
+
+	if (delay_us > 0) {
+		/* Sample the sensor shortly before the subsequent HID report transmission. */
+		k_timer_start(&sample_timer, K_USEC(delay_us), K_NO_WAIT);
+	} else {
+		request_sample();
+	}
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_hid_report_sent_event(aeh)) {
@@ -571,12 +618,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 
 		if ((event->report_id == REPORT_ID_MOUSE) ||
 		    (event->report_id == REPORT_ID_BOOT_MOUSE)) {
-			k_spinlock_key_t key = k_spin_lock(&state.lock);
-			if (state.state == STATE_FETCHING) {
-				state.sample = true;
-				k_sem_give(&sem);
-			}
-			k_spin_unlock(&state.lock, key);
+			handle_hid_report_sent();
 		}
 
 		return false;
@@ -1091,9 +1091,15 @@ static bool handle_hid_report_subscriber_event(const struct hid_report_subscribe
 		__ASSERT_NO_MSG(sub->in_reportq);
 	} else {
 		struct subscriber *sub = find_subscriber(event->subscriber);
+		struct hid_reportq_stats stats;
 
 		__ASSERT_NO_MSG(sub);
 
+		hid_reportq_stats_get(sub->in_reportq, &stats);
+		LOG_INF("Subscriber %p: %" PRIu32 " reports forwarded, %" PRIu32 " dropped, "
+			"max queue depth %" PRIu16,
+			event->subscriber, stats.submitted_cnt, stats.drop_cnt, stats.max_depth);
+
 		hid_reportq_free(sub->in_reportq);
 		sub->in_reportq = NULL;
 		clear_hid_out_reports(sub);
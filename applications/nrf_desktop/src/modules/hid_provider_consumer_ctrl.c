@@ -251,6 +251,7 @@ static bool handle_button_event(const struct button_event *event)
 
 static void init(void)
 {
+	hid_keymap_init();
 	hid_eventq_init(&report_data.eventq,
 			CONFIG_DESKTOP_HID_REPORT_PROVIDER_CONSUMER_CTRL_EVENT_QUEUE_SIZE);
 	keys_state_init(&report_data.keys_state, CONSUMER_CTRL_REPORT_KEY_COUNT_MAX);
@@ -300,6 +300,7 @@ static bool handle_button_event(const struct button_event *event)
 
 static void init(void)
 {
+	hid_keymap_init();
 	hid_eventq_init(&report_data.eventq,
 			CONFIG_DESKTOP_HID_REPORT_PROVIDER_KEYBOARD_EVENT_QUEUE_SIZE);
 	keys_state_init(&report_data.keys_state, KEYBOARD_REPORT_KEY_COUNT_MAX);
@@ -7,9 +7,11 @@
 #include <limits.h>
 #include <sys/types.h>
 
+#include <zephyr/kernel.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/byteorder.h>
+#include <nrf_profiler.h>
 
 #include <caf/events/button_event.h>
 #include "motion_event.h"
@@ -19,6 +21,7 @@
 
 #include "hid_keymap.h"
 #include "hid_report_desc.h"
+#include "motion_latency.h"
 
 #define MODULE hid_provider_mouse
 #include <caf/events/module_state_event.h>
@@ -29,6 +32,8 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LOG_LEVEL);
 /* Make sure that mouse buttons would fit in button bitmask. */
 BUILD_ASSERT(MOUSE_REPORT_BUTTON_COUNT_MAX <= BITS_PER_BYTE);
 
+#define LATENCY_EVENT_NAME	"mouse_motion_latency"
+
 enum SYNC_DATA {
 	SYNC_DATA_MOTION,
 };
@@ -48,6 +53,65 @@ static bool boot_mode;
 
 static const struct hid_state_api *hid_state_api;
 static struct report_data report_data;
+static struct motion_latency latency;
+static uint16_t latency_event_id;
+
+
+static int64_t latency_time_us(void)
+{
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+static void latency_reset(uint8_t pipeline_cnt)
+{
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LATENCY_PROFILING)) {
+		motion_latency_reset(&latency, pipeline_cnt);
+	}
+}
+
+static void latency_motion_received(void)
+{
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LATENCY_PROFILING)) {
+		motion_latency_motion_received(&latency, latency_time_us());
+	}
+}
+
+static void latency_report_submitted(bool motion_left)
+{
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LATENCY_PROFILING)) {
+		motion_latency_report_submitted(&latency, motion_left);
+	}
+}
+
+static void latency_report_sent(bool error)
+{
+	if (!IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LATENCY_PROFILING)) {
+		return;
+	}
+
+	uint32_t latency_us;
+
+	if (!motion_latency_report_sent(&latency, latency_time_us(), error, &latency_us) ||
+	    !is_profiling_enabled(latency_event_id)) {
+		return;
+	}
+
+	struct log_event_buf buf;
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_uint32(&buf, latency_us);
+	nrf_profiler_log_send(&buf, latency_event_id);
+}
+
+static void latency_init(void)
+{
+	static const char * const args[] = {"latency_us"};
+	static const enum nrf_profiler_arg arg_types[] = {NRF_PROFILER_ARG_U32};
+
+	latency_event_id = nrf_profiler_register_event_type(LATENCY_EVENT_NAME, args, arg_types,
+							    ARRAY_SIZE(args));
+	motion_latency_reset(&latency, 0);
+}
 
 
 static void clear_report_data(struct report_data *rd)
@@ -154,6 +218,8 @@ static bool send_report_mouse(uint8_t report_id, bool force)
 	APP_EVENT_SUBMIT(event);
 
 	rd->pipeline_cnt++;
+	latency_report_submitted((rd->axes[MOUSE_REPORT_AXIS_X] != 0) ||
+				 (rd->axes[MOUSE_REPORT_AXIS_Y] != 0));
 
 	if ((rd->axes[MOUSE_REPORT_AXIS_X] != 0) || (rd->axes[MOUSE_REPORT_AXIS_Y] != 0) ||
 	    (rd->axes[MOUSE_REPORT_AXIS_WHEEL] < -1) || (rd->axes[MOUSE_REPORT_AXIS_WHEEL] > 1)) {
@@ -216,6 +282,8 @@ static bool send_report_boot_mouse(uint8_t report_id, bool force)
 	APP_EVENT_SUBMIT(event);
 
 	rd->pipeline_cnt++;
+	latency_report_submitted((rd->axes[MOUSE_REPORT_AXIS_X] != 0) ||
+				 (rd->axes[MOUSE_REPORT_AXIS_Y] != 0));
 
 	if ((rd->axes[MOUSE_REPORT_AXIS_X] != 0) || (rd->axes[MOUSE_REPORT_AXIS_Y] != 0)) {
 		/* If there is some axis data to send, request report update. */
@@ -264,6 +332,8 @@ static void mouse_report_connection_state_changed(uint8_t report_id,
 		/* Clear whole report data. */
 		clear_report_data(rd);
 	}
+
+	latency_reset(rd->pipeline_cnt);
 }
 
 static void mouse_report_sent(uint8_t report_id, bool error)
@@ -283,6 +353,8 @@ static void mouse_report_sent(uint8_t report_id, bool error)
 	__ASSERT_NO_MSG(report_data.pipeline_cnt > 0);
 	report_data.pipeline_cnt--;
 
+	latency_report_sent(error);
+
 	if (error) {
 		LOG_WRN("Error while sending report");
 		/* HID state will send subsequent HID mouse report to update state. No need to do
@@ -328,6 +400,8 @@ static void update_key(uint16_t usage_id, bool pressed)
 
 static void init(void)
 {
+	hid_keymap_init();
+
 	static const struct hid_report_provider_api provider_api_mouse = {
 		.send_report = send_report_mouse,
 		.send_empty_report = send_empty_report,
@@ -337,6 +411,10 @@ static void init(void)
 
 	struct hid_report_provider_event *rp_event;
 
+	if (IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_PROVIDER_MOUSE_LATENCY_PROFILING)) {
+		latency_init();
+	}
+
 	rp_event = new_hid_report_provider_event();
 	rp_event->report_id = REPORT_ID_MOUSE;
 	rp_event->provider_api = &provider_api_mouse;
@@ -364,6 +442,10 @@ static bool handle_motion_event(const struct motion_event *event)
 	report_data.axes[MOUSE_REPORT_AXIS_X] += event->dx;
 	report_data.axes[MOUSE_REPORT_AXIS_Y] += event->dy;
 
+	if ((event->dx != 0) || (event->dy != 0)) {
+		latency_motion_received();
+	}
+
 	WRITE_BIT(report_data.sync_data_wait_bm, SYNC_DATA_MOTION, 0);
 	WRITE_BIT(report_data.sync_data_active_bm, SYNC_DATA_MOTION, event->active);
 
@@ -8,18 +8,74 @@
 #include CONFIG_DESKTOP_HID_KEYMAP_DEF_PATH
 
 #include <stdint.h>
-#include <stdlib.h>
+#include <inttypes.h>
 #include <zephyr/kernel.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(hid_keymap, CONFIG_DESKTOP_HID_KEYMAP_LOG_LEVEL);
 
+/* The hash table stores indexes of the hid_keymap array entries incremented by one, so that
+ * zero marks an empty slot. The table has at least twice as many slots as there are entries,
+ * so that a lookup needs about one probe on average. The size of the table is known at build
+ * time, the table is filled by hid_keymap_init. The slots take one byte, unless the keymap has
+ * too many entries to be indexed with one byte.
+ */
+#define KEYMAP_HASH_BITS	LOG2CEIL(2 * ARRAY_SIZE(hid_keymap))
+#define KEYMAP_HASH_SIZE	BIT(KEYMAP_HASH_BITS)
+#define KEYMAP_HASH_EMPTY	0
+#define KEYMAP_HASH_SMALL	(ARRAY_SIZE(hid_keymap) < UINT8_MAX)
+
+BUILD_ASSERT(KEYMAP_HASH_BITS <= 16,
+	     "The hid_keymap array is too big to be indexed by the hash table");
+
+/* Only the table matching the keymap size is used, the other one takes a single slot. */
+static uint8_t keymap_hash_small[KEYMAP_HASH_SMALL ? KEYMAP_HASH_SIZE : 1];
+static uint16_t keymap_hash_large[KEYMAP_HASH_SMALL ? 1 : KEYMAP_HASH_SIZE];
 static bool initialized;
 
+static size_t keymap_hash_get(size_t slot)
+{
+	return KEYMAP_HASH_SMALL ? keymap_hash_small[slot] : keymap_hash_large[slot];
+}
+
+static void keymap_hash_set(size_t slot, size_t value)
+{
+	if (KEYMAP_HASH_SMALL) {
+		keymap_hash_small[slot] = value;
+	} else {
+		keymap_hash_large[slot] = value;
+	}
+}
+
+static size_t keymap_hash_slot(uint16_t key_id)
+{
+	/* Fibonacci hashing spreads key IDs of neighbor rows and columns across the table. */
+	return (uint16_t)(key_id * 40503U) >> (16 - KEYMAP_HASH_BITS);
+}
+
+static void keymap_hash_build(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(hid_keymap); i++) {
+		size_t slot = keymap_hash_slot(hid_keymap[i].key_id);
+
+		while (keymap_hash_get(slot) != KEYMAP_HASH_EMPTY) {
+			__ASSERT(hid_keymap[keymap_hash_get(slot) - 1].key_id != hid_keymap[i].key_id,
+				 "Key ID 0x%" PRIx16 " is mapped more than once in hid_keymap!",
+				 hid_keymap[i].key_id);
+			slot = (slot + 1) & (KEYMAP_HASH_SIZE - 1);
+		}
+
+		keymap_hash_set(slot, i + 1);
+	}
+}
 
 void hid_keymap_init(void)
 {
-	if (IS_ENABLED(CONFIG_ASSERT) && !initialized) {
+	if (initialized) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_ASSERT)) {
 		/* Validate the order of key IDs on the key map array. */
 		for (size_t i = 1; i < ARRAY_SIZE(hid_keymap); i++) {
 			__ASSERT(hid_keymap[i - 1].key_id < hid_keymap[i].key_id,
@@ -32,18 +88,10 @@ void hid_keymap_init(void)
 				 (hid_keymap[i].report_id < REPORT_ID_COUNT),
 				 "Invalid report ID used in hid_keymap!");
 		}
-
-		initialized = true;
 	}
-}
-
-/* Compare Key ID in HID Keymap entries. */
-static int hid_keymap_compare(const void *a, const void *b)
-{
-	const struct hid_keymap *p_a = a;
-	const struct hid_keymap *p_b = b;
 
-	return (p_a->key_id - p_b->key_id);
+	keymap_hash_build();
+	initialized = true;
 }
 
 /** Translate Key ID to HID report ID and HID usage ID pair. */
@@ -63,15 +111,18 @@ const struct hid_keymap *hid_keymap_get(uint16_t key_id)
 		}
 	}
 
-	struct hid_keymap key = {
-		.key_id = key_id
-	};
+	__ASSERT(initialized, "The hid_keymap is not initialized");
 
-	const struct hid_keymap *map = bsearch(&key,
-					       hid_keymap,
-					       ARRAY_SIZE(hid_keymap),
-					       sizeof(key),
-					       hid_keymap_compare);
+	const struct hid_keymap *map = NULL;
+
+	for (size_t slot = keymap_hash_slot(key_id);
+	     keymap_hash_get(slot) != KEYMAP_HASH_EMPTY;
+	     slot = (slot + 1) & (KEYMAP_HASH_SIZE - 1)) {
+		if (hid_keymap[keymap_hash_get(slot) - 1].key_id == key_id) {
+			map = &hid_keymap[keymap_hash_get(slot) - 1];
+			break;
+		}
+	}
 
 	if (IS_ENABLED(CONFIG_DESKTOP_HID_KEYMAP_CACHE) && map) {
 		/* Update cached mapping. */
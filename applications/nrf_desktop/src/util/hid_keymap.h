@@ -36,8 +36,8 @@ struct hid_keymap {
  * @brief Initialize HID keymap
  *
  * If assertions (@kconfig{CONFIG_ASSERT}) are enabled, the function validates if the ``hid_keymap``
- * array defined as part of the configuration is sorted ascending by key ID. The array must be
- * sorted, because HID keymap utility uses binary search to speed up searching through the array.
+ * array defined as part of the configuration is sorted ascending by key ID and if every key ID is
+ * mapped only once. The function also fills the hash table used to map the key IDs.
  *
  * The function must be called before using other HID keymap APIs. The function can be called
  * multiple times.
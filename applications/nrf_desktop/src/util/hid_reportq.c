@@ -5,7 +5,6 @@
  */
 
 #include <stdint.h>
-#include <zephyr/sys/slist.h>
 #include <zephyr/kernel.h>
 
 #include "hid_reportq.h"
@@ -18,18 +17,15 @@ LOG_MODULE_REGISTER(hid_reportq, CONFIG_DESKTOP_HID_REPORTQ_LOG_LEVEL);
 #define MAX_ENQUEUED_REPORTS	CONFIG_DESKTOP_HID_REPORTQ_MAX_ENQUEUED_REPORTS
 #define REPORT_IDX_UNSUPPORTED	UINT8_MAX
 
-struct enqueued_report {
-	sys_snode_t node;
-	struct hid_report_event *event;
-};
-
-struct counted_list {
-	sys_slist_t list;
-	size_t node_count;
+struct report_ring {
+	struct hid_report_event *events[MAX_ENQUEUED_REPORTS];
+	uint8_t head;
+	uint8_t cnt;
 };
 
 struct hid_reportq {
-	struct counted_list report_lists[ARRAY_SIZE(input_reports)];
+	struct report_ring report_rings[ARRAY_SIZE(input_reports)];
+	struct hid_reportq_stats stats;
 	uint16_t enabled_report_idx_bm;
 	uint8_t last_sent_report_idx;
 	uint8_t report_max;
@@ -42,77 +38,61 @@ static struct hid_reportq queues[CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT];
 /* Ensure that enabled_report_idx_bm can handle all of the report indexes. */
 BUILD_ASSERT(ARRAY_SIZE(input_reports) <= 16);
 
-static struct enqueued_report *get_enqueued_report(struct counted_list *cnt_list)
-{
-	sys_snode_t *node = sys_slist_get(&cnt_list->list);
+BUILD_ASSERT(MAX_ENQUEUED_REPORTS <= UINT8_MAX);
 
-	if (!node) {
-		return NULL;
-	}
-
-	__ASSERT_NO_MSG(cnt_list->node_count > 0);
-	cnt_list->node_count--;
-
-	return CONTAINER_OF(node, struct enqueued_report, node);
-}
-
-static void enqueue_report(struct counted_list *cnt_list, struct enqueued_report *report)
-{
-	__ASSERT_NO_MSG(cnt_list->node_count < MAX_ENQUEUED_REPORTS);
-	cnt_list->node_count++;
-
-	sys_slist_append(&cnt_list->list, &report->node);
-}
-
-static struct hid_report_event *get_enqueued_event(struct counted_list *cnt_list)
+static struct hid_report_event *get_enqueued_event(struct hid_reportq *q,
+						   struct report_ring *ring)
 {
-	struct enqueued_report *report = get_enqueued_report(cnt_list);
-
-	if (!report) {
+	if (ring->cnt == 0) {
 		return NULL;
 	}
 
-	struct hid_report_event *event = report->event;
+	struct hid_report_event *event = ring->events[ring->head];
 
-	k_free(report);
+	ring->events[ring->head] = NULL;
+	ring->head = (ring->head + 1) % MAX_ENQUEUED_REPORTS;
+	ring->cnt--;
+
+	__ASSERT_NO_MSG(q->stats.depth > 0);
+	q->stats.depth--;
 
 	return event;
 }
 
-static void drop_enqueued_events(struct counted_list *cnt_list)
+static void drop_enqueued_events(struct hid_reportq *q, struct report_ring *ring)
 {
-	struct hid_report_event *event = get_enqueued_event(cnt_list);
+	struct hid_report_event *event = get_enqueued_event(q, ring);
 
 	while (event) {
 		app_event_manager_free(event);
-		event = get_enqueued_event(cnt_list);
+		event = get_enqueued_event(q, ring);
 	}
 
-	__ASSERT_NO_MSG(cnt_list->node_count == 0);
+	__ASSERT_NO_MSG(ring->cnt == 0);
 }
 
-static void enqueue_event(struct counted_list *cnt_list, struct hid_report_event *event)
+static void enqueue_event(struct hid_reportq *q, struct report_ring *ring,
+			  struct hid_report_event *event)
 {
-	struct enqueued_report *report;
+	if (ring->cnt == MAX_ENQUEUED_REPORTS) {
+		/* Logging every drop would only add to the load. Drops are counted instead. */
+		LOG_DBG("Enqueue dropped the oldest report");
 
-	if (cnt_list->node_count < MAX_ENQUEUED_REPORTS) {
-		report = k_malloc(sizeof(*report));
-	} else {
-		LOG_WRN("Enqueue dropped the oldest report");
-
-		report = get_enqueued_report(cnt_list);
-		__ASSERT_NO_MSG(report);
-		app_event_manager_free(report->event);
+		app_event_manager_free(get_enqueued_event(q, ring));
+		q->stats.drop_cnt++;
 	}
 
-	if (!report) {
-		LOG_ERR("Cannot allocate enqueued_report");
-		/* Should never happen. */
-		__ASSERT_NO_MSG(false);
-	} else {
-		report->event = event;
-		enqueue_report(cnt_list, report);
-	}
+	ring->events[(ring->head + ring->cnt) % MAX_ENQUEUED_REPORTS] = event;
+	ring->cnt++;
+
+	q->stats.depth++;
+	q->stats.max_depth = MAX(q->stats.max_depth, q->stats.depth);
+}
+
+static void submit_event(struct hid_reportq *q, struct hid_report_event *event)
+{
+	APP_EVENT_SUBMIT(event);
+	q->stats.submitted_cnt++;
 }
 
 static struct hid_reportq *reportq_find_free(void)
@@ -139,9 +119,8 @@ struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max)
 		return NULL;
 	}
 
-	for (size_t i = 0; i < ARRAY_SIZE(q->report_lists); i++) {
-		__ASSERT_NO_MSG(q->report_lists[i].node_count == 0);
-		sys_slist_init(&q->report_lists[i].list);
+	for (size_t i = 0; i < ARRAY_SIZE(q->report_rings); i++) {
+		__ASSERT_NO_MSG(q->report_rings[i].cnt == 0);
 	}
 
 	__ASSERT_NO_MSG(q->enabled_report_idx_bm == 0);
@@ -151,6 +130,7 @@ struct hid_reportq *hid_reportq_alloc(const void *sub_id, uint8_t report_max)
 
 	q->sub_id = sub_id;
 	q->report_max = report_max;
+	memset(&q->stats, 0, sizeof(q->stats));
 
 	return q;
 }
@@ -160,8 +140,8 @@ void hid_reportq_free(struct hid_reportq *q)
 	/* Make sure that queue was allocated. */
 	__ASSERT_NO_MSG(q->sub_id);
 
-	for (size_t i = 0; i < ARRAY_SIZE(q->report_lists); i++) {
-		drop_enqueued_events(&q->report_lists[i]);
+	for (size_t i = 0; i < ARRAY_SIZE(q->report_rings); i++) {
+		drop_enqueued_events(q, &q->report_rings[i]);
 	}
 
 	q->enabled_report_idx_bm = 0;
@@ -215,16 +195,18 @@ int hid_reportq_report_add(struct hid_reportq *q, const void *src_id, uint8_t re
 	event->source = src_id;
 	event->subscriber = q->sub_id;
 
-	/* Forward report as is adding report id on the front. */
+	/* Forward report as is adding report id on the front. The data must be copied, because it
+	 * belongs to the source and is valid only until this function returns.
+	 */
 	event->dyndata.data[0] = rep_id;
 	memcpy(&event->dyndata.data[1], data, size);
 
 	if (q->report_cnt < q->report_max) {
-		APP_EVENT_SUBMIT(event);
+		submit_event(q, event);
 		q->last_sent_report_idx = rep_idx;
 		q->report_cnt++;
 	} else {
-		enqueue_event(&q->report_lists[rep_idx], event);
+		enqueue_event(q, &q->report_rings[rep_idx], event);
 	}
 
 	return 0;
@@ -235,17 +217,21 @@ static struct hid_report_event *get_next_enqueued_event(struct hid_reportq *q)
 	uint8_t rep_idx = q->last_sent_report_idx;
 	struct hid_report_event *event;
 
+	if (q->stats.depth == 0) {
+		return NULL;
+	}
+
 	do {
-		rep_idx = (rep_idx + 1) % ARRAY_SIZE(q->report_lists);
+		rep_idx = (rep_idx + 1) % ARRAY_SIZE(q->report_rings);
 
-		event = get_enqueued_event(&q->report_lists[rep_idx]);
+		event = get_enqueued_event(q, &q->report_rings[rep_idx]);
 		if (event) {
 			q->last_sent_report_idx = rep_idx;
 			return event;
 		}
 	} while (rep_idx != q->last_sent_report_idx);
 
-	return get_enqueued_event(&q->report_lists[rep_idx]);
+	return get_enqueued_event(q, &q->report_rings[rep_idx]);
 }
 
 void hid_reportq_report_sent(struct hid_reportq *q, uint8_t rep_id, bool err)
@@ -259,12 +245,20 @@ void hid_reportq_report_sent(struct hid_reportq *q, uint8_t rep_id, bool err)
 	struct hid_report_event *event = get_next_enqueued_event(q);
 
 	if (event) {
-		APP_EVENT_SUBMIT(event);
+		submit_event(q, event);
 	} else {
 		q->report_cnt--;
 	}
 }
 
+void hid_reportq_stats_get(struct hid_reportq *q, struct hid_reportq_stats *stats)
+{
+	/* Make sure that queue was allocated. */
+	__ASSERT_NO_MSG(q->sub_id);
+
+	*stats = q->stats;
+}
+
 bool hid_reportq_is_subscribed(struct hid_reportq *q, uint8_t rep_id)
 {
 	/* Make sure that queue was allocated. */
@@ -292,7 +286,7 @@ int hid_reportq_subscribe(struct hid_reportq *q, uint8_t rep_id)
 	}
 
 	WRITE_BIT(q->enabled_report_idx_bm, rep_idx, 1);
-	__ASSERT_NO_MSG(q->report_lists[rep_idx].node_count == 0);
+	__ASSERT_NO_MSG(q->report_rings[rep_idx].cnt == 0);
 
 	return 0;
 }
@@ -309,7 +303,7 @@ int hid_reportq_unsubscribe(struct hid_reportq *q, uint8_t rep_id)
 	}
 
 	WRITE_BIT(q->enabled_report_idx_bm, rep_idx, 0);
-	drop_enqueued_events(&q->report_lists[rep_idx]);
+	drop_enqueued_events(q, &q->report_rings[rep_idx]);
 
 	return 0;
 }
@@ -25,6 +25,21 @@ extern "C" {
 /** Opaque type representing HID report queue object. */
 struct hid_reportq;
 
+/** HID report queue statistics. */
+struct hid_reportq_stats {
+	/** Number of HID report events submitted to the HID subscriber. */
+	uint32_t submitted_cnt;
+
+	/** Number of enqueued HID reports dropped because the queue was full. */
+	uint32_t drop_cnt;
+
+	/** Number of currently enqueued HID reports. */
+	uint16_t depth;
+
+	/** Maximum number of HID reports enqueued at the same time. */
+	uint16_t max_depth;
+};
+
 /**
  * @brief Allocate a HID report queue object instance.
  *
@@ -84,6 +99,16 @@ int hid_reportq_report_add(struct hid_reportq *q, const void *src_id, uint8_t re
  */
 void hid_reportq_report_sent(struct hid_reportq *q, uint8_t rep_id, bool err);
 
+/**
+ * @brief Get statistics of a HID report queue object instance.
+ *
+ * The statistics are cleared when the queue is allocated.
+ *
+ * @param[in] q		Pointer to the queue instance.
+ * @param[out] stats	Pointer to the structure filled with the statistics.
+ */
+void hid_reportq_stats_get(struct hid_reportq *q, struct hid_reportq_stats *stats);
+
 /**
  * @brief Check if HID report queue is subscribed for HID report with given ID.
  *
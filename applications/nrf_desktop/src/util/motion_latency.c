@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "motion_latency.h"
+
+#include <stddef.h>
+
+#include <zephyr/sys/util.h>
+
+#define NO_MOTION	(-1)
+
+
+void motion_latency_reset(struct motion_latency *ml, uint8_t pipeline_cnt)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(ml->report_us); i++) {
+		ml->report_us[i] = NO_MOTION;
+	}
+
+	ml->motion_us = NO_MOTION;
+	ml->head = 0;
+	ml->cnt = MIN(pipeline_cnt, MOTION_LATENCY_FIFO_SIZE);
+}
+
+void motion_latency_motion_received(struct motion_latency *ml, int64_t now_us)
+{
+	if (ml->motion_us == NO_MOTION) {
+		ml->motion_us = now_us;
+	}
+}
+
+void motion_latency_report_submitted(struct motion_latency *ml, bool motion_left)
+{
+	if (ml->cnt < MOTION_LATENCY_FIFO_SIZE) {
+		ml->report_us[(ml->head + ml->cnt) % MOTION_LATENCY_FIFO_SIZE] = ml->motion_us;
+		ml->cnt++;
+	}
+
+	/* Motion that did not fit in the HID report keeps its receive time. */
+	if (!motion_left) {
+		ml->motion_us = NO_MOTION;
+	}
+}
+
+bool motion_latency_report_sent(struct motion_latency *ml, int64_t now_us, bool error,
+				uint32_t *latency_us)
+{
+	if (ml->cnt == 0) {
+		return false;
+	}
+
+	int64_t motion_us = ml->report_us[ml->head];
+
+	ml->head = (ml->head + 1) % MOTION_LATENCY_FIFO_SIZE;
+	ml->cnt--;
+
+	if ((motion_us == NO_MOTION) || error) {
+		return false;
+	}
+
+	*latency_us = now_us - motion_us;
+
+	return true;
+}
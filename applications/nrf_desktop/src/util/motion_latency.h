@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _MOTION_LATENCY_H_
+#define _MOTION_LATENCY_H_
+
+/**
+ * @file
+ * @defgroup motion_latency Motion latency
+ * @{
+ * @brief Utility used to track latency of the motion sent in HID reports.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Maximum number of tracked HID reports in flight. */
+#define MOTION_LATENCY_FIFO_SIZE	8
+
+/** @brief Motion latency structure. */
+struct motion_latency {
+	/** Receive time of the oldest motion not yet included in a HID report. */
+	int64_t motion_us;
+	/** Motion receive time of the HID reports in flight. */
+	int64_t report_us[MOTION_LATENCY_FIFO_SIZE];
+	uint8_t head; /**< Index of the oldest HID report in flight. */
+	uint8_t cnt; /**< Number of the HID reports in flight. */
+};
+
+/**
+ * @brief Reset a motion latency object.
+ *
+ * The HID reports that are already in flight are tracked as reports without motion.
+ *
+ * @param[in] ml		A motion latency object.
+ * @param[in] pipeline_cnt	Number of the HID reports in flight.
+ */
+void motion_latency_reset(struct motion_latency *ml, uint8_t pipeline_cnt);
+
+/**
+ * @brief Notify motion latency about received motion
+ *
+ * Only the receive time of the oldest motion that is not yet included in a HID report is kept.
+ *
+ * @param[in] ml	A motion latency object.
+ * @param[in] now_us	Current time in microseconds.
+ */
+void motion_latency_motion_received(struct motion_latency *ml, int64_t now_us);
+
+/**
+ * @brief Notify motion latency about a submitted HID report
+ *
+ * If the FIFO of the HID reports in flight is full, the HID report is not tracked.
+ *
+ * @param[in] ml		A motion latency object.
+ * @param[in] motion_left	Information if some motion did not fit in the HID report.
+ */
+void motion_latency_report_submitted(struct motion_latency *ml, bool motion_left);
+
+/**
+ * @brief Notify motion latency about a sent HID report
+ *
+ * @param[in] ml		A motion latency object.
+ * @param[in] now_us		Current time in microseconds.
+ * @param[in] error		Information if the HID report was not sent because of an error.
+ * @param[out] latency_us	Time between receiving the oldest motion included in the HID
+ *				report and sending the HID report.
+ *
+ * @retval true if the HID report contained motion and was sent successfully.
+ * @retval false otherwise.
+ */
+bool motion_latency_report_sent(struct motion_latency *ml, int64_t now_us, bool error,
+				uint32_t *latency_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /*_MOTION_LATENCY_H_ */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "motion_sample_align.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include <zephyr/sys/util.h>
+
+
+void motion_sample_align_reset(struct motion_sample_align *sa)
+{
+	memset(sa, 0, sizeof(*sa));
+}
+
+static void period_store(struct motion_sample_align *sa, int64_t period)
+{
+	if (period > MOTION_SAMPLE_ALIGN_PERIOD_MAX_US) {
+		/* Break in the HID report stream, measure the period again. */
+		sa->period_idx = 0;
+		sa->period_cnt = 0;
+	} else if (period >= MOTION_SAMPLE_ALIGN_PERIOD_MIN_US) {
+		sa->period_us[sa->period_idx] = period;
+		sa->period_idx = (sa->period_idx + 1) % MOTION_SAMPLE_ALIGN_WINDOW;
+		if (sa->period_cnt < MOTION_SAMPLE_ALIGN_WINDOW) {
+			sa->period_cnt++;
+		}
+	}
+}
+
+uint32_t motion_sample_align_delay_get(struct motion_sample_align *sa, int64_t sent_us,
+				       uint32_t lead_us)
+{
+	if (sa->last_sent_valid) {
+		period_store(sa, sent_us - sa->last_sent_us);
+	}
+
+	sa->last_sent_us = sent_us;
+	sa->last_sent_valid = true;
+
+	uint32_t period_min = UINT32_MAX;
+
+	for (size_t i = 0; i < sa->period_cnt; i++) {
+		period_min = MIN(period_min, sa->period_us[i]);
+	}
+
+	if ((sa->period_cnt == 0) || (period_min <= lead_us)) {
+		return 0;
+	}
+
+	return period_min - lead_us;
+}
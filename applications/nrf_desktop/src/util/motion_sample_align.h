@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _MOTION_SAMPLE_ALIGN_H_
+#define _MOTION_SAMPLE_ALIGN_H_
+
+/**
+ * @file
+ * @defgroup motion_sample_align Motion sample alignment
+ * @{
+ * @brief Utility used to align motion sensor sampling with HID report transmission.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Number of the recently measured HID report transmission periods taken into account. */
+#define MOTION_SAMPLE_ALIGN_WINDOW		8
+
+/* HID report transmission periods outside of this range are not taken into account. The shorter
+ * ones come from multiple HID reports sent in a single Bluetooth LE connection event, the longer
+ * ones from a break in the HID report stream.
+ */
+#define MOTION_SAMPLE_ALIGN_PERIOD_MIN_US	100
+#define MOTION_SAMPLE_ALIGN_PERIOD_MAX_US	50000
+
+/** @brief Motion sample alignment structure. */
+struct motion_sample_align {
+	int64_t last_sent_us; /**< Time of the last HID report transmission. */
+	uint32_t period_us[MOTION_SAMPLE_ALIGN_WINDOW]; /**< Measured periods. */
+	uint8_t period_idx; /**< Index of the oldest measured period. */
+	uint8_t period_cnt; /**< Number of measured periods. */
+	bool last_sent_valid; /**< Information if the last HID report transmission time is known. */
+};
+
+/**
+ * @brief Reset a motion sample alignment object.
+ *
+ * The function drops all of the measured HID report transmission periods.
+ *
+ * @param[in] sa	A motion sample alignment object.
+ */
+void motion_sample_align_reset(struct motion_sample_align *sa);
+
+/**
+ * @brief Notify motion sample alignment about a HID report transmission
+ *
+ * The utility measures the period between subsequent HID report transmissions. The shortest
+ * recently measured period is used to estimate the subsequent transmission, so that a HID report
+ * that missed its transmission opportunity does not delay subsequent samples even more.
+ *
+ * @param[in] sa	A motion sample alignment object.
+ * @param[in] sent_us	Time of the HID report transmission in microseconds.
+ * @param[in] lead_us	Time between the motion sensor sample and the HID report transmission.
+ *
+ * @return Delay of the subsequent motion sensor sample in microseconds. Zero means that the
+ *	   sensor should be sampled right away, because the period is not known or is not longer
+ *	   than the lead time.
+ */
+uint32_t motion_sample_align_delay_get(struct motion_sample_align *sa, int64_t sent_us,
+				       uint32_t lead_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /*_MOTION_SAMPLE_ALIGN_H_ */
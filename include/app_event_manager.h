@@ -55,6 +55,11 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+	/** places events in the high priority queue, which is processed before the queue
+	 *  of other events. Used only if CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES is enabled.
+	 *  Flag set by user.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -178,6 +183,32 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Define an event type with its own memory slab size.
+ *
+ * This macro works like @ref APP_EVENT_TYPE_DEFINE. If CONFIG_APP_EVENT_MANAGER_EVENT_SLABS
+ * is enabled, the memory slab of the event type has @p slab_block_cnt blocks, and every block
+ * also fits @p slab_dyndata_size bytes of dynamic data, instead of the sizes set by
+ * CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT and CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE.
+ * Otherwise, the slab sizes are ignored.
+ *
+ * Use it for frequently submitted events, especially the ones with dynamic data of known
+ * maximum size.
+ *
+ * @param ename     	   Name of the event.
+ * @param log_fn  	   Function to stringify an event of this type.
+ * @param ev_info_struct   Data structure describing the event type.
+ * @param app_event_type_flags Event type flags.
+ *                         You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param slab_block_cnt   Number of blocks in the memory slab of the event type.
+ * @param slab_dyndata_size Size of the dynamic data (in bytes) that fits into the slab block.
+ *                         Ignored for event types without dynamic data.
+ */
+#define APP_EVENT_TYPE_SLAB_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+				   slab_block_cnt, slab_dyndata_size)			\
+	_APP_EVENT_TYPE_SLAB_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags,	\
+				    slab_block_cnt, slab_dyndata_size)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -211,6 +242,21 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_MANAGER_HOOK_POSTINIT_REGISTER(hook_fn,	\
 	_APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
 
+/**
+ * @brief Register event free hook.
+ *
+ * The event hook called when the event memory is freed, for the modules that provide the memory
+ * of the events they submit.
+ * The hook function should have a form `bool hook(void *addr)`.
+ * The hook returns true if the memory belongs to the module and has been released.
+ * Then, the remaining hooks are not called and the memory is not freed in other way.
+ *
+ * @param hook_fn Hook function.
+ */
+#define APP_EVENT_MANAGER_HOOK_FREE_REGISTER(hook_fn)	\
+	_APP_EVENT_MANAGER_HOOK_FREE_REGISTER(hook_fn,	\
+	_APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
+
 /**
  * @brief Get the event size
  *
@@ -396,6 +442,12 @@ void *app_event_manager_alloc(size_t size);
  *
  * The behavior of this function depends on the actual implementation.
  * The default implementation of this function is same as k_free.
+ * If CONFIG_APP_EVENT_MANAGER_EVENT_SLABS is enabled, the default implementation
+ * first returns events allocated from memory slabs using
+ * @ref app_event_manager_slab_free.
+ * If CONFIG_APP_EVENT_MANAGER_FREE_HOOKS is enabled, the default implementation
+ * also passes the memory to the registered free hooks using
+ * @ref app_event_manager_free_hooks_call.
  * It is annotated as weak and can be overridden by user.
  *
  * @param addr  Pointer to previously allocated memory.
@@ -403,6 +455,76 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Pass the event memory to the registered free hooks.
+ *
+ * A custom implementation of @ref app_event_manager_free must call this function
+ * if CONFIG_APP_EVENT_MANAGER_FREE_HOOKS is enabled.
+ *
+ * @param addr  Pointer to previously allocated memory.
+ * @retval true If one of the hooks has released the memory.
+ * @retval false If the memory must be freed in other way.
+ */
+bool app_event_manager_free_hooks_call(void *addr);
+
+
+/** @brief Event memory slab statistics.
+ */
+struct app_event_manager_slab_stats {
+	/** Size of the slab block (in bytes). */
+	size_t block_size;
+
+	/** Number of blocks in the slab. */
+	uint32_t num_blocks;
+
+	/** Number of blocks currently in use. */
+	uint32_t num_used;
+
+	/** Maximum number of blocks that were in use at the same time. */
+	uint32_t max_used;
+
+	/** Number of allocations that could not be served by the slab. */
+	uint32_t fallback_cnt;
+};
+
+/** @brief Allocate event of the given type.
+ *
+ * The event is allocated from the memory slab of the event type. If the slab is exhausted
+ * or the event is larger than the slab block, the event is allocated using
+ * @ref app_event_manager_alloc if CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_FALLBACK is enabled.
+ * Otherwise, the allocation failure is handled like in the default implementation of
+ * @ref app_event_manager_alloc.
+ *
+ * The function is used by the event allocators generated for the event types if
+ * CONFIG_APP_EVENT_MANAGER_EVENT_SLABS is enabled.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Size of the event (in bytes), including the dynamic data.
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *app_event_manager_slab_alloc(const struct event_type *et, size_t size);
+
+
+/** @brief Free event if it was allocated from the memory slab of its type.
+ *
+ * A custom implementation of @ref app_event_manager_free must call this function
+ * first if CONFIG_APP_EVENT_MANAGER_EVENT_SLABS is enabled.
+ *
+ * @param addr  Pointer to previously allocated event.
+ * @retval true If the event was allocated from a memory slab and has been freed.
+ * @retval false If the event was not allocated from a memory slab.
+ */
+bool app_event_manager_slab_free(void *addr);
+
+
+/** @brief Get memory slab statistics of the event type.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_slab_stats_get(const struct event_type *et,
+				      struct app_event_manager_slab_stats *stats);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
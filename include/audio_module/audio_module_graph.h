@@ -0,0 +1,279 @@
+/*
+ * Copyright(c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _AUDIO_MODULE_GRAPH_H_
+#define _AUDIO_MODULE_GRAPH_H_
+
+/**
+ * @file
+ * @defgroup audio_module_graph Audio module graph
+ * @{
+ * @brief Run a pipeline of audio modules in a single thread.
+ *
+ * The modules in a graph share a deadline, such as one audio frame. Each call to
+ * audio_module_graph_process() runs every module once in topological order, in the calling
+ * thread. The modules pass their output to the next modules in reference counted buffers from a
+ * common pool, so no messages are queued and no module threads are woken up. A buffer is
+ * returned to the pool as soon as the last module that reads it is done, so a chain of modules
+ * only needs two buffers.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/kernel.h>
+
+#include "audio_module.h"
+
+/**
+ * @brief An audio data buffer from a pool.
+ */
+struct audio_module_buffer {
+	/* The audio data, which points to the data area of the buffer. */
+	struct audio_data audio_data;
+
+	/* Number of users of the buffer. */
+	atomic_t ref_count;
+
+	/* The pool the buffer is returned to. */
+	struct audio_module_buffer_pool *pool;
+};
+
+/**
+ * @brief A pool of audio data buffers of the same size.
+ */
+struct audio_module_buffer_pool {
+	/* Memory for the buffers. */
+	char *buffer;
+
+	/* Slab that hands out the buffers. */
+	struct k_mem_slab slab;
+
+	/* Number of buffers. */
+	uint32_t buffers_num;
+
+	/* Size of the data area of each buffer in bytes. */
+	size_t data_size;
+};
+
+/**
+ * @brief Size of the memory used by a buffer with the given size of the data area.
+ */
+#define AUDIO_MODULE_BUFFER_BLOCK_SIZE(data_size)                                                  \
+	(WB_UP(sizeof(struct audio_module_buffer)) + WB_UP(data_size))
+
+/**
+ * @brief Define a pool of audio data buffers.
+ *
+ * @note The pool must be initialized with audio_module_buffer_pool_init() before use.
+ */
+#define AUDIO_MODULE_BUFFER_POOL_DEFINE(name, buffers_num_in, data_size_in)                        \
+	char __aligned(WB_UP(1))                                                                   \
+		_pool_buffer_##name[(buffers_num_in) * AUDIO_MODULE_BUFFER_BLOCK_SIZE(data_size_in)];  \
+	struct audio_module_buffer_pool name = {.buffer = _pool_buffer_##name,                     \
+						.buffers_num = (buffers_num_in),                   \
+						.data_size = (data_size_in)}
+
+/**
+ * @brief Processing time of a module in a graph.
+ */
+struct audio_module_graph_stats {
+	/* Number of times the module has processed audio data. */
+	uint32_t frames;
+
+	/* Total processing time in nanoseconds. */
+	uint64_t total_ns;
+
+	/* Longest processing time in nanoseconds. */
+	uint32_t max_ns;
+
+	/* Processing time of the last call in nanoseconds. */
+	uint32_t last_ns;
+};
+
+/**
+ * @brief A module in a graph.
+ */
+struct audio_module_graph_node {
+	/* The module's handle. */
+	struct audio_module_handle *handle;
+
+	/* Index of the node the module receives audio data from, or -1 for a root node. */
+	int16_t source;
+
+	/* Number of nodes that receive audio data from the module. */
+	uint8_t sinks_num;
+
+	/* Output of the module in the frame being processed. */
+	struct audio_module_buffer *buffer;
+
+	/* Processing time counters, in cycles. */
+	uint32_t frames;
+	uint64_t cycles_total;
+	uint32_t cycles_max;
+	uint32_t cycles_last;
+};
+
+/**
+ * @brief A graph of audio modules.
+ */
+struct audio_module_graph {
+	/* Pool for the audio data passed between the modules. */
+	struct audio_module_buffer_pool *pool;
+
+	/* The modules in the order they were added. */
+	struct audio_module_graph_node nodes[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Number of modules in the graph. */
+	uint8_t nodes_num;
+
+	/* Node indices in the order the modules are run. */
+	uint8_t order[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Flag to indicate that the order is valid for the current modules and connections. */
+	bool built;
+};
+
+/**
+ * @brief Initialize a pool of audio data buffers.
+ *
+ * @param pool  [in/out]  Pointer to the pool defined with AUDIO_MODULE_BUFFER_POOL_DEFINE.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_buffer_pool_init(struct audio_module_buffer_pool *pool);
+
+/**
+ * @brief Take a buffer from a pool.
+ *
+ * @note The buffer has a reference count of one, and its audio data is set to the full data
+ *       area of the buffer.
+ *
+ * @param pool     [in/out]  Pointer to the pool.
+ * @param buffer   [out]     Pointer to the buffer.
+ * @param timeout  [in]      Non-negative waiting period to wait for a free buffer.
+ *                           Use K_NO_WAIT to return without waiting,
+ *                           or K_FOREVER to wait as long as necessary.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_buffer_alloc(struct audio_module_buffer_pool *pool,
+			      struct audio_module_buffer **buffer, k_timeout_t timeout);
+
+/**
+ * @brief Add a user to a buffer.
+ *
+ * @param buffer  [in/out]  Pointer to the buffer.
+ */
+void audio_module_buffer_ref(struct audio_module_buffer *buffer);
+
+/**
+ * @brief Remove a user from a buffer, and return the buffer to its pool if it was the last.
+ *
+ * @param buffer  [in/out]  Pointer to the buffer.
+ */
+void audio_module_buffer_unref(struct audio_module_buffer *buffer);
+
+/**
+ * @brief Initialize an empty graph.
+ *
+ * @param graph  [out]     Pointer to the graph.
+ * @param pool   [in/out]  Pointer to an initialized pool for the audio data passed between the
+ *                         modules.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_init(struct audio_module_graph *graph,
+			    struct audio_module_buffer_pool *pool);
+
+/**
+ * @brief Add an open audio module to a graph.
+ *
+ * @note The module must not be running. Its thread is suspended while the module is in the
+ *       graph, so audio data can only be sent to it through the graph.
+ *
+ * @param graph   [in/out]  Pointer to the graph.
+ * @param handle  [in/out]  The handle to the module instance.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_add(struct audio_module_graph *graph, struct audio_module_handle *handle);
+
+/**
+ * @brief Remove an audio module from a graph and resume its thread.
+ *
+ * @param graph   [in/out]  Pointer to the graph.
+ * @param handle  [in/out]  The handle to the module instance.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_remove(struct audio_module_graph *graph,
+			      struct audio_module_handle *handle);
+
+/**
+ * @brief Order the modules in a graph from their connections.
+ *
+ * @note The connections are made with audio_module_connect(), and connections to modules
+ *       outside the graph are ignored. Each module can receive audio data from at most one
+ *       other module in the graph, but can send it to several. The graph must be built again
+ *       after the modules or their connections have changed.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ *
+ * @retval 0         Success.
+ * @retval -ENOTSUP  A module receives audio data from more than one module.
+ * @retval -EINVAL   The connections form a loop.
+ */
+int audio_module_graph_build(struct audio_module_graph *graph);
+
+/**
+ * @brief Run every module in a graph once.
+ *
+ * @note Input modules generate their audio data. The other modules at the start of the graph
+ *       process the given audio data, without copying it. Modules connected with
+ *       connect_external put their output on their TX FIFO, where it can be read with
+ *       audio_module_data_rx(). Modules that are not running, and the modules after them, are
+ *       skipped.
+ *
+ * @param graph          [in/out]  Pointer to the graph.
+ * @param audio_data_in  [in]      Pointer to the audio data for the modules at the start of the
+ *                                 graph, can be NULL if these are all input modules.
+ *
+ * @return 0 if successful, otherwise the first error from a module.
+ */
+int audio_module_graph_process(struct audio_module_graph *graph,
+			       struct audio_data const *const audio_data_in);
+
+/**
+ * @brief Get the processing time of a module in a graph.
+ *
+ * @param graph   [in]   Pointer to the graph.
+ * @param handle  [in]   The handle to the module instance.
+ * @param stats   [out]  Pointer to the processing time of the module.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_stats_get(struct audio_module_graph const *const graph,
+				 struct audio_module_handle const *const handle,
+				 struct audio_module_graph_stats *stats);
+
+/**
+ * @brief Clear the processing time of all the modules in a graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph.
+ */
+void audio_module_graph_stats_reset(struct audio_module_graph *graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /*_AUDIO_MODULE_GRAPH_H_ */
@@ -31,14 +31,36 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/* State of a FIFO in single-producer/single-consumer mode. The indices count from zero to twice
+ * the number of elements, so that a full ring can be told apart from an empty one. Each index is
+ * only written by one side:
+ * - alloc: Producer. The next block to hand out by data_fifo_pointer_first_vacant_get.
+ * - head: Producer. The next block to lock by data_fifo_block_lock.
+ * - tail: Consumer. The next block to read by data_fifo_pointer_last_filled_get.
+ * - free: Consumer. The next block to free by data_fifo_block_free.
+ */
+struct data_fifo_spsc {
+	atomic_t alloc;
+	atomic_t head;
+	atomic_t tail;
+	atomic_t free;
+	struct k_sem filled_sem;
+	struct k_sem vacant_sem;
+};
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
 	struct k_mem_slab mem_slab;
 	struct k_msgq msgq;
+	struct k_spinlock lock;
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	bool spsc;
+	struct data_fifo_spsc ring;
+#endif /* defined(CONFIG_DATA_FIFO_SPSC) */
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +74,33 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+/**
+ * @brief Define a data_fifo in single-producer/single-consumer mode.
+ *
+ * The FIFO uses the same API as one defined with DATA_FIFO_DEFINE, but it is lock-free and does
+ * not use any kernel objects to pass the blocks. The following rules apply:
+ * - Only one thread or ISR calls data_fifo_pointer_first_vacant_get and data_fifo_block_lock,
+ *   and only one other thread or ISR calls data_fifo_pointer_last_filled_get.
+ * - Blocks are locked in the order they were obtained, and freed by the consumer in the order
+ *   they were read.
+ * - The producer may free the last obtained block instead of locking it, for instance if
+ *   filling it failed.
+ * - An ISR must use K_NO_WAIT.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+#endif /* defined(CONFIG_DATA_FIFO_SPSC) */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
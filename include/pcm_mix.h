@@ -21,6 +21,12 @@
  * @{
  */
 
+/** @brief Number of fractional bits of the mixing gain. */
+#define PCM_MIX_GAIN_SHIFT (15)
+
+/** @brief Mixing gain that leaves the samples of B unchanged (1.0 in Q1.15 format). */
+#define PCM_MIX_GAIN_UNITY (1U << PCM_MIX_GAIN_SHIFT)
+
 enum pcm_mix_mode {
 	B_STEREO_INTO_A_STEREO,
 	B_MONO_INTO_A_MONO,
@@ -35,7 +41,7 @@ enum pcm_mix_mode {
  * @note Uses simple addition with hard clip protection.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
- * Hard coded for the signed 16-bit PCM.
+ * Hard coded for the signed 16-bit PCM, see @ref pcm_mix_bit_depth for other bit depths.
  *
  * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
  * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
@@ -52,6 +58,54 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with the given bit depth.
+ *
+ * @note Works like @ref pcm_mix. The 24-bit samples are packed in three bytes, like in the
+ * PCM stream channel modifier library. The samples are saturated to the range of the bit
+ * depth.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth [in]     Bit depth of the PCM samples (16, 24, or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or invalid bit depth.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_bit_depth(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		      enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth);
+
+/**
+ * @brief Scales the PCM data in buffer B and mixes it into buffer A.
+ *
+ * @note Works like @ref pcm_mix_bit_depth, but every sample of B is multiplied by gain_b
+ * before it is added to A. Use it for example to mix a tone at a lower level. The gain is in
+ * Q1.15 format, so @ref PCM_MIX_GAIN_UNITY is 1.0 and the maximum gain is just below 2.0.
+ * A gain of zero leaves A unchanged.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth [in]     Bit depth of the PCM samples (16, 24, or 32).
+ * @param gain_b        [in]     Gain applied to buffer B in Q1.15 format.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or invalid bit depth.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_gain(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		 enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint16_t gain_b);
+
 /**
  * @}
  */
@@ -148,6 +148,46 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_channels,
 		      uint8_t channel, uint8_t pcm_bit_depth, void *output, size_t output_size);
 
+/**
+ * @brief  Interleave N channels into a buffer of N channels of PCM in one call
+ * @note:  The interleaver can not be executed inplace (i.e. inputs[n] != output).
+ *	   Stereo is interleaved in a single pass, a frame at a time, which is faster
+ *	   than interleaving the channels one by one with @ref pscm_interleave.
+ *
+ * @param[in]	inputs			Array of output_channels pointers to the channel
+ *					input buffers, in channel order.
+ * @param[in]	input_size		Number of bytes in each input.
+ * @param[in]	pcm_bit_depth		Bit depth of PCM samples (8, 16, 24, or 32).
+ * @param[out]	output			Pointer to the multi-channel output buffer.
+ * @param[in]	output_size		Number of bytes in output. Must be at least
+ *					(input_size * output_channels).
+ * @param[in]	output_channels		Number of channels in the output buffer.
+ *
+ * @return	0 if successful, error value
+ */
+int pscm_interleave_all(void const *const *const inputs, size_t input_size, uint8_t pcm_bit_depth,
+			void *output, size_t output_size, uint8_t output_channels);
+
+/**
+ * @brief  De-interleave all channels from a buffer of N channels of PCM in one call
+ * @note:  The de-interleaver can not be executed inplace (i.e. input != outputs[n]).
+ *	   Stereo is de-interleaved in a single pass, a frame at a time, which is faster
+ *	   than de-interleaving the channels one by one with @ref pscm_deinterleave.
+ *
+ * @param[in]	input			Pointer to the multi channel input buffer.
+ * @param[in]	input_size		Number of bytes in input.
+ * @param[in]	input_channels		Number of channels in the input buffer.
+ * @param[in]	pcm_bit_depth		Bit depth of PCM samples (8, 16, 24, or 32).
+ * @param[out]	outputs			Array of input_channels pointers to the channel
+ *					output buffers, in channel order.
+ * @param[in]	output_size		Number of bytes in each output. Must be at least
+ *					(input_size / input_channels).
+ *
+ * @return	0 if successful, error value
+ */
+int pscm_deinterleave_all(void const *const input, size_t input_size, uint8_t input_channels,
+			  uint8_t pcm_bit_depth, void *const *const outputs, size_t output_size);
+
 /**
  * @}
  */
@@ -77,12 +77,60 @@ enum sample_rate_converter_filter {
 #define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE   0
 #endif
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * Number of phases in the polyphase coefficient bank. Output samples that fall between two phases
+ * are linearly interpolated.
+ */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES 32
+
+/** Largest supported ratio between the input and output sample rates for polyphase conversion */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_RATIO_MAX 4
+
+/** Number of coefficients in the polyphase coefficient bank */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_BANK_SIZE                                                  \
+	((SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES + 1) * CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS)
+
+/** Number of input samples kept between process calls by the polyphase conversion */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE                                               \
+	(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS - 1)
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
+/** Largest ratio trim in parts per billion, which is 1000 ppm */
+#define SAMPLE_RATE_CONVERTER_TRIM_PPB_MAX 1000000
+
 /** Buffer used for storing input bytes to the sample rate converter */
 struct buf_ctx {
 	uint8_t buf[SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE];
 	size_t bytes_in_buf;
 };
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** State of the polyphase conversion */
+struct sample_rate_converter_polyphase {
+	/* Distance between two output samples, in input samples. Fixed point with 32 fractional
+	 * bits.
+	 */
+	uint64_t step;
+
+	/* Position of the next output sample relative to the first input sample of the next
+	 * process call. Fixed point with 32 fractional bits.
+	 */
+	uint64_t pos;
+
+	/* Coefficient bank with one row of taps per phase. The extra last row is the first phase
+	 * shifted by one input sample, used to interpolate after the last phase.
+	 */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t bank[SAMPLE_RATE_CONVERTER_POLYPHASE_BANK_SIZE];
+	q15_t history[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t bank[SAMPLE_RATE_CONVERTER_POLYPHASE_BANK_SIZE];
+	q31_t history[SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE];
+#endif
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /** Context for the sample rate conversion */
 struct sample_rate_converter_ctx {
 	/* Input and output sample rate to be used for the conversion. */
@@ -90,10 +138,14 @@ struct sample_rate_converter_ctx {
 	uint32_t sample_rate_output;
 
 	/* The ratio for the current conversion. When the conversion is upsampling the ratio is
-	 * positive and negative when downsampling.
+	 * positive and negative when downsampling. The ratio is 0 when the polyphase conversion
+	 * is used.
 	 */
 	int conversion_ratio;
 
+	/* Trim of the output sample rate in parts per billion, used by the polyphase conversion. */
+	int32_t trim_ppb;
+
 	/* Filter type to be used for the conversion. */
 	enum sample_rate_converter_filter filter_type;
 
@@ -116,13 +168,19 @@ struct sample_rate_converter_ctx {
 	};
 
 	/* State buffers used by the CMSIS DSP filters to keep history of the stream between process
-	 * calls.
+	 * calls. A conversion uses either the CMSIS DSP filters or the polyphase conversion, so
+	 * they share memory.
 	 */
+	union {
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
-	q15_t state_buf_15[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
+		q15_t state_buf_15[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
-	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
+		q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
+#endif
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+		struct sample_rate_converter_polyphase polyphase;
 #endif
+	};
 };
 
 /**
@@ -161,6 +219,13 @@ int sample_rate_converter_open(struct sample_rate_converter_ctx *ctx);
  * @param[out]		output_written		Number of bytes written to output.
  * @param[in]		output_sample_rate	Sample rate of output.
  *
+ * @note	Conversions between 48 kHz and 24 kHz or 16 kHz use the CMSIS DSP filters, and
+ *		the number of output bytes is always the input size multiplied by the conversion
+ *		ratio. Other conversions require CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE, which
+ *		ignores the filter type. The number of output bytes may then differ by one sample
+ *		between calls, so the output array must have room for one more sample than the
+ *		average.
+ *
  * @retval	0	On success.
  * @retval	-EINVAL	Invalid parameters for sample rate conversion.
  * @retval	-EFAULT	Output ring buffer has either not enough bytes to output, or not enough
@@ -172,6 +237,75 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * @brief	Set the trim of the conversion ratio.
+ *
+ * @details	Adjusts the output sample rate by the given amount, so that the converter
+ *		produces slightly more or fewer output samples than the nominal ratio. This can be
+ *		used to compensate for drift between the clocks of the input and output streams,
+ *		for example an I2S clock and a Bluetooth LE Audio stream. The trim is kept when
+ *		the sample rates change, and only applies to the polyphase conversion.
+ *
+ *		A trimmed ratio gives a varying number of output samples per block, so the trim
+ *		is meant for the stream API. The nRF5340 Audio datapath converts fixed-size codec
+ *		frames and compensates drift by adjusting the audio PLL, so it does not use the
+ *		trim.
+ *
+ * @param[in,out]	ctx		Pointer to the sample rate conversion context.
+ * @param[in]		trim_ppb	Output sample rate trim in parts per billion.
+ *					Positive values produce more output samples.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or trim out of range.
+ */
+int sample_rate_converter_ratio_trim_set(struct sample_rate_converter_ctx *ctx, int32_t trim_ppb);
+
+/**
+ * @brief	Open the sample rate converter for a stream with an arbitrary conversion ratio.
+ *
+ * @details	Resets the context and prepares the polyphase coefficient bank for the given
+ *		sample rates. The context must then be used with
+ *		@ref sample_rate_converter_stream_process only. Requires
+ *		CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE.
+ *
+ * @param[out]	ctx			Pointer to the sample rate conversion context.
+ * @param[in]	input_sample_rate	Sample rate of the input samples.
+ * @param[in]	output_sample_rate	Sample rate of the output samples. The ratio
+ *					between the sample rates can be at most
+ *					SAMPLE_RATE_CONVERTER_POLYPHASE_RATIO_MAX.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or unsupported sample rates.
+ * @retval	-ENOTSUP	Polyphase conversion is not enabled.
+ */
+int sample_rate_converter_stream_open(struct sample_rate_converter_ctx *ctx,
+				      uint32_t input_sample_rate, uint32_t output_sample_rate);
+
+/**
+ * @brief	Convert a block of samples of any size in a stream.
+ *
+ * @details	Produces output samples until either all input samples are used, or the output
+ *		array is full. Input samples that are not used must be given again in the next
+ *		call. The samples are read from the input array and written to the output array
+ *		directly, so no intermediate buffers are needed.
+ *
+ * @param[in,out]	ctx		Pointer to a context opened with
+ *					@ref sample_rate_converter_stream_open.
+ * @param[in]		input		Pointer to samples to process.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		input_used	Number of input bytes used.
+ * @param[out]		output		Array that output will be written.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the context was not opened for streaming.
+ */
+int sample_rate_converter_stream_process(struct sample_rate_converter_ctx *ctx,
+					 void const *const input, size_t input_size,
+					 size_t *input_used, void *const output, size_t output_size,
+					 size_t *output_written);
+
 /**
  * @}
  */
@@ -8,10 +8,22 @@
 
 #include <zephyr/kernel.h>
 
+#include "data_fifo_spsc.h"
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
-static struct k_spinlock lock;
+/* Calls to the single-producer/single-consumer functions are removed by the compiler when the
+ * mode is not enabled.
+ */
+static inline bool is_spsc(const struct data_fifo *data_fifo)
+{
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	return data_fifo->spsc;
+#else
+	return false;
+#endif /* defined(CONFIG_DATA_FIFO_SPSC) */
+}
 
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
@@ -20,12 +32,12 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 					 uint32_t *slab_blocks_num_used_in)
 {
 	/* Lock so msgq and slab reads are in sync */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&data_fifo->lock);
 
 	uint32_t msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
 	uint32_t slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&data_fifo->lock, key);
 
 	if (slab_blocks_num_used < msgq_num_used) {
 		LOG_ERR("Num used mgsq %d cannot be larger than used blocks %d", msgq_num_used,
@@ -48,6 +60,10 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (is_spsc(data_fifo)) {
+		return data_fifo_spsc_pointer_first_vacant_get(data_fifo, data, timeout);
+	}
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
@@ -66,6 +82,10 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+	if (is_spsc(data_fifo)) {
+		return data_fifo_spsc_block_lock(data_fifo, data, size);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,6 +111,10 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+	if (is_spsc(data_fifo)) {
+		return data_fifo_spsc_pointer_last_filled_get(data_fifo, data, size, timeout);
+	}
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -108,6 +132,11 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_block_free(data_fifo, data);
+		return;
+	}
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +149,11 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_num_used_get(data_fifo, alloced_num, locked_num);
+		return 0;
+	}
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +172,12 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+	if (is_spsc(data_fifo)) {
+		/* All blocks are handed back at once by resetting the indices */
+		data_fifo_spsc_reset(data_fifo);
+		return 0;
+	}
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +232,12 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "data_fifo_spsc.h"
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
+
+/* The atomic operations are sequentially consistent. When one side publishes its index and then
+ * reads the index of the other side, at least one of the two sides sees the update of the other.
+ * This is what makes it safe to only signal the semaphores on the empty to non-empty and full to
+ * non-full edges.
+ */
+
+static inline uint32_t ring_next(const struct data_fifo *data_fifo, uint32_t idx)
+{
+	idx++;
+
+	return (idx == 2 * data_fifo->elements_max) ? 0 : idx;
+}
+
+static inline uint32_t ring_prev(const struct data_fifo *data_fifo, uint32_t idx)
+{
+	return ((idx == 0) ? 2 * data_fifo->elements_max : idx) - 1;
+}
+
+/* Number of blocks from index from up to, but not including, index to. */
+static inline uint32_t ring_count(const struct data_fifo *data_fifo, uint32_t from, uint32_t to)
+{
+	return (to >= from) ? (to - from) : (to + 2 * data_fifo->elements_max - from);
+}
+
+static inline uint32_t ring_slot(const struct data_fifo *data_fifo, uint32_t idx)
+{
+	return (idx >= data_fifo->elements_max) ? (idx - data_fifo->elements_max) : idx;
+}
+
+static inline void *ring_block(const struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + ring_slot(data_fifo, idx) * data_fifo->block_size_max;
+}
+
+static inline struct data_fifo_msgq *ring_entry(const struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[ring_slot(data_fifo, idx)];
+}
+
+int data_fifo_spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					    k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	uint32_t alloc = atomic_get(&ring->alloc);
+	int ret;
+
+	while (ring_count(data_fifo, atomic_get(&ring->free), alloc) == data_fifo->elements_max) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* Same as k_mem_slab_alloc */
+			return -ENOMEM;
+		}
+
+		/* The semaphore may hold a signal for a block that has since been used, so check
+		 * again after waking up.
+		 */
+		ret = k_sem_take(&ring->vacant_sem, sys_timepoint_timeout(end));
+		if (ret) {
+			return ret;
+		}
+	}
+
+	*data = ring_block(data_fifo, alloc);
+	atomic_set(&ring->alloc, ring_next(data_fifo, alloc));
+
+	return 0;
+}
+
+int data_fifo_spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t head = atomic_get(&ring->head);
+	struct data_fifo_msgq *entry = ring_entry(data_fifo, head);
+
+	__ASSERT(head != atomic_get(&ring->alloc), "No block to lock");
+	__ASSERT(*data == ring_block(data_fifo, head),
+		 "Blocks must be locked in the order they were obtained");
+
+	entry->block_ptr = *data;
+	entry->size = size;
+
+	atomic_set(&ring->head, ring_next(data_fifo, head));
+
+	/* Only wake the consumer if it had read every block before this one */
+	if (atomic_get(&ring->tail) == head) {
+		k_sem_give(&ring->filled_sem);
+	}
+
+	return 0;
+}
+
+int data_fifo_spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					   k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	uint32_t tail = atomic_get(&ring->tail);
+	struct data_fifo_msgq *entry;
+	int ret;
+
+	while (atomic_get(&ring->head) == tail) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* Same as k_msgq_get */
+			return -ENOMSG;
+		}
+
+		ret = k_sem_take(&ring->filled_sem, sys_timepoint_timeout(end));
+		if (ret) {
+			return ret;
+		}
+	}
+
+	entry = ring_entry(data_fifo, tail);
+	*data = entry->block_ptr;
+	*size = entry->size;
+
+	atomic_set(&ring->tail, ring_next(data_fifo, tail));
+
+	return 0;
+}
+
+void data_fifo_spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t free_idx = atomic_get(&ring->free);
+	uint32_t alloc_idx;
+
+	if ((free_idx != atomic_get(&ring->tail)) && (data == ring_block(data_fifo, free_idx))) {
+		atomic_set(&ring->free, ring_next(data_fifo, free_idx));
+
+		/* Only wake the producer if every block was in use before this one was freed */
+		if (ring_count(data_fifo, free_idx, atomic_get(&ring->alloc)) ==
+		    data_fifo->elements_max) {
+			k_sem_give(&ring->vacant_sem);
+		}
+
+		return;
+	}
+
+	/* The producer gives back the last obtained block, which was not locked */
+	alloc_idx = atomic_get(&ring->alloc);
+
+	__ASSERT((alloc_idx != atomic_get(&ring->head)) &&
+			 (data == ring_block(data_fifo, ring_prev(data_fifo, alloc_idx))),
+		 "Blocks must be freed in the order they were read");
+
+	atomic_set(&ring->alloc, ring_prev(data_fifo, alloc_idx));
+}
+
+void data_fifo_spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+				 uint32_t *locked_num)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	/* Read the indices from the oldest to the newest. An index never passes the next one, and
+	 * only alloc moves back, but never past head. So the number of locked blocks read can
+	 * never exceed the number of allocated blocks read.
+	 */
+	uint32_t free_idx = atomic_get(&ring->free);
+	uint32_t tail = atomic_get(&ring->tail);
+	uint32_t head = atomic_get(&ring->head);
+	uint32_t alloc = atomic_get(&ring->alloc);
+
+	*alloced_num = ring_count(data_fifo, free_idx, alloc);
+	*locked_num = ring_count(data_fifo, tail, head);
+}
+
+void data_fifo_spsc_reset(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	atomic_set(&ring->alloc, 0);
+	atomic_set(&ring->head, 0);
+	atomic_set(&ring->tail, 0);
+	atomic_set(&ring->free, 0);
+
+	k_sem_init(&ring->filled_sem, 0, 1);
+	k_sem_init(&ring->vacant_sem, 0, 1);
+}
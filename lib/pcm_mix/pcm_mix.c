@@ -6,130 +6,315 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
+#define INT24_MIN (-0x800000)
+#define INT24_MAX (0x7FFFFF)
+
+/* Position of the samples of A that a sample of B is mixed into. A sample of B is mixed into
+ * a_cnt consecutive samples of A, starting from sample (i * a_stride + a_offset).
+ */
+struct mix_layout {
+	uint8_t a_stride;
+	uint8_t a_offset;
+	uint8_t a_cnt;
+};
+
+static const struct mix_layout layouts[] = {
+	[B_STEREO_INTO_A_STEREO] = {.a_stride = 1, .a_offset = 0, .a_cnt = 1},
+	[B_MONO_INTO_A_MONO] = {.a_stride = 1, .a_offset = 0, .a_cnt = 1},
+	[B_MONO_INTO_A_STEREO_LR] = {.a_stride = 2, .a_offset = 0, .a_cnt = 2},
+	[B_MONO_INTO_A_STEREO_L] = {.a_stride = 2, .a_offset = 0, .a_cnt = 1},
+	[B_MONO_INTO_A_STEREO_R] = {.a_stride = 2, .a_offset = 1, .a_cnt = 1},
+};
+
 /* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+static inline int16_t sat16(int32_t pcm)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+#if defined(__ARM_FEATURE_DSP)
+	return __SSAT(pcm, 16);
+#else
+	return CLAMP(pcm, INT16_MIN, INT16_MAX);
+#endif
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline int32_t sat24(int32_t pcm)
 {
-	int32_t res;
+#if defined(__ARM_FEATURE_DSP)
+	return __SSAT(pcm, 24);
+#else
+	return CLAMP(pcm, INT24_MIN, INT24_MAX);
+#endif
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+static inline int32_t sat32(int64_t pcm)
+{
+	return CLAMP(pcm, INT32_MIN, INT32_MAX);
+}
 
-		hard_limiter(&res);
+static inline int32_t qadd32(int32_t a, int32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+	return __QADD(a, b);
+#else
+	return sat32((int64_t)a + b);
+#endif
+}
+
+#if defined(__ARM_FEATURE_DSP)
+/* The buffers are only guaranteed to be aligned to the sample size. The copies compile to
+ * single word accesses, as the cores with the DSP extension support unaligned access.
+ */
+static inline uint32_t read_word(void const *const p)
+{
+	uint32_t word;
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	memcpy(&word, p, sizeof(word));
+	return word;
+}
+
+static inline void write_word(void *const p, uint32_t word)
+{
+	memcpy(p, &word, sizeof(word));
+}
+
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_16_identical(int16_t *const pcm_a, int16_t const *const pcm_b, size_t n_b)
+{
+	size_t i;
+
+	/* Two samples per word */
+	for (i = 0; i + 1 < n_b; i += 2) {
+		write_word(&pcm_a[i], __QADD16(read_word(&pcm_a[i]), read_word(&pcm_b[i])));
+	}
+
+	if (i < n_b) {
+		pcm_a[i] = sat16(pcm_a[i] + pcm_b[i]);
 	}
 }
 
 /* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static void pcm_mix_16_b_mono_into_a_stereo_lr(int16_t *const pcm_a, int16_t const *const pcm_b,
+					       size_t n_b)
 {
-	int32_t res;
+	for (size_t i = 0; i < n_b; i++) {
+		uint32_t b = (uint16_t)pcm_b[i];
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+		write_word(&pcm_a[i * 2], __QADD16(read_word(&pcm_a[i * 2]), b | (b << 16)));
+	}
+}
 
-		hard_limiter(&res);
+/* Mix mono into one channel of a stereo buffer. The sample of B is added to the lower half of
+ * the stereo word for the left channel and to the upper half for the right channel, the other
+ * channel gets zero added.
+ */
+static void pcm_mix_16_b_mono_into_a_stereo_one(int16_t *const pcm_a,
+						int16_t const *const pcm_b, size_t n_b,
+						uint8_t shift)
+{
+	for (size_t i = 0; i < n_b; i++) {
+		uint32_t b = (uint32_t)(uint16_t)pcm_b[i] << shift;
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+		write_word(&pcm_a[i * 2], __QADD16(read_word(&pcm_a[i * 2]), b));
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static void pcm_mix_16(int16_t *const pcm_a, int16_t const *const pcm_b, size_t n_b,
+		       enum pcm_mix_mode mix_mode)
 {
-	int32_t res;
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+		/* Fall through */
+	case B_MONO_INTO_A_MONO:
+		pcm_mix_16_identical(pcm_a, pcm_b, n_b);
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		pcm_mix_16_b_mono_into_a_stereo_lr(pcm_a, pcm_b, n_b);
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		pcm_mix_16_b_mono_into_a_stereo_one(pcm_a, pcm_b, n_b, 0);
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		pcm_mix_16_b_mono_into_a_stereo_one(pcm_a, pcm_b, n_b, 16);
+		break;
+	}
+}
+#else
+/* Mix one sample of B into a_cnt samples of A for every sample of B. Inlined with constant
+ * layouts, so that the compiler can unroll and vectorize the loop for every mixing mode.
+ */
+static ALWAYS_INLINE void pcm_mix_16_layout(int16_t *const pcm_a, int16_t const *const pcm_b,
+					    size_t n_b, size_t a_stride, size_t a_offset,
+					    size_t a_cnt)
+{
+	for (size_t i = 0; i < n_b; i++) {
+		for (size_t c = 0; c < a_cnt; c++) {
+			int16_t *a = &pcm_a[i * a_stride + a_offset + c];
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+			*a = sat16(*a + pcm_b[i]);
+		}
+	}
+}
 
-		hard_limiter(&res);
+static void pcm_mix_16(int16_t *const pcm_a, int16_t const *const pcm_b, size_t n_b,
+		       enum pcm_mix_mode mix_mode)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+		/* Fall through */
+	case B_MONO_INTO_A_MONO:
+		pcm_mix_16_layout(pcm_a, pcm_b, n_b, 1, 0, 1);
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		pcm_mix_16_layout(pcm_a, pcm_b, n_b, 2, 0, 2);
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		pcm_mix_16_layout(pcm_a, pcm_b, n_b, 2, 0, 1);
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		pcm_mix_16_layout(pcm_a, pcm_b, n_b, 2, 1, 1);
+		break;
+	}
+}
+#endif /* defined(__ARM_FEATURE_DSP) */
+
+static inline int32_t read_s24(uint8_t const *const p)
+{
+	/* Sign extend through the top byte of the word */
+	return (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)) >>
+	       8;
+}
+
+static inline void write_s24(uint8_t *const p, int32_t pcm)
+{
+	p[0] = (uint8_t)pcm;
+	p[1] = (uint8_t)(pcm >> 8);
+	p[2] = (uint8_t)(pcm >> 16);
+}
+
+static void pcm_mix_16_gain(int16_t *const pcm_a, int16_t const *const pcm_b, size_t n_b,
+			    const struct mix_layout *layout, uint16_t gain_b)
+{
+	for (size_t i = 0; i < n_b; i++) {
+		/* Fits in 32 bits, as the gain is below 2.0 */
+		int32_t b = ((int32_t)pcm_b[i] * gain_b) >> PCM_MIX_GAIN_SHIFT;
+		int16_t *a = &pcm_a[i * layout->a_stride + layout->a_offset];
+
+		for (size_t c = 0; c < layout->a_cnt; c++) {
+			a[c] = sat16(a[c] + b);
+		}
+	}
+}
+
+static void pcm_mix_24(uint8_t *const pcm_a, uint8_t const *const pcm_b, size_t n_b,
+		       const struct mix_layout *layout, uint16_t gain_b)
+{
+	for (size_t i = 0; i < n_b; i++) {
+		int32_t b = ((int64_t)read_s24(&pcm_b[i * 3]) * gain_b) >> PCM_MIX_GAIN_SHIFT;
+		uint8_t *a = &pcm_a[(i * layout->a_stride + layout->a_offset) * 3];
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+		for (size_t c = 0; c < layout->a_cnt; c++) {
+			write_s24(&a[c * 3], sat24(read_s24(&a[c * 3]) + b));
+		}
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+static void pcm_mix_32(int32_t *const pcm_a, int32_t const *const pcm_b, size_t n_b,
+		       const struct mix_layout *layout, uint16_t gain_b)
 {
-	int32_t res;
+	if (gain_b == PCM_MIX_GAIN_UNITY) {
+		for (size_t i = 0; i < n_b; i++) {
+			int32_t *a = &pcm_a[i * layout->a_stride + layout->a_offset];
+
+			for (size_t c = 0; c < layout->a_cnt; c++) {
+				a[c] = qadd32(a[c], pcm_b[i]);
+			}
+		}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+		return;
+	}
 
-		hard_limiter(&res);
+	for (size_t i = 0; i < n_b; i++) {
+		int64_t b = ((int64_t)pcm_b[i] * gain_b) >> PCM_MIX_GAIN_SHIFT;
+		int32_t *a = &pcm_a[i * layout->a_stride + layout->a_offset];
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+		for (size_t c = 0; c < layout->a_cnt; c++) {
+			a[c] = sat32(a[c] + b);
+		}
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_gain(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		 enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint16_t gain_b)
 {
+	const struct mix_layout *layout;
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+	size_t n_b;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
-	if (pcm_b == NULL || size_b == 0) {
+	if (pcm_bit_depth != 16 && pcm_bit_depth != 24 && pcm_bit_depth != 32) {
+		LOG_ERR("Invalid bit depth: %d", pcm_bit_depth);
+		return -EINVAL;
+	}
+
+	if (pcm_b == NULL || size_b == 0 || gain_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
 	}
 
-	switch (mix_mode) {
-	case B_STEREO_INTO_A_STEREO:
-		/* Fall through */
-	case B_MONO_INTO_A_MONO:
-		if (size_b > size_a) {
-			return -EPERM;
-		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
+	if (mix_mode >= ARRAY_SIZE(layouts)) {
+		return -ESRCH;
+	}
+
+	layout = &layouts[mix_mode];
+	n_b = size_b / bytes_per_sample;
+
+	/* Check the size before touching buffer A */
+	if (n_b * layout->a_stride * bytes_per_sample > size_a) {
+		LOG_DBG("size a %zu size b %zu", size_a, size_b);
+		return -EPERM;
+	}
+
+	switch (pcm_bit_depth) {
+	case 16:
+		if (gain_b == PCM_MIX_GAIN_UNITY) {
+			pcm_mix_16(pcm_a, pcm_b, n_b, mix_mode);
+		} else {
+			pcm_mix_16_gain(pcm_a, pcm_b, n_b, layout, gain_b);
 		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
 		break;
-	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
+	case 24:
+		pcm_mix_24(pcm_a, pcm_b, n_b, layout, gain_b);
 		break;
-	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
+	case 32:
+		pcm_mix_32(pcm_a, pcm_b, n_b, layout, gain_b);
 		break;
-	default:
-		return -ESRCH;
-	};
+	}
 
 	return 0;
 }
+
+int pcm_mix_bit_depth(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		      enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
+{
+	return pcm_mix_gain(pcm_a, size_a, pcm_b, size_b, mix_mode, pcm_bit_depth,
+			    PCM_MIX_GAIN_UNITY);
+}
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_gain(pcm_a, size_a, pcm_b, size_b, mix_mode, 16, PCM_MIX_GAIN_UNITY);
+}
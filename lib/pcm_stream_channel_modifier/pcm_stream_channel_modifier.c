@@ -8,6 +8,7 @@
 
 #include <zephyr/kernel.h>
 #include <errno.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pscm, CONFIG_PSCM_LOG_LEVEL);
@@ -49,6 +50,198 @@ static bool is_valid_size(size_t size, uint8_t bytes_per_sample, uint8_t no_chan
 	return true;
 }
 
+/* The kernels below take the number of bytes per sample as a parameter and are always inlined
+ * into a switch on the sample size (see PSCM_KERNEL_CALL). The sample size is then a compile-time
+ * constant in every copy of the kernel, so the sample copies compile to single loads and stores
+ * instead of byte loops.
+ */
+#define PSCM_KERNEL_CALL(bytes_per_sample, kernel, ...)						\
+	do {												\
+		switch (bytes_per_sample) {							\
+		case 1:										\
+			kernel(__VA_ARGS__, 1);							\
+			break;									\
+		case 2:										\
+			kernel(__VA_ARGS__, 2);							\
+			break;									\
+		case 3:										\
+			kernel(__VA_ARGS__, 3);							\
+			break;									\
+		default:									\
+			kernel(__VA_ARGS__, 4);							\
+			break;									\
+		}										\
+	} while (0)
+
+/* A stereo frame of 16-bit samples is handled as one word, left channel in the lower half. */
+#define STEREO_16_WORDS !IS_ENABLED(CONFIG_BIG_ENDIAN)
+
+static ALWAYS_INLINE void sample_copy(uint8_t *dst, uint8_t const *src, size_t bytes_per_sample)
+{
+	memcpy(dst, src, bytes_per_sample);
+}
+
+static inline uint32_t word_read(void const *src)
+{
+	uint32_t word;
+
+	memcpy(&word, src, sizeof(word));
+	return word;
+}
+
+static inline void word_write(void *dst, uint32_t word)
+{
+	memcpy(dst, &word, sizeof(word));
+}
+
+static ALWAYS_INLINE void zero_pad_kernel(uint8_t const *input, size_t samples, size_t ch_offset,
+					  uint8_t *output, size_t bytes_per_sample)
+{
+	if (bytes_per_sample == 2 && STEREO_16_WORDS) {
+		uint8_t shift = ch_offset ? 16 : 0;
+
+		for (size_t i = 0; i < samples; i++) {
+			uint16_t sample;
+
+			memcpy(&sample, &input[i * 2], sizeof(sample));
+			word_write(&output[i * 4], (uint32_t)sample << shift);
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < samples; i++) {
+		uint8_t *frame = &output[i * 2 * bytes_per_sample];
+
+		memset(frame, 0, 2 * bytes_per_sample);
+		sample_copy(&frame[ch_offset * bytes_per_sample], &input[i * bytes_per_sample],
+			    bytes_per_sample);
+	}
+}
+
+static ALWAYS_INLINE void combine_kernel(uint8_t const *input_left, uint8_t const *input_right,
+					 size_t samples, uint8_t *output, size_t bytes_per_sample)
+{
+	if (bytes_per_sample == 2 && STEREO_16_WORDS) {
+		for (size_t i = 0; i < samples; i++) {
+			uint16_t left;
+			uint16_t right;
+
+			memcpy(&left, &input_left[i * 2], sizeof(left));
+			memcpy(&right, &input_right[i * 2], sizeof(right));
+			word_write(&output[i * 4], left | ((uint32_t)right << 16));
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < samples; i++) {
+		uint8_t *frame = &output[i * 2 * bytes_per_sample];
+
+		sample_copy(frame, &input_left[i * bytes_per_sample], bytes_per_sample);
+		sample_copy(&frame[bytes_per_sample], &input_right[i * bytes_per_sample],
+			    bytes_per_sample);
+	}
+}
+
+static ALWAYS_INLINE void one_channel_split_kernel(uint8_t const *input, size_t frames,
+						   size_t ch_offset, uint8_t *output,
+						   size_t bytes_per_sample)
+{
+	if (bytes_per_sample == 2 && STEREO_16_WORDS) {
+		uint8_t shift = ch_offset ? 16 : 0;
+
+		for (size_t i = 0; i < frames; i++) {
+			uint16_t sample = word_read(&input[i * 4]) >> shift;
+
+			memcpy(&output[i * 2], &sample, sizeof(sample));
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < frames; i++) {
+		sample_copy(&output[i * bytes_per_sample],
+			    &input[(i * 2 + ch_offset) * bytes_per_sample], bytes_per_sample);
+	}
+}
+
+static ALWAYS_INLINE void two_channel_split_kernel(uint8_t const *input, size_t frames,
+						   uint8_t *output_left, uint8_t *output_right,
+						   size_t bytes_per_sample)
+{
+	if (bytes_per_sample == 2 && STEREO_16_WORDS) {
+		for (size_t i = 0; i < frames; i++) {
+			uint32_t frame = word_read(&input[i * 4]);
+			uint16_t left = frame;
+			uint16_t right = frame >> 16;
+
+			memcpy(&output_left[i * 2], &left, sizeof(left));
+			memcpy(&output_right[i * 2], &right, sizeof(right));
+		}
+		return;
+	}
+
+	for (size_t i = 0; i < frames; i++) {
+		uint8_t const *frame = &input[i * 2 * bytes_per_sample];
+
+		sample_copy(&output_left[i * bytes_per_sample], frame, bytes_per_sample);
+		sample_copy(&output_right[i * bytes_per_sample], &frame[bytes_per_sample],
+			    bytes_per_sample);
+	}
+}
+
+static ALWAYS_INLINE void interleave_kernel(uint8_t const *input, size_t samples, size_t channel,
+					    uint8_t *output, size_t channels,
+					    size_t bytes_per_sample)
+{
+	uint8_t *out = &output[channel * bytes_per_sample];
+	size_t step = channels * bytes_per_sample;
+
+	for (size_t i = 0; i < samples; i++) {
+		sample_copy(out, &input[i * bytes_per_sample], bytes_per_sample);
+		out += step;
+	}
+}
+
+static ALWAYS_INLINE void deinterleave_kernel(uint8_t const *input, size_t samples,
+					      size_t channel, uint8_t *output, size_t channels,
+					      size_t bytes_per_sample)
+{
+	uint8_t const *in = &input[channel * bytes_per_sample];
+	size_t step = channels * bytes_per_sample;
+
+	for (size_t i = 0; i < samples; i++) {
+		sample_copy(&output[i * bytes_per_sample], in, bytes_per_sample);
+		in += step;
+	}
+}
+
+static ALWAYS_INLINE void interleave_all_kernel(void const *const *inputs, size_t samples,
+						uint8_t *output, size_t channels,
+						size_t bytes_per_sample)
+{
+	if (channels == 2) {
+		combine_kernel(inputs[0], inputs[1], samples, output, bytes_per_sample);
+		return;
+	}
+
+	for (size_t ch = 0; ch < channels; ch++) {
+		interleave_kernel(inputs[ch], samples, ch, output, channels, bytes_per_sample);
+	}
+}
+
+static ALWAYS_INLINE void deinterleave_all_kernel(uint8_t const *input, size_t samples,
+						  void *const *outputs, size_t channels,
+						  size_t bytes_per_sample)
+{
+	if (channels == 2) {
+		two_channel_split_kernel(input, samples, outputs[0], outputs[1], bytes_per_sample);
+		return;
+	}
+
+	for (size_t ch = 0; ch < channels; ch++) {
+		deinterleave_kernel(input, samples, ch, outputs[ch], channels, bytes_per_sample);
+	}
+}
+
 int pscm_zero_pad(void const *const input, size_t input_size, enum audio_channel channel,
 		  uint8_t pcm_bit_depth, void *output, size_t *output_size)
 {
@@ -58,32 +251,14 @@ int pscm_zero_pad(void const *const input, size_t input_size, enum audio_channel
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
-
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		if (channel == AUDIO_CH_L) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
-
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = 0;
-			}
-		} else if (channel == AUDIO_CH_R) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = 0;
-			}
-
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
-		} else {
-			LOG_ERR("Invalid channel selection");
-			return -EINVAL;
-		}
+	if (channel != AUDIO_CH_L && channel != AUDIO_CH_R) {
+		LOG_ERR("Invalid channel selection");
+		return -EINVAL;
 	}
 
+	PSCM_KERNEL_CALL(bytes_per_sample, zero_pad_kernel, input, input_size / bytes_per_sample,
+			 (channel == AUDIO_CH_R) ? 1 : 0, output);
+
 	*output_size = input_size * 2;
 	return 0;
 }
@@ -97,20 +272,9 @@ int pscm_copy_pad(void const *const input, size_t input_size, uint8_t pcm_bit_de
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
-
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input++;
-		}
-		/* Move back to start of sample to copy into next channel */
-		pointer_input -= bytes_per_sample;
-
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input++;
-		}
-	}
+	/* Copying a sample to both channels is combining the input with itself */
+	PSCM_KERNEL_CALL(bytes_per_sample, combine_kernel, input, input,
+			 input_size / bytes_per_sample, output);
 
 	*output_size = input_size * 2;
 	return 0;
@@ -125,18 +289,8 @@ int pscm_combine(void const *const input_left, void const *const input_right, si
 		return -EINVAL;
 	}
 
-	char *pointer_input_left = (char *)input_left;
-	char *pointer_input_right = (char *)input_right;
-	char *pointer_output = (char *)output;
-
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input_left++;
-		}
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input_right++;
-		}
-	}
+	PSCM_KERNEL_CALL(bytes_per_sample, combine_kernel, input_left, input_right,
+			 input_size / bytes_per_sample, output);
 
 	*output_size = input_size * 2;
 	return 0;
@@ -151,28 +305,15 @@ int pscm_one_channel_split(void const *const input, size_t input_size, enum audi
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
-
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i += 2) {
-		if (channel == AUDIO_CH_L) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
-			pointer_input += bytes_per_sample;
-
-		} else if (channel == AUDIO_CH_R) {
-			pointer_input += bytes_per_sample;
-
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
-		} else {
-			LOG_ERR("Invalid channel selection");
-			return -EINVAL;
-		}
+	if (channel != AUDIO_CH_L && channel != AUDIO_CH_R) {
+		LOG_ERR("Invalid channel selection");
+		return -EINVAL;
 	}
 
+	PSCM_KERNEL_CALL(bytes_per_sample, one_channel_split_kernel, input,
+			 input_size / (2 * bytes_per_sample), (channel == AUDIO_CH_R) ? 1 : 0,
+			 output);
+
 	*output_size = input_size / 2;
 	return 0;
 }
@@ -186,18 +327,8 @@ int pscm_two_channel_split(void const *const input, size_t input_size, uint8_t p
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output_left = (char *)output_left;
-	char *pointer_output_right = (char *)output_right;
-
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i += 2) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output_left++ = *pointer_input++;
-		}
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output_right++ = *pointer_input++;
-		}
-	}
+	PSCM_KERNEL_CALL(bytes_per_sample, two_channel_split_kernel, input,
+			 input_size / (2 * bytes_per_sample), output_left, output_right);
 
 	*output_size = input_size / 2;
 	return 0;
@@ -221,40 +352,9 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 	}
 
 	uint8_t bytes_per_sample = pcm_bit_depth / 8;
-	/*
-	 * Use types corresponding to pcm_bit_depth to make iterating over an array faster
-	 * when pcm_bit_depth is 16 or 32. Use uint8_t in 8/24 bits case.
-	 */
-	if (bytes_per_sample == sizeof(uint16_t)) {
-		const uint16_t *input_16 = (const uint16_t *)input;
-		uint16_t *output_16 = (uint16_t *)output + channel;
-		const uint16_t *input_16_end = input_16 + (input_size / sizeof(uint16_t));
-
-		while (input_16 < input_16_end) {
-			*output_16 = *input_16++;
-			output_16 += output_channels;
-		}
-	} else if (bytes_per_sample == sizeof(uint32_t)) {
-		const uint32_t *input_32 = (const uint32_t *)input;
-		uint32_t *output_32 = (uint32_t *)output + channel;
-		const uint32_t *input_32_end = input_32 + (input_size / sizeof(uint32_t));
-
-		while (input_32 < input_32_end) {
-			*output_32 = *input_32++;
-			output_32 += output_channels;
-		}
-	} else {
-		const uint8_t *input_8 = (const uint8_t *)input;
-		uint8_t *output_8 = (uint8_t *)output + (bytes_per_sample * channel);
-		size_t step = bytes_per_sample * (output_channels - 1);
-
-		for (size_t i = 0; i < input_size; i += bytes_per_sample) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*output_8++ = *input_8++;
-			}
-			output_8 += step;
-		}
-	}
+
+	PSCM_KERNEL_CALL(bytes_per_sample, interleave_kernel, input, input_size / bytes_per_sample,
+			 channel, output, output_channels);
 
 	return 0;
 }
@@ -262,8 +362,6 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_channels,
 		      uint8_t channel, uint8_t pcm_bit_depth, void *output, size_t output_size)
 {
-	size_t bytes_to_copy;
-
 	if (input == NULL || output == NULL || input_size == 0 || channel >= input_channels ||
 	    pcm_bit_depth == 0 || pcm_bit_depth % 8 || output_size == 0 ||
 	    pcm_bit_depth > PSCM_MAX_CARRIER_BIT_DEPTH || input_channels == 0 ||
@@ -277,41 +375,68 @@ int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_
 	}
 
 	uint8_t bytes_per_sample = pcm_bit_depth / 8;
-	/*
-	 * Use types corresponding to pcm_bit_depth to make iterating over an array faster
-	 * when pcm_bit_depth is 16 or 32. Use uint8_t in 8/24 bits case.
-	 */
-	bytes_to_copy = input_size / input_channels;
-	if (bytes_per_sample == sizeof(uint16_t)) {
-		uint16_t *output_16 = (uint16_t *)output;
-		const uint16_t *input_16 = (const uint16_t *)input + channel;
-		uint16_t *output_16_end = output_16 + (bytes_to_copy / sizeof(uint16_t));
-
-		while (output_16 < output_16_end) {
-			*output_16++ = *input_16;
-			input_16 += input_channels;
-		}
-	} else if (bytes_per_sample == sizeof(uint32_t)) {
-		uint32_t *output_32 = (uint32_t *)output;
-		const uint32_t *input_32 = (const uint32_t *)input + channel;
-		uint32_t *output_32_end = output_32 + (bytes_to_copy / sizeof(uint32_t));
-
-		while (output_32 < output_32_end) {
-			*output_32++ = *input_32;
-			input_32 += input_channels;
+
+	PSCM_KERNEL_CALL(bytes_per_sample, deinterleave_kernel, input,
+			 input_size / input_channels / bytes_per_sample, channel, output,
+			 input_channels);
+
+	return 0;
+}
+
+int pscm_interleave_all(void const *const *const inputs, size_t input_size, uint8_t pcm_bit_depth,
+			void *output, size_t output_size, uint8_t output_channels)
+{
+	if (inputs == NULL || output == NULL || input_size == 0 || pcm_bit_depth == 0 ||
+	    pcm_bit_depth > PSCM_MAX_CARRIER_BIT_DEPTH || pcm_bit_depth % 8 || output_size == 0 ||
+	    output_channels == 0) {
+		LOG_WRN("Invalid parameter(s) passed to interleaver");
+		return -EINVAL;
+	}
+
+	for (uint8_t ch = 0; ch < output_channels; ch++) {
+		if (inputs[ch] == NULL || inputs[ch] == output) {
+			LOG_WRN("Invalid input buffer for channel %d", ch);
+			return -EINVAL;
 		}
-	} else {
-		uint8_t *output_8 = (uint8_t *)output;
-		const uint8_t *input_8 = (const uint8_t *)input + (channel * bytes_per_sample);
-		size_t step = bytes_per_sample * (input_channels - 1);
-
-		for (size_t i = 0; i < bytes_to_copy; i += bytes_per_sample) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*output_8++ = *input_8++;
-			}
-			input_8 += step;
+	}
+
+	if (output_size < (input_size * output_channels)) {
+		LOG_WRN("Output buffer too small to interleave input into");
+		return -EINVAL;
+	}
+
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+
+	PSCM_KERNEL_CALL(bytes_per_sample, interleave_all_kernel, inputs,
+			 input_size / bytes_per_sample, output, output_channels);
+
+	return 0;
+}
+
+int pscm_deinterleave_all(void const *const input, size_t input_size, uint8_t input_channels,
+			  uint8_t pcm_bit_depth, void *const *const outputs, size_t output_size)
+{
+	if (input == NULL || outputs == NULL || input_size == 0 || pcm_bit_depth == 0 ||
+	    pcm_bit_depth % 8 || output_size == 0 || pcm_bit_depth > PSCM_MAX_CARRIER_BIT_DEPTH ||
+	    input_channels == 0) {
+		return -EINVAL;
+	}
+
+	for (uint8_t ch = 0; ch < input_channels; ch++) {
+		if (outputs[ch] == NULL || outputs[ch] == input) {
+			return -EINVAL;
 		}
 	}
 
+	if (output_size < (input_size / input_channels)) {
+		LOG_DBG("Output buffer too small to uninterleave input into");
+		return -EINVAL;
+	}
+
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+
+	PSCM_KERNEL_CALL(bytes_per_sample, deinterleave_all_kernel, input,
+			 input_size / input_channels / bytes_per_sample, outputs, input_channels);
+
 	return 0;
 }
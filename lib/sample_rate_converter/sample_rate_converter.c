@@ -6,6 +6,9 @@
 
 #include "sample_rate_converter.h"
 #include "sample_rate_converter_filter.h"
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+#include "sample_rate_converter_polyphase.h"
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 
 #include <errno.h>
 #include <stdbool.h>
@@ -23,48 +26,83 @@ LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVE
 	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
 
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define BYTES_PER_SAMPLE sizeof(uint16_t)
 #define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
 	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
 #define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define BYTES_PER_SAMPLE sizeof(uint32_t)
 #define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
 	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
 #define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
 #endif
 
-static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
+/**
+ * @brief Check if the sample rates can be converted by the CMSIS DSP filters.
+ *
+ * @details The filters support downsampling from 48 kHz to 24 kHz or 16 kHz, and upsampling from
+ *	    24 kHz or 16 kHz to 48 kHz.
+ */
+static bool integer_ratio_supported(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
 	if (sample_rate_input > sample_rate_output) {
-		if (sample_rate_input != 48000) {
-			LOG_ERR("Invalid input sample rate for downsampling %d", sample_rate_input);
-			return -EINVAL;
-		}
+		return (sample_rate_input == 48000) &&
+		       ((sample_rate_output == 24000) || (sample_rate_output == 16000));
+	}
 
-		if ((sample_rate_output != 24000) && (sample_rate_output != 16000)) {
-			LOG_ERR("Invalid output sample rate for downsampling %d",
-				sample_rate_output);
-			return -EINVAL;
-		}
-	} else if (sample_rate_input < sample_rate_output) {
-		if (sample_rate_output != 48000) {
-			LOG_ERR("Invalid output sample rate for upsampling: %d",
-				sample_rate_output);
-			return -EINVAL;
-		}
+	return (sample_rate_output == 48000) &&
+	       ((sample_rate_input == 24000) || (sample_rate_input == 16000));
+}
 
-		if ((sample_rate_input != 24000) && (sample_rate_input != 16000)) {
-			LOG_ERR("Invalid input sample rate for upsampling: %d", sample_rate_input);
-			return -EINVAL;
-		}
-	} else {
+static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	if (sample_rate_input == sample_rate_output) {
 		LOG_ERR("Input and out sample rates are the same");
 		return -EINVAL;
 	}
+
+	if (!integer_ratio_supported(sample_rate_input, sample_rate_output) &&
+	    !IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE)) {
+		LOG_ERR("Invalid sample rates for conversion: %d to %d", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
 	return 0;
 }
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+static bool polyphase_active(const struct sample_rate_converter_ctx *ctx)
+{
+	return (ctx->conversion_ratio == 0) && (ctx->sample_rate_input != 0);
+}
+
+static int polyphase_process(struct sample_rate_converter_ctx *ctx, void const *const input,
+			     size_t samples_in, void *const output, size_t output_size,
+			     size_t *output_written)
+{
+	size_t samples_used;
+	size_t samples_out =
+		sample_rate_converter_polyphase_output_max(&ctx->polyphase, samples_in);
+
+	if (samples_out * BYTES_PER_SAMPLE > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	samples_out = sample_rate_converter_polyphase_process(&ctx->polyphase, input, samples_in,
+							      &samples_used, output, samples_out);
+	__ASSERT(samples_used == samples_in, "Not all input samples were used");
+
+	*output_written = samples_out * BYTES_PER_SAMPLE;
+
+	return 0;
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 static inline int calculate_conversion_ratio(uint32_t sample_rate_input,
 					     uint32_t sample_rate_output)
 {
@@ -108,6 +146,28 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 		return ret;
 	}
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	if (!integer_ratio_supported(sample_rate_input, sample_rate_output)) {
+		ret = sample_rate_converter_polyphase_init(&ctx->polyphase, sample_rate_input,
+							   sample_rate_output, ctx->trim_ppb);
+		if (ret) {
+			LOG_ERR("Failed to initialize polyphase conversion (%d)", ret);
+			return ret;
+		}
+
+		ctx->sample_rate_input = sample_rate_input;
+		ctx->sample_rate_output = sample_rate_output;
+		ctx->conversion_ratio = 0;
+		ctx->filter_type = filter;
+		ctx->input_buf.bytes_in_buf = 0;
+
+		LOG_DBG("Polyphase sample rate converter initialized. Input sample rate: %d, "
+			"Output sample rate: %d",
+			ctx->sample_rate_input, ctx->sample_rate_output);
+		return 0;
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 	ctx->sample_rate_input = sample_rate_input;
 	ctx->sample_rate_output = sample_rate_output;
 
@@ -247,6 +307,13 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		}
 	}
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	if (polyphase_active(ctx)) {
+		return polyphase_process(ctx, input, samples_in, output, output_size,
+					 output_written);
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
 			"downsampling",
@@ -393,3 +460,108 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+int sample_rate_converter_ratio_trim_set(struct sample_rate_converter_ctx *ctx, int32_t trim_ppb)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((trim_ppb > SAMPLE_RATE_CONVERTER_TRIM_PPB_MAX) ||
+	    (trim_ppb < -SAMPLE_RATE_CONVERTER_TRIM_PPB_MAX)) {
+		LOG_ERR("Trim out of range: %d ppb", trim_ppb);
+		return -EINVAL;
+	}
+
+	ctx->trim_ppb = trim_ppb;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	if (polyphase_active(ctx)) {
+		sample_rate_converter_polyphase_trim(&ctx->polyphase, ctx->sample_rate_input,
+						     ctx->sample_rate_output, trim_ppb);
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
+	return 0;
+}
+
+int sample_rate_converter_stream_open(struct sample_rate_converter_ctx *ctx,
+				      uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	int ret;
+
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_ctx));
+
+	ret = sample_rate_converter_polyphase_init(&ctx->polyphase, input_sample_rate,
+						   output_sample_rate, ctx->trim_ppb);
+	if (ret) {
+		return ret;
+	}
+
+	ctx->sample_rate_input = input_sample_rate;
+	ctx->sample_rate_output = output_sample_rate;
+
+	return 0;
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(input_sample_rate);
+	ARG_UNUSED(output_sample_rate);
+
+	LOG_ERR("Polyphase conversion is not enabled");
+	return -ENOTSUP;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+}
+
+int sample_rate_converter_stream_process(struct sample_rate_converter_ctx *ctx,
+					 void const *const input, size_t input_size,
+					 size_t *input_used, void *const output, size_t output_size,
+					 size_t *output_written)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+	size_t samples_used;
+	size_t samples_out;
+
+	if ((ctx == NULL) || (input == NULL) || (input_used == NULL) || (output == NULL) ||
+	    (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (!polyphase_active(ctx)) {
+		LOG_ERR("Context is not opened for streaming");
+		return -EINVAL;
+	}
+
+	if (input_size % BYTES_PER_SAMPLE != 0) {
+		LOG_ERR("Size of input is not a byte multiple");
+		return -EINVAL;
+	}
+
+	samples_out = sample_rate_converter_polyphase_process(
+		&ctx->polyphase, input, input_size / BYTES_PER_SAMPLE, &samples_used, output,
+		output_size / BYTES_PER_SAMPLE);
+
+	*input_used = samples_used * BYTES_PER_SAMPLE;
+	*output_written = samples_out * BYTES_PER_SAMPLE;
+
+	return 0;
+#else
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(input);
+	ARG_UNUSED(input_size);
+	ARG_UNUSED(input_used);
+	ARG_UNUSED(output);
+	ARG_UNUSED(output_size);
+	ARG_UNUSED(output_written);
+
+	LOG_ERR("Polyphase conversion is not enabled");
+	return -ENOTSUP;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+}
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter_polyphase.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <dsp/basic_math_functions.h>
+#include <dsp/fast_math_functions.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_polyphase, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#define TAPS	CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS
+#define PHASES	SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES
+#define HISTORY SAMPLE_RATE_CONVERTER_POLYPHASE_HISTORY_SIZE
+
+#define PHASE_BITS 5
+BUILD_ASSERT(BIT(PHASE_BITS) == PHASES, "Number of phases must match the phase bits");
+
+/* Fractional bits of the position, and of the position between two phases. */
+#define POS_FRAC_BITS	 32
+#define INTERP_FRAC_BITS 15
+
+#define PPB_PER_UNIT 1000000000LL
+
+/* The -6 dB cut-off of the low-pass filter, relative to the Nyquist frequency of the lowest of
+ * the two sample rates. Leaves room for the transition band of the filter below the Nyquist
+ * frequency.
+ */
+#define CUTOFF 0.9f
+
+/* Coefficients for a 4-term Blackman-Harris window, which attenuates side lobes by 92 dB. */
+#define WINDOW_A0 0.35875f
+#define WINDOW_A1 0.48829f
+#define WINDOW_A2 0.14128f
+#define WINDOW_A3 0.01168f
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t sample_t;
+#define SAMPLE_MIN	 INT16_MIN
+#define SAMPLE_MAX	 INT16_MAX
+#define SAMPLE_SCALE	 32768.0f
+/* arm_dot_prod_q15 returns the sum in 34.30 format. */
+#define ACC_SHIFT	 (30 - 15)
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t sample_t;
+#define SAMPLE_MIN	 INT32_MIN
+#define SAMPLE_MAX	 INT32_MAX
+#define SAMPLE_SCALE	 2147483648.0f
+/* arm_dot_prod_q31 returns the sum in 16.48 format. */
+#define ACC_SHIFT	 (48 - 31)
+#endif
+
+static float sinc(float x)
+{
+	if ((x > -1e-6f) && (x < 1e-6f)) {
+		return 1.0f;
+	}
+
+	return arm_sin_f32(PI * x) / (PI * x);
+}
+
+static float window(float x)
+{
+	return WINDOW_A0 + WINDOW_A1 * arm_cos_f32(2.0f * PI * x) +
+	       WINDOW_A2 * arm_cos_f32(4.0f * PI * x) + WINDOW_A3 * arm_cos_f32(6.0f * PI * x);
+}
+
+static sample_t coeff_to_sample(float coeff)
+{
+	int64_t val = (int64_t)(coeff * SAMPLE_SCALE + ((coeff < 0.0f) ? -0.5f : 0.5f));
+
+	return CLAMP(val, SAMPLE_MIN, SAMPLE_MAX);
+}
+
+/**
+ * @brief Calculate the coefficient bank from a windowed sinc low-pass filter.
+ *
+ * @details Row p of the bank holds the taps for an output sample p / PHASES input samples after
+ *	    the newest input sample in the filter window. Each row is normalized to unity DC gain,
+ *	    so that interpolating between two rows does not modulate the signal level.
+ */
+static void bank_calculate(struct sample_rate_converter_polyphase *polyphase, float cutoff)
+{
+	for (size_t p = 0; p <= PHASES; p++) {
+		float row[TAPS];
+		float sum = 0.0f;
+
+		for (size_t j = 0; j < TAPS; j++) {
+			/* Distance in input samples from the output sample to window sample j,
+			 * where j = 0 is the oldest sample.
+			 */
+			float u = (float)p / PHASES + (float)(TAPS - 1 - j) - (float)(TAPS / 2);
+
+			row[j] = cutoff * sinc(cutoff * u) * window(u / TAPS);
+			sum += row[j];
+		}
+
+		for (size_t j = 0; j < TAPS; j++) {
+			polyphase->bank[p * TAPS + j] = coeff_to_sample(row[j] / sum);
+		}
+	}
+}
+
+static uint64_t step_calculate(uint32_t sample_rate_input, uint32_t sample_rate_output,
+			       int32_t trim_ppb)
+{
+	uint64_t step = ((uint64_t)sample_rate_input << POS_FRAC_BITS) / sample_rate_output;
+
+	/* A higher output sample rate gives a shorter distance between the output samples. The
+	 * first order approximation is accurate to well below 1 ppb for the supported trim range.
+	 */
+	return step - ((int64_t)step * trim_ppb) / PPB_PER_UNIT;
+}
+
+static inline q63_t dot_prod(const sample_t *window, const sample_t *coeffs)
+{
+	q63_t result;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	arm_dot_prod_q15(window, coeffs, TAPS, &result);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	arm_dot_prod_q31(window, coeffs, TAPS, &result);
+#endif
+
+	return result;
+}
+
+static inline sample_t output_sample(const sample_t *window, const sample_t *coeffs,
+				     uint32_t interp)
+{
+	q63_t a = dot_prod(window, coeffs);
+	q63_t b = dot_prod(window, coeffs + TAPS);
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q63_t acc = a + (((b - a) * interp) >> INTERP_FRAC_BITS);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	/* Scale down before multiplying, as the 16.48 sums leave no headroom for the factor. */
+	q63_t acc = a + ((b - a) >> INTERP_FRAC_BITS) * interp;
+#endif
+
+	acc = (acc + (q63_t)BIT64(ACC_SHIFT - 1)) >> ACC_SHIFT;
+
+	return CLAMP(acc, SAMPLE_MIN, SAMPLE_MAX);
+}
+
+int sample_rate_converter_polyphase_init(struct sample_rate_converter_polyphase *polyphase,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 int32_t trim_ppb)
+{
+	if ((sample_rate_input == 0) || (sample_rate_output == 0) ||
+	    (sample_rate_input >
+	     (uint64_t)sample_rate_output * SAMPLE_RATE_CONVERTER_POLYPHASE_RATIO_MAX) ||
+	    (sample_rate_output >
+	     (uint64_t)sample_rate_input * SAMPLE_RATE_CONVERTER_POLYPHASE_RATIO_MAX)) {
+		LOG_ERR("Unsupported sample rates for polyphase conversion: %d to %d",
+			sample_rate_input, sample_rate_output);
+		return -EINVAL;
+	}
+
+	polyphase->step = step_calculate(sample_rate_input, sample_rate_output, trim_ppb);
+	polyphase->pos = 0;
+	memset(polyphase->history, 0, sizeof(polyphase->history));
+
+	bank_calculate(polyphase,
+		       CUTOFF * MIN(1.0f, (float)sample_rate_output / (float)sample_rate_input));
+
+	return 0;
+}
+
+void sample_rate_converter_polyphase_trim(struct sample_rate_converter_polyphase *polyphase,
+					  uint32_t sample_rate_input, uint32_t sample_rate_output,
+					  int32_t trim_ppb)
+{
+	polyphase->step = step_calculate(sample_rate_input, sample_rate_output, trim_ppb);
+}
+
+size_t sample_rate_converter_polyphase_output_max(
+	const struct sample_rate_converter_polyphase *polyphase, size_t samples_in)
+{
+	uint64_t end = (uint64_t)samples_in << POS_FRAC_BITS;
+
+	/* Output samples are produced at every step from the current position up to the end of
+	 * the input.
+	 */
+	if (polyphase->pos >= end) {
+		return 0;
+	}
+
+	return DIV_ROUND_UP(end - polyphase->pos, polyphase->step);
+}
+
+size_t sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase *polyphase,
+					       void const *input, size_t samples_in,
+					       size_t *samples_used, void *output,
+					       size_t samples_out_max)
+{
+	const sample_t *in = input;
+	sample_t *out = output;
+	uint64_t pos = polyphase->pos;
+	size_t written = 0;
+	size_t used;
+
+	/* The history followed by the first input samples. Only the filter windows that start in
+	 * the history are read from here, the rest are read directly from the input.
+	 */
+	sample_t join[2 * HISTORY];
+
+	memcpy(join, polyphase->history, sizeof(polyphase->history));
+	memcpy(&join[HISTORY], in, MIN(samples_in, HISTORY) * sizeof(sample_t));
+
+	while (written < samples_out_max) {
+		/* Index of the newest input sample in the filter window */
+		size_t idx = pos >> POS_FRAC_BITS;
+
+		if (idx >= samples_in) {
+			break;
+		}
+
+		uint32_t frac = (uint32_t)pos;
+		uint32_t phase = frac >> (POS_FRAC_BITS - PHASE_BITS);
+		const sample_t *coeffs = &polyphase->bank[phase * TAPS];
+		uint32_t interp = (frac >> (POS_FRAC_BITS - PHASE_BITS - INTERP_FRAC_BITS)) &
+				  BIT_MASK(INTERP_FRAC_BITS);
+		const sample_t *window = (idx < HISTORY) ? &join[idx] : &in[idx - HISTORY];
+
+		out[written++] = output_sample(window, coeffs, interp);
+		pos += polyphase->step;
+	}
+
+	used = MIN(pos >> POS_FRAC_BITS, samples_in);
+	polyphase->pos = pos - ((uint64_t)used << POS_FRAC_BITS);
+
+	/* Keep the input samples before the first unused one for the next filter windows */
+	if (used >= HISTORY) {
+		memcpy(polyphase->history, &in[used - HISTORY], sizeof(polyphase->history));
+	} else {
+		memcpy(polyphase->history, &join[used], sizeof(polyphase->history));
+	}
+
+	*samples_used = used;
+
+	return written;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+#define _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sample_rate_converter.h"
+
+/**
+ * @brief Initialize the polyphase conversion for a pair of sample rates.
+ *
+ * @details Calculates the coefficient bank for the conversion and clears the history of the
+ *	    stream. The cut-off of the low-pass filter is set below the Nyquist frequency of the
+ *	    lowest of the two sample rates.
+ *
+ * @param[out]	polyphase		Pointer to the polyphase conversion state.
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ * @param[in]	trim_ppb		Output sample rate trim in parts per billion.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Sample rates not supported.
+ */
+int sample_rate_converter_polyphase_init(struct sample_rate_converter_polyphase *polyphase,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 int32_t trim_ppb);
+
+/**
+ * @brief Update the conversion ratio without resetting the stream.
+ *
+ * @param[in,out]	polyphase		Pointer to the polyphase conversion state.
+ * @param[in]		sample_rate_input	Sample rate of the input samples.
+ * @param[in]		sample_rate_output	Sample rate of the output samples.
+ * @param[in]		trim_ppb		Output sample rate trim in parts per billion.
+ */
+void sample_rate_converter_polyphase_trim(struct sample_rate_converter_polyphase *polyphase,
+					  uint32_t sample_rate_input, uint32_t sample_rate_output,
+					  int32_t trim_ppb);
+
+/**
+ * @brief Get the largest number of output samples produced from a number of input samples.
+ *
+ * @param[in]	polyphase	Pointer to the polyphase conversion state.
+ * @param[in]	samples_in	Number of input samples.
+ *
+ * @return	Number of output samples.
+ */
+size_t sample_rate_converter_polyphase_output_max(
+	const struct sample_rate_converter_polyphase *polyphase, size_t samples_in);
+
+/**
+ * @brief Convert input samples until the input is used or the output is full.
+ *
+ * @param[in,out]	polyphase	Pointer to the polyphase conversion state.
+ * @param[in]		input		Input samples.
+ * @param[in]		samples_in	Number of input samples.
+ * @param[out]		samples_used	Number of input samples used.
+ * @param[out]		output		Output samples.
+ * @param[in]		samples_out_max	Number of samples the output can hold.
+ *
+ * @return	Number of output samples written.
+ */
+size_t sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase *polyphase,
+					       void const *input, size_t samples_in,
+					       size_t *samples_used, void *output,
+					       size_t samples_out_max);
+
+#endif /* _SAMPLE_RATE_CONVERTER_POLYPHASE_H_ */
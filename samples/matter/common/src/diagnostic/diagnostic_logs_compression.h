@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Nrf::Matter
+{
+
+/*
+   Byte-oriented LZ77 codec for blocks of diagnostic logs.
+
+   Log lines repeat the timestamp format, the level and the module tags, so replacing repeated sequences with
+   references to the earlier part of the same block compresses them well, while both directions need only a few
+   hundred bytes of memory. Every block is compressed independently, so blocks can be dropped from the ring buffer
+   and decompressed one by one.
+
+   As every block starts with an empty history, both directions are primed with a static dictionary of substrings
+   common in the Matter logs. The dictionary is treated as if it preceded the block, so a match can refer to it with
+   a distance reaching back before the beginning of the block. Changing the dictionary makes the blocks compressed
+   before unreadable.
+
+   The compressed block is a sequence of tokens:
+   - 0x00-0x7F: literal run, followed by (token + 1) literal bytes.
+   - 0x80-0xFF: match, followed by one more byte. Bits 6-2 of the token hold the match length reduced by kMinMatch,
+     and bits 1-0 of the token with the following byte hold the distance to the beginning of the match, counted back
+     from the current position.
+*/
+class LogBlockCompressor {
+public:
+	static constexpr size_t kMinMatch = 3;
+	static constexpr size_t kMaxMatch = 0x1F + kMinMatch;
+	static constexpr size_t kMaxLiterals = 0x80;
+	static constexpr size_t kMaxDistance = 0x3FF;
+
+	/* Substrings common in the Matter logs. The dictionary is kept short, as it can be referred to only from the
+	 * part of the block that is closer to it than kMaxDistance. The most common ones are placed at the end, closest
+	 * to the block. */
+	static constexpr char kDictionary[] =
+		"Msg TX to 1:0000000000000000 [0000] --- Type 0000:10 (SecureChannel:StandaloneAck)"
+		"(IM:InvokeCommandRequest)(IM:StatusResponse)(IM:ReadRequest)(IM:SubscribeRequest)(IM:ReportData) "
+		"Cluster=0x0000_Attribute=0x0000_Command=0x0000_Endpoint= seconds<wrn> app: <err> chip: "
+		"<inf> chip: [DL]<inf> chip: [IN]<dbg> chip: [DMG]<inf> chip: [SVR]<inf> chip: [DMG]"
+		"<dbg> chip: [EM]>>> [E:<inf> chip: [EM]<<< [E:";
+	/* Size of the dictionary, without the terminating null character. */
+	static constexpr size_t kDictionarySize = sizeof(kDictionary) - 1;
+
+	static_assert(kDictionarySize < kMaxDistance, "The dictionary cannot be referred to from the block");
+
+	/**
+	 * @brief Compress the block of logs.
+	 *
+	 * @param input data to be compressed
+	 * @param inputSize size of data to be compressed
+	 * @param output buffer for the compressed data
+	 * @param outputCapacity size of the output buffer
+	 * @return size of the compressed data, or 0 if the compressed data would not fit the output buffer
+	 */
+	size_t Compress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity)
+	{
+		/* Positions are counted from the beginning of the dictionary, that precedes the input. */
+		const BlockView block{ input, inputSize };
+		size_t inPos = kDictionarySize;
+		size_t outPos = 0;
+		size_t literalsBegin = kDictionarySize;
+
+		memset(mHashTable, 0, sizeof(mHashTable));
+
+		for (size_t i = 0; i + kMinMatch <= kDictionarySize; i++) {
+			mHashTable[Hash(block, i)] = static_cast<uint16_t>(i + 1);
+		}
+
+		while (inPos + kMinMatch <= block.End()) {
+			const uint16_t hash = Hash(block, inPos);
+			/* Positions are stored incremented by one, so that zero marks an empty slot. */
+			const size_t candidate = mHashTable[hash];
+
+			mHashTable[hash] = static_cast<uint16_t>(inPos + 1);
+
+			if (candidate == 0 || inPos - (candidate - 1) > kMaxDistance ||
+			    !block.Equal(candidate - 1, inPos, kMinMatch)) {
+				inPos++;
+				continue;
+			}
+
+			const size_t matchBegin = candidate - 1;
+			size_t matchLength = kMinMatch;
+
+			while (inPos + matchLength < block.End() && matchLength < kMaxMatch &&
+			       block[matchBegin + matchLength] == block[inPos + matchLength]) {
+				matchLength++;
+			}
+
+			if (!EmitLiterals(input + literalsBegin - kDictionarySize, inPos - literalsBegin, output,
+					  outputCapacity, outPos) ||
+			    outPos + 2 > outputCapacity) {
+				return 0;
+			}
+
+			const size_t distance = inPos - matchBegin;
+
+			output[outPos++] = static_cast<uint8_t>(0x80 | ((matchLength - kMinMatch) << 2) | (distance >> 8));
+			output[outPos++] = static_cast<uint8_t>(distance);
+
+			/* Index the positions covered by the match, so that the following lines can refer to them. */
+			for (size_t i = inPos + 1; i < inPos + matchLength && i + kMinMatch <= block.End(); i++) {
+				mHashTable[Hash(block, i)] = static_cast<uint16_t>(i + 1);
+			}
+
+			inPos += matchLength;
+			literalsBegin = inPos;
+		}
+
+		if (!EmitLiterals(input + literalsBegin - kDictionarySize, block.End() - literalsBegin, output,
+				  outputCapacity, outPos)) {
+			return 0;
+		}
+
+		return outPos;
+	}
+
+	/**
+	 * @brief Decompress the block of logs compressed using Compress().
+	 *
+	 * @param input compressed data
+	 * @param inputSize size of compressed data
+	 * @param output buffer for the decompressed data
+	 * @param outputCapacity size of the output buffer
+	 * @return size of the decompressed data, or 0 if the compressed data is corrupted or does not fit the output
+	 * buffer
+	 */
+	static size_t Decompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputCapacity)
+	{
+		size_t inPos = 0;
+		size_t outPos = 0;
+
+		while (inPos < inputSize) {
+			const uint8_t token = input[inPos++];
+
+			if (token < 0x80) {
+				const size_t count = token + 1;
+
+				if (inPos + count > inputSize || outPos + count > outputCapacity) {
+					return 0;
+				}
+
+				memcpy(output + outPos, input + inPos, count);
+				inPos += count;
+				outPos += count;
+				continue;
+			}
+
+			if (inPos >= inputSize) {
+				return 0;
+			}
+
+			const size_t count = ((token >> 2) & 0x1F) + kMinMatch;
+			const size_t distance = ((token & 0x03) << 8) | input[inPos++];
+
+			if (distance == 0 || distance > outPos + kDictionarySize || outPos + count > outputCapacity) {
+				return 0;
+			}
+
+			/* The match may overlap the bytes being produced, so it must be copied byte by byte. It may
+			 * also begin in the dictionary, that precedes the block. */
+			for (size_t i = 0; i < count; i++, outPos++) {
+				output[outPos] = distance > outPos ? kDictionary[kDictionarySize + outPos - distance] :
+								     output[outPos - distance];
+			}
+		}
+
+		return outPos;
+	}
+
+private:
+	static constexpr size_t kHashBits = 8;
+
+	/* Input block preceded by the dictionary, addressed by the positions counted from the dictionary beginning. */
+	struct BlockView {
+		const uint8_t *mInput;
+		size_t mInputSize;
+
+		size_t End() const { return kDictionarySize + mInputSize; }
+
+		uint8_t operator[](size_t pos) const
+		{
+			return pos < kDictionarySize ? static_cast<uint8_t>(kDictionary[pos]) :
+						       mInput[pos - kDictionarySize];
+		}
+
+		bool Equal(size_t first, size_t second, size_t count) const
+		{
+			for (size_t i = 0; i < count; i++) {
+				if ((*this)[first + i] != (*this)[second + i]) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	static uint16_t Hash(const BlockView &block, size_t pos)
+	{
+		const uint32_t value = block[pos] | (block[pos + 1] << 8) | (block[pos + 2] << 16);
+
+		return static_cast<uint16_t>((value * 2654435761u) >> (32 - kHashBits));
+	}
+
+	static bool EmitLiterals(const uint8_t *literals, size_t count, uint8_t *output, size_t outputCapacity,
+				 size_t &outPos)
+	{
+		while (count > 0) {
+			const size_t runLength = count < kMaxLiterals ? count : kMaxLiterals;
+
+			if (outPos + 1 + runLength > outputCapacity) {
+				return false;
+			}
+
+			output[outPos++] = static_cast<uint8_t>(runLength - 1);
+			memcpy(output + outPos, literals, runLength);
+			outPos += runLength;
+			literals += runLength;
+			count -= runLength;
+		}
+
+		return true;
+	}
+
+	uint16_t mHashTable[1 << kHashBits];
+};
+
+} /* namespace Nrf::Matter */
@@ -9,6 +9,8 @@
 #include <lib/support/CodeUtils.h>
 #include <system/SystemError.h>
 
+#include <cstring>
+
 using namespace chip;
 
 K_MUTEX_DEFINE(sWriteMutex);
@@ -20,150 +22,280 @@ CHIP_ERROR DiagnosticLogsRetention::Init()
 	}
 
 	mCapacity = retention_size(mPartition);
-	VerifyOrReturnError(mCapacity > kHeaderSize, CHIP_ERROR_INTERNAL);
+	VerifyOrReturnError(mCapacity > kDataOffset + sizeof(mBlock), CHIP_ERROR_INTERNAL);
 
-	/* The actual capacity to store data is reduced by "header" tracking the stored size and data beginning. */
-	mCapacity = mCapacity - kHeaderSize;
+	/* The actual capacity to store data is reduced by "header" tracking the stored size and data beginning, and by
+	 * the pending area. */
+	mCapacity = mCapacity - kDataOffset;
 
 	int ret = retention_is_valid(mPartition);
 
-	/* If data is invalid just clean the header data, as we are not sure which part is corrupted. */
-	if (ret != 1) {
-		ret = retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
-		VerifyOrReturnError(ret == 0, System::MapErrorZephyr(ret));
-		ret = retention_write(mPartition, sizeof(mCurrentSize), reinterpret_cast<uint8_t *>(&mDataBegin),
-				      sizeof(mDataBegin));
-		VerifyOrReturnError(ret == 0, System::MapErrorZephyr(ret));
-	} else {
+	if (ret == 1) {
 		/* Load the header data from retention RAM. */
-		ret = retention_read(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
+		ret = retention_read(mPartition, 0, reinterpret_cast<uint8_t *>(&mHeader), sizeof(mHeader));
 		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+	}
 
-		ret = retention_read(mPartition, sizeof(mCurrentSize), reinterpret_cast<uint8_t *>(&mDataBegin),
-				     sizeof(mDataBegin));
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+	/* If data is invalid just clean the header data, as we are not sure which part is corrupted. */
+	if (ret != 0 || mHeader.mVersion != kLayoutVersion || mHeader.mStoredSize > mCapacity ||
+	    mHeader.mDataBegin >= mCapacity) {
+		mHeader = { kLayoutVersion, 0, 0, 0 };
+		ReturnErrorOnFailure(WriteHeader());
 	}
 
-	mDataEnd = mDataBegin + mCurrentSize > mCapacity ? mCurrentSize + mDataBegin - mCapacity :
-							   mDataBegin + mCurrentSize;
+	ReturnErrorOnFailure(RestorePending());
 
 	mIsInitialized = true;
 
 	return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR DiagnosticLogsRetention::RestorePending()
+{
+	mStagedSize = 0;
+	mPendingSize = 0;
+
+	/* Restore the logs pushed before the reset that did not fill a whole block. A record that does not fit is
+	 * treated as the end of the pending area, and it is overwritten by the next pushed logs. */
+	while (true) {
+		RecordSize recordSize = 0;
+
+		int ret = retention_read(mPartition, kPendingOffset + mPendingSize, reinterpret_cast<uint8_t *>(&recordSize),
+					 sizeof(recordSize));
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+		if (recordSize == 0 || recordSize > kBlockSize - mStagedSize ||
+		    mPendingSize + 2 * sizeof(RecordSize) + recordSize > kPendingAreaSize) {
+			break;
+		}
+
+		ret = retention_read(mPartition, kPendingOffset + mPendingSize + sizeof(recordSize), mStaging + mStagedSize,
+				     recordSize);
+		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+		mStagedSize += recordSize;
+		mPendingSize += sizeof(recordSize) + recordSize;
+	}
+
+	/* The reset could happen before the full pending block was written to the buffer. */
+	return IsPendingFull() ? FlushLocked() : CHIP_NO_ERROR;
+}
+
 CHIP_ERROR DiagnosticLogsRetention::Clear()
 {
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+
 	int ret = retention_clear(mPartition);
 
 	if (ret == 0) {
-		mCurrentSize = 0;
-		mDataBegin = 0;
-		mDataEnd = 0;
+		mHeader = { kLayoutVersion, 0, 0, 0 };
+		mStagedSize = 0;
+		mPendingSize = 0;
 	}
 
+	k_mutex_unlock(&sWriteMutex);
+
+	return System::MapErrorZephyr(ret);
+}
+
+CHIP_ERROR DiagnosticLogsRetention::WriteHeader()
+{
+	/* The header is directly followed by the pending area, so the zero record size written with it also empties the
+	 * pending area. */
+	uint8_t buffer[sizeof(Header) + sizeof(RecordSize)] = {};
+
+	memcpy(buffer, &mHeader, sizeof(mHeader));
+
+	int ret = retention_write(mPartition, 0, buffer, sizeof(buffer));
+
 	return System::MapErrorZephyr(ret);
 }
 
+int DiagnosticLogsRetention::WriteData(uint32_t offset, const uint8_t *data, size_t size)
+{
+	const size_t firstPart = mCapacity - offset > size ? size : mCapacity - offset;
+
+	int ret = retention_write(mPartition, kDataOffset + offset, data, firstPart);
+
+	/* Save the part that wrapped around. */
+	if (ret == 0 && firstPart < size) {
+		ret = retention_write(mPartition, kDataOffset, data + firstPart, size - firstPart);
+	}
+
+	return ret;
+}
+
+int DiagnosticLogsRetention::ReadData(uint32_t offset, uint8_t *data, size_t size)
+{
+	const size_t firstPart = mCapacity - offset > size ? size : mCapacity - offset;
+
+	int ret = retention_read(mPartition, kDataOffset + offset, data, firstPart);
+
+	/* Read the part that wrapped around. */
+	if (ret == 0 && firstPart < size) {
+		ret = retention_read(mPartition, kDataOffset, data + firstPart, size - firstPart);
+	}
+
+	return ret;
+}
+
 CHIP_ERROR DiagnosticLogsRetention::PushLog(const void *data, size_t size)
 {
 	VerifyOrReturnError(data, CHIP_ERROR_INVALID_ARGUMENT);
 	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
-	VerifyOrReturnError(size < mCapacity, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+	const uint8_t *bytes = reinterpret_cast<const uint8_t *>(data);
+	CHIP_ERROR err = CHIP_NO_ERROR;
 
 	/* Make sure that no-one will start write operation from different thread in the same time. */
 	k_mutex_lock(&sWriteMutex, K_FOREVER);
 
-	int ret = 0;
+	/* Append the logs to the pending area in the retention RAM, so they are not lost on reset. Every chunk is written
+	 * as a single record, followed by the zero size marking the end of the pending area, so the header is not
+	 * updated. The blocks buffer and the header are written, and the logs are compressed, only once per block. */
+	while (size > 0 && err == CHIP_NO_ERROR) {
+		size_t chunkSize = kBlockSize - mStagedSize > size ? size : kBlockSize - mStagedSize;
+		const size_t pendingLeft = kPendingAreaSize - mPendingSize - 2 * sizeof(RecordSize);
 
-	const size_t freeSpace = mCapacity - mCurrentSize;
-	/* There is no place for the new data. Forget the oldest data by moving the offset forward. */
-	if (freeSpace <= size) {
-		const size_t requiredShift = size - freeSpace;
-		mCurrentSize -= requiredShift;
+		chunkSize = chunkSize > pendingLeft ? pendingLeft : chunkSize;
 
-		/* Detect buffer wrapping around. */
-		mDataBegin = mDataBegin + requiredShift > mCapacity ? mDataBegin + requiredShift - mCapacity :
-								      mDataBegin + requiredShift;
+		/* The block buffer is not used until the pending block is flushed, so the record is built in it. */
+		const RecordSize recordSize = static_cast<RecordSize>(chunkSize);
+		const RecordSize endSize = 0;
 
-		/* Update data description header. */
-		ret = retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
-		ret = retention_write(mPartition, sizeof(mCurrentSize), reinterpret_cast<uint8_t *>(&mDataBegin),
-				      sizeof(mDataBegin));
-	}
+		memcpy(mBlock, &recordSize, sizeof(recordSize));
+		memcpy(mBlock + sizeof(recordSize), bytes, chunkSize);
+		memcpy(mBlock + sizeof(recordSize) + chunkSize, &endSize, sizeof(endSize));
 
-	size_t bytesToWrap = GetBytesToWrapNumber(mDataEnd + size);
+		int ret = retention_write(mPartition, kPendingOffset + mPendingSize, mBlock,
+					  chunkSize + 2 * sizeof(RecordSize));
+		VerifyOrExit(0 == ret, err = System::MapErrorZephyr(ret));
 
-	/* Detect buffer wrapping around. */
-	if (bytesToWrap) {
-		/* Save the part that fits the buffer. */
-		ret = retention_write(mPartition, GetRetentionAddress(mDataEnd),
-				      reinterpret_cast<const uint8_t *>(data), size - bytesToWrap);
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		mDataEnd = 0;
+		memcpy(mStaging + mStagedSize, bytes, chunkSize);
+		mStagedSize += chunkSize;
+		mPendingSize += sizeof(recordSize) + chunkSize;
+		bytes += chunkSize;
+		size -= chunkSize;
 
-		/* Save the part that wrapped around. */
-		ret = retention_write(mPartition, GetRetentionAddress(mDataEnd),
-				      reinterpret_cast<const uint8_t *>(data) + size - bytesToWrap, bytesToWrap);
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		mDataEnd += bytesToWrap;
-	} else {
-		ret = retention_write(mPartition, GetRetentionAddress(mDataEnd),
-				      reinterpret_cast<const uint8_t *>(data), size);
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		mDataEnd += size;
+		if (IsPendingFull()) {
+			err = FlushLocked();
+		}
 	}
 
-	mCurrentSize += size;
+exit:
+	k_mutex_unlock(&sWriteMutex);
+
+	return err;
+}
 
-	/* Update data description header. */
-	ret = retention_write(mPartition, 0, reinterpret_cast<uint8_t *>(&mCurrentSize), sizeof(mCurrentSize));
+CHIP_ERROR DiagnosticLogsRetention::Flush()
+{
+	VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+	CHIP_ERROR err = FlushLocked();
 	k_mutex_unlock(&sWriteMutex);
 
-	return CHIP_NO_ERROR;
+	return err;
 }
 
-CHIP_ERROR DiagnosticLogsRetention::GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readOffset, size_t totalSize,
-					    uint32_t dataBegin)
+CHIP_ERROR DiagnosticLogsRetention::FlushLocked()
 {
-	int ret = 0;
+	VerifyOrReturnError(mStagedSize > 0, CHIP_NO_ERROR);
+
+	BlockHeader blockHeader = { 0, static_cast<uint16_t>(mStagedSize) };
+	uint8_t *payload = mBlock + sizeof(BlockHeader);
 
-	/* Calculate how many bytes left to be read, considering previous iterations. */
-	const size_t readSize = readOffset >= dataBegin ? totalSize - readOffset + dataBegin :
-							  totalSize - (GetCapacity() - dataBegin + readOffset);
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	/* Keep the block compressed only if it gets smaller, so the stored block never exceeds the block size. */
+	blockHeader.mStoredSize =
+		static_cast<uint16_t>(mCompressor.Compress(mStaging, mStagedSize, payload, mStagedSize - 1));
+#endif
 
-	/* Check if the whole buffer will fit into single chunk or the fragmentation is required. */
-	size_t size = outBuffer.size() > readSize ? readSize : outBuffer.size();
+	if (blockHeader.mStoredSize == 0) {
+		blockHeader.mStoredSize = blockHeader.mLogsSize;
+		memcpy(payload, mStaging, mStagedSize);
+	}
 
-	size_t bytesToWrap = GetBytesToWrapNumber(readOffset + size);
+	memcpy(mBlock, &blockHeader, sizeof(blockHeader));
 
-	if (bytesToWrap) {
-		/* Read the part that fits the buffer. */
-		ret = retention_read(mPartition, GetRetentionAddress(readOffset),
-				     reinterpret_cast<uint8_t *>(outBuffer.data()), size - bytesToWrap);
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		readOffset = 0;
+	const size_t blockSize = sizeof(BlockHeader) + blockHeader.mStoredSize;
+
+	/* There is no place for the new block. Forget the oldest blocks by moving the offset forward. */
+	while (mCapacity - mHeader.mStoredSize < blockSize) {
+		BlockHeader oldest;
 
-		/* Read the part that wrapped around. */
-		ret = retention_read(mPartition, GetRetentionAddress(readOffset),
-				     reinterpret_cast<uint8_t *>(outBuffer.data()) + size - bytesToWrap, bytesToWrap);
+		int ret = ReadData(mHeader.mDataBegin, reinterpret_cast<uint8_t *>(&oldest), sizeof(oldest));
 		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		readOffset += bytesToWrap;
+
+		const size_t oldestSize = sizeof(BlockHeader) + oldest.mStoredSize;
+		VerifyOrReturnError(oldestSize <= mHeader.mStoredSize && oldest.mLogsSize <= mHeader.mLogsSize,
+				    CHIP_ERROR_INTERNAL);
+
+		mHeader.mDataBegin = Advance(mHeader.mDataBegin, oldestSize);
+		mHeader.mStoredSize -= oldestSize;
+		mHeader.mLogsSize -= oldest.mLogsSize;
+	}
+
+	int ret = WriteData(Advance(mHeader.mDataBegin, mHeader.mStoredSize), mBlock, blockSize);
+	VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
+
+	mHeader.mStoredSize += blockSize;
+	mHeader.mLogsSize += blockHeader.mLogsSize;
+	mStagedSize = 0;
+	mPendingSize = 0;
+
+	/* Update data description header, which also empties the pending block. */
+	return WriteHeader();
+}
+
+CHIP_ERROR DiagnosticLogsRetention::ReadBlock(uint32_t &readOffset, uint8_t *block, size_t &blockSize,
+					      size_t &storedSize)
+{
+	VerifyOrReturnError(block, CHIP_ERROR_INVALID_ARGUMENT);
+
+	CHIP_ERROR err = CHIP_NO_ERROR;
+	BlockHeader blockHeader;
+
+	/* The block buffer is shared with the writer, so make sure it is not used at the same time. */
+	k_mutex_lock(&sWriteMutex, K_FOREVER);
+
+	int ret = ReadData(readOffset, reinterpret_cast<uint8_t *>(&blockHeader), sizeof(blockHeader));
+	VerifyOrExit(0 == ret, err = System::MapErrorZephyr(ret));
+	VerifyOrExit(blockHeader.mStoredSize <= kBlockSize && blockHeader.mLogsSize <= kBlockSize,
+		     err = CHIP_ERROR_INTERNAL);
+
+	if (blockHeader.mStoredSize == blockHeader.mLogsSize) {
+		/* The block is not compressed, so it can be read directly into the output buffer. */
+		ret = ReadData(Advance(readOffset, sizeof(blockHeader)), block, blockHeader.mStoredSize);
+		VerifyOrExit(0 == ret, err = System::MapErrorZephyr(ret));
 	} else {
-		ret = retention_read(mPartition, GetRetentionAddress(readOffset),
-				     reinterpret_cast<uint8_t *>(outBuffer.data()), size);
-		VerifyOrReturnError(0 == ret, System::MapErrorZephyr(ret));
-		readOffset += size;
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+		ret = ReadData(Advance(readOffset, sizeof(blockHeader)), mBlock, blockHeader.mStoredSize);
+		VerifyOrExit(0 == ret, err = System::MapErrorZephyr(ret));
+		VerifyOrExit(Nrf::Matter::LogBlockCompressor::Decompress(mBlock, blockHeader.mStoredSize, block,
+									 kBlockSize) == blockHeader.mLogsSize,
+			     err = CHIP_ERROR_INTERNAL);
+#else
+		ExitNow(err = CHIP_ERROR_NOT_IMPLEMENTED);
+#endif
 	}
 
-	outBuffer.reduce_size(size);
+	blockSize = blockHeader.mLogsSize;
+	storedSize = sizeof(blockHeader) + blockHeader.mStoredSize;
+	readOffset = Advance(readOffset, storedSize);
 
-	return CHIP_NO_ERROR;
+exit:
+	k_mutex_unlock(&sWriteMutex);
+
+	return err;
 }
 
 size_t DiagnosticLogsRetentionReader::GetLogsSize()
 {
+	/* Include the logs collected since the last block was written. */
+	mDiagnosticLogsRetention.Flush();
+
 	return mDiagnosticLogsRetention.GetLogsSize();
 }
 
@@ -171,17 +303,51 @@ CHIP_ERROR DiagnosticLogsRetentionReader::GetLogs(chip::MutableByteSpan &outBuff
 {
 	CHIP_ERROR err = CHIP_NO_ERROR;
 	if (!mReadInProgress) {
-		/* Remember the data begin, the data end and the size, as these may change if writes will occur during read process. */
-		mTotalSize = mDiagnosticLogsRetention.GetLogsSize();
-		mDataBegin = mDiagnosticLogsRetention.GetLogsBegin();
-		mDataEnd = mDiagnosticLogsRetention.GetLogsEnd();
-		mReadOffset = mDataBegin;
+		/* Remember the data begin and the size, as these may change if writes will occur during read process. */
+		mDiagnosticLogsRetention.Flush();
+		mStoredSizeLeft = mDiagnosticLogsRetention.GetStoredSize();
+		mReadOffset = mDiagnosticLogsRetention.GetLogsBegin();
+		mBlockSize = 0;
+		mBlockOffset = 0;
 		mReadInProgress = true;
 	}
 
-	err = mDiagnosticLogsRetention.GetLogs(outBuffer, mReadOffset, mTotalSize, mDataBegin);
+	size_t size = 0;
+
+	/* Decompress the blocks one by one, and copy them to the output buffer using as many chunks as needed. */
+	while (size < outBuffer.size()) {
+		if (mBlockOffset == mBlockSize) {
+			if (mStoredSizeLeft == 0) {
+				break;
+			}
+
+			size_t storedSize = 0;
+
+			mBlockOffset = 0;
+			mBlockSize = 0;
+			err = mDiagnosticLogsRetention.ReadBlock(mReadOffset, mBlock, mBlockSize, storedSize);
+
+			if (err != CHIP_NO_ERROR) {
+				mStoredSizeLeft = 0;
+				break;
+			}
+
+			mStoredSizeLeft = mStoredSizeLeft > storedSize ? mStoredSizeLeft - storedSize : 0;
+			continue;
+		}
+
+		const size_t chunkSize = outBuffer.size() - size > mBlockSize - mBlockOffset ?
+						 mBlockSize - mBlockOffset :
+						 outBuffer.size() - size;
+
+		memcpy(outBuffer.data() + size, mBlock + mBlockOffset, chunkSize);
+		mBlockOffset += chunkSize;
+		size += chunkSize;
+	}
+
+	outBuffer.reduce_size(size);
 
-	if (mDataEnd == mReadOffset) {
+	if (mStoredSizeLeft == 0 && mBlockOffset == mBlockSize) {
 		mReadInProgress = false;
 		outIsEndOfLog = true;
 	} else {
@@ -8,12 +8,18 @@
 
 #include "diagnostic_logs_intent_iface.h"
 
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+#include "diagnostic_logs_compression.h"
+#endif
+
 #include <lib/core/CHIPError.h>
 #include <lib/support/Span.h>
 #include <zephyr/retention/retention.h>
 
 class DiagnosticLogsRetention {
 public:
+	static constexpr size_t kBlockSize = CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_BLOCK_SIZE;
+
 	DiagnosticLogsRetention(const struct device *partition) : mPartition(partition) {}
 
 	/**
@@ -26,7 +32,9 @@ public:
 	/**
 	 * @brief Stores given logs in the retention RAM.
 	 *
-	 * If the buffer is full, the new data overrides the oldest one.
+	 * The logs are appended to the pending block kept in the retention RAM, so they survive a reset. Once the pending
+	 * block is full, it is written to the retention RAM buffer as a single, optionally compressed, block. If the
+	 * buffer is full, the new block overrides the oldest ones.
 	 *
 	 * @param data address of logs data to be stored in the buffer
 	 * @param size size of data to be stored in the buffer
@@ -36,66 +44,116 @@ public:
 	CHIP_ERROR PushLog(const void *data, size_t size);
 
 	/**
-	 * @brief Clear the logs stored in the retention memory.
+	 * @brief Writes the logs collected in the pending block to the retention RAM buffer.
 	 *
 	 * @return CHIP_NO_ERROR on success, the other error code on failure.
 	 */
-	CHIP_ERROR Clear();
+	CHIP_ERROR Flush();
 
 	/**
-	 * @brief Get the stored logs size.
+	 * @brief Clear the logs stored in the retention memory.
 	 *
-	 * @return size of stored logs in bytes.
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
 	 */
-	size_t GetLogsSize() { return mCurrentSize; }
+	CHIP_ERROR Clear();
 
 	/**
-	 * @brief Get an offset of the logs beginning in the buffer.
+	 * @brief Get the stored logs size.
+	 *
+	 * @return size of stored logs in bytes, after decompression.
 	 */
-	uint32_t GetLogsBegin() { return mDataBegin; }
+	size_t GetLogsSize() { return mHeader.mLogsSize; }
 
 	/**
-	 * @brief Get an offset of the logs end in the buffer.
+	 * @brief Get the size of the blocks stored in the buffer.
+	 *
+	 * @return size of stored blocks in bytes, including the block headers.
 	 */
-	uint32_t GetLogsEnd() { return mDataEnd; }
+	size_t GetStoredSize() { return mHeader.mStoredSize; }
 
 	/**
-	 * @brief Get number of bytes that will wrap around the buffer after saving the given size of data.
-	 *
-	 * @param inputSize size of data to be stored in the buffer
-	 *
-	 * @return number of bytes that will be wrapped around
+	 * @brief Get an offset of the first block in the buffer.
 	 */
-	size_t GetBytesToWrapNumber(size_t inputSize) { return inputSize > mCapacity ? inputSize - mCapacity : 0; }
+	uint32_t GetLogsBegin() { return mHeader.mDataBegin; }
 
 	/**
 	 * @brief Get the logs buffer capacity.
 	 *
-	 * @return effective size of buffer to store logs (reduced by the data header size)
+	 * @return effective size of buffer to store logs (reduced by the data header and the pending area size)
 	 */
 	size_t GetCapacity() { return mCapacity; }
 
 	/**
-	 * @brief Get the address of retention memory to write or read data.
+	 * @brief Read and decompress the block of logs.
 	 *
-	 * @param logsOffset the desired logs offset in the buffer.
+	 * @param readOffset offset of the block in the buffer, moved to the following block on success
+	 * @param block output buffer of at least kBlockSize bytes to store the decompressed logs
+	 * @param blockSize reference to be filled with the size of the decompressed logs
+	 * @param storedSize reference to be filled with the size of the block in the buffer
 	 *
-	 * @return the retention memory offset, which is logs offset shifted by the data header size
+	 * @return CHIP_NO_ERROR on success, the other error code on failure.
 	 */
-	uint32_t GetRetentionAddress(uint32_t logsOffset) { return logsOffset + kHeaderSize; }
-
-	CHIP_ERROR GetLogs(chip::MutableByteSpan &outBuffer, uint32_t &readOffset, size_t totalSize,
-			   uint32_t dataBegin);
+	CHIP_ERROR ReadBlock(uint32_t &readOffset, uint8_t *block, size_t &blockSize, size_t &storedSize);
 
 private:
-	const size_t kHeaderSize = sizeof(mCurrentSize) + sizeof(mDataBegin);
+	/* Version of the retention RAM layout, stored to discard data written by a different firmware. */
+	static constexpr uint32_t kLayoutVersion = 5;
+
+	struct Header {
+		uint32_t mVersion;
+		uint32_t mStoredSize;
+		uint32_t mDataBegin;
+		uint32_t mLogsSize;
+	};
+
+	/* Every chunk of logs in the pending area is prefixed with its size, and the last one is followed by a zero size.
+	 * This way the pending logs are restored after a reset without tracking their size in the header. */
+	using RecordSize = uint16_t;
+
+	/* The pending area fits the pending block and the sizes of kMaxPendingRecords chunks. Logs pushed in shorter
+	 * chunks are written to the buffer before the pending block is full. */
+	static constexpr size_t kMaxPendingRecords = kBlockSize / 16;
+	static constexpr size_t kPendingAreaSize = kBlockSize + (kMaxPendingRecords + 1) * sizeof(RecordSize);
+
+	/* The header is followed by the pending area and the buffer of the written blocks. */
+	static constexpr size_t kPendingOffset = sizeof(Header);
+	static constexpr size_t kDataOffset = kPendingOffset + kPendingAreaSize;
+
+	struct BlockHeader {
+		uint16_t mStoredSize;
+		uint16_t mLogsSize;
+	};
+
+	static_assert(kBlockSize <= UINT16_MAX, "The block size must fit the block header");
+	static_assert(sizeof(BlockHeader) >= 2 * sizeof(RecordSize), "The block buffer must fit a pending record");
+
+	CHIP_ERROR RestorePending();
+	bool IsPendingFull() const
+	{
+		return mStagedSize == kBlockSize || kPendingAreaSize - mPendingSize <= 2 * sizeof(RecordSize);
+	}
+	CHIP_ERROR FlushLocked();
+	CHIP_ERROR WriteHeader();
+	int WriteData(uint32_t offset, const uint8_t *data, size_t size);
+	int ReadData(uint32_t offset, uint8_t *data, size_t size);
+	uint32_t Advance(uint32_t offset, size_t size)
+	{
+		return offset + size >= mCapacity ? offset + size - mCapacity : offset + size;
+	}
 
 	bool mIsInitialized = false;
-	bool mWriteInProgress = false;
-	size_t mCurrentSize = 0;
-	uint32_t mDataBegin = 0;
-	uint32_t mDataEnd = 0;
+	Header mHeader = {};
 	size_t mCapacity = 0;
+	size_t mStagedSize = 0;
+	/* Size of the pending area used by the records of the pending block. */
+	size_t mPendingSize = 0;
+	/* Copy of the pending block kept in the retention RAM. */
+	uint8_t mStaging[kBlockSize];
+	/* Block being written or read, including its header. */
+	uint8_t mBlock[sizeof(BlockHeader) + kBlockSize];
+#ifdef CONFIG_NCS_SAMPLE_MATTER_DIAGNOSTIC_LOGS_COMPRESSION
+	Nrf::Matter::LogBlockCompressor mCompressor;
+#endif
 
 	const struct device *mPartition;
 };
@@ -132,8 +190,10 @@ public:
 private:
 	uint32_t mReadOffset = 0;
 	bool mReadInProgress = false;
-	size_t mTotalSize = 0;
-	uint32_t mDataBegin = 0;
-	uint32_t mDataEnd = 0;
+	/* Size of the blocks left to be read, remembered when the read started. */
+	size_t mStoredSizeLeft = 0;
+	uint8_t mBlock[DiagnosticLogsRetention::kBlockSize];
+	size_t mBlockSize = 0;
+	size_t mBlockOffset = 0;
 	DiagnosticLogsRetention &mDiagnosticLogsRetention;
 };
@@ -6,6 +6,20 @@
 
 #include "persistent_storage_secure.h"
 
+#include <errno.h>
+
+namespace
+{
+ssize_t ReadProtectedStorageValue(void *readContext, void *data, size_t dataMaxSize)
+{
+	size_t outSize{ 0 };
+	psa_status_t status =
+		psa_ps_get(*static_cast<psa_storage_uid_t *>(readContext), 0, dataMaxSize, data, &outSize);
+
+	return (status == PSA_SUCCESS ? static_cast<ssize_t>(outSize) : -EIO);
+}
+} /* namespace */
+
 namespace Nrf
 {
 
@@ -27,9 +41,9 @@ PSErrorCode PersistentStorageSecure::_SecureStore(PersistentStorageNode *node, c
 		return PSErrorCode::Failure;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (node->GetKey(key)) {
+	if (key) {
 		psa_storage_uid_t uid = UIDFromString(key);
 		psa_status_t status = psa_ps_set(uid, dataSize, data, PSA_STORAGE_FLAG_NONE);
 
@@ -62,6 +76,47 @@ PSErrorCode PersistentStorageSecure::_SecureLoad(PersistentStorageNode *node, vo
 	return PSErrorCode::Failure;
 }
 
+PSErrorCode PersistentStorageSecure::_SecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor,
+							void *context)
+{
+	const char *key = rootNode ? rootNode->GetKey() : nullptr;
+
+	if (!key || !visitor) {
+		return PSErrorCode::Failure;
+	}
+
+	const size_t keyLength = rootNode->GetKeyLength();
+
+	/* All keys are kept in the UID map, so the subtree can be found without querying the storage for every key.
+	 * Removing a key leaves a free slot in the middle of the map, so the whole map must be visited. */
+	for (auto it = std::begin(sUidMap.mMap); it != std::end(sUidMap.mMap); ++it) {
+		if (it->key == UidMap::kInvalidKey) {
+			continue;
+		}
+
+		const char *name = it->value.mStr;
+
+		if (strncmp(name, key, keyLength) != 0 || (name[keyLength] != '\0' && name[keyLength] != '/')) {
+			continue;
+		}
+
+		psa_storage_uid_t uid = static_cast<psa_storage_uid_t>(it->key);
+		psa_storage_info_t info;
+
+		if (psa_ps_get_info(uid, &info) != PSA_SUCCESS) {
+			return PSErrorCode::Failure;
+		}
+
+		const char *relativeName = name[keyLength] == '/' ? name + keyLength + 1 : name + keyLength;
+
+		if (!visitor(relativeName, info.size, ReadProtectedStorageValue, &uid, context)) {
+			break;
+		}
+	}
+
+	return PSErrorCode::Success;
+}
+
 PSErrorCode PersistentStorageSecure::_SecureHasEntry(PersistentStorageNode *node)
 {
 	psa_storage_uid_t uid;
@@ -70,9 +125,9 @@ PSErrorCode PersistentStorageSecure::_SecureHasEntry(PersistentStorageNode *node
 
 PSErrorCode PersistentStorageSecure::_SecureRemove(PersistentStorageNode *node)
 {
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (node->GetKey(key)) {
+	if (key) {
 		bool alreadyInTheMap{ false };
 		psa_storage_uid_t uid = UIDFromString(key, &alreadyInTheMap);
 		if (alreadyInTheMap) {
@@ -112,7 +167,7 @@ PSErrorCode PersistentStorageSecure::_SecureFactoryReset()
 	return error;
 }
 
-psa_storage_uid_t PersistentStorageSecure::UIDFromString(char *str, bool *alreadyInTheMap)
+psa_storage_uid_t PersistentStorageSecure::UIDFromString(const char *str, bool *alreadyInTheMap)
 {
 	for (auto &it : sUidMap.mMap) {
 		if (it.value == str) {
@@ -212,10 +267,10 @@ PSErrorCode PersistentStorageSecure::DeserializeUIDMap(const Byte *buff, size_t
 
 bool PersistentStorageSecure::HasEntry(PersistentStorageNode *node, psa_storage_uid_t &uid)
 {
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 	bool alreadyInTheMap{ false };
 
-	if (node->GetKey(key)) {
+	if (key) {
 		uid = UIDFromString(key, &alreadyInTheMap);
 	}
 
@@ -18,6 +18,7 @@ protected:
 	PSErrorCode _NonSecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
 	PSErrorCode _NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
+	PSErrorCode _NonSecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
 	PSErrorCode _NonSecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _NonSecureRemove(PersistentStorageNode *node);
 	PSErrorCode _NonSecureFactoryReset();
@@ -25,6 +26,7 @@ protected:
 	PSErrorCode _SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
 	PSErrorCode _SecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
+	PSErrorCode _SecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
 	PSErrorCode _SecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _SecureRemove(PersistentStorageNode *node);
 	PSErrorCode _SecureFactoryReset();
@@ -38,7 +40,7 @@ private:
 	struct StringWrapper {
 		static constexpr auto kSize = PersistentStorageNode::kMaxKeyNameLength;
 		StringWrapper() {}
-		StringWrapper(char *str) { strcpy(mStr, str); }
+		StringWrapper(const char *str) { strcpy(mStr, str); }
 
 		~StringWrapper() {}
 
@@ -82,7 +84,7 @@ private:
 	static PSErrorCode StoreUIDMap();
 	static PSErrorCode LoadUIDMap();
 	static bool HasEntry(PersistentStorageNode *node, psa_storage_uid_t &uid);
-	static psa_storage_uid_t UIDFromString(char *str, bool *alreadyInTheMap = nullptr);
+	static psa_storage_uid_t UIDFromString(const char *str, bool *alreadyInTheMap = nullptr);
 
 	static constexpr size_t kMaxMapSerializationBufferSize =
 		(PersistentStorageNode::kMaxKeyNameLength + sizeof(SerializedUIDType)) * kMaxEntriesNumber +
@@ -109,6 +111,12 @@ inline PSErrorCode PersistentStorageSecure::_NonSecureLoad(PersistentStorageNode
 	return PSErrorCode::NotSupported;
 }
 
+inline PSErrorCode PersistentStorageSecure::_NonSecureLoadSubtree(PersistentStorageNode *rootNode,
+								 PSSubtreeVisitor visitor, void *context)
+{
+	return PSErrorCode::NotSupported;
+}
+
 inline PSErrorCode PersistentStorageSecure::_NonSecureHasEntry(PersistentStorageNode *node)
 {
 	return PSErrorCode::NotSupported;
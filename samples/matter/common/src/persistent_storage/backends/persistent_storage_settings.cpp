@@ -20,6 +20,16 @@ struct ReadEntry {
 	bool result;
 };
 
+struct LoadSubtreeEntry {
+	Nrf::PSSubtreeVisitor visitor;
+	void *context;
+};
+
+struct SettingsReadContext {
+	settings_read_cb readCb;
+	void *cbArg;
+};
+
 struct DeleteSubtreeEntry {
 	const char *prefix;
 	int result;
@@ -67,6 +77,35 @@ int LoadEntryCallback(const char *name, size_t entrySize, settings_read_cb readC
 	return 1;
 }
 
+ssize_t ReadSettingsValue(void *readContext, void *data, size_t dataMaxSize)
+{
+	SettingsReadContext &settingsContext = *static_cast<SettingsReadContext *>(readContext);
+
+	return settingsContext.readCb(settingsContext.cbArg, data, dataMaxSize);
+}
+
+int LoadSubtreeCallback(const char *name, size_t entrySize, settings_read_cb readCb, void *cbArg, void *param)
+{
+	LoadSubtreeEntry &entry = *static_cast<LoadSubtreeEntry *>(param);
+
+	/* Deleted keys are reported with no value, skip them. */
+	if (entrySize == 0) {
+		return 0;
+	}
+
+	uint8_t emptyValue[kEmptyValueSize];
+
+	if (entrySize == kEmptyValueSize && readCb(cbArg, emptyValue, kEmptyValueSize) == kEmptyValueSize &&
+	    memcmp(emptyValue, kEmptyValue, kEmptyValueSize) == 0) {
+		return 0;
+	}
+
+	SettingsReadContext readContext{ readCb, cbArg };
+
+	/* Returning a non-zero value stops loading the remaining entries. */
+	return entry.visitor(name ? name : "", entrySize, ReadSettingsValue, &readContext, entry.context) ? 0 : 1;
+}
+
 int DeleteSubtreeCallback(const char *name, size_t entrySize, settings_read_cb readCb, void *cbArg, void *param)
 {
 	DeleteSubtreeEntry &entry = *static_cast<DeleteSubtreeEntry *>(param);
@@ -105,9 +144,9 @@ PSErrorCode PersistentStorageSettings::_NonSecureStore(PersistentStorageNode *no
 		return PSErrorCode::Failure;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return PSErrorCode::Failure;
 	}
 
@@ -121,9 +160,9 @@ PSErrorCode PersistentStorageSettings::_NonSecureLoad(PersistentStorageNode *nod
 		return PSErrorCode::Failure;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return PSErrorCode::Failure;
 	}
 
@@ -138,15 +177,34 @@ PSErrorCode PersistentStorageSettings::_NonSecureLoad(PersistentStorageNode *nod
 	return (result ? PSErrorCode::Success : PSErrorCode::Failure);
 }
 
+PSErrorCode PersistentStorageSettings::_NonSecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor,
+							     void *context)
+{
+	if (!rootNode || !visitor) {
+		return PSErrorCode::Failure;
+	}
+
+	const char *key = rootNode->GetKey();
+
+	if (!key) {
+		return PSErrorCode::Failure;
+	}
+
+	LoadSubtreeEntry entry{ visitor, context };
+
+	return (settings_load_subtree_direct(key, LoadSubtreeCallback, &entry) ? PSErrorCode::Failure
+										: PSErrorCode::Success);
+}
+
 PSErrorCode PersistentStorageSettings::_NonSecureHasEntry(PersistentStorageNode *node)
 {
 	if (!node) {
 		return PSErrorCode::Failure;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return PSErrorCode::Failure;
 	}
 
@@ -159,9 +217,9 @@ PSErrorCode PersistentStorageSettings::_NonSecureRemove(PersistentStorageNode *n
 		return PSErrorCode::Failure;
 	}
 
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = node->GetKey();
 
-	if (!node->GetKey(key)) {
+	if (!key) {
 		return PSErrorCode::Failure;
 	}
 
@@ -192,9 +250,9 @@ bool PersistentStorageSettings::LoadEntry(const char *key, void *data, size_t da
 
 PSErrorCode PersistentStorageSettings::_NonSecureFactoryReset()
 {
-	char key[PersistentStorageNode::kMaxKeyNameLength];
+	const char *key = mRootNode->GetKey();
 
-	if (!mRootNode->GetKey(key)) {
+	if (!key) {
 		return PSErrorCode::Failure;
 	}
 
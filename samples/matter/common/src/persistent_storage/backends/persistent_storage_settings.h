@@ -15,6 +15,7 @@ protected:
 	PSErrorCode _NonSecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _NonSecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
 	PSErrorCode _NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
+	PSErrorCode _NonSecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
 	PSErrorCode _NonSecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _NonSecureRemove(PersistentStorageNode *node);
 	PSErrorCode _NonSecureFactoryReset();
@@ -22,6 +23,7 @@ protected:
 	PSErrorCode _SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode _SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
 	PSErrorCode _SecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
+	PSErrorCode _SecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
 	PSErrorCode _SecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode _SecureRemove(PersistentStorageNode *node);
 	PSErrorCode _SecureFactoryReset();
@@ -49,6 +51,12 @@ inline PSErrorCode PersistentStorageSettings::_SecureLoad(PersistentStorageNode
 	return PSErrorCode::NotSupported;
 }
 
+inline PSErrorCode PersistentStorageSettings::_SecureLoadSubtree(PersistentStorageNode *rootNode,
+								 PSSubtreeVisitor visitor, void *context)
+{
+	return PSErrorCode::NotSupported;
+}
+
 inline PSErrorCode PersistentStorageSettings::_SecureHasEntry(PersistentStorageNode *node)
 {
 	return PSErrorCode::NotSupported;
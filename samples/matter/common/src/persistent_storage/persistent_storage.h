@@ -56,6 +56,21 @@ public:
 	 */
 	PSErrorCode NonSecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
 
+	/**
+	 * @brief Load all entries of the subtree from the persistent storage in a single pass.
+	 *
+	 * The visitor is called for the subtree root and every its descendant that holds a value. The order in which
+	 * the entries are visited is not specified. Use this method instead of calling NonSecureLoad() for each key
+	 * when many keys under the same root are needed, as every NonSecureLoad() call scans the storage again.
+	 *
+	 * @param rootNode address of the tree node containing information about the subtree root key.
+	 * @param visitor function called for every entry found in the subtree.
+	 * @param context context passed to the visitor.
+	 * @return true if the subtree has been loaded successfully, also if it contains no entries.
+	 * @return false an error occurred.
+	 */
+	PSErrorCode NonSecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
+
 	/**
 	 * @brief Check if given key entry exists in the persistent storage.
 	 *
@@ -89,6 +104,7 @@ public:
 	PSErrorCode SecureInit(PersistentStorageNode *rootNode);
 	PSErrorCode SecureStore(PersistentStorageNode *node, const void *data, size_t dataSize);
 	PSErrorCode SecureLoad(PersistentStorageNode *node, void *data, size_t dataMaxSize, size_t &outSize);
+	PSErrorCode SecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor, void *context);
 	PSErrorCode SecureHasEntry(PersistentStorageNode *node);
 	PSErrorCode SecureRemove(PersistentStorageNode *node);
 	PSErrorCode SecureFactoryReset();
@@ -137,6 +153,12 @@ inline PSErrorCode PersistentStorage::NonSecureLoad(PersistentStorageNode *node,
 	return Impl()->_NonSecureLoad(node, data, dataMaxSize, outSize);
 }
 
+inline PSErrorCode PersistentStorage::NonSecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor,
+							   void *context)
+{
+	return Impl()->_NonSecureLoadSubtree(rootNode, visitor, context);
+}
+
 inline PSErrorCode PersistentStorage::NonSecureHasEntry(PersistentStorageNode *node)
 {
 	return Impl()->_NonSecureHasEntry(node);
@@ -169,6 +191,12 @@ inline PSErrorCode PersistentStorage::SecureLoad(PersistentStorageNode *node, vo
 	return Impl()->_SecureLoad(node, data, dataMaxSize, outSize);
 }
 
+inline PSErrorCode PersistentStorage::SecureLoadSubtree(PersistentStorageNode *rootNode, PSSubtreeVisitor visitor,
+							void *context)
+{
+	return Impl()->_SecureLoadSubtree(rootNode, visitor, context);
+}
+
 inline PSErrorCode PersistentStorage::SecureHasEntry(PersistentStorageNode *node)
 {
 	return Impl()->_SecureHasEntry(node);
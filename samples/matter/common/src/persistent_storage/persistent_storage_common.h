@@ -8,28 +8,132 @@
 
 #include <zephyr/sys/cbprintf.h>
 
+#include <sys/types.h>
+
+#include <cstring>
+#include <initializer_list>
+
 namespace Nrf
 {
 enum class PSErrorCode : uint8_t { Failure, Success, NotSupported };
 
+/**
+ * @brief Function reading the value of the entry that is currently visited by PSSubtreeVisitor.
+ *
+ * @param readContext opaque backend context passed to the visitor.
+ * @param data buffer to read the value into.
+ * @param dataMaxSize size of the data buffer.
+ * @return number of bytes read, or a negative value if an error occurred.
+ */
+using PSReadFunction = ssize_t (*)(void *readContext, void *data, size_t dataMaxSize);
+
+/**
+ * @brief Visitor called for every entry found in the subtree loaded using the *LoadSubtree() methods.
+ *
+ * @param name key name of the entry relative to the subtree root, or an empty string for the root itself.
+ * @param dataSize size of the entry value.
+ * @param read function to read the entry value, valid only during the visitor call.
+ * @param readContext opaque backend context that must be passed to the read function.
+ * @param context context passed by the caller of the *LoadSubtree() method.
+ * @return true to continue visiting the remaining entries.
+ * @return false to stop the iteration.
+ */
+using PSSubtreeVisitor = bool (*)(const char *name, size_t dataSize, PSReadFunction read, void *readContext,
+				  void *context);
+
 /**
  * @brief Class representing single tree node and containing information about its key.
+ *
+ * The complete key of the node, including the names of all its parents, is built on the first GetKey() call and cached
+ * in the node, so the following storage operations cost no string formatting. The key is built without recursion,
+ * using an array bounded by kMaxDepth to walk up the parent chain, so the stack usage does not depend on the depth.
+ * Static nodes can use the key built at compile time by BuildKey() instead.
  */
 class PersistentStorageNode {
 public:
 	static constexpr uint8_t kMaxKeyNameLength{ CONFIG_NCS_SAMPLE_MATTER_STORAGE_MAX_KEY_LEN };
 
+	/* Every tree level takes at least two characters of the key: the name and the separator or the terminator. */
+	static constexpr uint8_t kMaxDepth{ kMaxKeyNameLength / 2 };
+
+	/**
+	 * @brief Complete key of a static node, built at compile time using BuildKey().
+	 */
+	struct Key {
+		char mValue[kMaxKeyNameLength] = { 0 };
+		uint8_t mLength = 0;
+
+		constexpr bool IsValid() const { return mLength > 0; }
+	};
+
+	/**
+	 * @brief Build the complete key from the names of the consecutive tree levels at compile time, for example:
+	 * constexpr auto kVersionKey = PersistentStorageNode::BuildKey({ "br", "ver" });
+	 *
+	 * @return the key that is not valid if any of the names is empty or the key does not fit in kMaxKeyNameLength.
+	 */
+	static constexpr Key BuildKey(std::initializer_list<const char *> names)
+	{
+		Key key{};
+		size_t length = 0;
+
+		for (const char *name : names) {
+			if (!name || name[0] == '\0') {
+				return Key{};
+			}
+
+			if (length > 0) {
+				if (length + 1 >= kMaxKeyNameLength) {
+					return Key{};
+				}
+				key.mValue[length++] = '/';
+			}
+
+			for (; *name != '\0'; ++name) {
+				if (length + 1 >= kMaxKeyNameLength) {
+					return Key{};
+				}
+				key.mValue[length++] = *name;
+			}
+		}
+
+		key.mLength = static_cast<uint8_t>(length);
+		return key;
+	}
+
 	/**
 	 * @brief Constructor assigns name of a key for this node and sets parent node address in the tree
 	 * hierarchy. The node does not need to have a parent (parent = nullptr), if it is a top level element.
 	 */
 	PersistentStorageNode(const char *keyName, size_t keyNameLength, PersistentStorageNode *parent = nullptr)
+		: mParent(parent)
 	{
-		if (keyName && keyNameLength < kMaxKeyNameLength) {
-			memcpy(mKeyName, keyName, keyNameLength);
-			mKeyName[keyNameLength] = '\0';
+		if (!keyName || keyNameLength >= kMaxKeyNameLength) {
+			return;
+		}
+
+		memcpy(mKey, keyName, keyNameLength);
+		mKey[keyNameLength] = '\0';
+		mLength = static_cast<uint8_t>(strlen(mKey));
+
+		if (mLength == 0) {
+			return;
+		}
+
+		/* The parent may not be constructed yet, so its key is not accessed before the first GetKey() call. */
+		mState = mParent ? State::Unresolved : State::Resolved;
+	}
+
+	/**
+	 * @brief Constructor of a top level node using the complete key built at compile time by BuildKey().
+	 */
+	explicit PersistentStorageNode(const Key &key)
+	{
+		if (key.IsValid()) {
+			memcpy(mKey, key.mValue, key.mLength + 1);
+			mLength = key.mLength;
+			mState = State::Resolved;
 		}
-		mParent = parent;
 	}
 
 	/**
@@ -37,42 +141,86 @@ public:
 	 * name is a key name specific for this node concatenated with the names of all parents up to the top of the
 	 * tree.
 	 *
+	 * @return the null-terminated key owned by the node, or nullptr if the key cannot be created.
+	 */
+	const char *GetKey()
+	{
+		if (mState == State::Unresolved) {
+			Resolve();
+		}
+
+		return mState == State::Resolved ? mKey : nullptr;
+	}
+
+	/**
+	 * @brief Copies complete key name for this node into the buffer of at least kMaxKeyNameLength bytes.
+	 *
 	 * @return true if the key has been created successfully
 	 * @return false otherwise
 	 */
 	bool GetKey(char *key)
 	{
-		if (!key || mKeyName[0] == '\0') {
+		const char *fullKey = GetKey();
+
+		if (!key || !fullKey) {
 			return false;
 		}
 
-		/* Recursively call GetKey method for the parents until the full key name including all hierarchy levels
-		 * will be created. */
-		if (mParent != nullptr) {
-			char parentKey[kMaxKeyNameLength];
+		memcpy(key, fullKey, mLength + 1);
+		return true;
+	}
 
-			if (!mParent->GetKey(parentKey)) {
-				return false;
-			}
+	/**
+	 * @brief Gets the length of the complete key name, not counting the terminating null.
+	 *
+	 * @return the key length, or 0 if the key cannot be created.
+	 */
+	uint8_t GetKeyLength() { return GetKey() ? mLength : 0; }
+
+private:
+	enum class State : uint8_t { Invalid, Unresolved, Resolved };
 
-			int result = snprintf(key, kMaxKeyNameLength, "%s/%s", parentKey, mKeyName);
+	void Resolve()
+	{
+		PersistentStorageNode *chain[kMaxDepth];
+		uint8_t depth = 0;
 
-			/* snprintf() returns the number of characters written not counting the terminating null. */
-			if (result < 0 || result + 1 > kMaxKeyNameLength) {
-				return false;
+		/* Collect the nodes whose keys are not built yet, up to the first ancestor with a known key. */
+		for (PersistentStorageNode *node = this; node && node->mState == State::Unresolved;
+		     node = node->mParent) {
+			if (depth == kMaxDepth) {
+				mState = State::Invalid;
+				return;
 			}
+			chain[depth++] = node;
+		}
 
-		} else {
-			/* In case of not having a parent, return only own key name. */
-			strncpy(key, mKeyName, kMaxKeyNameLength);
+		/* Build the keys top-down, so every node only needs the cached key of its direct parent. */
+		while (depth > 0) {
+			chain[--depth]->ResolveWithParent();
 		}
+	}
 
-		return true;
+	void ResolveWithParent()
+	{
+		if (mParent->mState != State::Resolved || mParent->mLength + 1 + mLength + 1 > kMaxKeyNameLength) {
+			mState = State::Invalid;
+			return;
+		}
+
+		/* The node name is kept at the beginning of the buffer until the key is built, move it after the parent
+		 * key and the separator. */
+		memmove(mKey + mParent->mLength + 1, mKey, mLength + 1);
+		memcpy(mKey, mParent->mKey, mParent->mLength);
+		mKey[mParent->mLength] = '/';
+		mLength += mParent->mLength + 1;
+		mState = State::Resolved;
 	}
 
-private:
 	PersistentStorageNode *mParent = nullptr;
-	char mKeyName[kMaxKeyNameLength] = { 0 };
+	char mKey[kMaxKeyNameLength] = { 0 };
+	uint8_t mLength = 0;
+	State mState = State::Invalid;
 };
 
 } /* namespace Nrf */
@@ -34,6 +34,7 @@ class PersistentStorageImpl : public PersistentStorage
 	using PersistentStorageSettings::_NonSecureHasEntry;
 	using PersistentStorageSettings::_NonSecureInit;
 	using PersistentStorageSettings::_NonSecureLoad;
+	using PersistentStorageSettings::_NonSecureLoadSubtree;
 	using PersistentStorageSettings::_NonSecureRemove;
 	using PersistentStorageSettings::_NonSecureFactoryReset;
 	using PersistentStorageSettings::_NonSecureStore;
@@ -44,6 +45,7 @@ class PersistentStorageImpl : public PersistentStorage
 	using PersistentStorageSecure::_SecureHasEntry;
 	using PersistentStorageSecure::_SecureInit;
 	using PersistentStorageSecure::_SecureLoad;
+	using PersistentStorageSecure::_SecureLoadSubtree;
 	using PersistentStorageSecure::_SecureRemove;
 	using PersistentStorageSecure::_SecureStore;
 #endif
@@ -7,6 +7,7 @@
 #include "access_manager.h"
 #include "access_storage.h"
 
+#include <crypto/CHIPCryptoPAL.h>
 #include <platform/CHIPDeviceLayer.h>
 
 #include <zephyr/logging/log.h>
@@ -74,15 +75,9 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Fact
 
 #ifdef CONFIG_LOCK_SCHEDULES
 	/* Remove schedules */
-	for (uint16_t userIndex = 1; userIndex <= CONFIG_LOCK_MAX_NUM_USERS; userIndex++) {
-		RemoveCollection(mWeekDayScheduleIndexes.Get(userIndex), AccessStorage::Type::WeekDaySchedule,
-				 AccessStorage::Type::WeekDayScheduleIndexes, userIndex);
-		RemoveCollection(mYearDayScheduleIndexes.Get(userIndex), AccessStorage::Type::YearDaySchedule,
-				 AccessStorage::Type::YearDayScheduleIndexes, userIndex);
+	if (!AccessStorage::Instance().Remove(AccessStorage::Type::Schedules)) {
+		LOG_DBG("No stored schedules to remove");
 	}
-
-	RemoveCollection(mHolidayScheduleIndexes, AccessStorage::Type::HolidaySchedule,
-			 AccessStorage::Type::HolidayScheduleIndexes);
 #endif
 
 	/* Remove other data */
@@ -115,41 +110,36 @@ bool AccessManager<CRED_BIT_MASK>::ValidatePIN(const Optional<ByteSpan> &pinCode
 		return true;
 	}
 
-	EmberAfPluginDoorLockCredentialInfo credential;
-
 	/* Check the PIN code */
-	for (size_t index = 1; index <= CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_TYPE; ++index) {
-		if (CHIP_NO_ERROR != mCredentials.GetCredentials(CredentialTypeEnum::kPin, credential, index)) {
-			err = OperationErrorEnum::kInvalidCredential;
-			continue;
-		}
+	const uint16_t index = FindCredential(CredentialTypeEnum::kPin, pinCode.Value());
 
-		if (credential.status == DlCredentialStatus::kAvailable) {
-			continue;
-		}
-
-		if (!credential.credentialData.data_equal(pinCode.Value())) {
-			err = OperationErrorEnum::kInvalidCredential;
-			continue;
-		}
+	if (index == 0) {
+		LOG_DBG("Invalid lock PIN code provided");
+		err = OperationErrorEnum::kInvalidCredential;
+		return false;
+	}
 
-		uint32_t credentialUserId;
-		if (GetCredentialUserId(index, CredentialTypeEnum::kPin, credentialUserId) == CHIP_NO_ERROR) {
-			result = ValidatePINResult{
-				.mUserId = static_cast<uint16_t>(credentialUserId),
-				.mCredential =
-					LockOpCredentials{ CredentialTypeEnum::kPin, static_cast<uint16_t>(index) },
-			};
-		} else {
-			result = {};
-		}
+#ifdef CONFIG_LOCK_SCHEDULES
+	if (!IsCredentialUserAllowed(index, CredentialTypeEnum::kPin)) {
+		LOG_DBG("Lock PIN code provided outside of the user schedules");
+		err = OperationErrorEnum::kRestricted;
+		return false;
+	}
+#endif
 
-		LOG_DBG("Valid lock PIN code provided");
-		err = OperationErrorEnum::kUnspecified;
-		return true;
+	uint32_t credentialUserId;
+	if (GetCredentialUserId(index, CredentialTypeEnum::kPin, credentialUserId) == CHIP_NO_ERROR) {
+		result = ValidatePINResult{
+			.mUserId = static_cast<uint16_t>(credentialUserId),
+			.mCredential = LockOpCredentials{ CredentialTypeEnum::kPin, index },
+		};
+	} else {
+		result = {};
 	}
-	LOG_DBG("Invalid lock PIN code provided");
-	return false;
+
+	LOG_DBG("Valid lock PIN code provided");
+	err = OperationErrorEnum::kUnspecified;
+	return true;
 }
 
 template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::InitializeUsers()
@@ -167,6 +157,7 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Init
 		/* max better than 0 which is the special home user unique ID*/
 		user.mInfo.mFields.mUserUniqueId = std::numeric_limits<uint32_t>::max();
 	}
+	mCredentialOwners = {};
 }
 
 #ifdef CONFIG_LOCK_SCHEDULES
@@ -177,23 +168,47 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Init
 		     ++weekDayIndex) {
 			auto &schedule = mWeekDaySchedule[userIndex][weekDayIndex];
 			memset(schedule.mData.mRaw, 0, sizeof(schedule.mData));
+			schedule.mAvailable = true;
 		}
 		for (size_t yearDayIndex = 0; yearDayIndex < CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER;
 		     ++yearDayIndex) {
 			auto &schedule = mYearDaySchedule[userIndex][yearDayIndex];
 			memset(schedule.mData.mRaw, 0, sizeof(schedule.mData));
+			schedule.mAvailable = true;
 		}
 	}
 	for (size_t holidayIndex = 0; holidayIndex < CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES; ++holidayIndex) {
 		auto &schedule = mHolidaySchedule[holidayIndex];
 		memset(schedule.mData.mRaw, 0, sizeof(schedule.mData));
+		schedule.mAvailable = true;
+	}
+	for (auto &scheduleIndex : mScheduleIndex) {
+		scheduleIndex.mWeekDay.Clear();
+		scheduleIndex.mYearDay.Clear();
 	}
 }
 #endif /* CONFIG_LOCK_SCHEDULES */
 
+template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::InitializeCredentialLookups()
+{
+	uint8_t key[CredentialLookups::Lookup::kKeySize] = { 0 };
+
+	/* The random key makes the position of the credential in the lookup independent of its secret. */
+	if (CHIP_NO_ERROR != Crypto::DRBG_get_bytes(key, sizeof(key))) {
+		LOG_ERR("Cannot generate the credential lookup key");
+	}
+
+	for (auto &lookup : mCredentialLookups.mLookups) {
+		lookup.Clear(key);
+	}
+
+	Crypto::ClearSecretData(key, sizeof(key));
+}
+
 template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::InitializeAllCredentials()
 {
 	mCredentials.Initialize();
+	InitializeCredentialLookups();
 	InitializeUsers();
 #ifdef CONFIG_LOCK_SCHEDULES
 	InitializeSchedules();
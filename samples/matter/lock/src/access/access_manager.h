@@ -10,6 +10,10 @@
 #include <lib/core/ClusterEnums.h>
 
 #include "access_data_types.h"
+#include "credential_lookup.h"
+#ifdef CONFIG_LOCK_SCHEDULES
+#include "schedule_index.h"
+#endif /* CONFIG_LOCK_SCHEDULES */
 
 template <DoorLockData::CredentialsBits CRED_BIT_MASK> class AccessManager {
 public:
@@ -232,6 +236,21 @@ public:
 	DlStatus SetHolidaySchedule(uint8_t holidayIndex, DlScheduleStatus status, uint32_t localStartTime,
 				    uint32_t localEndTime, OperatingModeEnum operatingMode);
 
+	/**
+	 * @brief Check if the schedules of the user allow the access at the given time.
+	 *
+	 * Only the schedules that match the user type apply: the Week Day schedules to a Week Day Schedule User, the
+	 * Year Day schedules to a Year Day Schedule User, and both of them to a Schedule Restricted User. Users of
+	 * other types are not restricted by schedules. The check uses the per-user schedule index that is updated
+	 * whenever the schedules of the user change, so it does not depend on the number of users and schedules.
+	 *
+	 * @param userIndex Index of the user starting from 1.
+	 * @param localTime Local time in Epoch Time in Seconds with local time offset, like in the Year Day schedules.
+	 * @return true if the user is not restricted by schedules or a matching schedule covers the given time,
+	 * false otherwise.
+	 */
+	bool IsUserAllowed(uint16_t userIndex, uint32_t localTime);
+
 #endif /* CONFIG_LOCK_SCHEDULES */
 
 	/**
@@ -249,7 +268,8 @@ public:
 	/**
 	 * @brief Initialize credential database.
 	 *
-	 * Sets all users and credential slots to default values, including empty secret data.
+	 * Sets all users and credential slots to default values, including empty secret data,
+	 * and clears the credential lookups using a new random hash key.
 	 *
 	 */
 	void InitializeAllCredentials();
@@ -296,24 +316,42 @@ private:
 		CredentialList &Get(DoorLockData::CredentialTypeIndex type) { return mCredentialsIndexes[type - 1]; }
 	};
 
-	using UsersIndexes = DoorLockData::IndexList<CONFIG_LOCK_MAX_NUM_USERS>;
-
-#ifdef CONFIG_LOCK_SCHEDULES
-	struct WeekDayScheduleIndexes {
-		using ScheduleList = DoorLockData::IndexList<CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER>;
-		ScheduleList mScheduleIndexes[CONFIG_LOCK_MAX_NUM_USERS];
+	struct CredentialLookups {
+		using Lookup = DoorLockData::CredentialLookup<CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_TYPE>;
+		Lookup mLookups[DoorLockData::CredentialTypeIndex::Max];
 
-		ScheduleList &Get(uint16_t userIndex) { return mScheduleIndexes[userIndex - 1]; }
+		Lookup &Get(DoorLockData::CredentialTypeIndex type) { return mLookups[type - 1]; }
 	};
 
-	struct YearDayScheduleIndexes {
-		using ScheduleList = DoorLockData::IndexList<CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER>;
-		ScheduleList mScheduleIndexes[CONFIG_LOCK_MAX_NUM_USERS];
+	/* Index of the user that owns the credential, or 0 if the credential is not assigned to any user. */
+	struct CredentialOwners {
+		uint16_t mOwners[DoorLockData::CredentialTypeIndex::Max][CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_TYPE];
+
+		uint16_t *Get(CredentialTypeEnum type, uint16_t credentialIndex)
+		{
+			const uint8_t typeIndex = static_cast<uint8_t>(type);
+
+			if (typeIndex < DoorLockData::CredentialTypeIndex::Pin ||
+			    typeIndex > DoorLockData::CredentialTypeIndex::Max || credentialIndex == 0 ||
+			    credentialIndex > CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_TYPE) {
+				return nullptr;
+			}
 
-		ScheduleList &Get(uint16_t userIndex) { return mScheduleIndexes[userIndex - 1]; }
+			return &mOwners[typeIndex - 1][credentialIndex - 1];
+		}
 	};
 
+	using UsersIndexes = DoorLockData::IndexList<CONFIG_LOCK_MAX_NUM_USERS>;
+
+#ifdef CONFIG_LOCK_SCHEDULES
+	/* Layout of the schedule indexes stored separately for every user by the previous versions of the sample. */
+	using WeekDayScheduleIndexes = DoorLockData::IndexList<CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER>;
+	using YearDayScheduleIndexes = DoorLockData::IndexList<CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER>;
 	using HolidayScheduleIndexes = DoorLockData::IndexList<CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES>;
+
+	/* Time intervals in which the schedules of a single user allow the access. */
+	using ScheduleIndex = DoorLockData::UserScheduleIndex<CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER,
+							      CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER>;
 #endif /* CONFIG_LOCK_SCHEDULES */
 
 	AccessManager() = default;
@@ -323,13 +361,37 @@ private:
 	AccessManager &operator=(AccessManager &) = delete;
 
 	void InitializeUsers();
+	void InitializeCredentialLookups();
 	void LoadUsersFromPersistentStorage();
 	void LoadCredentialsFromPersistentStorage();
 #ifdef CONFIG_LOCK_SCHEDULES
 	void InitializeSchedules();
 	void LoadSchedulesFromPersistentStorage();
+	bool LoadLegacySchedules();
+	void RemoveLegacySchedules();
+	bool StoreSchedules();
+	void RebuildScheduleIndex(uint16_t userIndex);
+	/* Checks the schedules of the user owning the credential, if the type of the user restricts the access to
+	 * the schedules. */
+	bool IsCredentialUserAllowed(uint16_t credentialIndex, CredentialTypeEnum credentialType);
+	/* Returns false if the type of the user does not restrict the access to the schedules. */
+	static bool GetScheduleRestriction(const DoorLockData::User &user,
+					   DoorLockData::ScheduleRestriction &restriction);
 #endif
 
+	/* Sets the owner of all credentials assigned to the user, or clears it if owner is 0 */
+	void SetCredentialOwner(uint16_t userIndex, uint16_t owner);
+
+	/* Returns the index of the occupied credential with the given secret, or 0 if there is no such credential */
+	uint16_t FindCredential(CredentialTypeEnum credentialType, const chip::ByteSpan &secret);
+
+	/* Only the occupied credentials with the secret data are added to the credential lookups */
+	static bool IsLookedUp(const DoorLockData::Credential &credential)
+	{
+		return credential.mInfo.mFields.mStatus != static_cast<uint8_t>(DlCredentialStatus::kAvailable) &&
+		       credential.mSecret.mDataLength > 0;
+	}
+
 	static CHIP_ERROR GetCredentialUserId(uint16_t credentialIndex, CredentialTypeEnum credentialType,
 					      uint32_t &userId);
 
@@ -345,6 +407,8 @@ private:
 
 	DoorLockData::Credentials<CRED_BIT_MASK> mCredentials{};
 	CredentialsIndexes mCredentialsIndexes{};
+	CredentialLookups mCredentialLookups{};
+	CredentialOwners mCredentialOwners{};
 
 	DoorLockData::User mUsers[CONFIG_LOCK_MAX_NUM_USERS] = {};
 	UsersIndexes mUsersIndexes{};
@@ -352,14 +416,10 @@ private:
 #ifdef CONFIG_LOCK_SCHEDULES
 	DoorLockData::WeekDaySchedule mWeekDaySchedule[CONFIG_LOCK_MAX_NUM_USERS]
 						      [CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER] = {};
-	WeekDayScheduleIndexes mWeekDayScheduleIndexes = {};
-
 	DoorLockData::YearDaySchedule mYearDaySchedule[CONFIG_LOCK_MAX_NUM_USERS]
 						      [CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER] = {};
-	YearDayScheduleIndexes mYearDayScheduleIndexes = {};
-
 	DoorLockData::HolidaySchedule mHolidaySchedule[CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES];
-	HolidayScheduleIndexes mHolidayScheduleIndexes = {};
+	ScheduleIndex mScheduleIndex[CONFIG_LOCK_MAX_NUM_USERS];
 #endif /* CONFIG_LOCK_SCHEDULES */
 
 	bool mRequirePINForRemoteOperation{ false };
@@ -53,6 +53,12 @@ bool AccessManager<CRED_BIT_MASK>::DoSetCredential(DoorLockData::Credential &cre
 						   CredentialTypeEnum credentialType, const ByteSpan &secret)
 {
 	uint32_t uniqueUserId;
+	auto &lookup = Instance().mCredentialLookups.Get(static_cast<CredentialTypeIndex>(credentialType));
+
+	if (IsLookedUp(credential)) {
+		lookup.Remove(credentialIndex, credential.mSecret.mData, credential.mSecret.mDataLength);
+	}
+
 	credential.mInfo.mFields.mStatus = static_cast<uint8_t>(credentialStatus);
 	credential.mInfo.mFields.mCredentialType = static_cast<uint8_t>(credentialType);
 	credential.mInfo.mFields.mCreationSource = static_cast<uint8_t>(DlAssetSource::kMatterIM);
@@ -76,6 +82,10 @@ bool AccessManager<CRED_BIT_MASK>::DoSetCredential(DoorLockData::Credential &cre
 		credential.mSecret.mDataLength = 0;
 	}
 
+	if (IsLookedUp(credential)) {
+		lookup.Insert(credentialIndex, credential.mSecret.mData, credential.mSecret.mDataLength);
+	}
+
 	uint8_t credentialSerialized[DoorLockData::Credential::RequiredBufferSize()] = { 0 };
 	size_t serializedSize = credential.Serialize(credentialSerialized, sizeof(credentialSerialized));
 
@@ -127,22 +137,31 @@ bool AccessManager<CRED_BIT_MASK>::DoSetCredential(DoorLockData::Credential &cre
 	return true;
 }
 
+template <CredentialsBits CRED_BIT_MASK>
+uint16_t AccessManager<CRED_BIT_MASK>::FindCredential(CredentialTypeEnum credentialType, const ByteSpan &secret)
+{
+	bool success{ false };
+	auto &credentials = mCredentials.GetCredentialsTypes(credentialType, success);
+	VerifyOrReturnError(success, 0);
+
+	return mCredentialLookups.Get(static_cast<CredentialTypeIndex>(credentialType))
+		.Find(secret.data(), secret.size(), [&credentials, &secret](uint16_t credentialIndex) {
+			auto &credentialSecret = credentials[credentialIndex - 1].mSecret;
+			return CredentialLookups::Lookup::ConstantTimeEqual(credentialSecret.mData,
+									    credentialSecret.mDataLength,
+									    secret.data(), secret.size());
+		});
+}
+
 template <CredentialsBits CRED_BIT_MASK>
 CHIP_ERROR AccessManager<CRED_BIT_MASK>::GetCredentialUserId(uint16_t credentialIndex,
 							     CredentialTypeEnum credentialType, uint32_t &userId)
 {
-	for (size_t idxUsr = 0; idxUsr < CONFIG_LOCK_MAX_NUM_USERS; ++idxUsr) {
-		auto &user = Instance().mUsers[idxUsr];
-		for (size_t idxCred = 0; idxCred < CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_USER; ++idxCred) {
-			auto &credentialStruct = user.mOccupiedCredentials.mData[idxCred];
-			if (credentialStruct.credentialIndex == credentialIndex &&
-			    credentialStruct.credentialType == credentialType) {
-				userId = user.mInfo.mFields.mUserUniqueId;
-				return CHIP_NO_ERROR;
-			}
-		}
-	}
-	return CHIP_ERROR_NOT_FOUND;
+	const uint16_t *owner = Instance().mCredentialOwners.Get(credentialType, credentialIndex);
+	VerifyOrReturnError(owner && *owner != 0, CHIP_ERROR_NOT_FOUND);
+
+	userId = Instance().mUsers[*owner - 1].mInfo.mFields.mUserUniqueId;
+	return CHIP_NO_ERROR;
 }
 
 template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::LoadCredentialsFromPersistentStorage()
@@ -182,9 +201,14 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Load
 					credentialIndex);
 			}
 
-			if (CHIP_NO_ERROR != credentials[credentialIndex - 1].Deserialize(credentialData, outSize)) {
+			auto &credential = credentials[credentialIndex - 1];
+			if (CHIP_NO_ERROR != credential.Deserialize(credentialData, outSize)) {
 				LOG_ERR("Cannot deserialize credentials of type %d for index: %d",
 					static_cast<uint8_t>(type), credentialIndex);
+			} else if (IsLookedUp(credential)) {
+				auto &lookup = mCredentialLookups.Get(static_cast<CredentialTypeIndex>(type));
+				lookup.Insert(credentialIndex, credential.mSecret.mData,
+					      credential.mSecret.mDataLength);
 			}
 		}
 	}
@@ -8,8 +8,15 @@
 #include "access_manager.h"
 #include "access_storage.h"
 
+#include <app/util/config.h>
+#include <lib/support/TimeUtils.h>
 #include <platform/CHIPDeviceLayer.h>
 
+#ifdef MATTER_DM_PLUGIN_TIME_SYNCHRONIZATION_SERVER
+#include <app/clusters/time-synchronization-server/time-synchronization-server.h>
+#endif
+
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_DECLARE(cr_manager, CONFIG_CHIP_APP_LOG_LEVEL);
@@ -17,6 +24,101 @@ LOG_MODULE_DECLARE(cr_manager, CONFIG_CHIP_APP_LOG_LEVEL);
 using namespace chip;
 using namespace DoorLockData;
 
+namespace
+{
+/*
+ * All schedules are stored as a single entry, so that they can be restored with a single read of the persistent
+ * storage. The entry starts with the layout version, followed by the occupied schedules:
+ * <schedule type (uint8_t)> <user index (uint16_t)> <schedule index (uint8_t)> <schedule data>
+ * The user index of the Holiday schedules is 0.
+ */
+constexpr uint8_t kSchedulesVersion = 1;
+
+/* Returns the current local time in seconds since the Matter epoch, as used by the Year Day schedules. */
+bool GetLocalTime(uint32_t &localTime)
+{
+#ifdef MATTER_DM_PLUGIN_TIME_SYNCHRONIZATION_SERVER
+	/* The Time Synchronization server applies the time zone and DST offsets set by the controller. */
+	app::DataModel::Nullable<uint64_t> localTimeUs;
+
+	if (app::Clusters::TimeSynchronization::TimeSynchronizationServer::Instance().GetLocalTime(
+		    kRootEndpointId, localTimeUs) != CHIP_NO_ERROR ||
+	    localTimeUs.IsNull()) {
+		return false;
+	}
+
+	localTime = static_cast<uint32_t>(localTimeUs.Value() / kMicrosecondsPerSecond);
+
+	return true;
+#else
+	/* Without the Time Synchronization server there is no time zone offset, so the UTC time is used. */
+	System::Clock::Milliseconds64 realTime;
+
+	if (System::SystemClock().GetClock_RealTimeMS(realTime) != CHIP_NO_ERROR) {
+		return false;
+	}
+
+	return UnixEpochToChipEpochTime(
+		static_cast<uint32_t>(std::chrono::duration_cast<System::Clock::Seconds32>(realTime).count()),
+		localTime);
+#endif
+}
+
+enum class ScheduleEntryType : uint8_t { WeekDay, YearDay, Holiday };
+
+struct ScheduleEntryHeader {
+	ScheduleEntryType mType;
+	uint16_t mUserIndex;
+	uint8_t mScheduleIndex;
+};
+
+constexpr size_t kEntryHeaderSize = sizeof(ScheduleEntryType) + sizeof(uint16_t) + sizeof(uint8_t);
+constexpr size_t kMaxSchedulesSize =
+	sizeof(kSchedulesVersion) +
+	CONFIG_LOCK_MAX_NUM_USERS *
+		(CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER * (kEntryHeaderSize + sizeof(WeekDaySchedule::Data)) +
+		 CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER * (kEntryHeaderSize + sizeof(YearDaySchedule::Data))) +
+	CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES * (kEntryHeaderSize + sizeof(HolidaySchedule::Data));
+
+/* Only accessed from the Matter thread, kept off the stack because of its size. */
+uint8_t sSchedulesBuffer[kMaxSchedulesSize];
+
+void PackEntry(ScheduleEntryType type, uint16_t userIndex, uint8_t scheduleIndex, const void *data, size_t dataSize,
+	       size_t &offset)
+{
+	pack(sSchedulesBuffer, &type, sizeof(type), offset);
+	pack(sSchedulesBuffer, &userIndex, sizeof(userIndex), offset);
+	pack(sSchedulesBuffer, &scheduleIndex, sizeof(scheduleIndex), offset);
+	pack(sSchedulesBuffer, data, dataSize, offset);
+}
+
+bool UnpackEntryHeader(size_t size, size_t &offset, ScheduleEntryHeader &header)
+{
+	if (offset + kEntryHeaderSize > size) {
+		return false;
+	}
+
+	unpack(&header.mType, sizeof(header.mType), sSchedulesBuffer, offset);
+	unpack(&header.mUserIndex, sizeof(header.mUserIndex), sSchedulesBuffer, offset);
+	unpack(&header.mScheduleIndex, sizeof(header.mScheduleIndex), sSchedulesBuffer, offset);
+
+	return true;
+}
+
+template <typename T>
+bool UnpackEntryData(T &schedule, size_t size, size_t &offset)
+{
+	if (offset + sizeof(schedule.mData.mRaw) > size) {
+		return false;
+	}
+
+	unpack(schedule.mData.mRaw, sizeof(schedule.mData.mRaw), sSchedulesBuffer, offset);
+	schedule.mAvailable = false;
+
+	return true;
+}
+} /* namespace */
+
 template <CredentialsBits CRED_BIT_MASK>
 DlStatus AccessManager<CRED_BIT_MASK>::GetWeekDaySchedule(uint8_t weekdayIndex, uint16_t userIndex,
 							  EmberAfPluginDoorLockWeekDaySchedule &schedule)
@@ -57,76 +159,24 @@ DlStatus AccessManager<CRED_BIT_MASK>::SetWeekDaySchedule(uint8_t weekdayIndex,
 		/* Clear the existing schedule */
 		schedule.mAvailable = true;
 		memset(schedule.mData.mRaw, 0, sizeof(schedule.mData.mRaw));
-		if (!AccessStorage::Instance().Remove(AccessStorage::Type::WeekDaySchedule, userIndex, weekdayIndex)) {
-			LOG_ERR("Cannot remove the WeekDay schedule");
-			return DlStatus::kFailure;
+	} else {
+		if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
+			LOG_DBG("Modifying week day schedule of index: %d for user %d", weekdayIndex, userIndex);
 		}
 
-		/* Remove the index from the schedule indexes list and update persistent storage */
-		auto &scheduleIndexes = mWeekDayScheduleIndexes.Get(userIndex);
-		if (CHIP_NO_ERROR != scheduleIndexes.RemoveIndex(weekdayIndex)) {
-			LOG_ERR("Cannot remove WeekDay schedule index from list");
-			return DlStatus::kFailure;
-		}
-
-		uint8_t scheduleIndexesSerialized[WeekDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
-		size_t serializedIndexesSize = scheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
-
-		if (0 < serializedIndexesSize) {
-			if (!AccessStorage::Instance().Store(AccessStorage::Type::WeekDayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize,
-							    userIndex)) {
-				LOG_ERR("Cannot store WeekDaySchedule counter. The persistent database will be corrupted.");
-				return DlStatus::kFailure;
-			}
-		} else {
-			/* If there are no more schedules, remove the indexes entry from storage */
-			if (!AccessStorage::Instance().Remove(AccessStorage::Type::WeekDayScheduleIndexes, userIndex)) {
-				LOG_ERR("Cannot remove WeekDaySchedule indexes entry");
-				return DlStatus::kFailure;
-			}
-		}
-
-		return DlStatus::kSuccess;
-	} else if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
-		LOG_DBG("Modifying week day schedule of index: %d for user %d", weekdayIndex, userIndex);
+		schedule.mData.mFields.mDaysMask = static_cast<uint8_t>(daysMask);
+		schedule.mData.mFields.mStartHour = startHour;
+		schedule.mData.mFields.mStartMinute = startMinute;
+		schedule.mData.mFields.mEndHour = endHour;
+		schedule.mData.mFields.mEndMinute = endMinute;
+		schedule.mAvailable = false;
 	}
 
-	schedule.mData.mFields.mDaysMask = static_cast<uint8_t>(daysMask);
-	schedule.mData.mFields.mStartHour = startHour;
-	schedule.mData.mFields.mStartMinute = startMinute;
-	schedule.mData.mFields.mEndHour = endHour;
-	schedule.mData.mFields.mEndMinute = endMinute;
-	schedule.mAvailable = false;
-
-	uint8_t scheduleSerialized[DoorLockData::WeekDaySchedule::RequiredBufferSize()] = { 0 };
-	size_t serializedSize = schedule.Serialize(scheduleSerialized, sizeof(scheduleSerialized));
-
-	uint8_t scheduleIndexesSerialized[WeekDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
-	size_t serializedIndexesSize{ 0 };
-
-	if (0 < serializedSize) {
-		auto &scheduleIndexes = mWeekDayScheduleIndexes.Get(userIndex);
-		if (CHIP_ERROR_BUFFER_TOO_SMALL == scheduleIndexes.AddIndex(weekdayIndex)) {
-			return DlStatus::kFailure;
-		}
+	RebuildScheduleIndex(userIndex);
 
-		serializedIndexesSize =
-			scheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
-	}
-
-	/* Store to persistent storage */
-	if (0 < serializedSize && 0 < serializedIndexesSize) {
-		if (!AccessStorage::Instance().Store(AccessStorage::Type::WeekDaySchedule, scheduleSerialized,
-						     serializedSize, userIndex, weekdayIndex)) {
-			LOG_ERR("Cannot store WeekDaySchedule");
-			return DlStatus::kFailure;
-		} else if (!AccessStorage::Instance().Store(AccessStorage::Type::WeekDayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize,
-							    userIndex)) {
-			LOG_ERR("Cannot store WeekDaySchedule counter. The persistent database will be corrupted.");
-			return DlStatus::kFailure;
-		}
+	if (!StoreSchedules()) {
+		LOG_ERR("Cannot store WeekDaySchedule");
+		return DlStatus::kFailure;
 	}
 
 	return DlStatus::kSuccess;
@@ -171,73 +221,21 @@ DlStatus AccessManager<CRED_BIT_MASK>::SetYearDaySchedule(uint8_t yeardayIndex,
 		/* Clear the existing schedule */
 		schedule.mAvailable = true;
 		memset(schedule.mData.mRaw, 0, sizeof(schedule.mData.mRaw));
-		if (!AccessStorage::Instance().Remove(AccessStorage::Type::YearDaySchedule, userIndex, yeardayIndex)) {
-			LOG_ERR("Cannot remove the YearDay schedule");
-			return DlStatus::kFailure;
-		}
-
-		/* Remove the index from the schedule indexes list and update persistent storage */
-		auto &scheduleIndexes = mYearDayScheduleIndexes.Get(userIndex);
-		if (CHIP_NO_ERROR != scheduleIndexes.RemoveIndex(yeardayIndex)) {
-			LOG_ERR("Cannot remove YearDay schedule index from list");
-			return DlStatus::kFailure;
-		}
-
-		uint8_t scheduleIndexesSerialized[YearDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
-		size_t serializedIndexesSize = scheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
-
-		if (0 < serializedIndexesSize) {
-			if (!AccessStorage::Instance().Store(AccessStorage::Type::YearDayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize,
-							    userIndex)) {
-				LOG_ERR("Cannot store YearDaySchedule counter. The persistent database will be corrupted.");
-				return DlStatus::kFailure;
-			}
-		} else {
-			/* If there are no more schedules, remove the indexes entry from storage */
-			if (!AccessStorage::Instance().Remove(AccessStorage::Type::YearDayScheduleIndexes, userIndex)) {
-				LOG_ERR("Cannot remove YearDaySchedule indexes entry");
-				return DlStatus::kFailure;
-			}
+	} else {
+		if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
+			LOG_DBG("Modifying year day schedule of index: %d for user %d", yeardayIndex, userIndex);
 		}
 
-		return DlStatus::kSuccess;
-	} else if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
-		LOG_DBG("Modifying year day schedule of index: %d for user %d", yeardayIndex, userIndex);
+		schedule.mData.mFields.mLocalStartTime = localStartTime;
+		schedule.mData.mFields.mLocalEndTime = localEndTime;
+		schedule.mAvailable = false;
 	}
 
-	schedule.mData.mFields.mLocalStartTime = localStartTime;
-	schedule.mData.mFields.mLocalEndTime = localEndTime;
-	schedule.mAvailable = false;
-
-	uint8_t scheduleSerialized[DoorLockData::YearDaySchedule::RequiredBufferSize()] = { 0 };
-	size_t serializedSize = schedule.Serialize(scheduleSerialized, sizeof(scheduleSerialized));
-
-	uint8_t scheduleIndexesSerialized[YearDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
-	size_t serializedIndexesSize{ 0 };
+	RebuildScheduleIndex(userIndex);
 
-	if (0 < serializedSize) {
-		auto &scheduleIndexes = mYearDayScheduleIndexes.Get(userIndex);
-		if (CHIP_ERROR_BUFFER_TOO_SMALL == scheduleIndexes.AddIndex(yeardayIndex)) {
-			return DlStatus::kFailure;
-		}
-
-		serializedIndexesSize =
-			scheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
-	}
-
-	/* Store to persistent storage */
-	if (0 < serializedSize && 0 < serializedIndexesSize) {
-		if (!AccessStorage::Instance().Store(AccessStorage::Type::YearDaySchedule, scheduleSerialized,
-						     serializedSize, userIndex, yeardayIndex)) {
-			LOG_ERR("Cannot store YearDaySchedule");
-			return DlStatus::kFailure;
-		} else if (!AccessStorage::Instance().Store(AccessStorage::Type::YearDayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize,
-							    userIndex)) {
-			LOG_ERR("Cannot store YearDaySchedule counter. The persistent database will be corrupted.");
-			return DlStatus::kFailure;
-		}
+	if (!StoreSchedules()) {
+		LOG_ERR("Cannot store YearDaySchedule");
+		return DlStatus::kFailure;
 	}
 
 	return DlStatus::kSuccess;
@@ -278,105 +276,253 @@ DlStatus AccessManager<CRED_BIT_MASK>::SetHolidaySchedule(uint8_t holidayIndex,
 		/* Clear the existing schedule */
 		schedule.mAvailable = true;
 		memset(schedule.mData.mRaw, 0, sizeof(schedule.mData.mRaw));
-		if (!AccessStorage::Instance().Remove(AccessStorage::Type::HolidaySchedule, holidayIndex)) {
-			LOG_ERR("Cannot remove the Holiday schedule");
-			return DlStatus::kFailure;
+	} else {
+		if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
+			LOG_DBG("Modifying holiday schedule of index: %d", holidayIndex);
 		}
 
-		/* Remove the index from the schedule indexes list and update persistent storage */
-		if (CHIP_NO_ERROR != mHolidayScheduleIndexes.RemoveIndex(holidayIndex)) {
-			LOG_ERR("Cannot remove Holiday schedule index from list");
-			return DlStatus::kFailure;
+		schedule.mData.mFields.mLocalStartTime = localStartTime;
+		schedule.mData.mFields.mLocalEndTime = localEndTime;
+		schedule.mData.mFields.mOperatingMode = static_cast<uint8_t>(operatingMode);
+		schedule.mAvailable = false;
+	}
+
+	if (!StoreSchedules()) {
+		LOG_ERR("Cannot store HolidaySchedule");
+		return DlStatus::kFailure;
+	}
+
+	return DlStatus::kSuccess;
+}
+
+template <CredentialsBits CRED_BIT_MASK>
+bool AccessManager<CRED_BIT_MASK>::GetScheduleRestriction(const DoorLockData::User &user,
+							   ScheduleRestriction &restriction)
+{
+	switch (static_cast<UserTypeEnum>(user.mInfo.mFields.mUserType)) {
+	case UserTypeEnum::kWeekDayScheduleUser:
+		restriction = ScheduleRestriction::WeekDay;
+		return true;
+	case UserTypeEnum::kYearDayScheduleUser:
+		restriction = ScheduleRestriction::YearDay;
+		return true;
+	case UserTypeEnum::kScheduleRestrictedUser:
+		restriction = ScheduleRestriction::Any;
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <CredentialsBits CRED_BIT_MASK>
+bool AccessManager<CRED_BIT_MASK>::IsUserAllowed(uint16_t userIndex, uint32_t localTime)
+{
+	VerifyOrReturnError(userIndex > 0 && userIndex <= CONFIG_LOCK_MAX_NUM_USERS, false);
+
+	ScheduleRestriction restriction;
+
+	if (!GetScheduleRestriction(mUsers[userIndex - 1], restriction)) {
+		return true;
+	}
+
+	return mScheduleIndex[userIndex - 1].IsAllowed(restriction, localTime);
+}
+
+template <CredentialsBits CRED_BIT_MASK>
+bool AccessManager<CRED_BIT_MASK>::IsCredentialUserAllowed(uint16_t credentialIndex, CredentialTypeEnum credentialType)
+{
+	const uint16_t *owner = mCredentialOwners.Get(credentialType, credentialIndex);
+	ScheduleRestriction restriction;
+
+	if (!owner || *owner == 0 || !GetScheduleRestriction(mUsers[*owner - 1], restriction)) {
+		return true;
+	}
+
+	uint32_t localTime;
+
+	/* The schedules cannot be checked without the time, so the restricted user is not allowed. */
+	if (!GetLocalTime(localTime)) {
+		LOG_WRN("The time is not synchronized, the schedules cannot be checked");
+		return false;
+	}
+
+	return mScheduleIndex[*owner - 1].IsAllowed(restriction, localTime);
+}
+
+template <CredentialsBits CRED_BIT_MASK>
+void AccessManager<CRED_BIT_MASK>::RebuildScheduleIndex(uint16_t userIndex)
+{
+	typename ScheduleIndex::WeekDayIndex::Interval weekDayIntervals[7 * CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER];
+	typename ScheduleIndex::YearDayIndex::Interval yearDayIntervals[CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER];
+	size_t weekDayCount = 0;
+	size_t yearDayCount = 0;
+
+	/* Every day selected by the Week Day schedule becomes a separate interval of the week. */
+	for (auto &schedule : mWeekDaySchedule[userIndex - 1]) {
+		if (schedule.mAvailable) {
+			continue;
 		}
 
-		uint8_t scheduleIndexesSerialized[HolidayScheduleIndexes::RequiredBufferSize()] = { 0 };
-		size_t serializedIndexesSize = mHolidayScheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
+		const auto &fields = schedule.mData.mFields;
 
-		if (0 < serializedIndexesSize) {
-			if (!AccessStorage::Instance().Store(AccessStorage::Type::HolidayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize)) {
-				LOG_ERR("Cannot store HolidaySchedule counter. The persistent database will be corrupted.");
-				return DlStatus::kFailure;
-			}
-		} else {
-			/* If there are no more schedules, remove the indexes entry from storage */
-			if (!AccessStorage::Instance().Remove(AccessStorage::Type::HolidayScheduleIndexes)) {
-				LOG_ERR("Cannot remove HolidaySchedule indexes entry");
-				return DlStatus::kFailure;
+		for (uint8_t day = 0; day < 7; day++) {
+			if (fields.mDaysMask & BIT(day)) {
+				weekDayIntervals[weekDayCount++] = {
+					ScheduleTime::MinuteOfWeek(day, fields.mStartHour, fields.mStartMinute),
+					ScheduleTime::MinuteOfWeek(day, fields.mEndHour, fields.mEndMinute)
+				};
 			}
 		}
+	}
 
-		return DlStatus::kSuccess;
-	} else if (DlScheduleStatus::kOccupied == status && !schedule.mAvailable) {
-		LOG_DBG("Modifying holiday schedule of index: %d", holidayIndex);
+	for (auto &schedule : mYearDaySchedule[userIndex - 1]) {
+		if (!schedule.mAvailable) {
+			yearDayIntervals[yearDayCount++] = { schedule.mData.mFields.mLocalStartTime,
+							     schedule.mData.mFields.mLocalEndTime };
+		}
 	}
 
-	schedule.mData.mFields.mLocalStartTime = localStartTime;
-	schedule.mData.mFields.mLocalEndTime = localEndTime;
-	schedule.mData.mFields.mOperatingMode = static_cast<uint8_t>(operatingMode);
-	schedule.mAvailable = false;
+	auto &scheduleIndex = mScheduleIndex[userIndex - 1];
 
-	uint8_t scheduleSerialized[DoorLockData::HolidaySchedule::RequiredBufferSize()] = { 0 };
-	size_t serializedSize = schedule.Serialize(scheduleSerialized, sizeof(scheduleSerialized));
+	scheduleIndex.mWeekDay.Build(weekDayIntervals, weekDayCount);
+	scheduleIndex.mYearDay.Build(yearDayIntervals, yearDayCount);
+}
 
-	uint8_t scheduleIndexesSerialized[HolidayScheduleIndexes::RequiredBufferSize()] = { 0 };
-	size_t serializedIndexesSize{ 0 };
+template <CredentialsBits CRED_BIT_MASK> bool AccessManager<CRED_BIT_MASK>::StoreSchedules()
+{
+	size_t offset = 0;
 
-	if (0 < serializedSize) {
-		if (CHIP_ERROR_BUFFER_TOO_SMALL == mHolidayScheduleIndexes.AddIndex(holidayIndex)) {
-			return DlStatus::kFailure;
-		}
+	pack(sSchedulesBuffer, &kSchedulesVersion, sizeof(kSchedulesVersion), offset);
 
-		serializedIndexesSize =
-			mHolidayScheduleIndexes.Serialize(scheduleIndexesSerialized, sizeof(scheduleIndexesSerialized));
+	for (uint16_t userIndex = 1; userIndex <= CONFIG_LOCK_MAX_NUM_USERS; userIndex++) {
+		for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER;
+		     scheduleIndex++) {
+			auto &schedule = mWeekDaySchedule[userIndex - 1][scheduleIndex - 1];
+			if (!schedule.mAvailable) {
+				PackEntry(ScheduleEntryType::WeekDay, userIndex, scheduleIndex, schedule.mData.mRaw,
+					  sizeof(schedule.mData.mRaw), offset);
+			}
+		}
+		for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER;
+		     scheduleIndex++) {
+			auto &schedule = mYearDaySchedule[userIndex - 1][scheduleIndex - 1];
+			if (!schedule.mAvailable) {
+				PackEntry(ScheduleEntryType::YearDay, userIndex, scheduleIndex, schedule.mData.mRaw,
+					  sizeof(schedule.mData.mRaw), offset);
+			}
+		}
 	}
 
-	/* Store to persistent storage */
-	if (0 < serializedSize && 0 < serializedIndexesSize) {
-		if (!AccessStorage::Instance().Store(AccessStorage::Type::HolidaySchedule, scheduleSerialized,
-						     serializedSize, holidayIndex)) {
-			LOG_ERR("Cannot store HolidaySchedule");
-			return DlStatus::kFailure;
-		} else if (!AccessStorage::Instance().Store(AccessStorage::Type::HolidayScheduleIndexes,
-							    scheduleIndexesSerialized, serializedIndexesSize)) {
-			LOG_ERR("Cannot store HolidaySchedule counter. The persistent database will be corrupted.");
-			return DlStatus::kFailure;
+	for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES; scheduleIndex++) {
+		auto &schedule = mHolidaySchedule[scheduleIndex - 1];
+		if (!schedule.mAvailable) {
+			PackEntry(ScheduleEntryType::Holiday, 0, scheduleIndex, schedule.mData.mRaw,
+				  sizeof(schedule.mData.mRaw), offset);
 		}
 	}
 
-	return DlStatus::kSuccess;
+	return AccessStorage::Instance().Store(AccessStorage::Type::Schedules, sSchedulesBuffer, offset);
 }
 
 template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::LoadSchedulesFromPersistentStorage()
 {
-	/* Load all Schedules from persistent storage */
+	const uint32_t startTime = k_uptime_get_32();
+	size_t outSize{ 0 };
+	size_t offset{ 0 };
+	uint8_t version{ 0 };
+	ScheduleEntryHeader header;
+
+	if (!AccessStorage::Instance().Load(AccessStorage::Type::Schedules, sSchedulesBuffer, sizeof(sSchedulesBuffer),
+					    outSize) ||
+	    outSize < sizeof(version)) {
+		/* Schedules stored by the previous versions of the sample are moved to the single entry once. */
+		if (LoadLegacySchedules()) {
+			if (StoreSchedules()) {
+				RemoveLegacySchedules();
+			} else {
+				LOG_ERR("Cannot store the migrated schedules");
+			}
+		}
+		return;
+	}
+
+	unpack(&version, sizeof(version), sSchedulesBuffer, offset);
+	if (version != kSchedulesVersion) {
+		LOG_ERR("Unsupported version of the stored schedules: %u", version);
+		return;
+	}
+
+	while (UnpackEntryHeader(outSize, offset, header)) {
+		const uint16_t userIndex = header.mUserIndex;
+		const uint8_t scheduleIndex = header.mScheduleIndex;
+		bool valid{ false };
+
+		switch (header.mType) {
+		case ScheduleEntryType::WeekDay:
+			valid = userIndex > 0 && userIndex <= CONFIG_LOCK_MAX_NUM_USERS && scheduleIndex > 0 &&
+				scheduleIndex <= CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER &&
+				UnpackEntryData(mWeekDaySchedule[userIndex - 1][scheduleIndex - 1], outSize, offset);
+			break;
+		case ScheduleEntryType::YearDay:
+			valid = userIndex > 0 && userIndex <= CONFIG_LOCK_MAX_NUM_USERS && scheduleIndex > 0 &&
+				scheduleIndex <= CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER &&
+				UnpackEntryData(mYearDaySchedule[userIndex - 1][scheduleIndex - 1], outSize, offset);
+			break;
+		case ScheduleEntryType::Holiday:
+			valid = scheduleIndex > 0 && scheduleIndex <= CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES &&
+				UnpackEntryData(mHolidaySchedule[scheduleIndex - 1], outSize, offset);
+			break;
+		default:
+			break;
+		}
+
+		if (!valid) {
+			/* The size of the entry depends on its type, so the remaining entries cannot be parsed. */
+			LOG_ERR("Cannot deserialize schedule %u of type %u for user index: %u", scheduleIndex,
+				static_cast<uint8_t>(header.mType), userIndex);
+			break;
+		}
+
+#if CONFIG_LOCK_ENABLE_DEBUG
+		/* ScheduleEntryType follows the order of ScheduleType. */
+		PrintSchedule(static_cast<ScheduleType>(header.mType), scheduleIndex, userIndex);
+#endif
+	}
+
+	for (uint16_t userIndex = 1; userIndex <= CONFIG_LOCK_MAX_NUM_USERS; userIndex++) {
+		RebuildScheduleIndex(userIndex);
+	}
+
+	LOG_DBG("Schedules restored in %u ms", k_uptime_get_32() - startTime);
+}
+
+template <CredentialsBits CRED_BIT_MASK> bool AccessManager<CRED_BIT_MASK>::LoadLegacySchedules()
+{
 	bool scheduleFound{ false };
 	size_t outSize{ 0 };
 	uint16_t scheduleIndex = 0;
 
-	uint8_t scheduleWeekDayIndexesSerialized[WeekDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
+	WeekDayScheduleIndexes weekDayIndexes;
+	uint8_t scheduleWeekDayIndexesSerialized[WeekDayScheduleIndexes::RequiredBufferSize()] = { 0 };
 	uint8_t scheduleWeekDayData[DoorLockData::WeekDaySchedule::RequiredBufferSize()] = { 0 };
 
-	uint8_t scheduleYearDayIndexesSerialized[YearDayScheduleIndexes::ScheduleList::RequiredBufferSize()] = { 0 };
+	YearDayScheduleIndexes yearDayIndexes;
+	uint8_t scheduleYearDayIndexesSerialized[YearDayScheduleIndexes::RequiredBufferSize()] = { 0 };
 	uint8_t scheduleYearDayData[DoorLockData::YearDaySchedule::RequiredBufferSize()] = { 0 };
 
+	HolidayScheduleIndexes holidayIndexes;
+	uint8_t scheduleHolidayIndexesSerialized[HolidayScheduleIndexes::RequiredBufferSize()] = { 0 };
+	uint8_t scheduleHolidayData[DoorLockData::HolidaySchedule::RequiredBufferSize()] = { 0 };
+
 	for (size_t userIndex = 1; userIndex <= CONFIG_LOCK_MAX_NUM_USERS; userIndex++) {
-		scheduleFound = false;
 		/* Load WeekDay schedules */
 		if (AccessStorage::Instance().Load(AccessStorage::Type::WeekDayScheduleIndexes,
 						   scheduleWeekDayIndexesSerialized,
-						   sizeof(scheduleWeekDayIndexesSerialized), outSize, userIndex)) {
-			if (CHIP_NO_ERROR == mWeekDayScheduleIndexes.Get(userIndex).Deserialize(
-						     scheduleWeekDayIndexesSerialized, outSize)) {
-				scheduleFound = true;
-			}
-		}
-
-		if (scheduleFound) {
-			auto &scheduleIndexes = mWeekDayScheduleIndexes.Get(userIndex);
-			for (size_t scheduleIdx = 0; scheduleIdx < scheduleIndexes.mList.mLength; scheduleIdx++) {
+						   sizeof(scheduleWeekDayIndexesSerialized), outSize, userIndex) &&
+		    CHIP_NO_ERROR == weekDayIndexes.Deserialize(scheduleWeekDayIndexesSerialized, outSize)) {
+			for (size_t scheduleIdx = 0; scheduleIdx < weekDayIndexes.mList.mLength; scheduleIdx++) {
 				/* Read the actual index from the indexList */
-				scheduleIndex = scheduleIndexes.mList.mIndexes[scheduleIdx];
+				scheduleIndex = weekDayIndexes.mList.mIndexes[scheduleIdx];
 				if (AccessStorage::Instance().Load(AccessStorage::Type::WeekDaySchedule,
 								   scheduleWeekDayData, sizeof(scheduleWeekDayData),
 								   outSize, userIndex, scheduleIndex)) {
@@ -385,81 +531,104 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Load
 						    scheduleWeekDayData, outSize)) {
 						LOG_ERR("Cannot deserialize WeekDay Schedule %d for user index: %d",
 							scheduleIndex, userIndex);
+					} else {
+						scheduleFound = true;
 					}
-#if CONFIG_LOCK_ENABLE_DEBUG
-					else {
-						PrintSchedule(ScheduleType::WeekDay, scheduleIndex, userIndex);
-					}
-#endif
 				}
 			}
 		}
 
-		scheduleFound = false;
-
 		/* Load YearDay schedules */
 		if (AccessStorage::Instance().Load(AccessStorage::Type::YearDayScheduleIndexes,
 						   scheduleYearDayIndexesSerialized,
-						   sizeof(scheduleYearDayIndexesSerialized), outSize, userIndex)) {
-			if (CHIP_NO_ERROR == mYearDayScheduleIndexes.Get(userIndex).Deserialize(
-						     scheduleYearDayIndexesSerialized, outSize)) {
-				scheduleFound = true;
-			}
-		}
-
-		if (scheduleFound) {
-			auto &scheduleIndexes = mYearDayScheduleIndexes.Get(userIndex);
-			for (size_t scheduleIdx = 0; scheduleIdx < scheduleIndexes.mList.mLength; scheduleIdx++) {
+						   sizeof(scheduleYearDayIndexesSerialized), outSize, userIndex) &&
+		    CHIP_NO_ERROR == yearDayIndexes.Deserialize(scheduleYearDayIndexesSerialized, outSize)) {
+			for (size_t scheduleIdx = 0; scheduleIdx < yearDayIndexes.mList.mLength; scheduleIdx++) {
 				/* Read the actual index from the indexList */
-				scheduleIndex = scheduleIndexes.mList.mIndexes[scheduleIdx];
-				if (!AccessStorage::Instance().Load(AccessStorage::Type::YearDaySchedule,
-								    scheduleYearDayData, sizeof(scheduleYearDayData),
-								    outSize, userIndex, scheduleIndex)) {
-				} else {
+				scheduleIndex = yearDayIndexes.mList.mIndexes[scheduleIdx];
+				if (AccessStorage::Instance().Load(AccessStorage::Type::YearDaySchedule,
+								   scheduleYearDayData, sizeof(scheduleYearDayData),
+								   outSize, userIndex, scheduleIndex)) {
 					if (CHIP_NO_ERROR !=
 					    mYearDaySchedule[userIndex - 1][scheduleIndex - 1].Deserialize(
 						    scheduleYearDayData, outSize)) {
 						LOG_ERR("Cannot deserialize YearDay Schedule %d for user index: %d",
 							scheduleIndex, userIndex);
+					} else {
+						scheduleFound = true;
 					}
-#if CONFIG_LOCK_ENABLE_DEBUG
-					else {
-						PrintSchedule(ScheduleType::YearDay, scheduleIndex, userIndex);
-					}
-#endif
 				}
 			}
 		}
-	}
 
-	scheduleFound = false;
+		RebuildScheduleIndex(userIndex);
+	}
 
 	/* Load Holiday schedules */
-	uint8_t scheduleHolidayIndexesSerialized[HolidayScheduleIndexes::RequiredBufferSize()] = { 0 };
-	uint8_t scheduleHolidayData[DoorLockData::HolidaySchedule::RequiredBufferSize()] = { 0 };
-
 	if (AccessStorage::Instance().Load(AccessStorage::Type::HolidayScheduleIndexes,
 					   scheduleHolidayIndexesSerialized, sizeof(scheduleHolidayIndexesSerialized),
-					   outSize, 0)) {
-		if (CHIP_NO_ERROR == mHolidayScheduleIndexes.Deserialize(scheduleHolidayIndexesSerialized, outSize)) {
-			scheduleFound = true;
+					   outSize, 0) &&
+	    CHIP_NO_ERROR == holidayIndexes.Deserialize(scheduleHolidayIndexesSerialized, outSize)) {
+		for (size_t scheduleIdx = 0; scheduleIdx < holidayIndexes.mList.mLength; scheduleIdx++) {
+			/* Read the actual index from the indexList */
+			scheduleIndex = holidayIndexes.mList.mIndexes[scheduleIdx];
+			if (AccessStorage::Instance().Load(AccessStorage::Type::HolidaySchedule, scheduleHolidayData,
+							   sizeof(scheduleHolidayData), outSize, scheduleIndex)) {
+				if (CHIP_NO_ERROR !=
+				    mHolidaySchedule[scheduleIndex - 1].Deserialize(scheduleHolidayData, outSize)) {
+					LOG_ERR("Cannot deserialize Holiday Schedule %d ", scheduleIndex);
+				} else {
+					scheduleFound = true;
+				}
+			}
 		}
 	}
-	for (size_t scheduleIdx = 0; scheduleIdx < mHolidayScheduleIndexes.mList.mLength; scheduleIdx++) {
-		/* Read the actual index from the indexList */
-		scheduleIndex = mHolidayScheduleIndexes.mList.mIndexes[scheduleIdx];
-		if (AccessStorage::Instance().Load(AccessStorage::Type::HolidaySchedule, scheduleHolidayData,
-						   sizeof(scheduleHolidayData), outSize, scheduleIndex)) {
-			if (CHIP_NO_ERROR !=
-			    mHolidaySchedule[scheduleIndex - 1].Deserialize(scheduleHolidayData, outSize)) {
-				LOG_ERR("Cannot deserialize Holiday Schedule %d ", scheduleIndex);
+
+	return scheduleFound;
+}
+
+template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::RemoveLegacySchedules()
+{
+	for (uint16_t userIndex = 1; userIndex <= CONFIG_LOCK_MAX_NUM_USERS; userIndex++) {
+		bool weekDayFound{ false };
+		bool yearDayFound{ false };
+
+		for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_WEEKDAY_SCHEDULES_PER_USER;
+		     scheduleIndex++) {
+			if (!mWeekDaySchedule[userIndex - 1][scheduleIndex - 1].mAvailable) {
+				AccessStorage::Instance().Remove(AccessStorage::Type::WeekDaySchedule, userIndex,
+								 scheduleIndex);
+				weekDayFound = true;
 			}
-#if CONFIG_LOCK_ENABLE_DEBUG
-			else {
-				PrintSchedule(ScheduleType::Holiday, scheduleIndex);
+		}
+		for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_YEARDAY_SCHEDULES_PER_USER;
+		     scheduleIndex++) {
+			if (!mYearDaySchedule[userIndex - 1][scheduleIndex - 1].mAvailable) {
+				AccessStorage::Instance().Remove(AccessStorage::Type::YearDaySchedule, userIndex,
+								 scheduleIndex);
+				yearDayFound = true;
 			}
-#endif
 		}
+
+		if (weekDayFound) {
+			AccessStorage::Instance().Remove(AccessStorage::Type::WeekDayScheduleIndexes, userIndex);
+		}
+		if (yearDayFound) {
+			AccessStorage::Instance().Remove(AccessStorage::Type::YearDayScheduleIndexes, userIndex);
+		}
+	}
+
+	bool holidayFound{ false };
+
+	for (uint8_t scheduleIndex = 1; scheduleIndex <= CONFIG_LOCK_MAX_HOLIDAY_SCHEDULES; scheduleIndex++) {
+		if (!mHolidaySchedule[scheduleIndex - 1].mAvailable) {
+			AccessStorage::Instance().Remove(AccessStorage::Type::HolidaySchedule, scheduleIndex);
+			holidayFound = true;
+		}
+	}
+
+	if (holidayFound) {
+		AccessStorage::Instance().Remove(AccessStorage::Type::HolidayScheduleIndexes);
 	}
 }
 
@@ -11,6 +11,8 @@
 
 #include <zephyr/logging/log.h>
 
+#include <algorithm>
+
 LOG_MODULE_DECLARE(cr_manager, CONFIG_CHIP_APP_LOG_LEVEL);
 
 using namespace chip;
@@ -44,11 +46,13 @@ bool AccessManager<CRED_BIT_MASK>::SetUser(uint16_t userIndex, FabricIndex creat
 	user.mName.mSize = userName.size();
 	memcpy(user.mName.mValue, userName.data(), userName.size());
 
+	SetCredentialOwner(userIndex, 0);
 	for (size_t i = 0; i < totalCredentials; ++i) {
 		auto *currentCredentials = credentials + i;
 		memcpy(&user.mOccupiedCredentials.mData[i], currentCredentials, sizeof(CredentialStruct));
 	}
 	user.mOccupiedCredentials.mSize = totalCredentials * sizeof(CredentialStruct);
+	SetCredentialOwner(userIndex, userIndex);
 
 	user.mInfo.mFields.mUserUniqueId = uniqueId;
 	user.mInfo.mFields.mUserStatus = static_cast<uint8_t>(userStatus);
@@ -121,12 +125,33 @@ template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::Load
 								sizeof(userData), outSize, userIndex)) {
 				if (CHIP_NO_ERROR != mUsers[userIndex - 1].Deserialize(userData, outSize)) {
 					LOG_ERR("Cannot deserialize User index: %d", userIndex);
+				} else {
+					SetCredentialOwner(userIndex, userIndex);
 				}
 			}
 		}
 	}
 }
 
+template <CredentialsBits CRED_BIT_MASK>
+void AccessManager<CRED_BIT_MASK>::SetCredentialOwner(uint16_t userIndex, uint16_t owner)
+{
+	const auto &user = mUsers[userIndex - 1];
+	const size_t count = std::min<size_t>(user.mOccupiedCredentials.mSize / sizeof(CredentialStruct),
+					      CONFIG_LOCK_MAX_NUM_CREDENTIALS_PER_USER);
+
+	for (size_t i = 0; i < count; ++i) {
+		const auto &credential = user.mOccupiedCredentials.mData[i];
+		uint16_t *credentialOwner =
+			mCredentialOwners.Get(credential.credentialType, credential.credentialIndex);
+
+		/* Keep the owner if the credential has already been assigned to another user. */
+		if (credentialOwner && (owner != 0 || *credentialOwner == userIndex)) {
+			*credentialOwner = owner;
+		}
+	}
+}
+
 #ifdef CONFIG_LOCK_ENABLE_DEBUG
 
 template <CredentialsBits CRED_BIT_MASK> void AccessManager<CRED_BIT_MASK>::PrintUser(uint16_t userIndex)
@@ -29,6 +29,9 @@
  *     /sch_idxs_<type (h - holiday)>                            = <schedule indices>
  *     /sch_<type (h - holiday)>
  *         /<schedule index (uint8_t)>                           = <schedule data>
+ *     /sch_all                                                  = <all schedules>
+ *
+ * The separate schedule entries are only read to migrate them to the single entry with all schedules.
  * /pin_req                                                      = <requires PIN?>
  *
  */
@@ -73,6 +76,7 @@ constexpr auto kScheduleWeekDaySuffix = "_w";
 constexpr auto kScheduleYearDaySuffix = "_y";
 constexpr auto kScheduleHolidaySuffix = "_h";
 constexpr auto kScheduleCounterPrefix = "sch_idxs";
+constexpr auto kSchedulesPrefix = "sch_all";
 #endif /* CONFIG_LOCK_SCHEDULES */
 constexpr auto kMaxAccessName = Nrf::PersistentStorageNode::kMaxKeyNameLength;
 
@@ -140,6 +144,9 @@ bool PrepareKeyName(AccessStorage::Type storageType, uint16_t index, uint16_t su
 		(void)snprintf(keyName, kMaxAccessName, "%s/%s%s", kAccessPrefix, kScheduleCounterPrefix,
 			       kScheduleHolidaySuffix);
 		return true;
+	case AccessStorage::Type::Schedules:
+		(void)snprintf(keyName, kMaxAccessName, "%s/%s", kAccessPrefix, kSchedulesPrefix);
+		return true;
 #endif /* CONFIG_LOCK_SCHEDULES */
 	default:
 		break;
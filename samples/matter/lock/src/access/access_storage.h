@@ -37,7 +37,8 @@ public:
 		YearDaySchedule,
 		YearDayScheduleIndexes,
 		HolidaySchedule,
-		HolidayScheduleIndexes
+		HolidayScheduleIndexes,
+		Schedules
 #endif /* CONFIG_LOCK_SCHEDULES */
 	};
 
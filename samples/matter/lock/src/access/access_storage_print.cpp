@@ -52,6 +52,8 @@ static const char *TypeToString(AccessStorage::Type type)
 	case AccessStorage::Type::YearDayScheduleIndexes:
 	case AccessStorage::Type::HolidayScheduleIndexes:
 		return "schedule idx";
+	case AccessStorage::Type::Schedules:
+		return "schedules";
 #endif /* CONFIG_LOCK_SCHEDULES */
 	default:
 		return "other";
@@ -23,6 +23,7 @@
  * - 8: YearDayScheduleIndexes
  * - 9: HolidaySchedule
  * - 10: HolidayScheduleIndexes
+ * - 11: Schedules
  *
  * For example, the UID offset for the credential with type Fingerprint (3) and index 10 is 0x0103000a.
  */
@@ -87,6 +88,7 @@ psa_storage_uid_t MakeUIDOffset(AccessStorage::Type type, uint16_t index, uint16
 	case AccessStorage::Type::HolidaySchedule:
 		return PackIntegers(type, static_cast<ScheduleIndex>(index));
 	case AccessStorage::Type::HolidayScheduleIndexes:
+	case AccessStorage::Type::Schedules:
 		return PackIntegers(type);
 #endif /* CONFIG_LOCK_SCHEDULES */
 	default:
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace DoorLockData
+{
+
+/*
+   CredentialLookup finds the credential of a single type by its secret data without walking through all credential
+   slots.
+
+   The lookup keeps an open-addressing hash table of credential indexes, keyed by HalfSipHash-2-4 of the secret data.
+   The hash key is random and generated at every initialization, so the position of a credential in the table and the
+   time needed to find it cannot be predicted from the secret. The table stores only a part of the hash, so every
+   candidate found must be confirmed by comparing the secret data with ConstantTimeEqual().
+
+   N is the number of credential slots, which are indexed from 1 like in the door lock server.
+*/
+template <uint16_t N> class CredentialLookup {
+public:
+	static constexpr size_t kKeySize = 8;
+
+	/**
+	 * @brief Remove all credentials from the lookup and set the new hash key.
+	 *
+	 * @param key random hash key
+	 */
+	void Clear(const uint8_t (&key)[kKeySize])
+	{
+		mKey[0] = Load32(key);
+		mKey[1] = Load32(key + 4);
+		memset(mSlots, 0, sizeof(mSlots));
+	}
+
+	/**
+	 * @brief Add the credential to the lookup.
+	 *
+	 * @param credentialIndex credential index starting from 1
+	 * @param data secret data of the credential
+	 * @param size size of the secret data
+	 * @return true on success, false if the credential index is out of range
+	 */
+	bool Insert(uint16_t credentialIndex, const uint8_t *data, size_t size)
+	{
+		if (credentialIndex == 0 || credentialIndex > N) {
+			return false;
+		}
+
+		const uint32_t hash = Hash(data, size);
+		size_t slot = hash & kSlotMask;
+
+		/* The table has at least twice as many slots as credentials, so an empty slot is always found. */
+		while (mSlots[slot].mIndex != 0) {
+			slot = (slot + 1) & kSlotMask;
+		}
+
+		mSlots[slot] = { Tag(hash), credentialIndex };
+		return true;
+	}
+
+	/**
+	 * @brief Remove the credential from the lookup.
+	 *
+	 * @param credentialIndex credential index starting from 1
+	 * @param data secret data with which the credential has been added
+	 * @param size size of the secret data
+	 * @return true on success, false if the credential has not been found
+	 */
+	bool Remove(uint16_t credentialIndex, const uint8_t *data, size_t size)
+	{
+		const uint32_t hash = Hash(data, size);
+		size_t slot = hash & kSlotMask;
+
+		while (mSlots[slot].mIndex != credentialIndex) {
+			if (mSlots[slot].mIndex == 0) {
+				return false;
+			}
+			slot = (slot + 1) & kSlotMask;
+		}
+
+		/* Shift back the following entries of the probe sequence, so that no tombstones are needed. */
+		size_t next = (slot + 1) & kSlotMask;
+
+		while (mSlots[next].mIndex != 0) {
+			const size_t home = mSlots[next].mHash & kSlotMask;
+
+			if (((next - home) & kSlotMask) >= ((next - slot) & kSlotMask)) {
+				mSlots[slot] = mSlots[next];
+				slot = next;
+			}
+			next = (next + 1) & kSlotMask;
+		}
+
+		mSlots[slot] = {};
+		return true;
+	}
+
+	/**
+	 * @brief Find the credential with the given secret data.
+	 *
+	 * @param data secret data to look for
+	 * @param size size of the secret data
+	 * @param matches callable invoked with the index of every candidate credential, that shall return true if the
+	 * secret data of the credential is equal to the data looked for
+	 * @return index of the found credential, or 0 if no credential matches
+	 */
+	template <typename Matches> uint16_t Find(const uint8_t *data, size_t size, Matches &&matches) const
+	{
+		const uint32_t hash = Hash(data, size);
+		const uint16_t tag = Tag(hash);
+
+		for (size_t slot = hash & kSlotMask; mSlots[slot].mIndex != 0; slot = (slot + 1) & kSlotMask) {
+			if (mSlots[slot].mHash == tag && matches(mSlots[slot].mIndex)) {
+				return mSlots[slot].mIndex;
+			}
+		}
+
+		return 0;
+	}
+
+	/**
+	 * @brief Compare the secret data in time that does not depend on the position of the first difference.
+	 */
+	static bool ConstantTimeEqual(const uint8_t *a, size_t aSize, const uint8_t *b, size_t bSize)
+	{
+		const size_t size = aSize < bSize ? aSize : bSize;
+		uint8_t diff = aSize != bSize;
+
+		for (size_t i = 0; i < size; i++) {
+			diff |= a[i] ^ b[i];
+		}
+
+		return diff == 0;
+	}
+
+	/**
+	 * @brief HalfSipHash-2-4 of the data, using the key set by Clear().
+	 */
+	uint32_t Hash(const uint8_t *data, size_t size) const
+	{
+		uint32_t v0 = mKey[0];
+		uint32_t v1 = mKey[1];
+		uint32_t v2 = 0x6c796765 ^ mKey[0];
+		uint32_t v3 = 0x74656462 ^ mKey[1];
+		uint32_t last = static_cast<uint32_t>(size) << 24;
+		const size_t tail = size & 3;
+
+		for (const uint8_t *end = data + size - tail; data != end; data += 4) {
+			const uint32_t word = Load32(data);
+
+			v3 ^= word;
+			SipRound(v0, v1, v2, v3);
+			SipRound(v0, v1, v2, v3);
+			v0 ^= word;
+		}
+
+		for (size_t i = 0; i < tail; i++) {
+			last |= static_cast<uint32_t>(data[i]) << (8 * i);
+		}
+
+		v3 ^= last;
+		SipRound(v0, v1, v2, v3);
+		SipRound(v0, v1, v2, v3);
+		v0 ^= last;
+
+		v2 ^= 0xff;
+		for (size_t i = 0; i < 4; i++) {
+			SipRound(v0, v1, v2, v3);
+		}
+
+		return v1 ^ v3;
+	}
+
+private:
+	static constexpr size_t SlotCount()
+	{
+		size_t count = 1;
+
+		while (count < 2 * static_cast<size_t>(N)) {
+			count <<= 1;
+		}
+
+		return count;
+	}
+
+	static constexpr size_t kSlotCount = SlotCount();
+	static constexpr size_t kSlotMask = kSlotCount - 1;
+
+	static_assert(N > 0, "The lookup must have at least one credential slot");
+	static_assert(kSlotCount <= UINT16_MAX + 1, "The stored part of the hash must select the home slot");
+
+	/*
+	   The entry stores the credential index and the lower half of the hash. It selects the home slot of the entry,
+	   needed to remove credentials, and its remaining bits reject most of the non-matching candidates before their
+	   secret data is compared.
+	*/
+	struct Slot {
+		uint16_t mHash;
+		uint16_t mIndex;
+	};
+
+	static uint16_t Tag(uint32_t hash) { return static_cast<uint16_t>(hash); }
+
+	static uint32_t Load32(const uint8_t *data)
+	{
+		return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+	}
+
+	static uint32_t Rotate(uint32_t value, unsigned bits) { return (value << bits) | (value >> (32 - bits)); }
+
+	static void SipRound(uint32_t &v0, uint32_t &v1, uint32_t &v2, uint32_t &v3)
+	{
+		v0 += v1;
+		v1 = Rotate(v1, 5);
+		v1 ^= v0;
+		v0 = Rotate(v0, 16);
+		v2 += v3;
+		v3 = Rotate(v3, 8);
+		v3 ^= v2;
+		v0 += v3;
+		v3 = Rotate(v3, 7);
+		v3 ^= v0;
+		v2 += v1;
+		v1 = Rotate(v1, 13);
+		v1 ^= v2;
+		v2 = Rotate(v2, 16);
+	}
+
+	uint32_t mKey[2]{};
+	Slot mSlots[kSlotCount]{};
+};
+
+} /* namespace DoorLockData */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace DoorLockData
+{
+
+/*
+   IntervalIndex answers whether a point in time belongs to any of up to N time intervals.
+
+   The intervals are half-open, [start, end), and expressed in any unit of type T, for example minutes of the week or
+   seconds since the epoch. Build() sorts the intervals and merges the overlapping ones, so a single binary search
+   answers Contains() no matter how many schedules the intervals come from.
+*/
+template <typename T, size_t N> class IntervalIndex {
+public:
+	struct Interval {
+		T mStart;
+		T mEnd;
+	};
+
+	/**
+	 * @brief Replace the content of the index with the given intervals.
+	 *
+	 * Empty intervals (start not lower than end) are skipped.
+	 *
+	 * @param intervals intervals to be indexed, modified by sorting
+	 * @param count number of intervals, at most N
+	 */
+	void Build(Interval *intervals, size_t count)
+	{
+		mCount = 0;
+
+		if (count > N) {
+			count = N;
+		}
+
+		/* Insertion sort by the interval start, the number of schedules per user is small. */
+		for (size_t i = 1; i < count; i++) {
+			const Interval current = intervals[i];
+			size_t j = i;
+
+			for (; j > 0 && intervals[j - 1].mStart > current.mStart; j--) {
+				intervals[j] = intervals[j - 1];
+			}
+			intervals[j] = current;
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			const Interval &interval = intervals[i];
+
+			if (interval.mStart >= interval.mEnd) {
+				continue;
+			}
+
+			if (mCount > 0 && interval.mStart <= mIntervals[mCount - 1].mEnd) {
+				if (interval.mEnd > mIntervals[mCount - 1].mEnd) {
+					mIntervals[mCount - 1].mEnd = interval.mEnd;
+				}
+				continue;
+			}
+
+			mIntervals[mCount++] = interval;
+		}
+	}
+
+	void Clear() { mCount = 0; }
+
+	/**
+	 * @brief Check if the point in time belongs to any of the indexed intervals.
+	 */
+	bool Contains(T value) const
+	{
+		size_t low = 0;
+		size_t high = mCount;
+
+		/* Find the first interval that ends after the value. */
+		while (low < high) {
+			const size_t middle = low + (high - low) / 2;
+
+			if (mIntervals[middle].mEnd <= value) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		return low < mCount && mIntervals[low].mStart <= value;
+	}
+
+	bool IsEmpty() const { return mCount == 0; }
+
+	size_t Count() const { return mCount; }
+
+private:
+	Interval mIntervals[N];
+	size_t mCount{ 0 };
+};
+
+/*
+   ScheduleTime converts the local time used by the year day schedules, in seconds since the Matter epoch
+   (January 1, 2000, which was a Saturday), to the minute of the week used by the week day schedules. The week starts
+   on Sunday, like the DaysMaskMap bitmap.
+*/
+struct ScheduleTime {
+	static constexpr uint32_t kMinutesPerDay = 24 * 60;
+	static constexpr uint32_t kMinutesPerWeek = 7 * kMinutesPerDay;
+	static constexpr uint32_t kEpochDayOfWeek = 6;
+
+	static uint16_t MinuteOfWeek(uint32_t localTime)
+	{
+		const uint32_t minutes = localTime / 60;
+		const uint32_t dayOfWeek = (minutes / kMinutesPerDay + kEpochDayOfWeek) % 7;
+
+		return static_cast<uint16_t>(dayOfWeek * kMinutesPerDay + minutes % kMinutesPerDay);
+	}
+
+	static uint16_t MinuteOfWeek(uint8_t dayOfWeek, uint8_t hour, uint8_t minute)
+	{
+		return static_cast<uint16_t>(dayOfWeek * kMinutesPerDay + hour * 60 + minute);
+	}
+};
+
+/*
+   ScheduleRestriction selects the schedules that apply to a user. It follows the user type: a Week Day Schedule User
+   is restricted to the Week Day schedules, a Year Day Schedule User to the Year Day schedules, and a Schedule
+   Restricted User to both of them.
+*/
+enum class ScheduleRestriction : uint8_t { WeekDay, YearDay, Any };
+
+/*
+   UserScheduleIndex keeps the time intervals in which the Week Day and Year Day schedules of a single user allow the
+   access. A Week Day schedule may apply to every day of the week, so it can take up to seven intervals.
+*/
+template <size_t kWeekDaySchedules, size_t kYearDaySchedules> struct UserScheduleIndex {
+	using WeekDayIndex = IntervalIndex<uint16_t, 7 * kWeekDaySchedules>;
+	using YearDayIndex = IntervalIndex<uint32_t, kYearDaySchedules>;
+
+	/**
+	 * @brief Check if the schedules of the user that apply to its restriction allow the access at the given time.
+	 *
+	 * @param restriction schedules that apply to the user
+	 * @param localTime local time in seconds since the Matter epoch, like in the Year Day schedules
+	 */
+	bool IsAllowed(ScheduleRestriction restriction, uint32_t localTime) const
+	{
+		const bool weekDay = restriction != ScheduleRestriction::YearDay &&
+				     mWeekDay.Contains(ScheduleTime::MinuteOfWeek(localTime));
+		const bool yearDay = restriction != ScheduleRestriction::WeekDay && mYearDay.Contains(localTime);
+
+		return weekDay || yearDay;
+	}
+
+	WeekDayIndex mWeekDay;
+	YearDayIndex mYearDay;
+};
+
+} /* namespace DoorLockData */
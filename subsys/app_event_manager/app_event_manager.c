@@ -19,10 +19,24 @@ static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
+/* Queue of high priority events goes first, queue of other events goes last.
+ * All queues are processed by a single work item. Listeners are never called
+ * concurrently, and modules rely on that to share state between the handlers
+ * of different event types without locking.
+ */
+#define EVENT_QUEUE_CNT (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES) ? 2 : 1)
+#define EVENT_QUEUE_HIGH_PRIORITY 0
+
 static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+static sys_slist_t eventq[EVENT_QUEUE_CNT];
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE)
+static K_THREAD_STACK_DEFINE(event_processor_stack,
+			     CONFIG_APP_EVENT_MANAGER_WORKQUEUE_STACK_SIZE);
+static struct k_work_q event_processor_wq;
+#endif
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -114,18 +128,23 @@ static void log_event_init(void)
 	}
 }
 
+static void event_alloc_failed(void)
+{
+	LOG_ERR("Application Event Manager OOM error\n");
+	__ASSERT_NO_MSG(false);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_REBOOT_ON_EVENT_ALLOC_FAIL)) {
+		sys_reboot(SYS_REBOOT_WARM);
+	} else {
+		k_panic();
+	}
+}
+
 void * __weak app_event_manager_alloc(size_t size)
 {
 	void *event = k_malloc(size);
 
 	if (unlikely(!event)) {
-		LOG_ERR("Application Event Manager OOM error\n");
-		__ASSERT_NO_MSG(false);
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_REBOOT_ON_EVENT_ALLOC_FAIL)) {
-			sys_reboot(SYS_REBOOT_WARM);
-		} else {
-			k_panic();
-		}
+		event_alloc_failed();
 		return NULL;
 	}
 
@@ -134,74 +153,197 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS) &&
+	    app_event_manager_slab_free(addr)) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_FREE_HOOKS) &&
+	    app_event_manager_free_hooks_call(addr)) {
+		return;
+	}
+
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+bool app_event_manager_free_hooks_call(void *addr)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_FREE_HOOKS)) {
+		STRUCT_SECTION_FOREACH(app_event_manager_free_hook, h) {
+			if (h->hook(addr)) {
+				return true;
+			}
+		}
+	}
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	return false;
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+static bool slab_owns(const struct k_mem_slab *mem_slab, const void *addr)
+{
+	const char *block = addr;
+
+	return (block >= mem_slab->buffer) &&
+	       (block < mem_slab->buffer +
+			(size_t)mem_slab->info.num_blocks * mem_slab->info.block_size);
+}
+
+void *app_event_manager_slab_alloc(const struct event_type *et, size_t size)
+{
+	struct app_event_slab *slab = et->slab;
+	void *event;
+
+	if ((size <= slab->mem_slab->info.block_size) &&
+	    !k_mem_slab_alloc(slab->mem_slab, &event, K_NO_WAIT)) {
+		return event;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	atomic_inc(&slab->fallback_cnt);
 
-	k_spin_unlock(&lock, key);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_FALLBACK)) {
+		return app_event_manager_alloc(size);
+	}
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+	LOG_ERR("No %s slab block for %zu bytes", et->name, size);
+	event_alloc_failed();
+	return NULL;
+}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+bool app_event_manager_slab_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+	const struct event_type *et = aeh->type_id;
 
-		const struct event_type *et = aeh->type_id;
+	/* The event type is set right after the allocation, so it points to the slab
+	 * of the event. Memory allocated in other ways may hold any value there, so the
+	 * pointer is validated before it is used.
+	 */
+	if ((et < _event_type_list_start) || (et >= _event_type_list_end) ||
+	    !slab_owns(et->slab->mem_slab, addr)) {
+		return false;
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	k_mem_slab_free(et->slab->mem_slab, addr);
+
+	return true;
+}
+
+void app_event_manager_slab_stats_get(const struct event_type *et,
+				      struct app_event_manager_slab_stats *stats)
+{
+	struct k_mem_slab *mem_slab = et->slab->mem_slab;
+
+	stats->block_size = mem_slab->info.block_size;
+	stats->num_blocks = mem_slab->info.num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(mem_slab);
+	stats->max_used = k_mem_slab_max_used_get(mem_slab);
+	stats->fallback_cnt = atomic_get(&et->slab->fallback_cnt);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLABS */
+
+static size_t event_queue_idx(const struct event_type *et)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES) &&
+	    app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY)) {
+		return EVENT_QUEUE_HIGH_PRIORITY;
+	}
+
+	return EVENT_QUEUE_CNT - 1;
+}
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
 
-		log_event(aeh);
+	log_event(aeh);
 
-		bool consumed = false;
+	bool consumed = false;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
 
-			__ASSERT_NO_MSG(es != NULL);
+		__ASSERT_NO_MSG(es != NULL);
 
-			const struct event_listener *el = es->listener;
+		const struct event_listener *el = es->listener;
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
 
-			log_event_progress(et, el);
+		log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+		consumed = el->notification(aeh);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+		if (consumed) {
+			log_event_consumed(et);
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
 		}
-
-		app_event_manager_free(aeh);
 	}
+
+	app_event_manager_free(aeh);
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	bool preempted;
+
+	do {
+		size_t queue_idx = 0;
+
+		/* Make current event list of the highest priority local. */
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		while ((queue_idx < ARRAY_SIZE(eventq)) && sys_slist_is_empty(&eventq[queue_idx])) {
+			queue_idx++;
+		}
+
+		if (queue_idx == ARRAY_SIZE(eventq)) {
+			k_spin_unlock(&lock, key);
+			return;
+		}
+
+		sys_slist_merge_slist(&events, &eventq[queue_idx]);
+
+		k_spin_unlock(&lock, key);
+
+		preempted = false;
+
+		/* Traverse the list of events. */
+		sys_snode_t *node;
+		while (NULL != (node = sys_slist_get(&events))) {
+			event_process(CONTAINER_OF(node, struct app_event_header, node));
+
+			if ((queue_idx != EVENT_QUEUE_HIGH_PRIORITY) &&
+			    !sys_slist_is_empty(&eventq[EVENT_QUEUE_HIGH_PRIORITY])) {
+				/* Return the remaining events to the front of their queue
+				 * and process the high priority events first.
+				 */
+				key = k_spin_lock(&lock);
+				sys_slist_merge_slist(&events, &eventq[queue_idx]);
+				eventq[queue_idx] = events;
+				sys_slist_init(&events);
+				k_spin_unlock(&lock, key);
+
+				preempted = true;
+				break;
+			}
+		}
+	} while (preempted);
 }
 
 void _event_submit(struct app_event_header *aeh)
@@ -211,15 +353,22 @@ void _event_submit(struct app_event_header *aeh)
 
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	aeh->submit_time = k_cycle_get_32();
+#endif
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
 		STRUCT_SECTION_FOREACH(event_submit_hook, h) {
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(&eventq[event_queue_idx(aeh->type_id)], &aeh->node);
 	k_spin_unlock(&lock, key);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE)
+	k_work_submit_to_queue(&event_processor_wq, &event_processor);
+#else
 	k_work_submit(&event_processor);
+#endif
 }
 
 int app_event_manager_init(void)
@@ -231,6 +380,16 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_WORKQUEUE)
+	k_work_queue_start(&event_processor_wq, event_processor_stack,
+			   K_THREAD_STACK_SIZEOF(event_processor_stack),
+			   CONFIG_APP_EVENT_MANAGER_WORKQUEUE_PRIORITY, NULL);
+	k_thread_name_set(&event_processor_wq.thread, "app_event_manager");
+
+	/* Process events submitted before the workqueue was started. */
+	k_work_submit_to_queue(&event_processor_wq, &event_processor);
+#endif
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
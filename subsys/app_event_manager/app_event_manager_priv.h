@@ -119,6 +119,14 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Allocate memory for the event of the given ename type. */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_slab_alloc(_EVENT_ID(ename), (size))
+#else
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +135,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -145,7 +153,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event) + size);	\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -219,6 +227,41 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+#define _APP_EVENT_SLAB_DEFAULT_BLOCK_CNT CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT
+#define _APP_EVENT_SLAB_DEFAULT_DYNDATA_SIZE CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE
+
+/* Size of the slab block that holds the event with the dynamic data of the given size. */
+#define _APP_EVENT_SLAB_BLOCK_SIZE(ename, dyndata_size)					\
+	ROUND_UP(sizeof(struct ename) + ((_CONCAT(ename, _HAS_DYNDATA)) ?		\
+		 (dyndata_size) : 0),							\
+		 __alignof__(struct ename))
+
+/* The slab name is pasted by K_MEM_SLAB_DEFINE_STATIC, so it must be expanded earlier. */
+#define _APP_EVENT_MEM_SLAB_DEFINE(slab_name, ename, block_cnt, dyndata_size)		\
+	K_MEM_SLAB_DEFINE_STATIC(slab_name,						\
+				 _APP_EVENT_SLAB_BLOCK_SIZE(ename, dyndata_size),	\
+				 block_cnt,						\
+				 __alignof__(struct ename))
+
+#define _APP_EVENT_TYPE_DEFINE_SLAB(ename, block_cnt, dyndata_size)			\
+	BUILD_ASSERT((block_cnt) > 0, "Event slab must have at least one block");	\
+	_APP_EVENT_MEM_SLAB_DEFINE(_CONCAT(__event_mem_slab_, ename), ename,		\
+				   block_cnt, dyndata_size);				\
+	static struct app_event_slab _CONCAT(__event_slab_, ename) = {			\
+		.mem_slab = &_CONCAT(__event_mem_slab_, ename),				\
+	};
+
+#define _APP_EVENT_TYPE_DEFINE_SLAB_PTR(ename)          \
+	.slab = &_CONCAT(__event_slab_, ename),
+#else
+#define _APP_EVENT_SLAB_DEFAULT_BLOCK_CNT 0
+#define _APP_EVENT_SLAB_DEFAULT_DYNDATA_SIZE 0
+
+#define _APP_EVENT_TYPE_DEFINE_SLAB(ename, block_cnt, dyndata_size)
+#define _APP_EVENT_TYPE_DEFINE_SLAB_PTR(ename)
+#endif
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
@@ -230,6 +273,23 @@ struct app_event_header {
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	/** Time of the event submission (in hardware cycles). */
+	uint32_t submit_time;
+#endif
+};
+
+/** @brief Memory slab of the event type.
+ *
+ * Used only if CONFIG_APP_EVENT_MANAGER_EVENT_SLABS is enabled.
+ */
+struct app_event_slab {
+	/** Memory slab with blocks of the event type size. */
+	struct k_mem_slab *mem_slab;
+
+	/** Number of allocations that could not be served by the memory slab. */
+	atomic_t fallback_cnt;
 };
 
 /** Function to log data from this event. */
@@ -292,6 +352,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+	/** Memory slab used to allocate events of this type. */
+	struct app_event_slab *slab;
+#endif
 };
 
 
@@ -300,10 +365,19 @@ extern struct event_type _event_type_list_end[];
 
 
 #define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+	_APP_EVENT_TYPE_SLAB_DEFINE(ename, log_fn, trace_data_pointer, et_flags,		\
+				    _APP_EVENT_SLAB_DEFAULT_BLOCK_CNT,			\
+				    _APP_EVENT_SLAB_DEFAULT_DYNDATA_SIZE)
+
+
+#define _APP_EVENT_TYPE_SLAB_DEFINE(ename, log_fn, trace_data_pointer, et_flags,		\
+				    slab_block_cnt, slab_dyndata_size)			\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
+	_APP_EVENT_TYPE_DEFINE_SLAB(ename, slab_block_cnt, slab_dyndata_size)		\
+		/* No semicolon here intentionally */					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
 		.subs_start      = _APP_EVENT_SUBSCRIBERS_START_TAG(ename),		\
@@ -315,6 +389,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_SLAB_PTR(ename) /* No comma here intentionally */\
 	}
 
 /**
@@ -339,6 +414,11 @@ extern struct app_event_manager_event_display_bm _app_event_manager_event_displa
 		     "Enable APP_EVENT_MANAGER_POSTINIT_HOOK before usage"); \
 	_APP_EVENT_HOOK_REGISTER(app_event_manager_postinit_hook, hook_fn, prio)
 
+#define _APP_EVENT_MANAGER_HOOK_FREE_REGISTER(hook_fn, prio)                \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_FREE_HOOKS),       \
+		     "Enable APP_EVENT_MANAGER_FREE_HOOKS before usage");   \
+	_APP_EVENT_HOOK_REGISTER(app_event_manager_free_hook, hook_fn, prio)
+
 #define _APP_EVENT_HOOK_ON_SUBMIT_REGISTER(hook_fn, prio)                   \
 	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS),     \
 		     "Enable APP_EVENT_MANAGER_SUBMIT_HOOKS before usage"); \
@@ -404,6 +484,14 @@ struct app_event_manager_postinit_hook {
 	/** @brief Hook function */
 	int (*hook)(void);
 };
+
+/** @brief Structure used to register event free hook
+ */
+struct app_event_manager_free_hook {
+	/** @brief Hook function */
+	bool (*hook)(void *addr);
+};
+
 /** @brief Structure used to register event submit hook
  */
 struct event_submit_hook {
@@ -81,6 +81,27 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+static int show_slabs(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event Slabs:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_slab_stats stats;
+
+		app_event_manager_slab_stats_get(et, &stats);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] block %zu B, used %u/%u, max used %u, fallback %u\n",
+			      et->name, stats.block_size, stats.num_used, stats.num_blocks,
+			      stats.max_used, stats.fallback_cnt);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLABS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +176,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+	SHELL_CMD_ARG(show_slabs, NULL, "Show event slab usage", show_slabs, 0, 0),
+#endif
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
@@ -10,7 +10,7 @@
 
 LOG_MODULE_REGISTER(app_event_manager_profiler_tracer, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
-#define IDS_COUNT (CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT + 2)
+#define IDS_COUNT (CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT + 3)
 
 extern struct nrf_profiler_info _nrf_profiler_info_list_start[];
 extern struct nrf_profiler_info _nrf_profiler_info_list_end[];
@@ -45,8 +45,36 @@ static void app_event_manager_trace_event_execution(const struct app_event_heade
 	nrf_profiler_log_send(&buf, trace_evt_id);
 }
 
+/** @brief Trace time between event submission and the start of its processing.
+ *
+ * @param aeh Pointer to the application event header of the event that is
+ *            processed by app_event_manager.
+ **/
+static void app_event_manager_trace_dispatch_latency(const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_DISPATCH_LATENCY)
+	size_t event_cnt = _nrf_profiler_info_list_end - _nrf_profiler_info_list_start;
+	size_t trace_evt_id = nrf_profiler_event_ids[event_cnt + 2];
+	uint32_t latency = k_cycle_get_32() - aeh->submit_time;
+
+	if (!aeh->type_id->trace_data || !is_profiling_enabled(trace_evt_id)) {
+		return;
+	}
+
+	struct log_event_buf buf;
+
+	ARG_UNUSED(buf);
+
+	nrf_profiler_log_start(&buf);
+	nrf_profiler_log_encode_string(&buf, aeh->type_id->name);
+	nrf_profiler_log_encode_uint32(&buf, k_cyc_to_us_floor32(latency));
+	nrf_profiler_log_send(&buf, trace_evt_id);
+#endif
+}
+
 static void app_event_manager_trace_event_preprocess(const struct app_event_header *aeh)
 {
+	app_event_manager_trace_dispatch_latency(aeh);
 	app_event_manager_trace_event_execution(aeh, true);
 }
 
@@ -120,6 +148,21 @@ static void trace_register_execution_tracking_events(void)
 	nrf_profiler_event_ids[event_cnt + 1] = nrf_profiler_event_id;
 }
 
+static void trace_register_dispatch_latency_event(void)
+{
+	static const char * const labels[] = {"event", "latency_us"};
+	enum nrf_profiler_arg types[] = {NRF_PROFILER_ARG_STRING, NRF_PROFILER_ARG_U32};
+	size_t event_cnt = _nrf_profiler_info_list_end - _nrf_profiler_info_list_start;
+
+	ARG_UNUSED(types);
+	ARG_UNUSED(labels);
+
+	/* Dispatch latency event after event execution start and end events. */
+	nrf_profiler_event_ids[event_cnt + 2] = nrf_profiler_register_event_type(
+				"event_dispatch_latency",
+				labels, types, ARRAY_SIZE(types));
+}
+
 static void trace_register_events(void)
 {
 	STRUCT_SECTION_FOREACH(nrf_profiler_info, pi) {
@@ -137,6 +180,10 @@ static void trace_register_events(void)
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_EVENT_EXECUTION)) {
 		trace_register_execution_tracking_events();
 	}
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_DISPATCH_LATENCY)) {
+		trace_register_dispatch_latency_event();
+	}
 }
 
 /** @brief Initialize tracing in the Application Event Manager.
@@ -148,10 +195,12 @@ static int app_event_manager_trace_event_init(void)
 {
 	/* Every profiled Application Event Manager event registers a single nrf_profiler event.
 	 * Apart from that 2 additional nrf_profiler events are used to indicate processing
-	 * start and end of an Application Event Manager event.
+	 * start and end of an Application Event Manager event, and 1 to report the dispatch
+	 * latency.
 	 */
-	__ASSERT_NO_MSG(_nrf_profiler_info_list_end - _nrf_profiler_info_list_start + 2 <=
-			CONFIG_NRF_PROFILER_MAX_NUMBER_OF_APP_EVENTS);
+	__ASSERT_NO_MSG(_nrf_profiler_info_list_end - _nrf_profiler_info_list_start + 2 +
+		IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_DISPATCH_LATENCY) <=
+		CONFIG_NRF_PROFILER_MAX_NUMBER_OF_APP_EVENTS);
 
 	if (nrf_profiler_init()) {
 		LOG_ERR("System nrf_profiler: initialization problem\n");
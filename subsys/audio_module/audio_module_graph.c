@@ -0,0 +1,511 @@
+/*
+ * Copyright(c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "audio_module/audio_module_graph.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <data_fifo.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(audio_module, CONFIG_AUDIO_MODULE_LOG_LEVEL);
+
+/* Define a timeout to prevent system locking */
+#define LOCK_TIMEOUT_US (K_USEC(100))
+
+/* Offset of the data area from the start of a buffer. */
+#define BUFFER_DATA_OFFSET (WB_UP(sizeof(struct audio_module_buffer)))
+
+/**
+ * @brief Helper function to get the buffer that holds the given data area.
+ *
+ * @param data  [in]  Pointer to the data area of a buffer.
+ *
+ * @return Pointer to the buffer.
+ */
+static struct audio_module_buffer *buffer_from_data(void *data)
+{
+	return (struct audio_module_buffer *)((uint8_t *)data - BUFFER_DATA_OFFSET);
+}
+
+/**
+ * @brief Helper function to find a module in a graph.
+ *
+ * @param graph   [in]  Pointer to the graph.
+ * @param handle  [in]  The handle to the module instance.
+ *
+ * @return Index of the module's node, or -1 if the module is not in the graph.
+ */
+static int node_find(struct audio_module_graph const *const graph,
+		     struct audio_module_handle const *const handle)
+{
+	for (int i = 0; i < graph->nodes_num; i++) {
+		if (graph->nodes[i].handle == handle) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief Callback for releasing the audio data that a graph has put on a module's TX FIFO.
+ *
+ * @param handle      [in/out]  The handle of the module that sent the audio data.
+ * @param audio_data  [in]      Pointer to the audio data to release.
+ */
+static void tx_fifo_release_cb(struct audio_module_handle_private *handle,
+			       struct audio_data const *const audio_data)
+{
+	ARG_UNUSED(handle);
+
+	audio_module_buffer_unref(buffer_from_data(audio_data->data));
+}
+
+/**
+ * @brief Put a module's output buffer on the module's TX FIFO, without copying the audio data.
+ *
+ * @param handle  [in/out]  The handle for the module instance.
+ * @param buffer  [in/out]  Pointer to the module's output buffer.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int tx_fifo_put(struct audio_module_handle *handle, struct audio_module_buffer *buffer)
+{
+	int ret;
+	struct audio_module_message *data_msg_tx;
+
+	ret = data_fifo_pointer_first_vacant_get(handle->thread.msg_tx, (void **)&data_msg_tx,
+						 K_NO_WAIT);
+	if (ret) {
+		LOG_WRN("No free space in TX FIFO for module %s, ret %d", handle->name, ret);
+		return ret;
+	}
+
+	memcpy(&data_msg_tx->audio_data, &buffer->audio_data, sizeof(struct audio_data));
+	data_msg_tx->tx_handle = handle;
+	data_msg_tx->response_cb = tx_fifo_release_cb;
+
+	/* The reader of the TX FIFO releases the buffer through the callback. */
+	audio_module_buffer_ref(buffer);
+
+	ret = data_fifo_block_lock(handle->thread.msg_tx, (void **)&data_msg_tx,
+				   sizeof(struct audio_module_message));
+	if (ret) {
+		LOG_ERR("Failed to send audio data to output of module %s, ret %d", handle->name,
+			ret);
+
+		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
+		audio_module_buffer_unref(buffer);
+
+		return ret;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Run the module of a node on the given input audio data.
+ *
+ * @note On success, the node's buffer is set to the module's output if other nodes read it.
+ *
+ * @param graph          [in/out]  Pointer to the graph.
+ * @param node           [in/out]  Pointer to the node to run.
+ * @param audio_data_rx  [in]      Pointer to the input audio data, or NULL for an input module.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int node_run(struct audio_module_graph *graph, struct audio_module_graph_node *node,
+		    struct audio_data const *const audio_data_rx)
+{
+	int ret;
+	struct audio_module_handle *handle = node->handle;
+	struct audio_module_buffer *buffer = NULL;
+	struct audio_data *audio_data_tx = NULL;
+	uint32_t start;
+	uint32_t cycles;
+
+	if (handle->description->type != AUDIO_MODULE_TYPE_OUTPUT) {
+		ret = audio_module_buffer_alloc(graph->pool, &buffer, K_NO_WAIT);
+		if (ret) {
+			LOG_ERR("No free data buffer for module %s, ret %d", handle->name, ret);
+			return ret;
+		}
+
+		if (handle->thread.data_size != 0) {
+			buffer->audio_data.data_size = handle->thread.data_size;
+		}
+
+		audio_data_tx = &buffer->audio_data;
+	}
+
+	start = k_cycle_get_32();
+
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, audio_data_rx, audio_data_tx);
+
+	cycles = k_cycle_get_32() - start;
+
+	node->frames++;
+	node->cycles_total += cycles;
+	node->cycles_max = MAX(node->cycles_max, cycles);
+	node->cycles_last = cycles;
+
+	if (ret) {
+		LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+
+		if (buffer != NULL) {
+			audio_module_buffer_unref(buffer);
+		}
+
+		return ret;
+	}
+
+	if (buffer == NULL) {
+		return 0;
+	}
+
+	if (handle->use_tx_queue && handle->thread.msg_tx != NULL) {
+		ret = tx_fifo_put(handle, buffer);
+	}
+
+	/* Each node that reads the output releases it after it has run. */
+	if (node->sinks_num != 0) {
+		atomic_add(&buffer->ref_count, node->sinks_num);
+		node->buffer = buffer;
+	}
+
+	audio_module_buffer_unref(buffer);
+
+	return ret;
+}
+
+int audio_module_buffer_pool_init(struct audio_module_buffer_pool *pool)
+{
+	int ret;
+
+	if (pool == NULL || pool->buffer == NULL || pool->buffers_num == 0) {
+		LOG_ERR("Invalid buffer pool");
+		return -EINVAL;
+	}
+
+	ret = k_mem_slab_init(&pool->slab, pool->buffer,
+			      AUDIO_MODULE_BUFFER_BLOCK_SIZE(pool->data_size), pool->buffers_num);
+	if (ret) {
+		LOG_ERR("Buffer pool slab init failed, ret %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int audio_module_buffer_alloc(struct audio_module_buffer_pool *pool,
+			      struct audio_module_buffer **buffer, k_timeout_t timeout)
+{
+	int ret;
+	struct audio_module_buffer *buf;
+
+	if (pool == NULL || buffer == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	ret = k_mem_slab_alloc(&pool->slab, (void **)&buf, timeout);
+	if (ret) {
+		return ret;
+	}
+
+	memset(&buf->audio_data, 0, sizeof(struct audio_data));
+	buf->audio_data.data = (uint8_t *)buf + BUFFER_DATA_OFFSET;
+	buf->audio_data.data_size = pool->data_size;
+	buf->pool = pool;
+	atomic_set(&buf->ref_count, 1);
+
+	*buffer = buf;
+
+	return 0;
+}
+
+void audio_module_buffer_ref(struct audio_module_buffer *buffer)
+{
+	__ASSERT_NO_MSG(buffer != NULL);
+	__ASSERT(atomic_get(&buffer->ref_count) > 0, "Buffer has already been released");
+
+	atomic_inc(&buffer->ref_count);
+}
+
+void audio_module_buffer_unref(struct audio_module_buffer *buffer)
+{
+	__ASSERT_NO_MSG(buffer != NULL);
+	__ASSERT(atomic_get(&buffer->ref_count) > 0, "Buffer has already been released");
+
+	if (atomic_dec(&buffer->ref_count) == 1) {
+		k_mem_slab_free(&buffer->pool->slab, (void *)buffer);
+	}
+}
+
+int audio_module_graph_init(struct audio_module_graph *graph,
+			    struct audio_module_buffer_pool *pool)
+{
+	if (graph == NULL || pool == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	memset(graph, 0, sizeof(struct audio_module_graph));
+	graph->pool = pool;
+
+	return 0;
+}
+
+int audio_module_graph_add(struct audio_module_graph *graph, struct audio_module_handle *handle)
+{
+	struct audio_module_graph_node *node;
+
+	if (graph == NULL || handle == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	if (handle->state != AUDIO_MODULE_STATE_CONFIGURED &&
+	    handle->state != AUDIO_MODULE_STATE_STOPPED) {
+		LOG_ERR("Module %s in an invalid state, %d, for adding to a graph", handle->name,
+			handle->state);
+		return -ECANCELED;
+	}
+
+	if (node_find(graph, handle) >= 0) {
+		LOG_WRN("Module %s is already in the graph", handle->name);
+		return -EALREADY;
+	}
+
+	if (graph->nodes_num == CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX) {
+		LOG_ERR("No room for module %s in the graph", handle->name);
+		return -ENOMEM;
+	}
+
+	if (handle->thread.data_size > graph->pool->data_size) {
+		LOG_ERR("Data size of module %s, %zu, is larger than the graph buffers, %zu",
+			handle->name, handle->thread.data_size, graph->pool->data_size);
+		return -EINVAL;
+	}
+
+	node = &graph->nodes[graph->nodes_num];
+	memset(node, 0, sizeof(struct audio_module_graph_node));
+	node->handle = handle;
+	node->source = -1;
+
+	graph->nodes_num++;
+	graph->built = false;
+
+	/* The graph runs the module, so the module's own thread must not. */
+	k_thread_suspend(handle->thread_id);
+
+	LOG_DBG("Added module %s to the graph", handle->name);
+
+	return 0;
+}
+
+int audio_module_graph_remove(struct audio_module_graph *graph,
+			      struct audio_module_handle *handle)
+{
+	int idx;
+
+	if (graph == NULL || handle == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	idx = node_find(graph, handle);
+	if (idx < 0) {
+		LOG_WRN("Module %s is not in the graph", handle->name);
+		return -EALREADY;
+	}
+
+	memmove(&graph->nodes[idx], &graph->nodes[idx + 1],
+		(graph->nodes_num - idx - 1) * sizeof(struct audio_module_graph_node));
+
+	graph->nodes_num--;
+	graph->built = false;
+
+	k_thread_resume(handle->thread_id);
+
+	LOG_DBG("Removed module %s from the graph", handle->name);
+
+	return 0;
+}
+
+int audio_module_graph_build(struct audio_module_graph *graph)
+{
+	int ret;
+	uint8_t order_num = 0;
+	bool placed[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX] = {false};
+	bool progress = true;
+	struct audio_module_handle *handle_to;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	graph->built = false;
+
+	for (int i = 0; i < graph->nodes_num; i++) {
+		graph->nodes[i].source = -1;
+		graph->nodes[i].sinks_num = 0;
+		graph->nodes[i].buffer = NULL;
+	}
+
+	/* Find the module each module receives audio data from. */
+	for (int i = 0; i < graph->nodes_num; i++) {
+		struct audio_module_handle *handle = graph->nodes[i].handle;
+
+		ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+		if (ret) {
+			LOG_ERR("Failed to take MUTEX lock in time");
+			return ret;
+		}
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+			int idx = node_find(graph, handle_to);
+
+			if (idx < 0) {
+				continue;
+			}
+
+			if (graph->nodes[idx].source >= 0) {
+				LOG_ERR("Module %s receives audio data from more than one module",
+					handle_to->name);
+				k_mutex_unlock(&handle->dest_mutex);
+				return -ENOTSUP;
+			}
+
+			graph->nodes[idx].source = i;
+			graph->nodes[i].sinks_num++;
+		}
+
+		k_mutex_unlock(&handle->dest_mutex);
+	}
+
+	/* Topological order: a module runs after the module it receives audio data from. The
+	 * modules are otherwise kept in the order they were added.
+	 */
+	while (order_num < graph->nodes_num && progress) {
+		progress = false;
+
+		for (int i = 0; i < graph->nodes_num; i++) {
+			int16_t source = graph->nodes[i].source;
+
+			if (!placed[i] && (source < 0 || placed[source])) {
+				graph->order[order_num++] = i;
+				placed[i] = true;
+				progress = true;
+			}
+		}
+	}
+
+	if (order_num != graph->nodes_num) {
+		LOG_ERR("The module connections in the graph form a loop");
+		return -EINVAL;
+	}
+
+	graph->built = true;
+
+	return 0;
+}
+
+int audio_module_graph_process(struct audio_module_graph *graph,
+			       struct audio_data const *const audio_data_in)
+{
+	int ret = 0;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph is NULL");
+		return -EINVAL;
+	}
+
+	if (!graph->built) {
+		LOG_ERR("The graph has not been built");
+		return -ECANCELED;
+	}
+
+	for (int i = 0; i < graph->nodes_num; i++) {
+		struct audio_module_graph_node *node = &graph->nodes[graph->order[i]];
+		struct audio_module_buffer *source_buffer = NULL;
+		struct audio_data const *audio_data_rx = NULL;
+		bool skip = (node->handle->state != AUDIO_MODULE_STATE_RUNNING);
+
+		node->buffer = NULL;
+
+		if (node->source >= 0) {
+			source_buffer = graph->nodes[node->source].buffer;
+			if (source_buffer == NULL) {
+				/* The module before this one was skipped or failed. */
+				continue;
+			}
+
+			audio_data_rx = &source_buffer->audio_data;
+		} else if (node->handle->description->type != AUDIO_MODULE_TYPE_INPUT) {
+			audio_data_rx = audio_data_in;
+			skip = skip || (audio_data_in == NULL);
+		}
+
+		if (!skip) {
+			int err = node_run(graph, node, audio_data_rx);
+
+			if (err && !ret) {
+				ret = err;
+			}
+		}
+
+		if (source_buffer != NULL) {
+			audio_module_buffer_unref(source_buffer);
+		}
+	}
+
+	return ret;
+}
+
+int audio_module_graph_stats_get(struct audio_module_graph const *const graph,
+				 struct audio_module_handle const *const handle,
+				 struct audio_module_graph_stats *stats)
+{
+	int idx;
+	struct audio_module_graph_node const *node;
+
+	if (graph == NULL || handle == NULL || stats == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	idx = node_find(graph, handle);
+	if (idx < 0) {
+		LOG_WRN("Module %s is not in the graph", handle->name);
+		return -ENOENT;
+	}
+
+	node = &graph->nodes[idx];
+
+	stats->frames = node->frames;
+	stats->total_ns = k_cyc_to_ns_floor64(node->cycles_total);
+	stats->max_ns = (uint32_t)k_cyc_to_ns_floor64(node->cycles_max);
+	stats->last_ns = (uint32_t)k_cyc_to_ns_floor64(node->cycles_last);
+
+	return 0;
+}
+
+void audio_module_graph_stats_reset(struct audio_module_graph *graph)
+{
+	__ASSERT_NO_MSG(graph != NULL);
+
+	for (int i = 0; i < graph->nodes_num; i++) {
+		graph->nodes[i].frames = 0;
+		graph->nodes[i].cycles_total = 0;
+		graph->nodes[i].cycles_max = 0;
+		graph->nodes[i].cycles_last = 0;
+	}
+}
@@ -26,6 +26,13 @@ static struct event_type *_emp_event_type_pointer_size_check
 extern struct event_type *event_manager_proxy_array[];
 extern struct event_type *_event_manager_proxy_array_list_end[];
 
+/* Hash table used to find event types by name, twice as big as the event type array. */
+extern struct event_type *event_manager_proxy_event_hash[];
+extern struct event_type *_event_manager_proxy_event_hash_end[];
+
+/* Alignment of the events in the batched messages. */
+#define EMP_FRAME_ALIGN sizeof(uint64_t)
+
 
 /** @brief Command codes used by the proxy. */
 enum emp_cmd_code {
@@ -51,6 +58,13 @@ struct emp_cmd_subscribe {
 	char name[];
 };
 
+/**
+ * @brief The header preceding every event in a batched message.
+ */
+struct emp_frame_hdr {
+	uint32_t len;
+} __aligned(EMP_FRAME_ALIGN);
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -59,6 +73,22 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX)
+	bool rx_hold_unsupported;
+#endif
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	struct k_mutex batch_lock;
+	size_t batch_len;
+	uint64_t batch_buf[DIV_ROUND_UP(CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE, sizeof(uint64_t))];
+#endif
+};
+
+/** @brief Received IPC buffer holding events that are processed in place. */
+struct emp_rx_buf {
+	struct emp_ipc_data *ipc;
+	const uint8_t *data;
+	size_t len;
+	size_t event_cnt;
 };
 
 
@@ -71,6 +101,22 @@ static K_EVENT_DEFINE(emp_all_remotes_started);
 /** @brief IPC communication data. One entry per connected core. */
 static struct emp_ipc_data emp_ipc_data[CONFIG_EVENT_MANAGER_PROXY_CH_COUNT];
 
+/** @brief True if the event type hash table was filled. */
+static bool emp_event_hash_ready;
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX)
+/** @brief Received buffers held until all their events are processed. */
+static struct emp_rx_buf emp_rx_bufs[CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX_BUF_CNT];
+static struct k_spinlock emp_rx_bufs_lock;
+#endif
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+static void batch_flush_work_fn(struct k_work *work);
+
+/** @brief Work sending the events batched during event processing. */
+static K_WORK_DEFINE(emp_batch_flush_work, batch_flush_work_fn);
+#endif
+
 
 /**
  * @brief Find IPC structure by the given instance.
@@ -92,6 +138,53 @@ static struct emp_ipc_data *find_ipc_by_instance(const struct device *instance)
 	return NULL;
 }
 
+/**
+ * @brief Calculate the hash of the event name.
+ *
+ * The FNV-1a hash function is used.
+ *
+ * @param name The name of the event.
+ *
+ * @return The hash value.
+ */
+static uint32_t event_name_hash(const char *name)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*name != '\0') {
+		hash ^= (uint8_t)*name++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/**
+ * @brief Fill the event type hash table.
+ *
+ * The space for the table is reserved by the linker. The table has twice as many slots as
+ * there are event types, so there is always a free slot that ends the linear probing.
+ */
+static void event_hash_init(void)
+{
+	size_t slot_cnt = _event_manager_proxy_event_hash_end - event_manager_proxy_event_hash;
+
+	__ASSERT_NO_MSG(slot_cnt == 2 * (_event_type_list_end - _event_type_list_start));
+	memset(event_manager_proxy_event_hash, 0, slot_cnt * sizeof(event_manager_proxy_event_hash[0]));
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		size_t idx = event_name_hash(et->name) % slot_cnt;
+
+		while (event_manager_proxy_event_hash[idx]) {
+			idx = (idx + 1) % slot_cnt;
+		}
+
+		event_manager_proxy_event_hash[idx] = et;
+	}
+
+	emp_event_hash_ready = true;
+}
+
 /**
  * @brief Find event type by name.
  *
@@ -102,7 +195,19 @@ static struct emp_ipc_data *find_ipc_by_instance(const struct device *instance)
  */
 static struct event_type *find_event_by_name(const char *name)
 {
-	STRUCT_SECTION_FOREACH(event_type, et) {
+	size_t slot_cnt = _event_manager_proxy_event_hash_end - event_manager_proxy_event_hash;
+
+	__ASSERT_NO_MSG(emp_event_hash_ready);
+
+	if (slot_cnt == 0) {
+		return NULL;
+	}
+
+	for (size_t idx = event_name_hash(name) % slot_cnt;
+	     event_manager_proxy_event_hash[idx];
+	     idx = (idx + 1) % slot_cnt) {
+		struct event_type *et = event_manager_proxy_event_hash[idx];
+
 		if (!strcmp(et->name, name)) {
 			return et;
 		}
@@ -151,12 +256,202 @@ static void handle_ipc_endpoint_bound(void *priv)
 	k_event_set(&ipc->bound, 0x1);
 }
 
-static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size_t len)
+/**
+ * @brief Get the size of the batched message frame.
+ *
+ * @param len The size of the event in the frame.
+ *
+ * @return The frame size, including the padding of the event.
+ */
+static size_t frame_size(size_t len)
 {
-	void *event = app_event_manager_alloc(len);
+	return sizeof(struct emp_frame_hdr) + ROUND_UP(len, EMP_FRAME_ALIGN);
+}
 
-	memcpy(event, data, len);
-	_event_submit(event);
+/**
+ * @brief Count the events in the batched message.
+ *
+ * @param data The pointer to the data received.
+ * @param len  The length of the data received.
+ *
+ * @return The number of events or 0 if the message is malformed.
+ */
+static size_t frame_count(const uint8_t *data, size_t len)
+{
+	size_t cnt = 0;
+
+	while (len >= sizeof(struct emp_frame_hdr)) {
+		const struct emp_frame_hdr *hdr = (const struct emp_frame_hdr *)data;
+
+		if ((hdr->len < sizeof(struct app_event_header)) || (hdr->len > len) ||
+		    (frame_size(hdr->len) > len)) {
+			return 0;
+		}
+
+		data += frame_size(hdr->len);
+		len -= frame_size(hdr->len);
+		cnt++;
+	}
+
+	return (len == 0) ? cnt : 0;
+}
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX)
+/**
+ * @brief Hold the received buffer to process the events in place.
+ *
+ * @param ipc       The IPC the buffer was received on.
+ * @param data      The pointer to the data received.
+ * @param len       The length of the data received.
+ * @param event_cnt The number of events in the buffer.
+ *
+ * @retval true  The buffer is held and released when all its events are freed.
+ * @retval false The events must be copied.
+ */
+static bool rx_buf_hold(struct emp_ipc_data *ipc, const void *data, size_t len, size_t event_cnt)
+{
+	struct emp_rx_buf *rx_buf = NULL;
+	k_spinlock_key_t key;
+	int ret;
+
+	if (ipc->rx_hold_unsupported || !IS_ALIGNED(data, EMP_FRAME_ALIGN)) {
+		return false;
+	}
+
+	key = k_spin_lock(&emp_rx_bufs_lock);
+	for (size_t i = 0; i < ARRAY_SIZE(emp_rx_bufs); ++i) {
+		if (!emp_rx_bufs[i].data) {
+			rx_buf = &emp_rx_bufs[i];
+			rx_buf->ipc = ipc;
+			rx_buf->data = data;
+			rx_buf->len = len;
+			rx_buf->event_cnt = event_cnt;
+			break;
+		}
+	}
+	k_spin_unlock(&emp_rx_bufs_lock, key);
+
+	if (!rx_buf) {
+		return false;
+	}
+
+	ret = ipc_service_hold_rx_buffer(&ipc->ept, (void *)data);
+	if (ret) {
+		if (ret == -ENOTSUP) {
+			ipc->rx_hold_unsupported = true;
+		} else {
+			LOG_WRN("Cannot hold rx buffer, err: %d", ret);
+		}
+
+		key = k_spin_lock(&emp_rx_bufs_lock);
+		rx_buf->data = NULL;
+		k_spin_unlock(&emp_rx_bufs_lock, key);
+
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Release the received buffer holding the freed event.
+ *
+ * Registered as the Application Event Manager free hook. The received buffer is released when
+ * all the events it holds are freed.
+ *
+ * @param event Pointer to the freed event.
+ *
+ * @retval true  The event is placed in a held received buffer.
+ * @retval false The event was not received in place and must be freed in other way.
+ */
+static bool rx_buf_release(void *event)
+{
+	const uint8_t *addr = event;
+	struct emp_ipc_data *ipc = NULL;
+	const uint8_t *data = NULL;
+	k_spinlock_key_t key;
+	bool found = false;
+
+	key = k_spin_lock(&emp_rx_bufs_lock);
+	for (size_t i = 0; i < ARRAY_SIZE(emp_rx_bufs); ++i) {
+		struct emp_rx_buf *rx_buf = &emp_rx_bufs[i];
+
+		if (rx_buf->data && (addr >= rx_buf->data) &&
+		    (addr < rx_buf->data + rx_buf->len)) {
+			found = true;
+			__ASSERT_NO_MSG(rx_buf->event_cnt > 0);
+			rx_buf->event_cnt--;
+			if (rx_buf->event_cnt == 0) {
+				ipc = rx_buf->ipc;
+				data = rx_buf->data;
+				rx_buf->data = NULL;
+			}
+			break;
+		}
+	}
+	k_spin_unlock(&emp_rx_bufs_lock, key);
+
+	if (data) {
+		int ret = ipc_service_release_rx_buffer(&ipc->ept, (void *)data);
+
+		if (ret) {
+			LOG_ERR("Cannot release rx buffer, err: %d", ret);
+			__ASSERT_NO_MSG(false);
+		}
+	}
+
+	return found;
+}
+
+APP_EVENT_MANAGER_HOOK_FREE_REGISTER(rx_buf_release);
+#endif /* CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX */
+
+static void handle_remote_event(const void *data, size_t len, bool in_place)
+{
+	struct app_event_header *aeh;
+
+	if (in_place) {
+		/* The received buffer is held, so the event header may be updated in place. */
+		aeh = (struct app_event_header *)data;
+	} else {
+		aeh = app_event_manager_alloc(len);
+		memcpy(aeh, data, len);
+	}
+
+	_event_submit(aeh);
+}
+
+static void handle_remote_events(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	size_t event_cnt = 1;
+	bool in_place = false;
+
+	if (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)) {
+		event_cnt = frame_count(data, len);
+		if (event_cnt == 0) {
+			LOG_ERR("Malformed batch of %zu bytes", len);
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+	}
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX)
+	in_place = rx_buf_hold(ipc, data, len, event_cnt);
+#endif
+
+	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)) {
+		handle_remote_event(data, len, in_place);
+		return;
+	}
+
+	const uint8_t *pos = data;
+
+	for (size_t i = 0; i < event_cnt; i++) {
+		const struct emp_frame_hdr *hdr = (const struct emp_frame_hdr *)pos;
+
+		handle_remote_event(hdr + 1, hdr->len, in_place);
+		pos += frame_size(hdr->len);
+	}
 }
 
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
@@ -256,7 +551,7 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		handle_remote_events(ipc, data, len);
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,24 +569,12 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static int send_to_remote(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
-	}
-
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
-
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
-
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
+		ret = ipc_service_send(&ipc->ept, data, len);
 		if (ret >= 0) {
 			break;
 		}
@@ -306,6 +589,122 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	return ret;
 }
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+/**
+ * @brief Write the event as a batched message frame.
+ *
+ * @param dst       The frame buffer.
+ * @param eh        The event.
+ * @param size      The event size.
+ * @param remote_ev The event type requested by the remote.
+ */
+static void frame_write(uint8_t *dst, const struct app_event_header *eh, size_t size,
+			const struct event_type *remote_ev)
+{
+	struct emp_frame_hdr *hdr = (struct emp_frame_hdr *)dst;
+	struct app_event_header *remote_eh = (struct app_event_header *)(hdr + 1);
+
+	hdr->len = size;
+	memcpy(remote_eh, eh, size);
+	remote_eh->type_id = remote_ev;
+}
+
+/**
+ * @brief Send the batched events to the remote.
+ *
+ * The batch lock of the IPC must be taken.
+ *
+ * @param ipc The IPC the events are batched for.
+ */
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	int ret = 0;
+
+	if (ipc->batch_len > 0) {
+		ret = send_to_remote(ipc, ipc->batch_buf, ipc->batch_len);
+		ipc->batch_len = 0;
+	}
+
+	return (ret < 0) ? ret : 0;
+}
+
+static void batch_flush_work_fn(struct k_work *work)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(emp_ipc_data); ++i) {
+		struct emp_ipc_data *ipc = &emp_ipc_data[i];
+
+		if (!ipc->used || !ipc->started) {
+			continue;
+		}
+
+		k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+		(void)batch_flush(ipc);
+		k_mutex_unlock(&ipc->batch_lock);
+	}
+}
+
+static int batch_event(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+		       const struct event_type *remote_ev)
+{
+	size_t size = app_event_manager_event_size(eh);
+	size_t fsize = frame_size(size);
+	int ret;
+
+	k_mutex_lock(&ipc->batch_lock, K_FOREVER);
+
+	if (ipc->batch_len + fsize > sizeof(ipc->batch_buf)) {
+		ret = batch_flush(ipc);
+		if (ret) {
+			goto unlock;
+		}
+	}
+
+	if (fsize > sizeof(ipc->batch_buf)) {
+		/* The event does not fit the batch, send it alone. */
+		uint64_t buffer[DIV_ROUND_UP(fsize, sizeof(uint64_t))];
+
+		frame_write((uint8_t *)buffer, eh, size, remote_ev);
+		ret = send_to_remote(ipc, buffer, fsize);
+	} else {
+		frame_write((uint8_t *)ipc->batch_buf + ipc->batch_len, eh, size, remote_ev);
+		ipc->batch_len += fsize;
+
+		/* The batch is sent when the work queue gets to it, which for events
+		 * processed by the system work queue is after the current batch of events.
+		 */
+		(void)k_work_submit(&emp_batch_flush_work);
+		ret = 0;
+	}
+
+unlock:
+	k_mutex_unlock(&ipc->batch_lock);
+
+	return ret;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
+
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+
+	if (remote_ev == NULL) {
+		return 0;
+	}
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	return batch_event(ipc, eh, remote_ev);
+#else
+	size_t size = app_event_manager_event_size(eh);
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+
+	memcpy(buffer, eh, sizeof(buffer));
+	remote_eh->type_id = remote_ev;
+
+	return send_to_remote(ipc, buffer, sizeof(buffer));
+#endif
+}
+
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
 	int ret = 0;
@@ -354,6 +753,15 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 			(char *)_event_manager_proxy_array_list_end);
 	memset(ipc->event_type_map, 0, event_type_count * sizeof(ipc->event_type_map[0]));
 
+	if (!emp_event_hash_ready) {
+		event_hash_init();
+	}
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+	k_mutex_init(&ipc->batch_lock);
+	ipc->batch_len = 0;
+#endif
+
 	k_event_init(&ipc->bound);
 
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
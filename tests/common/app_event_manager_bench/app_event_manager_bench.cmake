@@ -0,0 +1,14 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Events shared by the Application Event Manager benchmarks, so that the results of the
+# benchmarks are measured with the same event layouts.
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+
+target_sources(app PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/bench_events.c
+)
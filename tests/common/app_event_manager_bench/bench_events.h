@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_EVENTS_H_
+#define _BENCH_EVENTS_H_
+
+/**
+ * @brief Benchmark Events
+ * @defgroup bench_events Events used to benchmark the Application Event Manager
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Fixed size event, like the motion or button events. */
+struct bench_event {
+	struct app_event_header header;
+
+	uint64_t submit_ns;
+	uint32_t seq;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_event);
+
+/* Event passed back by the remote core of the Event Manager Proxy benchmark. It has the same
+ * layout as the bench_event.
+ */
+struct bench_echo_event {
+	struct app_event_header header;
+
+	uint64_t submit_ns;
+	uint32_t seq;
+};
+
+APP_EVENT_TYPE_DECLARE(bench_echo_event);
+
+/* Event with dynamic data, like the HID report events. */
+struct bench_data_event {
+	struct app_event_header header;
+
+	struct event_dyndata dyndata;
+};
+
+APP_EVENT_TYPE_DYNDATA_DECLARE(bench_data_event);
+
+/* Events delivered to 1, 4 and 16 listeners. */
+struct fanout_1_event {
+	struct app_event_header header;
+
+	uint64_t submit_ns;
+};
+
+APP_EVENT_TYPE_DECLARE(fanout_1_event);
+
+struct fanout_4_event {
+	struct app_event_header header;
+
+	uint64_t submit_ns;
+};
+
+APP_EVENT_TYPE_DECLARE(fanout_4_event);
+
+struct fanout_16_event {
+	struct app_event_header header;
+
+	uint64_t submit_ns;
+};
+
+APP_EVENT_TYPE_DECLARE(fanout_16_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _BENCH_EVENTS_H_ */
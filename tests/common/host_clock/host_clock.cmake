@@ -0,0 +1,15 @@
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+# Host clock for benchmarks run on native_sim. The simulated time does not
+# advance while the code runs, so the benchmark reads the host clock from the
+# native simulator runner, which is built against the host C library.
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR})
+
+target_sources(native_simulator INTERFACE
+	${CMAKE_CURRENT_LIST_DIR}/host_clock_bottom.c
+)
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef HOST_CLOCK_H_
+#define HOST_CLOCK_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Host clock for benchmarks run on native_sim.
+ *
+ * The simulated time does not advance while the code runs, so benchmarks
+ * measure the execution time with the clock of the host running the
+ * simulator. Include host_clock.cmake in the test's CMakeLists.txt to use it.
+ */
+
+/** @brief Get the host monotonic time in nanoseconds. */
+uint64_t host_clock_time_ns(void);
+
+/**
+ * @brief Get the host cycle counter.
+ *
+ * Falls back to host_clock_time_ns() on hosts without a cycle counter.
+ */
+uint64_t host_clock_cycles(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_CLOCK_H_ */
@@ -7,6 +7,14 @@
 #include <zephyr/ztest.h>
 #include <errno.h>
 #include <data_fifo.h>
+#include <zephyr/irq_offload.h>
+
+/* The tests are run for the single-producer/single-consumer mode when it is enabled */
+#if defined(CONFIG_DATA_FIFO_SPSC)
+#define TEST_DATA_FIFO_DEFINE DATA_FIFO_SPSC_DEFINE
+#else
+#define TEST_DATA_FIFO_DEFINE DATA_FIFO_DEFINE
+#endif /* defined(CONFIG_DATA_FIFO_SPSC) */
 
 /* Catch asserts to fail test */
 void assert_post_action(const char *file, unsigned int line)
@@ -34,7 +42,7 @@ static void internal_test_remaining_elements(struct data_fifo *data_fifo, uint32
 ZTEST(suite_data_fifo, test_data_fifo_uninit_ok)
 {
 #define BLOCKS_NUM 10
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -75,7 +83,7 @@ ZTEST(suite_data_fifo, test_data_fifo_uninit_ok)
 
 ZTEST(suite_data_fifo, test_data_fifo_init_ok)
 {
-	DATA_FIFO_DEFINE(data_fifo, 8, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 8, 128);
 
 	int ret;
 
@@ -86,7 +94,7 @@ ZTEST(suite_data_fifo, test_data_fifo_init_ok)
 ZTEST(suite_data_fifo, test_data_fifo_data_put_get_ok)
 {
 #define DATA_SIZE 5
-	DATA_FIFO_DEFINE(data_fifo, 8, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 8, 128);
 
 	int ret;
 
@@ -161,7 +169,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_get_ok)
 ZTEST(suite_data_fifo, test_data_fifo_data_put_too_many)
 {
 #define BLOCKS_NUM 10
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -195,7 +203,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_too_many)
 
 ZTEST(suite_data_fifo, test_data_fifo_data_put_too_much_data)
 {
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -214,7 +222,7 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_too_much_data)
 
 ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 {
-	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+	TEST_DATA_FIFO_DEFINE(data_fifo, 10, 128);
 
 	int ret;
 
@@ -232,3 +240,214 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 }
 
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+#define SPSC_BLOCKS_NUM	 4
+#define SPSC_BLOCK_SIZE	 16
+#define SPSC_STACK_SIZE	 1024
+#define SPSC_THREAD_PRIO K_PRIO_PREEMPT(0)
+
+K_THREAD_STACK_DEFINE(spsc_stack, SPSC_STACK_SIZE);
+static struct k_thread spsc_thread;
+
+DATA_FIFO_SPSC_DEFINE(spsc_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCK_SIZE);
+
+static void *spsc_data;
+static int spsc_ret;
+
+static void spsc_put(uint32_t value)
+{
+	uint32_t *data_ptr;
+	int ret;
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	*data_ptr = value;
+
+	ret = data_fifo_block_lock(&spsc_fifo, (void **)&data_ptr, sizeof(value));
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+static void spsc_get_free(uint32_t value)
+{
+	uint32_t *data_ptr;
+	size_t data_size;
+	int ret;
+
+	ret = data_fifo_pointer_last_filled_get(&spsc_fifo, (void **)&data_ptr, &data_size,
+						K_NO_WAIT);
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+	zassert_equal(data_size, sizeof(value), "data size incorrect");
+	zassert_equal(*data_ptr, value, "data contents are not identical");
+
+	data_fifo_block_free(&spsc_fifo, data_ptr);
+}
+
+static void spsc_isr_put(const void *arg)
+{
+	spsc_put(POINTER_TO_UINT(arg));
+}
+
+static void spsc_consumer(void *p1, void *p2, void *p3)
+{
+	size_t data_size;
+
+	spsc_ret = data_fifo_pointer_last_filled_get(&spsc_fifo, &spsc_data, &data_size, K_FOREVER);
+}
+
+static void spsc_producer(void *p1, void *p2, void *p3)
+{
+	spsc_ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &spsc_data, K_FOREVER);
+}
+
+static void spsc_thread_start(k_thread_entry_t entry)
+{
+	spsc_ret = -1;
+	spsc_data = NULL;
+
+	k_thread_create(&spsc_thread, spsc_stack, K_THREAD_STACK_SIZEOF(spsc_stack), entry, NULL,
+			NULL, NULL, SPSC_THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* Let the thread run until it waits on the FIFO */
+	k_sleep(K_MSEC(10));
+}
+
+static void suite_data_fifo_spsc_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	if (data_fifo_state(&spsc_fifo)) {
+		(void)data_fifo_uninit(&spsc_fifo);
+	}
+
+	zassert_equal(data_fifo_init(&spsc_fifo), 0, "init did not return 0");
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_wrap_ok)
+{
+	uint32_t value_get = 0;
+	uint32_t value_put = 0;
+
+	/* Go around the ring several times at every fill level */
+	for (uint32_t fill = 1; fill <= SPSC_BLOCKS_NUM; fill++) {
+		for (uint32_t i = 0; i < fill; i++) {
+			spsc_put(value_put++);
+		}
+
+		for (uint32_t i = 0; i < 3 * SPSC_BLOCKS_NUM; i++) {
+			internal_test_remaining_elements(&spsc_fifo, fill, fill, __LINE__);
+			spsc_get_free(value_get++);
+			spsc_put(value_put++);
+		}
+
+		while (value_get != value_put) {
+			spsc_get_free(value_get++);
+		}
+
+		internal_test_remaining_elements(&spsc_fifo, 0, 0, __LINE__);
+	}
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_full_empty)
+{
+	void *data_ptr;
+	size_t data_size;
+	int ret;
+
+	ret = data_fifo_pointer_last_filled_get(&spsc_fifo, &data_ptr, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+
+	ret = data_fifo_pointer_last_filled_get(&spsc_fifo, &data_ptr, &data_size, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "last_filled_get did not return -EAGAIN");
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		spsc_put(i);
+	}
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &data_ptr, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+	/* A block that has been read but not freed is still in use */
+	ret = data_fifo_pointer_last_filled_get(&spsc_fifo, &data_ptr, &data_size, K_NO_WAIT);
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+	internal_test_remaining_elements(&spsc_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCKS_NUM - 1,
+					 __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_producer_free)
+{
+	void *data_ptr;
+	void *data_ptr_again;
+	int ret;
+
+	spsc_put(0);
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	internal_test_remaining_elements(&spsc_fifo, 2, 1, __LINE__);
+
+	/* The producer gives back the block without locking it */
+	data_fifo_block_free(&spsc_fifo, data_ptr);
+	internal_test_remaining_elements(&spsc_fifo, 1, 1, __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&spsc_fifo, &data_ptr_again, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal_ptr(data_ptr_again, data_ptr, "Block was not reused");
+
+	ret = data_fifo_block_lock(&spsc_fifo, &data_ptr_again, SPSC_BLOCK_SIZE + 1);
+	zassert_equal(ret, -ENOMEM, "block_lock did not return -ENOMEM");
+	data_fifo_block_free(&spsc_fifo, data_ptr_again);
+
+	spsc_get_free(0);
+	internal_test_remaining_elements(&spsc_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_isr_to_thread)
+{
+	int ret;
+
+	spsc_thread_start(spsc_consumer);
+	zassert_equal(spsc_ret, -1, "Consumer did not wait for a block");
+
+	/* The block locked from the ISR wakes the waiting consumer */
+	irq_offload(spsc_isr_put, UINT_TO_POINTER(0xa5a5a5a5));
+
+	ret = k_thread_join(&spsc_thread, K_SECONDS(1));
+	zassert_equal(ret, 0, "Consumer was not woken");
+	zassert_equal(spsc_ret, 0, "last_filled_get did not return 0");
+	zassert_equal(*(uint32_t *)spsc_data, 0xa5a5a5a5, "data contents are not identical");
+
+	data_fifo_block_free(&spsc_fifo, spsc_data);
+	internal_test_remaining_elements(&spsc_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_producer_wakeup)
+{
+	int ret;
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		spsc_put(i);
+	}
+
+	spsc_thread_start(spsc_producer);
+	zassert_equal(spsc_ret, -1, "Producer did not wait for a block");
+
+	/* Freeing a block of the full FIFO wakes the waiting producer */
+	spsc_get_free(0);
+
+	ret = k_thread_join(&spsc_thread, K_SECONDS(1));
+	zassert_equal(ret, 0, "Producer was not woken");
+	zassert_equal(spsc_ret, 0, "first_vacant_get did not return 0");
+	internal_test_remaining_elements(&spsc_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCKS_NUM - 1,
+					 __LINE__);
+}
+
+ZTEST_SUITE(suite_data_fifo_spsc, NULL, NULL, suite_data_fifo_spsc_before, NULL, NULL);
+#endif /* defined(CONFIG_DATA_FIFO_SPSC) */
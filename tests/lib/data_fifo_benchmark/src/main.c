@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+#include <data_fifo.h>
+
+#include "host_clock.h"
+
+#define BENCH_OP_CNT		10000
+#define BENCH_BURST_SIZE	8
+#define BENCH_TIMEOUT		K_SECONDS(10)
+#define BENCH_STACK_SIZE	2048
+#define BENCH_TEST_PRIO		K_PRIO_PREEMPT(5)
+#define BENCH_CONSUMER_PRIO	K_PRIO_PREEMPT(0)
+
+/* Room for two bursts, so that the ISR never finds the FIFO full. 960 bytes is one 10 ms block
+ * of 48 kHz 16-bit stereo audio.
+ */
+#define BENCH_BLOCKS_NUM	(2 * BENCH_BURST_SIZE)
+#define BENCH_BLOCK_SIZE	960
+
+BUILD_ASSERT((BENCH_OP_CNT % BENCH_BURST_SIZE) == 0);
+
+DATA_FIFO_DEFINE(fifo_default, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(fifo_spsc, BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE);
+
+K_THREAD_STACK_DEFINE(consumer_stack, BENCH_STACK_SIZE);
+static struct k_thread consumer_thread;
+
+/* Every sample is stored, so that the percentiles are exact. */
+static uint32_t samples[BENCH_OP_CNT];
+static uint32_t samples_pop[BENCH_OP_CNT];
+
+/* First error from a producer running in an ISR */
+static int isr_ret;
+
+/* Time stamp written to every block by the producer */
+struct bench_block {
+	uint64_t put_ns;
+};
+
+static int sample_cmp(const void *a, const void *b)
+{
+	uint32_t sa = *(const uint32_t *)a;
+	uint32_t sb = *(const uint32_t *)b;
+
+	return (sa > sb) - (sa < sb);
+}
+
+static uint32_t sample_percentile(const uint32_t *sorted, uint32_t cnt, uint32_t pct)
+{
+	/* Nearest-rank percentile of the sorted samples. */
+	return sorted[DIV_ROUND_UP(cnt * pct, 100) - 1];
+}
+
+/* Print the result in the format parsed by the Twister record harness. The samples include the
+ * cost of reading the host clock.
+ */
+static void bench_report(const char *mode, const char *name, uint32_t *buf, uint32_t cnt)
+{
+	uint64_t total_ns = 0;
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		total_ns += buf[i];
+	}
+
+	qsort(buf, cnt, sizeof(buf[0]), sample_cmp);
+
+	TC_PRINT("BENCH data_fifo_%s_%s ops=%u ns_per_op=%u p50_ns=%u p99_ns=%u\n", mode, name,
+		 cnt, (uint32_t)(total_ns / cnt), sample_percentile(buf, cnt, 50),
+		 sample_percentile(buf, cnt, 99));
+}
+
+static void bench_fifo_init(struct data_fifo *fifo)
+{
+	if (data_fifo_state(fifo)) {
+		zassert_ok(data_fifo_uninit(fifo), "Failed to uninit the FIFO");
+	}
+
+	zassert_ok(data_fifo_init(fifo), "Failed to init the FIFO");
+}
+
+static int bench_put(struct data_fifo *fifo)
+{
+	struct bench_block *block;
+	int ret;
+
+	ret = data_fifo_pointer_first_vacant_get(fifo, (void **)&block, K_NO_WAIT);
+	if (ret) {
+		return ret;
+	}
+
+	block->put_ns = host_clock_time_ns();
+
+	return data_fifo_block_lock(fifo, (void **)&block, sizeof(*block));
+}
+
+static void bench_push_pop(struct data_fifo *fifo, const char *mode)
+{
+	struct bench_block *block;
+	size_t size;
+	int ret;
+
+	bench_fifo_init(fifo);
+
+	/* Push and pop one block at a time in the same thread, which is the cost of the FIFO
+	 * operations without any context switches.
+	 */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		uint64_t start = host_clock_time_ns();
+
+		zassert_ok(bench_put(fifo), "Failed to put a block");
+
+		uint64_t mid = host_clock_time_ns();
+
+		ret = data_fifo_pointer_last_filled_get(fifo, (void **)&block, &size, K_NO_WAIT);
+		zassert_ok(ret, "last_filled_get failed");
+		data_fifo_block_free(fifo, block);
+
+		uint64_t end = host_clock_time_ns();
+
+		samples[i] = mid - start;
+		samples_pop[i] = end - mid;
+	}
+
+	bench_report(mode, "push", samples, BENCH_OP_CNT);
+	bench_report(mode, "pop", samples_pop, BENCH_OP_CNT);
+}
+
+static void bench_consumer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *fifo = p1;
+	struct bench_block *block;
+	size_t size;
+	int ret;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		ret = data_fifo_pointer_last_filled_get(fifo, (void **)&block, &size,
+							BENCH_TIMEOUT);
+		if (ret) {
+			return;
+		}
+
+		samples[i] = host_clock_time_ns() - block->put_ns;
+		data_fifo_block_free(fifo, block);
+	}
+}
+
+static void bench_isr_put(const void *arg)
+{
+	struct data_fifo *fifo = (struct data_fifo *)arg;
+	int ret = bench_put(fifo);
+
+	if (ret && !isr_ret) {
+		isr_ret = ret;
+	}
+}
+
+static void bench_isr_put_burst(const void *arg)
+{
+	for (uint32_t i = 0; i < BENCH_BURST_SIZE; i++) {
+		bench_isr_put(arg);
+	}
+}
+
+static void bench_isr_handoff(struct data_fifo *fifo, const char *mode, const char *name,
+			      irq_offload_routine_t isr, uint32_t blocks_per_isr)
+{
+	bench_fifo_init(fifo);
+	isr_ret = 0;
+
+	/* The consumer has a higher priority than the test thread, so it runs as soon as the
+	 * ISR returns and the block is measured from the time it was locked until it is read.
+	 */
+	k_thread_create(&consumer_thread, consumer_stack, K_THREAD_STACK_SIZEOF(consumer_stack),
+			bench_consumer, fifo, NULL, NULL, BENCH_CONSUMER_PRIO, 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < BENCH_OP_CNT / blocks_per_isr; i++) {
+		irq_offload(isr, fifo);
+	}
+
+	zassert_ok(isr_ret, "Failed to put a block from the ISR");
+	zassert_ok(k_thread_join(&consumer_thread, BENCH_TIMEOUT), "Consumer did not finish");
+
+	bench_report(mode, name, samples, BENCH_OP_CNT);
+}
+
+static void bench_fifo(struct data_fifo *fifo, const char *mode)
+{
+	bench_push_pop(fifo, mode);
+	bench_isr_handoff(fifo, mode, "isr_handoff", bench_isr_put, 1);
+	bench_isr_handoff(fifo, mode, "isr_burst", bench_isr_put_burst, BENCH_BURST_SIZE);
+}
+
+ZTEST(suite_data_fifo_benchmark, test_bench_default)
+{
+	k_thread_priority_set(k_current_get(), BENCH_TEST_PRIO);
+
+	bench_fifo(&fifo_default, "default");
+}
+
+ZTEST(suite_data_fifo_benchmark, test_bench_spsc)
+{
+	k_thread_priority_set(k_current_get(), BENCH_TEST_PRIO);
+
+	bench_fifo(&fifo_spsc, "spsc");
+}
+
+ZTEST_SUITE(suite_data_fifo_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -127,4 +127,108 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_high_values_stereo_odd_length)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, INT16_MIN, 100 };
+	int16_t sample_b[] = { 1000, -1000, -200 };
+	int16_t sample_r[] = { INT16_MAX, INT16_MIN, -100 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_STEREO_INTO_A_STEREO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_size_checked_first)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10 };
+	int16_t sample_b[] = { 1, 2, 3 };
+	int16_t sample_r[] = { 10, 10, 10, 10 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	/* Buffer A is left untouched on error */
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_lr_32)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX - 1, 10, INT32_MIN + 1, -10 };
+	int32_t sample_b[] = { 5, -5 };
+	int32_t sample_r[] = { INT32_MAX, 15, INT32_MIN, -15 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_STEREO_LR, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_r_24)
+{
+	int ret;
+	/* Packed little-endian 24-bit samples: { 0x7FFFF0, 1, -1, -0x7FFFF0 } */
+	uint8_t sample_a[] = { 0xF0, 0xFF, 0x7F, 0x01, 0x00, 0x00,
+			       0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x80 };
+	/* { 0x20, -0x20 } */
+	uint8_t sample_b[] = { 0x20, 0x00, 0x00, 0xE0, 0xFF, 0xFF };
+	/* { 0x7FFFF0, 0x21, -1, -0x800000 } */
+	uint8_t sample_r[] = { 0xF0, 0xFF, 0x7F, 0x21, 0x00, 0x00,
+			       0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_STEREO_R, 24);
+	ZEQ(ret, 0);
+
+	zassert_mem_equal(sample_a, sample_r, sizeof(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_gain)
+{
+	int ret;
+	int16_t sample_a[] = { 100, 100, INT16_MAX - 10, 0 };
+	int16_t sample_b[] = { 64, -64, 100, -1000 };
+	int16_t sample_r[] = { 132, 68, INT16_MAX, -500 };
+
+	ret = pcm_mix_gain(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			   B_MONO_INTO_A_MONO, 16, PCM_MIX_GAIN_UNITY / 2);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_gain_zero)
+{
+	int ret;
+	int32_t sample_a[] = { 1, 2 };
+	int32_t sample_b[] = { 100, 100 };
+
+	ret = pcm_mix_gain(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			   B_MONO_INTO_A_MONO, 32, 0);
+	ZEQ(ret, 0);
+	ZEQ(sample_a[0], 1);
+	ZEQ(sample_a[1], 2);
+}
+
+ZTEST(suite_pcm_mix, test_invalid_bit_depth)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1 };
+	int16_t sample_b[] = { 1, 1 };
+
+	ret = pcm_mix_bit_depth(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+				B_MONO_INTO_A_MONO, 8);
+	ZEQ(ret, -EINVAL);
+	ZEQ(sample_a[0], 0);
+	ZEQ(sample_a[1], 1);
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+#include "host_clock.h"
+
+/* One 10 ms block of 48 kHz audio, like an I2S block of the nRF5340 Audio applications. */
+#define FRAMES_PER_BLOCK	480
+#define BLOCK_CNT		2000
+#define MAX_BYTES_PER_SAMPLE	4
+
+/* Half of full scale, for gain-scaled mixing. */
+#define BENCH_GAIN		(PCM_MIX_GAIN_UNITY / 2)
+
+struct bench_mode {
+	const char *name;
+	enum pcm_mix_mode mode;
+	uint8_t a_channels;
+	uint8_t b_channels;
+};
+
+static const struct bench_mode bench_modes[] = {
+	{"stereo_into_stereo", B_STEREO_INTO_A_STEREO, 2, 2},
+	{"mono_into_mono", B_MONO_INTO_A_MONO, 1, 1},
+	{"mono_into_stereo_lr", B_MONO_INTO_A_STEREO_LR, 2, 1},
+	{"mono_into_stereo_l", B_MONO_INTO_A_STEREO_L, 2, 1},
+	{"mono_into_stereo_r", B_MONO_INTO_A_STEREO_R, 2, 1},
+};
+
+static uint8_t pcm_a[FRAMES_PER_BLOCK * 2 * MAX_BYTES_PER_SAMPLE];
+static uint8_t pcm_b[FRAMES_PER_BLOCK * 2 * MAX_BYTES_PER_SAMPLE];
+
+
+static void noise_fill(uint8_t *buf, size_t size)
+{
+	/* Fixed seed, so that every run mixes the same data. */
+	uint32_t state = 0x12345678;
+
+	for (size_t i = 0; i < size; i++) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		buf[i] = (uint8_t)state;
+	}
+}
+
+static void bench_run(const struct bench_mode *bm, uint8_t pcm_bit_depth, uint16_t gain_b)
+{
+	size_t bytes_per_sample = pcm_bit_depth / 8;
+	size_t size_a = FRAMES_PER_BLOCK * bm->a_channels * bytes_per_sample;
+	size_t size_b = FRAMES_PER_BLOCK * bm->b_channels * bytes_per_sample;
+	uint64_t cycles = 0;
+	uint64_t ns = 0;
+	char name[64];
+
+	/* Full scale noise, so that part of the samples clip. */
+	noise_fill(pcm_b, size_b);
+
+	for (uint32_t i = 0; i < BLOCK_CNT; i++) {
+		/* Refresh A every block, like a new I2S block. The copy is not timed. */
+		memcpy(pcm_a, pcm_b, MIN(size_a, size_b));
+
+		uint64_t ns_start = host_clock_time_ns();
+		uint64_t cycles_start = host_clock_cycles();
+		int ret = pcm_mix_gain(pcm_a, size_a, pcm_b, size_b, bm->mode, pcm_bit_depth,
+				       gain_b);
+
+		cycles += host_clock_cycles() - cycles_start;
+		ns += host_clock_time_ns() - ns_start;
+
+		zassert_equal(ret, 0, "Mixing failed: %d", ret);
+	}
+
+	snprintk(name, sizeof(name), "pcm_mix_%s_%u%s", bm->name, pcm_bit_depth,
+		 (gain_b == PCM_MIX_GAIN_UNITY) ? "" : "_gain");
+
+	/* Print the result in the format parsed by the Twister record harness. */
+	TC_PRINT("BENCH %s blocks=%u cycles_per_block=%u ns_per_block=%u\n", name, BLOCK_CNT,
+		 (uint32_t)(cycles / BLOCK_CNT), (uint32_t)(ns / BLOCK_CNT));
+}
+
+static void bench_bit_depth(uint8_t pcm_bit_depth)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(bench_modes); i++) {
+		bench_run(&bench_modes[i], pcm_bit_depth, PCM_MIX_GAIN_UNITY);
+		bench_run(&bench_modes[i], pcm_bit_depth, BENCH_GAIN);
+	}
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_16)
+{
+	bench_bit_depth(16);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_24)
+{
+	bench_bit_depth(24);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_bench_32)
+{
+	bench_bit_depth(32);
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
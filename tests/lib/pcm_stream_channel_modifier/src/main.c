@@ -69,6 +69,7 @@ uint8_t copy_padded_16[] = {1, 2, 1, 2, 3, 4,  3, 4,  5,  6,  5,  6,
 			    7, 8, 7, 8, 9, 10, 9, 10, 11, 12, 11, 12};
 uint8_t __aligned(4) combine_16[] = {1, 2, 13, 14, 3, 4,  15, 16, 5,  6,  17, 18,
 					     7, 8, 19, 20, 9, 10, 21, 22, 11, 12, 23, 24};
+uint8_t stereo_split_16_all[] = {1, 2, 7, 8, 3, 4, 9, 10, 5, 6, 11, 12};
 uint8_t stereo_split_left_16[] = {1, 13, 3, 15, 5, 17, 7, 19, 9, 21, 11, 23};
 uint8_t stereo_split_right_16[] = {2, 14, 4, 16, 6, 18, 8, 20, 10, 22, 12, 24};
 
@@ -413,6 +414,66 @@ ZTEST(suite_pscm_deint, test_pscm_deinterleave_multi)
 	zassert_equal(ret, 0, "Failed de-interleave 8-bit carrier surround right: ret %d", ret);
 }
 
+ZTEST(suite_pscm_int, test_pscm_interleave_all)
+{
+	int ret;
+	uint8_t __aligned(4) output[TEST_PCM_INT_MULTI_SIZE] = {0};
+	void const *inputs[TEST_CHANNELS_5] = {
+		unpadded_left, unpadded_right, unpadded_centre, unpadded_surround_left,
+		unpadded_surround_right};
+
+	ret = pscm_interleave_all(inputs, sizeof(unpadded_left), TEST_SAMPLE_BITS_8, &output[0],
+				  TEST_PCM_INT_MULTI_SIZE, TEST_CHANNELS_5);
+	zassert_equal(ret, 0, "Failed interleave: ret %d", ret);
+
+	zassert_mem_equal(&output[0], &multi_split[0], sizeof(multi_split),
+			  "Failed to interleave multi channels, output != multi_split");
+
+	/* Stereo 16-bit is the same as combining the channels */
+	inputs[1] = &unpadded_left[sizeof(unpadded_left) / 2];
+	ret = pscm_interleave_all(inputs, sizeof(unpadded_left) / 2, 16, &output[0],
+				  TEST_PCM_INT_MULTI_SIZE, 2);
+	zassert_equal(ret, 0, "Failed interleave: ret %d", ret);
+
+	zassert_mem_equal(&output[0], &stereo_split_16_all[0], sizeof(stereo_split_16_all),
+			  "Failed to interleave 16-bit stereo");
+
+	ret = pscm_interleave_all(inputs, sizeof(unpadded_left), TEST_SAMPLE_BITS_8, &output[0],
+				  TEST_PCM_INT_MULTI_SIZE - 1, TEST_CHANNELS_5);
+	zassert_equal(ret, -EINVAL, "Output buffer too small not detected: ret %d", ret);
+
+	inputs[2] = &output[0];
+	ret = pscm_interleave_all(inputs, sizeof(unpadded_left), TEST_SAMPLE_BITS_8, &output[0],
+				  TEST_PCM_INT_MULTI_SIZE, TEST_CHANNELS_5);
+	zassert_equal(ret, -EINVAL, "Inplace interleave not detected: ret %d", ret);
+}
+
+ZTEST(suite_pscm_deint, test_pscm_deinterleave_all)
+{
+	int ret;
+	uint8_t output[TEST_CHANNELS_5][TEST_PCM_DEINT_SIZE];
+	void *outputs[TEST_CHANNELS_5] = {output[0], output[1], output[2], output[3], output[4]};
+
+	ret = pscm_deinterleave_all(&multi_split[0], sizeof(multi_split), TEST_CHANNELS_5,
+				    TEST_SAMPLE_BITS_8, outputs, TEST_PCM_DEINT_SIZE);
+	zassert_equal(ret, 0, "Failed de-interleave: ret %d", ret);
+
+	zassert_mem_equal(output[0], unpadded_left, sizeof(unpadded_left));
+	zassert_mem_equal(output[1], unpadded_right, sizeof(unpadded_right));
+	zassert_mem_equal(output[2], unpadded_centre, sizeof(unpadded_centre));
+	zassert_mem_equal(output[3], unpadded_surround_left, sizeof(unpadded_surround_left));
+	zassert_mem_equal(output[4], unpadded_surround_right, sizeof(unpadded_surround_right));
+
+	ret = pscm_deinterleave_all(&multi_split[0], sizeof(multi_split), TEST_CHANNELS_5,
+				    TEST_SAMPLE_BITS_8, outputs, TEST_PCM_DEINT_SIZE - 1);
+	zassert_equal(ret, -EINVAL, "Output buffer too small not detected: ret %d", ret);
+
+	outputs[4] = NULL;
+	ret = pscm_deinterleave_all(&multi_split[0], sizeof(multi_split), TEST_CHANNELS_5,
+				    TEST_SAMPLE_BITS_8, outputs, TEST_PCM_DEINT_SIZE);
+	zassert_equal(ret, -EINVAL, "NULL output not detected: ret %d", ret);
+}
+
 ZTEST(suite_pscm, test_pscm_zero_pad_16)
 {
 	uint16_t left_test_list[50];
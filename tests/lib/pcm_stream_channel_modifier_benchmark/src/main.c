@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_stream_channel_modifier.h>
+
+#include "host_clock.h"
+#include "pscm_legacy.h"
+
+/* One 10 ms block of 48 kHz audio per channel, like an LC3 frame of the nRF5340 Audio
+ * applications.
+ */
+#define SAMPLES_PER_CHANNEL	480
+#define MAX_CHANNELS		4
+#define MAX_BYTES_PER_SAMPLE	4
+#define CHANNEL_SIZE_MAX	(SAMPLES_PER_CHANNEL * MAX_BYTES_PER_SAMPLE)
+#define BLOCK_CNT		2000
+
+enum bench_op {
+	BENCH_ZERO_PAD,
+	BENCH_COPY_PAD,
+	BENCH_COMBINE,
+	BENCH_ONE_CHANNEL_SPLIT,
+	BENCH_TWO_CHANNEL_SPLIT,
+	BENCH_INTERLEAVE_STEREO,
+	BENCH_DEINTERLEAVE_STEREO,
+	BENCH_INTERLEAVE_4CH,
+	BENCH_DEINTERLEAVE_4CH,
+};
+
+static const char *const bench_names[] = {
+	[BENCH_ZERO_PAD] = "zero_pad",
+	[BENCH_COPY_PAD] = "copy_pad",
+	[BENCH_COMBINE] = "combine",
+	[BENCH_ONE_CHANNEL_SPLIT] = "one_channel_split",
+	[BENCH_TWO_CHANNEL_SPLIT] = "two_channel_split",
+	[BENCH_INTERLEAVE_STEREO] = "interleave_stereo",
+	[BENCH_DEINTERLEAVE_STEREO] = "deinterleave_stereo",
+	[BENCH_INTERLEAVE_4CH] = "interleave_4ch",
+	[BENCH_DEINTERLEAVE_4CH] = "deinterleave_4ch",
+};
+
+static uint8_t __aligned(4) channels[MAX_CHANNELS][CHANNEL_SIZE_MAX];
+static uint8_t __aligned(4) multi[MAX_CHANNELS * CHANNEL_SIZE_MAX];
+static uint8_t __aligned(4) out_channels[MAX_CHANNELS][CHANNEL_SIZE_MAX];
+static uint8_t __aligned(4) out_multi[MAX_CHANNELS * CHANNEL_SIZE_MAX];
+static uint8_t __aligned(4) legacy_out_channels[MAX_CHANNELS][CHANNEL_SIZE_MAX];
+static uint8_t __aligned(4) legacy_out_multi[MAX_CHANNELS * CHANNEL_SIZE_MAX];
+
+
+static void data_fill(void)
+{
+	/* Fixed seed, so that every run uses the same data. */
+	uint32_t state = 0x12345678;
+
+	for (size_t i = 0; i < sizeof(channels); i++) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		((uint8_t *)channels)[i] = (uint8_t)state;
+	}
+
+	memcpy(multi, channels, sizeof(multi));
+}
+
+/* Run the operation once on one block and return the number of bytes written. The optimized
+ * N channel functions are compared with interleaving the channels one by one in the legacy
+ * implementation, as done in the audio datapath.
+ */
+static size_t bench_op_run(enum bench_op op, uint8_t bits, bool legacy)
+{
+	size_t ch_size = SAMPLES_PER_CHANNEL * (bits / 8);
+	uint8_t *out = legacy ? legacy_out_multi : out_multi;
+	uint8_t(*out_ch)[CHANNEL_SIZE_MAX] = legacy ? legacy_out_channels : out_channels;
+	size_t out_size;
+	int ret = 0;
+
+	switch (op) {
+	case BENCH_ZERO_PAD:
+		ret = (legacy ? pscm_legacy_zero_pad : pscm_zero_pad)(channels[0], ch_size, AUDIO_CH_R,
+								    bits, out, &out_size);
+		break;
+	case BENCH_COPY_PAD:
+		ret = (legacy ? pscm_legacy_copy_pad : pscm_copy_pad)(channels[0], ch_size, bits, out,
+								    &out_size);
+		break;
+	case BENCH_COMBINE:
+		ret = (legacy ? pscm_legacy_combine : pscm_combine)(channels[0], channels[1], ch_size,
+								  bits, out, &out_size);
+		break;
+	case BENCH_ONE_CHANNEL_SPLIT:
+		ret = (legacy ? pscm_legacy_one_channel_split : pscm_one_channel_split)(
+			multi, 2 * ch_size, AUDIO_CH_R, bits, out_ch[0], &out_size);
+		break;
+	case BENCH_TWO_CHANNEL_SPLIT:
+		ret = (legacy ? pscm_legacy_two_channel_split : pscm_two_channel_split)(
+			multi, 2 * ch_size, bits, out_ch[0], out_ch[1], &out_size);
+		out_size *= 2;
+		break;
+	case BENCH_INTERLEAVE_STEREO:
+	case BENCH_INTERLEAVE_4CH: {
+		uint8_t ch_cnt = (op == BENCH_INTERLEAVE_STEREO) ? 2 : 4;
+
+		if (legacy) {
+			for (uint8_t ch = 0; ch < ch_cnt; ch++) {
+				ret |= pscm_legacy_interleave(channels[ch], ch_size, ch, bits, out,
+							      sizeof(legacy_out_multi), ch_cnt);
+			}
+		} else {
+			void const *inputs[] = {channels[0], channels[1], channels[2], channels[3]};
+
+			ret = pscm_interleave_all(inputs, ch_size, bits, out, sizeof(out_multi),
+						  ch_cnt);
+		}
+
+		out_size = ch_cnt * ch_size;
+		break;
+	}
+	case BENCH_DEINTERLEAVE_STEREO:
+	case BENCH_DEINTERLEAVE_4CH: {
+		uint8_t ch_cnt = (op == BENCH_DEINTERLEAVE_STEREO) ? 2 : 4;
+
+		if (legacy) {
+			for (uint8_t ch = 0; ch < ch_cnt; ch++) {
+				ret |= pscm_legacy_deinterleave(multi, ch_cnt * ch_size, ch_cnt, ch,
+								bits, out_ch[ch], CHANNEL_SIZE_MAX);
+			}
+		} else {
+			void *outputs[] = {out_ch[0], out_ch[1], out_ch[2], out_ch[3]};
+
+			ret = pscm_deinterleave_all(multi, ch_cnt * ch_size, ch_cnt, bits, outputs,
+						    CHANNEL_SIZE_MAX);
+		}
+
+		out_size = ch_cnt * ch_size;
+		break;
+	}
+	}
+
+	zassert_equal(ret, 0, "%s failed for %u bits", bench_names[op], bits);
+
+	return out_size;
+}
+
+static uint32_t bench_bytes_per_kcycle(enum bench_op op, uint8_t bits, bool legacy,
+				       size_t *bytes)
+{
+	uint64_t cycles = 0;
+
+	for (uint32_t i = 0; i < BLOCK_CNT; i++) {
+		uint64_t start = host_clock_cycles();
+
+		*bytes = bench_op_run(op, bits, legacy);
+		cycles += host_clock_cycles() - start;
+	}
+
+	return (uint64_t)*bytes * BLOCK_CNT * 1000 / MAX(cycles, 1);
+}
+
+static void bench_bit_depth(uint8_t bits)
+{
+	data_fill();
+
+	for (size_t op = 0; op < ARRAY_SIZE(bench_names); op++) {
+		size_t bytes;
+		uint32_t legacy = bench_bytes_per_kcycle(op, bits, true, &bytes);
+		uint32_t optimized = bench_bytes_per_kcycle(op, bits, false, &bytes);
+
+		/* Both implementations must produce the same output */
+		zassert_mem_equal(out_multi, legacy_out_multi, sizeof(out_multi),
+				  "%s output differs for %u bits", bench_names[op], bits);
+		zassert_mem_equal(out_channels, legacy_out_channels, sizeof(out_channels),
+				  "%s output differs for %u bits", bench_names[op], bits);
+
+		/* Print the result in the format parsed by the Twister record harness. */
+		TC_PRINT("BENCH %s_%u bytes=%zu bytes_per_kcycle=%u legacy_bytes_per_kcycle=%u\n",
+			 bench_names[op], bits, bytes, optimized, legacy);
+	}
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_16)
+{
+	bench_bit_depth(16);
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_24)
+{
+	bench_bit_depth(24);
+}
+
+ZTEST(suite_pscm_benchmark, test_bench_32)
+{
+	bench_bit_depth(32);
+}
+
+ZTEST_SUITE(suite_pscm_benchmark, NULL, NULL, NULL, NULL, NULL);
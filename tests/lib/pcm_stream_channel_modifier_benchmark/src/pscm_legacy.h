@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PSCM_LEGACY_H_
+#define _PSCM_LEGACY_H_
+
+#include <zephyr/kernel.h>
+#include <audio_defines.h>
+
+/* Same API as in pcm_stream_channel_modifier.h, see pscm_legacy.c. */
+int pscm_legacy_zero_pad(void const *const input, size_t input_size, enum audio_channel channel,
+			 uint8_t pcm_bit_depth, void *output, size_t *output_size);
+
+int pscm_legacy_copy_pad(void const *const input, size_t input_size, uint8_t pcm_bit_depth,
+			 void *output, size_t *output_size);
+
+int pscm_legacy_combine(void const *const input_left, void const *const input_right,
+			size_t input_size, uint8_t pcm_bit_depth, void *output, size_t *output_size);
+
+int pscm_legacy_one_channel_split(void const *const input, size_t input_size,
+				  enum audio_channel channel, uint8_t pcm_bit_depth, void *output,
+				  size_t *output_size);
+
+int pscm_legacy_two_channel_split(void const *const input, size_t input_size, uint8_t pcm_bit_depth,
+				  void *output_left, void *output_right, size_t *output_size);
+
+int pscm_legacy_interleave(void const *const input, size_t input_size, uint8_t channel,
+			   uint8_t pcm_bit_depth, void *output, size_t output_size,
+			   uint8_t output_channels);
+
+int pscm_legacy_deinterleave(void const *const input, size_t input_size, uint8_t input_channels,
+			     uint8_t channel, uint8_t pcm_bit_depth, void *output,
+			     size_t output_size);
+
+#endif /* _PSCM_LEGACY_H_ */
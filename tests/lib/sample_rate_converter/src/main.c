@@ -8,6 +8,7 @@
 #include <zephyr/tc_util.h>
 #include <sample_rate_converter.h>
 #include <stdlib.h>
+#include <math.h>
 
 struct sample_rate_converter_ctx conv_ctx;
 
@@ -823,6 +824,7 @@ ZTEST(suite_sample_rate_converter, test_init_valid_sample_rates_changed)
 		      "Output sample rate not as expected");
 }
 
+#ifndef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
 ZTEST(suite_sample_rate_converter, test_init_invalid_sample_rates)
 {
 	int ret;
@@ -877,6 +879,7 @@ ZTEST(suite_sample_rate_converter, test_init_invalid_sample_rates)
 
 	zassert_equal(ret, -EINVAL, "Sample rate conversion process did not fail");
 }
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 
 ZTEST(suite_sample_rate_converter, test_init_invalid_sample_rates_equal)
 {
@@ -1152,4 +1155,192 @@ ZTEST(suite_sample_rate_converter, test_invalid_process_output_buf_too_small)
 		      "Sample rate conversion process did not fail when output buffer is to small");
 }
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t test_sample_t;
+#define TEST_AMPLITUDE 16000.0
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t test_sample_t;
+#define TEST_AMPLITUDE 1000000000.0
+#endif
+
+/* Filter delay of the polyphase conversion in input samples */
+#define POLYPHASE_DELAY (CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS / 2)
+
+#define POLYPHASE_TEST_SAMPLES_IN 4410
+
+static test_sample_t polyphase_input[POLYPHASE_TEST_SAMPLES_IN];
+static test_sample_t polyphase_output[POLYPHASE_TEST_SAMPLES_IN * 2];
+static test_sample_t polyphase_output_ref[POLYPHASE_TEST_SAMPLES_IN * 2];
+
+static void sine_fill(test_sample_t *buf, size_t num_samples, uint32_t freq, uint32_t sample_rate)
+{
+	for (size_t i = 0; i < num_samples; i++) {
+		buf[i] = TEST_AMPLITUDE * sin(2.0 * PI * freq * i / sample_rate);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_44khz_to_48khz)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 44100;
+	uint32_t output_sample_rate = 48000;
+	uint32_t freq = 1000;
+	size_t block_samples = 441;
+	size_t total_written = 0;
+
+	sine_fill(polyphase_input, POLYPHASE_TEST_SAMPLES_IN, freq, input_sample_rate);
+
+	for (size_t i = 0; i < POLYPHASE_TEST_SAMPLES_IN; i += block_samples) {
+		size_t output_written;
+
+		ret = sample_rate_converter_process(
+			&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, &polyphase_input[i],
+			block_samples * sizeof(test_sample_t), input_sample_rate,
+			&polyphase_output[total_written],
+			(block_samples * 2) * sizeof(test_sample_t), &output_written,
+			output_sample_rate);
+
+		zassert_equal(ret, 0, "Sample rate conversion process failed");
+		zassert_equal(conv_ctx.conversion_ratio, 0, "Polyphase conversion not used");
+		zassert_within(output_written / sizeof(test_sample_t), 480, 1,
+			       "Unexpected number of output samples");
+
+		total_written += output_written / sizeof(test_sample_t);
+	}
+
+	zassert_within(total_written, 4800, 1, "Output samples do not match the ratio");
+
+	/* Compare with the ideal sine at the output sample rate, delayed by the filter. Skip the
+	 * first samples, where the filter window includes the zeroed history.
+	 */
+	for (size_t k = 2 * CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS; k < total_written; k++) {
+		double t = (double)k * input_sample_rate / output_sample_rate - POLYPHASE_DELAY;
+		double expected = TEST_AMPLITUDE * sin(2.0 * PI * freq * t / input_sample_rate);
+
+		zassert_within(polyphase_output[k], (test_sample_t)expected, TEST_AMPLITUDE / 100,
+			       "Output sample %d not as expected", k);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_stream_block_sizes)
+{
+	int ret;
+	size_t input_used;
+	size_t output_written;
+	size_t in_pos = 0;
+	size_t out_pos = 0;
+	size_t ref_written;
+	uint32_t state = 1;
+
+	sine_fill(polyphase_input, POLYPHASE_TEST_SAMPLES_IN, 3000, 48000);
+
+	/* Convert everything in one call as the reference */
+	ret = sample_rate_converter_stream_open(&conv_ctx, 48000, 44100);
+	zassert_equal(ret, 0, "Failed to open stream");
+
+	ret = sample_rate_converter_stream_process(&conv_ctx, polyphase_input,
+						   sizeof(polyphase_input), &input_used,
+						   polyphase_output_ref,
+						   sizeof(polyphase_output_ref), &ref_written);
+	zassert_equal(ret, 0, "Stream process failed");
+	zassert_equal(input_used, sizeof(polyphase_input), "Not all input was used");
+
+	/* Convert again with varying input and output sizes, including output arrays that are
+	 * too small for the input. The result must be the same.
+	 */
+	ret = sample_rate_converter_stream_open(&conv_ctx, 48000, 44100);
+	zassert_equal(ret, 0, "Failed to open stream");
+
+	while (in_pos < POLYPHASE_TEST_SAMPLES_IN) {
+		state = state * 1103515245 + 12345;
+
+		size_t in_samples = 1 + (state >> 16) % 100;
+		size_t out_samples = (state >> 8) % 100;
+
+		in_samples = MIN(in_samples, POLYPHASE_TEST_SAMPLES_IN - in_pos);
+
+		ret = sample_rate_converter_stream_process(
+			&conv_ctx, &polyphase_input[in_pos], in_samples * sizeof(test_sample_t),
+			&input_used, &polyphase_output[out_pos],
+			out_samples * sizeof(test_sample_t), &output_written);
+		zassert_equal(ret, 0, "Stream process failed");
+		zassert_true(output_written <= out_samples * sizeof(test_sample_t),
+			     "Output array overrun");
+
+		in_pos += input_used / sizeof(test_sample_t);
+		out_pos += output_written / sizeof(test_sample_t);
+	}
+
+	zassert_equal(out_pos * sizeof(test_sample_t), ref_written,
+		      "Number of output samples differs with block sizes");
+	zassert_mem_equal(polyphase_output, polyphase_output_ref, ref_written,
+			  "Output differs with block sizes");
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_ratio_trim)
+{
+	int ret;
+	size_t input_used;
+	size_t output_written;
+	size_t total_written = 0;
+
+	memset(polyphase_input, 0, sizeof(polyphase_input));
+
+	ret = sample_rate_converter_stream_open(&conv_ctx, 48000, 48000);
+	zassert_equal(ret, 0, "Failed to open stream");
+
+	ret = sample_rate_converter_ratio_trim_set(&conv_ctx, SAMPLE_RATE_CONVERTER_TRIM_PPB_MAX);
+	zassert_equal(ret, 0, "Failed to set trim");
+
+	/* 1000 ppm more output samples, so 48048 output samples from 48000 input samples */
+	for (size_t i = 0; i < 48000; i += 480) {
+		ret = sample_rate_converter_stream_process(
+			&conv_ctx, polyphase_input, 480 * sizeof(test_sample_t), &input_used,
+			polyphase_output, sizeof(polyphase_output), &output_written);
+		zassert_equal(ret, 0, "Stream process failed");
+		zassert_equal(input_used, 480 * sizeof(test_sample_t), "Not all input was used");
+
+		total_written += output_written / sizeof(test_sample_t);
+	}
+
+	zassert_within(total_written, 48048, 1, "Trim not applied");
+
+	ret = sample_rate_converter_ratio_trim_set(&conv_ctx,
+						   -SAMPLE_RATE_CONVERTER_TRIM_PPB_MAX - 1);
+	zassert_equal(ret, -EINVAL, "Trim out of range did not fail");
+}
+
+ZTEST(suite_sample_rate_converter, test_polyphase_invalid)
+{
+	int ret;
+	size_t input_used;
+	size_t output_written;
+
+	/* Ratio larger than supported */
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, polyphase_input,
+					    480 * sizeof(test_sample_t), 48000, polyphase_output,
+					    sizeof(polyphase_output), &output_written, 8000);
+	zassert_equal(ret, -EINVAL, "Unsupported ratio did not fail");
+
+	ret = sample_rate_converter_stream_open(&conv_ctx, 0, 48000);
+	zassert_equal(ret, -EINVAL, "Invalid sample rate did not fail");
+
+	/* Output array too small for the 480 expected output samples */
+	ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, polyphase_input,
+					    441 * sizeof(test_sample_t), 44100, polyphase_output,
+					    470 * sizeof(test_sample_t), &output_written, 48000);
+	zassert_equal(ret, -EINVAL, "Too small output array did not fail");
+
+	/* Stream process on a context not opened for streaming */
+	sample_rate_converter_open(&conv_ctx);
+	ret = sample_rate_converter_stream_process(&conv_ctx, polyphase_input,
+						   sizeof(test_sample_t), &input_used,
+						   polyphase_output, sizeof(polyphase_output),
+						   &output_written);
+	zassert_equal(ret, -EINVAL, "Stream process on unopened context did not fail");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 ZTEST_SUITE(suite_sample_rate_converter, NULL, NULL, test_setup, NULL, NULL);
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <zephyr/ztest.h>
+#include <sample_rate_converter.h>
+
+#include "host_clock.h"
+
+/* 10 ms blocks, like an LC3 frame of the nRF5340 Audio applications */
+#define BLOCK_DURATION_MS	10
+#define BLOCK_SAMPLES(rate)	((rate) * BLOCK_DURATION_MS / MSEC_PER_SEC)
+#define BLOCK_SAMPLES_MAX	BLOCK_SAMPLES(48000)
+
+/* Number of blocks converted per tone of the sweep. The output of the first blocks is not
+ * measured, so that the filters have settled.
+ */
+#define BLOCKS_PER_TONE		20
+#define SETTLE_BLOCKS		2
+
+/* Tones of the sweep, from the lowest frequency in steps of half an octave up to the highest
+ * fraction of the lowest Nyquist frequency.
+ */
+#define SWEEP_FREQ_START_HZ	100.0
+#define SWEEP_FREQ_STEP		1.41421356
+#define SWEEP_FREQ_MAX_FRAC	0.8
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t bench_sample_t;
+#define SAMPLE_BITS 16
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t bench_sample_t;
+#define SAMPLE_BITS 32
+#endif
+
+/* Half of full scale, so that filter ripple does not clip */
+#define SWEEP_AMPLITUDE		((double)BIT64(SAMPLE_BITS - 1) / 2)
+
+struct bench_conversion {
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+	bool polyphase;
+};
+
+static const struct bench_conversion bench_conversions[] = {
+	/* The conversions supported by the CMSIS DSP filters, with both implementations */
+	{48000, 16000, false},
+	{48000, 16000, true},
+	{48000, 24000, false},
+	{48000, 24000, true},
+	{16000, 48000, false},
+	{16000, 48000, true},
+	{24000, 48000, false},
+	{24000, 48000, true},
+	/* Conversions only supported by the polyphase converter */
+	{44100, 48000, true},
+	{48000, 44100, true},
+	{32000, 48000, true},
+	{48000, 32000, true},
+};
+
+struct bench_result {
+	uint32_t blocks;
+	uint64_t cycles;
+	uint64_t ns;
+	double snr_min_db;
+	double snr_sum_db;
+	uint32_t tones;
+};
+
+static struct sample_rate_converter_ctx conv_ctx;
+static bench_sample_t input[BLOCK_SAMPLES_MAX];
+static bench_sample_t output[BLOCKS_PER_TONE * (BLOCK_SAMPLES_MAX + 1)];
+
+
+/**
+ * @brief Calculate the signal-to-noise ratio of a tone with a known frequency.
+ *
+ * @details Fits a sine, a cosine and an offset to the samples with the least squares method. The
+ *	    fitted sinusoid is the signal, and everything else is noise and distortion.
+ */
+static double snr_db_calculate(const bench_sample_t *samples, size_t num_samples, double omega)
+{
+	/* Normal equations for the fit of a * sin + b * cos + c */
+	double m[3][3] = {0};
+	double v[3] = {0};
+	double coef[3];
+	double det;
+	double signal = 0.0;
+	double noise = 0.0;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		double basis[3] = {sin(omega * i), cos(omega * i), 1.0};
+
+		for (size_t r = 0; r < 3; r++) {
+			for (size_t c = 0; c < 3; c++) {
+				m[r][c] += basis[r] * basis[c];
+			}
+			v[r] += basis[r] * samples[i];
+		}
+	}
+
+	/* Cramer's rule */
+	det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+	      m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+	      m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+	for (size_t k = 0; k < 3; k++) {
+		double mk[3][3];
+
+		memcpy(mk, m, sizeof(mk));
+		for (size_t r = 0; r < 3; r++) {
+			mk[r][k] = v[r];
+		}
+
+		coef[k] = (mk[0][0] * (mk[1][1] * mk[2][2] - mk[1][2] * mk[2][1]) -
+			   mk[0][1] * (mk[1][0] * mk[2][2] - mk[1][2] * mk[2][0]) +
+			   mk[0][2] * (mk[1][0] * mk[2][1] - mk[1][1] * mk[2][0])) /
+			  det;
+	}
+
+	for (size_t i = 0; i < num_samples; i++) {
+		double fit = coef[0] * sin(omega * i) + coef[1] * cos(omega * i);
+		double err = samples[i] - fit - coef[2];
+
+		signal += fit * fit;
+		noise += err * err;
+	}
+
+	return 10.0 * log10(signal / MAX(noise, 1e-30));
+}
+
+static size_t bench_block(const struct bench_conversion *conv, size_t samples_in,
+			  bench_sample_t *out, size_t out_size)
+{
+	int ret;
+	size_t input_used;
+	size_t output_written;
+
+	if (conv->polyphase) {
+		ret = sample_rate_converter_stream_process(
+			&conv_ctx, input, samples_in * sizeof(bench_sample_t), &input_used, out,
+			out_size, &output_written);
+		zassert_equal(input_used, samples_in * sizeof(bench_sample_t),
+			      "Not all input was used");
+	} else {
+		ret = sample_rate_converter_process(&conv_ctx, SAMPLE_RATE_FILTER_SIMPLE, input,
+						    samples_in * sizeof(bench_sample_t),
+						    conv->sample_rate_input, out, out_size,
+						    &output_written, conv->sample_rate_output);
+	}
+
+	zassert_equal(ret, 0, "Sample rate conversion failed: %d", ret);
+
+	return output_written / sizeof(bench_sample_t);
+}
+
+static void bench_tone(const struct bench_conversion *conv, double freq,
+		       struct bench_result *res)
+{
+	int ret;
+	size_t samples_in = BLOCK_SAMPLES(conv->sample_rate_input);
+	size_t measured = 0;
+	double omega_in = 2.0 * PI * freq / conv->sample_rate_input;
+
+	/* Start every tone from a fresh context, so that the previous tone does not leak in */
+	if (conv->polyphase) {
+		ret = sample_rate_converter_stream_open(&conv_ctx, conv->sample_rate_input,
+							conv->sample_rate_output);
+	} else {
+		ret = sample_rate_converter_open(&conv_ctx);
+	}
+
+	zassert_equal(ret, 0, "Failed to open converter: %d", ret);
+
+	for (uint32_t block = 0; block < BLOCKS_PER_TONE; block++) {
+		bench_sample_t *out = (block < SETTLE_BLOCKS) ? output : &output[measured];
+		size_t out_size = sizeof(output) - ((uint8_t *)out - (uint8_t *)output);
+
+		for (size_t i = 0; i < samples_in; i++) {
+			input[i] = SWEEP_AMPLITUDE * sin(omega_in * (block * samples_in + i));
+		}
+
+		uint64_t ns_start = host_clock_time_ns();
+		uint64_t cycles_start = host_clock_cycles();
+		size_t written = bench_block(conv, samples_in, out, out_size);
+		uint64_t cycles = host_clock_cycles() - cycles_start;
+		uint64_t ns = host_clock_time_ns() - ns_start;
+
+		/* The first block configures the integer converter, so it is not timed */
+		if (block > 0) {
+			res->cycles += cycles;
+			res->ns += ns;
+			res->blocks++;
+		}
+
+		if (block >= SETTLE_BLOCKS) {
+			measured += written;
+		}
+	}
+
+	double snr_db = snr_db_calculate(output, measured,
+					 2.0 * PI * freq / conv->sample_rate_output);
+
+	res->snr_min_db = MIN(res->snr_min_db, snr_db);
+	res->snr_sum_db += snr_db;
+	res->tones++;
+}
+
+static void bench_conversion_run(const struct bench_conversion *conv)
+{
+	struct bench_result res = {.snr_min_db = INFINITY};
+	uint32_t rate_min = MIN(conv->sample_rate_input, conv->sample_rate_output);
+
+	for (double freq = SWEEP_FREQ_START_HZ; freq < SWEEP_FREQ_MAX_FRAC * rate_min / 2;
+	     freq *= SWEEP_FREQ_STEP) {
+		bench_tone(conv, freq, &res);
+	}
+
+	/* Print the result in the format parsed by the Twister record harness. */
+	TC_PRINT("BENCH src_%s_%u_to_%u_%u blocks=%u cycles_per_block=%u ns_per_block=%u "
+		 "snr_min_db=%d snr_avg_db=%d\n",
+		 conv->polyphase ? "polyphase" : "integer", conv->sample_rate_input,
+		 conv->sample_rate_output, SAMPLE_BITS, res.blocks,
+		 (uint32_t)(res.cycles / res.blocks), (uint32_t)(res.ns / res.blocks),
+		 (int)res.snr_min_db, (int)(res.snr_sum_db / res.tones));
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_bench)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(bench_conversions); i++) {
+		bench_conversion_run(&bench_conversions[i]);
+	}
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_benchmark, NULL, NULL, NULL, NULL, NULL);
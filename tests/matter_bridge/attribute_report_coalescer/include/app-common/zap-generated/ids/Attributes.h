@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the generated attribute identifiers. */
+
+#include <app/util/attribute-storage.h>
+
+namespace chip
+{
+namespace app
+{
+namespace Clusters
+{
+namespace OnOff
+{
+namespace Attributes
+{
+namespace OnOff
+{
+constexpr AttributeId Id = 0x0000;
+} /* namespace OnOff */
+} /* namespace Attributes */
+} /* namespace OnOff */
+
+namespace TemperatureMeasurement
+{
+namespace Attributes
+{
+namespace MeasuredValue
+{
+constexpr AttributeId Id = 0x0000;
+} /* namespace MeasuredValue */
+} /* namespace Attributes */
+} /* namespace TemperatureMeasurement */
+
+namespace RelativeHumidityMeasurement
+{
+namespace Attributes
+{
+namespace MeasuredValue
+{
+constexpr AttributeId Id = 0x0000;
+} /* namespace MeasuredValue */
+} /* namespace Attributes */
+} /* namespace RelativeHumidityMeasurement */
+} /* namespace Clusters */
+} /* namespace app */
+} /* namespace chip */
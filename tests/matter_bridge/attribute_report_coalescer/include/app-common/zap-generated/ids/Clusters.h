@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the generated cluster identifiers. */
+
+#include <app/util/attribute-storage.h>
+
+namespace chip
+{
+namespace app
+{
+namespace Clusters
+{
+namespace OnOff
+{
+constexpr ClusterId Id = 0x0006;
+} /* namespace OnOff */
+
+namespace TemperatureMeasurement
+{
+constexpr ClusterId Id = 0x0402;
+} /* namespace TemperatureMeasurement */
+
+namespace RelativeHumidityMeasurement
+{
+constexpr ClusterId Id = 0x0405;
+} /* namespace RelativeHumidityMeasurement */
+} /* namespace Clusters */
+} /* namespace app */
+} /* namespace chip */
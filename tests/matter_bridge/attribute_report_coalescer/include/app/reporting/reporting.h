@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter reporting engine entry point, recorded by the test. */
+
+#include <app/util/attribute-storage.h>
+
+void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint, chip::ClusterId clusterId,
+					    chip::AttributeId attributeId);
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter data model types used by the attribute report coalescer. */
+
+#include <cstdint>
+
+namespace chip
+{
+using EndpointId = uint16_t;
+using ClusterId = uint32_t;
+using AttributeId = uint32_t;
+
+constexpr EndpointId kInvalidEndpointId = 0xFFFF;
+constexpr ClusterId kInvalidClusterId = 0xFFFF'FFFF;
+constexpr AttributeId kInvalidAttributeId = 0xFFFF'FFFF;
+} /* namespace chip */
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter device layer. */
+
+#include <system/SystemLayer.h>
+
+namespace chip
+{
+namespace DeviceLayer
+{
+System::Layer &SystemLayer();
+} /* namespace DeviceLayer */
+} /* namespace chip */
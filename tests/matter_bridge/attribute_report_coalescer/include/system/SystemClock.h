@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter system clock, advanced manually by the test. */
+
+#include <chrono>
+#include <cstdint>
+
+namespace chip
+{
+namespace System
+{
+namespace Clock
+{
+using Milliseconds32 = std::chrono::duration<uint32_t, std::milli>;
+using Milliseconds64 = std::chrono::duration<uint64_t, std::milli>;
+using Timestamp = Milliseconds64;
+using Timeout = Milliseconds32;
+
+constexpr Milliseconds32 kZero{ 0 };
+
+class ClockBase {
+public:
+	Timestamp GetMonotonicTimestamp() { return mNow; }
+	void Advance(Timestamp delta) { mNow += delta; }
+
+private:
+	Timestamp mNow{ 0 };
+};
+} /* namespace Clock */
+
+Clock::ClockBase &SystemClock();
+} /* namespace System */
+} /* namespace chip */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter system layer, with a single timer fired manually by the test. */
+
+#include "SystemClock.h"
+
+#include <cinttypes>
+
+#define CHIP_ERROR_FORMAT PRIu32
+
+namespace chip
+{
+class ChipError {
+public:
+	constexpr explicit ChipError(uint32_t code) : mCode(code) {}
+
+	bool operator==(const ChipError &other) const { return mCode == other.mCode; }
+	bool operator!=(const ChipError &other) const { return mCode != other.mCode; }
+	uint32_t Format() const { return mCode; }
+
+private:
+	uint32_t mCode;
+};
+} /* namespace chip */
+
+using CHIP_ERROR = ::chip::ChipError;
+
+#define CHIP_NO_ERROR CHIP_ERROR(0)
+#define CHIP_ERROR_NO_MEMORY CHIP_ERROR(0x0B)
+
+namespace chip
+{
+namespace System
+{
+class Layer;
+
+using TimerCompleteCallback = void (*)(Layer *layer, void *appState);
+
+class Layer {
+public:
+	CHIP_ERROR StartTimer(Clock::Timeout delay, TimerCompleteCallback callback, void *appState);
+
+	/* Test helpers. */
+	bool IsTimerPending() const { return mCallback != nullptr; }
+	Clock::Timeout GetTimerDelay() const { return mDelay; }
+	void FireTimer();
+	void SetStartTimerError(CHIP_ERROR error) { mStartTimerError = error; }
+	void Reset();
+
+private:
+	TimerCompleteCallback mCallback{ nullptr };
+	void *mAppState{ nullptr };
+	Clock::Timeout mDelay{ 0 };
+	CHIP_ERROR mStartTimerError{ CHIP_NO_ERROR };
+};
+} /* namespace System */
+} /* namespace chip */
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "attribute_report_coalescer.h"
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/reporting/reporting.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using namespace ::chip::app;
+using Nrf::AttributeReportCoalescer;
+
+namespace
+{
+constexpr size_t kMaxTrackedAttributes = CONFIG_BRIDGE_REPORT_MAX_TRACKED_ATTRIBUTES;
+constexpr System::Clock::Timestamp kMinInterval = System::Clock::Timestamp(CONFIG_BRIDGE_REPORT_MIN_INTERVAL_MS);
+constexpr EndpointId kEndpoint = 3;
+constexpr ClusterId kTemperature = Clusters::TemperatureMeasurement::Id;
+constexpr AttributeId kMeasuredValue = Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Id;
+constexpr ClusterId kOnOff = Clusters::OnOff::Id;
+constexpr AttributeId kOnOffAttribute = Clusters::OnOff::Attributes::OnOff::Id;
+constexpr size_t kMaxReports = 64;
+
+struct Report {
+	EndpointId mEndpointId;
+	ClusterId mClusterId;
+	AttributeId mAttributeId;
+};
+
+Report sReports[kMaxReports];
+size_t sReportsCount;
+
+System::Clock::ClockBase sClock;
+System::Layer sSystemLayer;
+
+void MarkTemperature(AttributeReportCoalescer &coalescer, EndpointId endpoint, int16_t value)
+{
+	coalescer.MarkDirty(endpoint, kTemperature, kMeasuredValue, &value, sizeof(value));
+}
+
+void MarkOnOff(AttributeReportCoalescer &coalescer, EndpointId endpoint)
+{
+	bool value = true;
+
+	coalescer.MarkDirty(endpoint, kOnOff, kOnOffAttribute, &value, sizeof(value));
+}
+
+/* Runs the pending flush when its delay passes, as the Matter thread would. */
+void RunPendingFlush()
+{
+	zassert_true(sSystemLayer.IsTimerPending());
+	sClock.Advance(sSystemLayer.GetTimerDelay());
+	sSystemLayer.FireTimer();
+}
+
+void Before(void *)
+{
+	sReportsCount = 0;
+	sSystemLayer.Reset();
+	/* Start every test after the minimum interval since any previous flush. */
+	sClock.Advance(kMinInterval);
+}
+} /* namespace */
+
+void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+	if (sReportsCount < kMaxReports) {
+		sReports[sReportsCount] = { endpoint, clusterId, attributeId };
+	}
+	sReportsCount++;
+}
+
+namespace chip
+{
+System::Clock::ClockBase &System::SystemClock()
+{
+	return sClock;
+}
+
+System::Layer &DeviceLayer::SystemLayer()
+{
+	return sSystemLayer;
+}
+
+CHIP_ERROR System::Layer::StartTimer(Clock::Timeout delay, TimerCompleteCallback callback, void *appState)
+{
+	if (mStartTimerError != CHIP_NO_ERROR) {
+		return mStartTimerError;
+	}
+
+	mDelay = delay;
+	mCallback = callback;
+	mAppState = appState;
+
+	return CHIP_NO_ERROR;
+}
+
+void System::Layer::FireTimer()
+{
+	TimerCompleteCallback callback = mCallback;
+
+	mCallback = nullptr;
+	callback(this, mAppState);
+}
+
+void System::Layer::Reset()
+{
+	mCallback = nullptr;
+	mStartTimerError = CHIP_NO_ERROR;
+}
+} /* namespace chip */
+
+ZTEST(attribute_report_coalescer, test_first_change_reported_immediately)
+{
+	AttributeReportCoalescer coalescer;
+
+	MarkOnOff(coalescer, kEndpoint);
+
+	/* The report is deferred to the Matter thread, but without any delay. */
+	zassert_equal(sReportsCount, 0);
+	zassert_true(sSystemLayer.IsTimerPending());
+	zassert_equal(sSystemLayer.GetTimerDelay().count(), 0);
+
+	RunPendingFlush();
+
+	zassert_equal(sReportsCount, 1);
+	zassert_equal(sReports[0].mEndpointId, kEndpoint);
+	zassert_equal(sReports[0].mClusterId, kOnOff);
+	zassert_equal(sReports[0].mAttributeId, kOnOffAttribute);
+}
+
+ZTEST(attribute_report_coalescer, test_burst_coalesced)
+{
+	constexpr size_t kUpdates = 100;
+	AttributeReportCoalescer coalescer;
+
+	MarkOnOff(coalescer, kEndpoint);
+	RunPendingFlush();
+	zassert_equal(sReportsCount, 1);
+
+	/* Updates following the flush within the minimum interval result in a single report. */
+	for (size_t i = 0; i < kUpdates; i++) {
+		MarkOnOff(coalescer, kEndpoint);
+		zassert_equal(sReportsCount, 1);
+	}
+
+	zassert_equal(sSystemLayer.GetTimerDelay(), kMinInterval);
+	RunPendingFlush();
+
+	zassert_equal(sReportsCount, 2);
+	zassert_false(sSystemLayer.IsTimerPending());
+
+	const AttributeReportCoalescer::Statistics &statistics = coalescer.GetStatistics();
+
+	zassert_equal(statistics.mUpdates, kUpdates + 1);
+	zassert_equal(statistics.mReports, 2);
+	zassert_equal(statistics.mCoalesced, kUpdates - 1);
+}
+
+ZTEST(attribute_report_coalescer, test_batch_of_attributes)
+{
+	AttributeReportCoalescer coalescer;
+
+	MarkOnOff(coalescer, kEndpoint);
+	MarkOnOff(coalescer, kEndpoint + 1);
+	MarkTemperature(coalescer, kEndpoint + 2, 2000);
+	RunPendingFlush();
+
+	/* Every attribute is reported once, in one batch. */
+	zassert_equal(sReportsCount, 3);
+	zassert_equal(sReports[0].mEndpointId, kEndpoint);
+	zassert_equal(sReports[1].mEndpointId, kEndpoint + 1);
+	zassert_equal(sReports[2].mEndpointId, kEndpoint + 2);
+	zassert_equal(sReports[2].mClusterId, kTemperature);
+}
+
+ZTEST(attribute_report_coalescer, test_delta)
+{
+	AttributeReportCoalescer coalescer;
+
+	MarkTemperature(coalescer, kEndpoint, 2000);
+	RunPendingFlush();
+	zassert_equal(sReportsCount, 1);
+
+	/* Changes below the delta since the last reported value are dropped, until they accumulate. */
+	MarkTemperature(coalescer, kEndpoint, 2020);
+	MarkTemperature(coalescer, kEndpoint, 2049);
+	zassert_false(sSystemLayer.IsTimerPending());
+	zassert_equal(coalescer.GetStatistics().mSuppressedByDelta, 2);
+
+	MarkTemperature(coalescer, kEndpoint, 2050);
+	RunPendingFlush();
+	zassert_equal(sReportsCount, 2);
+
+	/* The null value is always reported. */
+	MarkTemperature(coalescer, kEndpoint, INT16_MIN);
+	RunPendingFlush();
+	zassert_equal(sReportsCount, 3);
+}
+
+ZTEST(attribute_report_coalescer, test_overflow_reported_immediately)
+{
+	AttributeReportCoalescer coalescer;
+
+	for (EndpointId endpoint = kEndpoint; endpoint < kEndpoint + kMaxTrackedAttributes; endpoint++) {
+		MarkOnOff(coalescer, endpoint);
+	}
+	RunPendingFlush();
+	zassert_equal(sReportsCount, kMaxTrackedAttributes);
+
+	/* The table is full, so changes of another attribute bypass coalescing and are reported right away. */
+	const EndpointId overflowEndpoint = kEndpoint + kMaxTrackedAttributes;
+
+	MarkOnOff(coalescer, overflowEndpoint);
+	zassert_equal(sReportsCount, kMaxTrackedAttributes + 1);
+	zassert_equal(sReports[kMaxTrackedAttributes].mEndpointId, overflowEndpoint);
+	MarkOnOff(coalescer, overflowEndpoint);
+	zassert_equal(sReportsCount, kMaxTrackedAttributes + 2);
+	zassert_false(sSystemLayer.IsTimerPending());
+
+	/* Removing an endpoint frees its slot for the next attribute. */
+	coalescer.RemoveEndpoint(kEndpoint);
+	MarkOnOff(coalescer, overflowEndpoint);
+	zassert_equal(sReportsCount, kMaxTrackedAttributes + 2);
+	RunPendingFlush();
+	zassert_equal(sReportsCount, kMaxTrackedAttributes + 3);
+}
+
+ZTEST(attribute_report_coalescer, test_timer_failure)
+{
+	AttributeReportCoalescer coalescer;
+
+	/* Without the timer the change is reported synchronously instead of being lost. */
+	sSystemLayer.SetStartTimerError(CHIP_ERROR_NO_MEMORY);
+	MarkOnOff(coalescer, kEndpoint);
+
+	zassert_equal(sReportsCount, 1);
+	zassert_false(sSystemLayer.IsTimerPending());
+}
+
+ZTEST_SUITE(attribute_report_coalescer, NULL, NULL, Before, NULL, NULL);
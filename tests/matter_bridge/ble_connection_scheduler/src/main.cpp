@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_connection_scheduler.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+LOG_MODULE_REGISTER(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using Nrf::BLEBridgedDeviceProvider;
+using Nrf::BLEConnectionScheduler;
+
+namespace
+{
+constexpr uint8_t kPeerCount = BLEConnectionScheduler::kMaxEntries;
+constexpr uint32_t kConnectTimeoutMs = 2000;
+constexpr uint32_t kDiscoveryTimeoutMs = 10000;
+constexpr uint32_t kBusyRetryMs = 100;
+constexpr k_timeout_t kRunTimeout = K_SECONDS(120);
+
+/* Limits used by the bridge: one connection attempt and one GATT discovery at a time, overlapping each other. */
+constexpr BLEConnectionScheduler::Limits kBridgeLimits = { kPeerCount, 1, 1, kConnectTimeoutMs, kDiscoveryTimeoutMs,
+							   kBusyRetryMs };
+/* One device connected and discovered after another, as the bridge used to recover the devices. */
+constexpr BLEConnectionScheduler::Limits kSequentialLimits = { 1, 1, 1, kConnectTimeoutMs, kDiscoveryTimeoutMs,
+							       kBusyRetryMs };
+/* All devices at once, as allowed by a stack without the limits of the Bluetooth host and GATT Discovery Manager. */
+constexpr BLEConnectionScheduler::Limits kParallelLimits = { kPeerCount, kPeerCount, kPeerCount, kConnectTimeoutMs,
+							     kDiscoveryTimeoutMs, kBusyRetryMs };
+
+/* Number of operations of each kind that the simulated stack can run at a time. */
+struct StackCapabilities {
+	uint8_t mConnecting;
+	uint8_t mDiscovering;
+};
+
+constexpr StackCapabilities kBridgeStack = { 1, 1 };
+constexpr StackCapabilities kParallelStack = { kPeerCount, kPeerCount };
+
+struct SimulatedPeer {
+	enum class State : uint8_t { Idle, Connecting, Connected, Discovering, Reachable };
+	enum class Failure : uint8_t { None, Connection, Discovery };
+
+	k_work_delayable mWork;
+	uint32_t mConnectLatencyMs;
+	uint32_t mDiscoveryLatencyMs;
+	Failure mFailure;
+	State mState;
+	int64_t mReachableTime;
+};
+
+class Simulation;
+Simulation *sSimulation;
+
+/* Runs the scheduler on the system work queue against a simulated Bluetooth stack, in which every peer completes the
+ * connection and the discovery after its own latency, unless it is set to be unresponsive. */
+class Simulation {
+public:
+	Simulation(const BLEConnectionScheduler::Limits &limits, const StackCapabilities &stack)
+		: mScheduler(kOperations, limits, this), mStack(stack)
+	{
+		for (uint8_t i = 0; i < kPeerCount; i++) {
+			InitPeer(mPeers[i], i);
+		}
+
+		k_sem_init(&mIdleSem, 0, 1);
+		k_work_init(&mStartWork, StartWorkHandler);
+		k_work_init_delayable(&mTimerWork, TimerWorkHandler);
+		sSimulation = this;
+	}
+
+	~Simulation()
+	{
+		k_work_cancel_delayable_sync(&mTimerWork, &mSync);
+
+		for (auto &peer : mPeers) {
+			k_work_cancel_delayable_sync(&peer.mWork, &mSync);
+		}
+
+		sSimulation = nullptr;
+	}
+
+	static void InitPeer(SimulatedPeer &peer, uint8_t index)
+	{
+		peer = {};
+		/* Spread the latencies to resemble devices with different connection intervals. */
+		peer.mConnectLatencyMs = 100 + (index * 37) % 150;
+		peer.mDiscoveryLatencyMs = 500 + (index * 53) % 400;
+		k_work_init_delayable(&peer.mWork, PeerWorkHandler);
+	}
+
+	static BLEBridgedDeviceProvider *ToProvider(SimulatedPeer &peer)
+	{
+		return reinterpret_cast<BLEBridgedDeviceProvider *>(&peer);
+	}
+
+	static SimulatedPeer &ToPeer(BLEBridgedDeviceProvider *provider)
+	{
+		return *reinterpret_cast<SimulatedPeer *>(provider);
+	}
+
+	void SetFailure(uint8_t index, SimulatedPeer::Failure failure) { mPeers[index].mFailure = failure; }
+	void SetBusyAttempts(uint8_t attempts) { mBusyAttempts = attempts; }
+	BLEConnectionScheduler &Scheduler() { return mScheduler; }
+	SimulatedPeer &Peer(uint8_t index) { return mPeers[index]; }
+
+	/* Queues all peers, as the recovery scan does, and returns the time until the last one became reachable. */
+	int64_t Run()
+	{
+		mStartTime = k_uptime_get();
+		k_work_submit(&mStartWork);
+
+		return WaitForIdle();
+	}
+
+	int64_t WaitForIdle()
+	{
+		zassert_ok(k_sem_take(&mIdleSem, kRunTimeout));
+
+		int64_t lastReachable = mStartTime;
+
+		for (const auto &peer : mPeers) {
+			if (peer.mState == SimulatedPeer::State::Reachable && peer.mReachableTime > lastReachable) {
+				lastReachable = peer.mReachableTime;
+			}
+		}
+
+		return lastReachable - mStartTime;
+	}
+
+	uint8_t ReachableCount() const
+	{
+		uint8_t count = 0;
+
+		for (const auto &peer : mPeers) {
+			if (peer.mState == SimulatedPeer::State::Reachable) {
+				count++;
+			}
+		}
+
+		return count;
+	}
+
+	/* Time needed to connect and discover all responsive peers one after another. */
+	int64_t SequentialTimeMs() const
+	{
+		int64_t time = 0;
+
+		for (const auto &peer : mPeers) {
+			if (peer.mFailure == SimulatedPeer::Failure::None) {
+				time += peer.mConnectLatencyMs + peer.mDiscoveryLatencyMs;
+			}
+		}
+
+		return time;
+	}
+
+	void MarkStart() { mStartTime = k_uptime_get(); }
+
+private:
+	static void StartWorkHandler(k_work *work)
+	{
+		for (auto &peer : sSimulation->mPeers) {
+			sSimulation->mScheduler.Enqueue(ToProvider(peer));
+		}
+	}
+
+	static void TimerWorkHandler(k_work *work) { sSimulation->mScheduler.OnTimer(); }
+
+	static void PeerWorkHandler(k_work *work)
+	{
+		k_work_delayable *delayable = k_work_delayable_from_work(work);
+		SimulatedPeer &peer = *CONTAINER_OF(delayable, SimulatedPeer, mWork);
+
+		if (peer.mState == SimulatedPeer::State::Connecting) {
+			peer.mState = SimulatedPeer::State::Connected;
+			sSimulation->mConnecting--;
+			sSimulation->mScheduler.OnConnected(ToProvider(peer), true);
+		} else if (peer.mState == SimulatedPeer::State::Discovering) {
+			peer.mState = SimulatedPeer::State::Connected;
+			sSimulation->mDiscovering--;
+			sSimulation->mScheduler.OnDiscovered(ToProvider(peer), true);
+		}
+	}
+
+	static BLEConnectionScheduler::Result Connect(BLEBridgedDeviceProvider *provider, void *context)
+	{
+		auto *simulation = reinterpret_cast<Simulation *>(context);
+		SimulatedPeer &peer = ToPeer(provider);
+
+		if (simulation->mBusyAttempts > 0) {
+			simulation->mBusyAttempts--;
+			return BLEConnectionScheduler::Result::Busy;
+		}
+
+		if (simulation->mConnecting >= simulation->mStack.mConnecting) {
+			return BLEConnectionScheduler::Result::Busy;
+		}
+
+		simulation->mConnecting++;
+		peer.mState = SimulatedPeer::State::Connecting;
+
+		if (peer.mFailure != SimulatedPeer::Failure::Connection) {
+			k_work_schedule(&peer.mWork, K_MSEC(peer.mConnectLatencyMs));
+		}
+
+		return BLEConnectionScheduler::Result::Started;
+	}
+
+	static BLEConnectionScheduler::Result Discover(BLEBridgedDeviceProvider *provider, void *context)
+	{
+		auto *simulation = reinterpret_cast<Simulation *>(context);
+		SimulatedPeer &peer = ToPeer(provider);
+
+		if (simulation->mDiscovering >= simulation->mStack.mDiscovering) {
+			return BLEConnectionScheduler::Result::Busy;
+		}
+
+		simulation->mDiscovering++;
+		peer.mState = SimulatedPeer::State::Discovering;
+
+		if (peer.mFailure != SimulatedPeer::Failure::Discovery) {
+			k_work_schedule(&peer.mWork, K_MSEC(peer.mDiscoveryLatencyMs));
+		}
+
+		return BLEConnectionScheduler::Result::Started;
+	}
+
+	static void Finished(BLEBridgedDeviceProvider *provider, bool success, void *context)
+	{
+		auto *simulation = reinterpret_cast<Simulation *>(context);
+		SimulatedPeer &peer = ToPeer(provider);
+
+		if (success) {
+			peer.mState = SimulatedPeer::State::Reachable;
+			peer.mReachableTime = k_uptime_get();
+			return;
+		}
+
+		/* Release the connection, like the bridge disconnects the device or cancels the connection attempt. */
+		k_work_cancel_delayable(&peer.mWork);
+
+		if (peer.mState == SimulatedPeer::State::Connecting) {
+			simulation->mConnecting--;
+		} else if (peer.mState == SimulatedPeer::State::Discovering) {
+			simulation->mDiscovering--;
+		}
+
+		peer.mState = SimulatedPeer::State::Idle;
+	}
+
+	static void Idle(void *context) { k_sem_give(&reinterpret_cast<Simulation *>(context)->mIdleSem); }
+
+	static void StartTimer(uint32_t timeoutMs, void *context)
+	{
+		k_work_reschedule(&reinterpret_cast<Simulation *>(context)->mTimerWork, K_MSEC(timeoutMs));
+	}
+
+	static constexpr BLEConnectionScheduler::Operations kOperations = { Connect, Discover, Finished, Idle,
+									    StartTimer };
+
+	BLEConnectionScheduler mScheduler;
+	StackCapabilities mStack;
+	SimulatedPeer mPeers[kPeerCount];
+	uint8_t mConnecting = 0;
+	uint8_t mDiscovering = 0;
+	uint8_t mBusyAttempts = 0;
+	int64_t mStartTime = 0;
+	k_sem mIdleSem;
+	k_work mStartWork;
+	k_work_delayable mTimerWork;
+	k_work_sync mSync;
+};
+} /* namespace */
+
+ZTEST(ble_connection_scheduler, test_time_to_all_reachable)
+{
+	int64_t sequentialTime;
+	int64_t bridgeTime;
+	int64_t parallelTime;
+	int64_t expectedSequentialTime;
+
+	{
+		Simulation simulation(kSequentialLimits, kBridgeStack);
+
+		expectedSequentialTime = simulation.SequentialTimeMs();
+		sequentialTime = simulation.Run();
+		zassert_equal(simulation.ReachableCount(), kPeerCount);
+		zassert_equal(simulation.Scheduler().GetStatistics().mMaxInFlight, 1);
+	}
+
+	{
+		Simulation simulation(kBridgeLimits, kBridgeStack);
+
+		bridgeTime = simulation.Run();
+		zassert_equal(simulation.ReachableCount(), kPeerCount);
+		zassert_equal(simulation.Scheduler().GetStatistics().mDiscovered, kPeerCount);
+		zassert_true(simulation.Scheduler().GetStatistics().mMaxInFlight > 1);
+	}
+
+	{
+		Simulation simulation(kParallelLimits, kParallelStack);
+
+		parallelTime = simulation.Run();
+		zassert_equal(simulation.ReachableCount(), kPeerCount);
+		zassert_equal(simulation.Scheduler().GetStatistics().mMaxInFlight, kPeerCount);
+	}
+
+	TC_PRINT("Time to all %u devices reachable: sequential %lld ms, bridge limits %lld ms, parallel stack %lld ms\n",
+		 kPeerCount, static_cast<long long>(sequentialTime), static_cast<long long>(bridgeTime),
+		 static_cast<long long>(parallelTime));
+
+	zassert_true(sequentialTime >= expectedSequentialTime);
+	zassert_true(bridgeTime < sequentialTime);
+	zassert_true(parallelTime < bridgeTime);
+}
+
+ZTEST(ble_connection_scheduler, test_unresponsive_peers_skipped)
+{
+	Simulation simulation(kBridgeLimits, kBridgeStack);
+
+	simulation.SetFailure(0, SimulatedPeer::Failure::Connection);
+	simulation.SetFailure(kPeerCount / 2, SimulatedPeer::Failure::Discovery);
+
+	const int64_t time = simulation.Run();
+	const auto &statistics = simulation.Scheduler().GetStatistics();
+
+	TC_PRINT("Time to %u devices reachable with 2 unresponsive ones: %lld ms\n", kPeerCount - 2,
+		 static_cast<long long>(time));
+
+	zassert_equal(simulation.ReachableCount(), kPeerCount - 2);
+	zassert_equal(statistics.mTimedOut, 2);
+	zassert_equal(statistics.mFailed, 2);
+	zassert_equal(simulation.Peer(0).mState, SimulatedPeer::State::Idle);
+	zassert_equal(simulation.Peer(kPeerCount / 2).mState, SimulatedPeer::State::Idle);
+	/* Every unresponsive device delays the remaining ones by no more than its timeout. */
+	zassert_true(time < simulation.SequentialTimeMs() + kConnectTimeoutMs + kDiscoveryTimeoutMs);
+}
+
+ZTEST(ble_connection_scheduler, test_busy_stack_retried)
+{
+	Simulation simulation(kBridgeLimits, kBridgeStack);
+
+	simulation.SetBusyAttempts(3);
+	simulation.Run();
+
+	zassert_equal(simulation.ReachableCount(), kPeerCount);
+	zassert_equal(simulation.Scheduler().GetStatistics().mFailed, 0);
+}
+
+ZTEST(ble_connection_scheduler, test_bounded_queue)
+{
+	Simulation simulation(kBridgeLimits, kBridgeStack);
+	SimulatedPeer extraPeer;
+
+	Simulation::InitPeer(extraPeer, kPeerCount);
+	simulation.MarkStart();
+
+	/* Keep the work queue from handling the started operations until all peers are queued. */
+	k_sched_lock();
+
+	for (uint8_t i = 0; i < kPeerCount; i++) {
+		zassert_true(simulation.Scheduler().Enqueue(Simulation::ToProvider(simulation.Peer(i))));
+	}
+
+	zassert_true(simulation.Scheduler().Enqueue(Simulation::ToProvider(simulation.Peer(0))));
+	zassert_false(simulation.Scheduler().Enqueue(Simulation::ToProvider(extraPeer)));
+	zassert_false(simulation.Scheduler().Contains(Simulation::ToProvider(extraPeer)));
+
+	k_sched_unlock();
+
+	simulation.WaitForIdle();
+
+	zassert_equal(simulation.ReachableCount(), kPeerCount);
+	zassert_equal(extraPeer.mState, SimulatedPeer::State::Idle);
+}
+
+ZTEST_SUITE(ble_connection_scheduler, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_recovery_policy.h"
+
+#include <zephyr/ztest.h>
+
+using Nrf::BLERecoveryPolicy;
+
+namespace
+{
+constexpr uint32_t kIntervalMs = 1000;
+constexpr uint32_t kMaxIntervalMs = 60000;
+constexpr int64_t kRecentlyLostMs = 30000;
+constexpr uint32_t kWindowMs = 60000;
+constexpr uint32_t kBudgetMs = 6000;
+constexpr uint32_t kScanTimeMs = 2000;
+
+constexpr BLERecoveryPolicy::Config kConfig = { kIntervalMs, kMaxIntervalMs, kRecentlyLostMs, kWindowMs, kBudgetMs };
+
+/* Checks that the backoff stays in the second half of the interval, and that the random number reaches both ends. */
+void CheckBackoffRange(const BLERecoveryPolicy &policy, uint16_t failedAttempts, int64_t lostTimeMs, int64_t now,
+		       uint32_t intervalMs)
+{
+	const uint32_t half = intervalMs / 2;
+
+	zassert_equal(policy.GetBackoffMs(failedAttempts, lostTimeMs, now, 0), half);
+	zassert_equal(policy.GetBackoffMs(failedAttempts, lostTimeMs, now, half), intervalMs);
+	zassert_equal(policy.GetBackoffMs(failedAttempts, lostTimeMs, now, half + 1), half);
+
+	for (uint32_t i = 0; i < 1000; i++) {
+		const uint32_t backoff = policy.GetBackoffMs(failedAttempts, lostTimeMs, now, i * 7919);
+
+		zassert_between_inclusive(backoff, half, intervalMs);
+	}
+
+	zassert_between_inclusive(policy.GetBackoffMs(failedAttempts, lostTimeMs, now, UINT32_MAX), half, intervalMs);
+}
+} /* namespace */
+
+ZTEST(ble_recovery_policy, test_backoff_recently_lost)
+{
+	const BLERecoveryPolicy policy(kConfig);
+	constexpr int64_t kLostTimeMs = 5000;
+
+	/* The recently lost devices are looked for with the base interval, whatever the number of failed attempts. */
+	CheckBackoffRange(policy, 0, kLostTimeMs, kLostTimeMs, kIntervalMs);
+	CheckBackoffRange(policy, 10, kLostTimeMs, kLostTimeMs + kRecentlyLostMs - 1, kIntervalMs);
+}
+
+ZTEST(ble_recovery_policy, test_backoff_growth)
+{
+	const BLERecoveryPolicy policy(kConfig);
+	constexpr int64_t kLostTimeMs = 5000;
+	constexpr int64_t kNow = kLostTimeMs + kRecentlyLostMs;
+
+	/* The interval doubles with every failed attempt, up to the maximum. */
+	CheckBackoffRange(policy, 0, kLostTimeMs, kNow, kIntervalMs);
+	CheckBackoffRange(policy, 1, kLostTimeMs, kNow, 2 * kIntervalMs);
+	CheckBackoffRange(policy, 5, kLostTimeMs, kNow, 32 * kIntervalMs);
+	CheckBackoffRange(policy, 6, kLostTimeMs, kNow, kMaxIntervalMs);
+
+	/* The shift is limited, so a large number of attempts does not overflow the interval. */
+	CheckBackoffRange(policy, 40, kLostTimeMs, kNow, kMaxIntervalMs);
+	CheckBackoffRange(policy, UINT16_MAX, kLostTimeMs, kNow, kMaxIntervalMs);
+}
+
+ZTEST(ble_recovery_policy, test_backoff_jitter)
+{
+	const BLERecoveryPolicy policy(kConfig);
+	constexpr uint16_t kAttempts = 3;
+	constexpr int64_t kNow = kRecentlyLostMs;
+	const uint32_t first = policy.GetBackoffMs(kAttempts, 0, kNow, 0);
+	bool spread = false;
+
+	/* Devices lost at the same time get different backoffs, so they are not looked for in lockstep. */
+	for (uint32_t random = 1; random < 16; random++) {
+		spread |= policy.GetBackoffMs(kAttempts, 0, kNow, random) != first;
+	}
+
+	zassert_true(spread);
+}
+
+ZTEST(ble_recovery_policy, test_scan_budget)
+{
+	BLERecoveryPolicy policy(kConfig);
+	constexpr int64_t kInitTimeMs = 50000;
+	uint32_t waitMs = 0;
+	int64_t now = kInitTimeMs;
+
+	/* The first window starts at the initialization, not at the boot. */
+	policy.Init(kInitTimeMs);
+
+	for (uint32_t usedMs = 0; usedMs < kBudgetMs; usedMs += kScanTimeMs) {
+		zassert_true(policy.ConsumeScanBudget(now, kScanTimeMs, waitMs));
+		now += kScanTimeMs;
+	}
+
+	/* The budget is used up, so the scan is postponed until the next window. */
+	zassert_false(policy.ConsumeScanBudget(now, kScanTimeMs, waitMs));
+	zassert_equal(waitMs, kInitTimeMs + kWindowMs - now);
+
+	now = kInitTimeMs + kWindowMs - 1;
+	zassert_false(policy.ConsumeScanBudget(now, kScanTimeMs, waitMs));
+	zassert_equal(waitMs, 1);
+
+	now = kInitTimeMs + kWindowMs;
+	zassert_true(policy.ConsumeScanBudget(now, kScanTimeMs, waitMs));
+}
+
+ZTEST(ble_recovery_policy, test_scan_longer_than_budget)
+{
+	BLERecoveryPolicy policy(kConfig);
+	uint32_t waitMs = 0;
+
+	policy.Init(0);
+
+	/* A single scan is allowed in every window, even if it is longer than the budget. */
+	zassert_true(policy.ConsumeScanBudget(0, 2 * kBudgetMs, waitMs));
+	zassert_false(policy.ConsumeScanBudget(2 * kBudgetMs, kScanTimeMs, waitMs));
+	zassert_equal(waitMs, kWindowMs - 2 * kBudgetMs);
+	zassert_true(policy.ConsumeScanBudget(kWindowMs, 2 * kBudgetMs, waitMs));
+}
+
+ZTEST_SUITE(ble_recovery_policy, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the bridged device, providing only the sizes used by the storage manager. */
+
+#include <cstdint>
+
+namespace Nrf
+{
+class MatterBridgedDevice {
+public:
+	static constexpr uint8_t kNodeLabelSize = 32;
+	static constexpr uint8_t kUniqueIDSize = 32;
+};
+} /* namespace Nrf */
@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bridge_storage_manager.h"
+#include "settings_mock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+
+#include <cstdio>
+#include <utility>
+
+LOG_MODULE_REGISTER(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using Nrf::BridgeStorageManager;
+using Nrf::MatterBridgedDevice;
+
+namespace
+{
+constexpr uint8_t kMaxDevices = CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
+constexpr uint8_t kUserDataSize = 7;
+constexpr uint16_t kDeviceType = 0x0302;
+
+/* Bridged device together with the buffers it points to. */
+struct TestDevice {
+	BridgeStorageManager::BridgedDevice mDevice;
+	uint8_t mUserData[BridgeStorageManager::kMaxUserDataSize];
+};
+
+void MakeDevice(uint8_t index, TestDevice &device, const char *label = "Sensor")
+{
+	device.mDevice.mEndpointId = 3 + index;
+	device.mDevice.mDeviceType = kDeviceType;
+	device.mDevice.mUniqueIDLength = snprintf(device.mDevice.mUniqueID, sizeof(device.mDevice.mUniqueID),
+						  "0123456789ABCDEF%02u", index);
+	device.mDevice.mNodeLabelLength =
+		snprintf(device.mDevice.mNodeLabel, sizeof(device.mDevice.mNodeLabel), "%s %u", label, index);
+
+	for (uint8_t i = 0; i < kUserDataSize; i++) {
+		device.mUserData[i] = index + i;
+	}
+	device.mDevice.mUserData = device.mUserData;
+	device.mDevice.mUserDataSize = kUserDataSize;
+}
+
+void StoreDevices(BridgeStorageManager &storage, uint8_t count)
+{
+	TestDevice device;
+
+	storage.StartTransaction();
+
+	for (uint8_t index = 0; index < count; index++) {
+		MakeDevice(index, device);
+		zassert_true(storage.StoreBridgedDevice(device.mDevice, index));
+	}
+
+	zassert_true(storage.CommitTransaction());
+}
+
+void CheckDevice(BridgeStorageManager &storage, uint8_t index, const char *label = "Sensor")
+{
+	TestDevice expected;
+	TestDevice loaded{};
+
+	MakeDevice(index, expected, label);
+	loaded.mDevice.mUserData = loaded.mUserData;
+	loaded.mDevice.mUserDataSize = sizeof(loaded.mUserData);
+
+	zassert_true(storage.LoadBridgedDevice(loaded.mDevice, index));
+	zassert_equal(loaded.mDevice.mEndpointId, expected.mDevice.mEndpointId);
+	zassert_equal(loaded.mDevice.mDeviceType, expected.mDevice.mDeviceType);
+	zassert_equal(loaded.mDevice.mUniqueIDLength, expected.mDevice.mUniqueIDLength);
+	zassert_mem_equal(loaded.mDevice.mUniqueID, expected.mDevice.mUniqueID, expected.mDevice.mUniqueIDLength);
+	zassert_equal(loaded.mDevice.mNodeLabelLength, expected.mDevice.mNodeLabelLength);
+	zassert_mem_equal(loaded.mDevice.mNodeLabel, expected.mDevice.mNodeLabel, expected.mDevice.mNodeLabelLength);
+	zassert_equal(loaded.mDevice.mUserDataSize, kUserDataSize);
+	zassert_mem_equal(loaded.mUserData, expected.mUserData, kUserDataSize);
+}
+
+/* Stores the device using the version 2 scheme, with every device under a separate key. */
+void StoreLegacyDevice(uint8_t index, uint8_t userDataSize = kUserDataSize)
+{
+	TestDevice device;
+	uint8_t buffer[sizeof(BridgeStorageManager::BridgedDeviceV2) + BridgeStorageManager::kMaxUserDataSize];
+	size_t size = 0;
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+
+	MakeDevice(index, device);
+	device.mDevice.mUserDataSize = userDataSize;
+
+	auto append = [&buffer, &size](const void *data, size_t dataSize) {
+		memcpy(buffer + size, data, dataSize);
+		size += dataSize;
+	};
+
+	append(&device.mDevice.mEndpointId, sizeof(device.mDevice.mEndpointId));
+	append(&device.mDevice.mDeviceType, sizeof(device.mDevice.mDeviceType));
+	append(&device.mDevice.mUniqueIDLength, sizeof(device.mDevice.mUniqueIDLength));
+	append(device.mDevice.mUniqueID, device.mDevice.mUniqueIDLength);
+	append(&device.mDevice.mNodeLabelLength, sizeof(device.mDevice.mNodeLabelLength));
+	append(device.mDevice.mNodeLabel, device.mDevice.mNodeLabelLength);
+	append(&device.mDevice.mUserDataSize, sizeof(device.mDevice.mUserDataSize));
+	append(device.mUserData, device.mDevice.mUserDataSize);
+
+	snprintf(key, sizeof(key), "br/brd/%u", index);
+	zassert_ok(settings_save_one(key, buffer, size));
+}
+
+BridgeStorageManager::GattCacheEntry MakeGattCacheEntry(uint8_t id, uint8_t handlesCount)
+{
+	BridgeStorageManager::GattCacheEntry entry;
+
+	entry.mAddr.type = BT_ADDR_LE_RANDOM;
+	memset(entry.mAddr.a.val, id, sizeof(entry.mAddr.a.val));
+	memset(entry.mDatabaseHash, 0xA0 + id, sizeof(entry.mDatabaseHash));
+	entry.mHandlesCount = handlesCount;
+
+	for (uint8_t i = 0; i < handlesCount; i++) {
+		entry.mHandles[i] = 0x0100 * id + i;
+	}
+
+	return entry;
+}
+
+/* Builds the record of a single entry, as described in the storage scheme. */
+size_t MakeGattCacheRecord(const BridgeStorageManager::GattCacheEntry &entry, uint8_t *record)
+{
+	size_t size = 0;
+
+	record[size++] = BridgeStorageManager::kGattCacheVersion;
+	record[size++] = 1;
+	record[size++] = entry.mAddr.type;
+	memcpy(&record[size], entry.mAddr.a.val, sizeof(entry.mAddr.a.val));
+	size += sizeof(entry.mAddr.a.val);
+	memcpy(&record[size], entry.mDatabaseHash, sizeof(entry.mDatabaseHash));
+	size += sizeof(entry.mDatabaseHash);
+	record[size++] = entry.mHandlesCount;
+
+	for (uint8_t i = 0; i < entry.mHandlesCount; i++) {
+		record[size++] = entry.mHandles[i] & 0xFF;
+		record[size++] = entry.mHandles[i] >> 8;
+	}
+
+	return size;
+}
+
+void CheckGattCacheEntry(BridgeStorageManager &storage, const BridgeStorageManager::GattCacheEntry &expected)
+{
+	BridgeStorageManager::GattCacheEntry loaded;
+
+	zassert_true(storage.LoadGattCache(expected.mAddr, loaded));
+	zassert_true(bt_addr_le_eq(&loaded.mAddr, &expected.mAddr));
+	zassert_mem_equal(loaded.mDatabaseHash, expected.mDatabaseHash, sizeof(expected.mDatabaseHash));
+	zassert_equal(loaded.mHandlesCount, expected.mHandlesCount);
+	zassert_mem_equal(loaded.mHandles, expected.mHandles, expected.mHandlesCount * sizeof(uint16_t));
+}
+
+void Before(void *)
+{
+	settings_mock_clear();
+	settings_mock_reset_stats();
+}
+} /* namespace */
+
+ZTEST(bridge_storage_manager, test_store_writes_record)
+{
+	BridgeStorageManager storage;
+	TestDevice device;
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	/* Only the version is written when the storage is initialized for the first time. */
+	zassert_true(storage.Init());
+	zassert_equal(stats.writes, 1);
+	settings_mock_reset_stats();
+
+	/* Adding a device outside of a transaction writes its record and the list of devices. */
+	MakeDevice(0, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	zassert_equal(stats.writes, 2);
+
+	MakeDevice(1, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 1));
+	zassert_equal(stats.writes, 4);
+
+	/* Storing an unchanged device does not write the storage. */
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 1));
+	zassert_equal(stats.writes, 4);
+
+	/* Updating a device writes only its record, whatever the number of devices. */
+	MakeDevice(0, device, "Renamed");
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	zassert_equal(stats.writes, 5);
+
+	/* Removing a device deletes its record and writes the list. */
+	zassert_true(storage.RemoveBridgedDevice(1));
+	zassert_equal(stats.writes, 6);
+	zassert_equal(stats.deletes, 1);
+	zassert_false(storage.RemoveBridgedDevice(1));
+	zassert_equal(stats.writes, 6);
+	zassert_equal(stats.deletes, 1);
+
+	/* The version, the list and the record of the remaining device are stored. */
+	zassert_equal(settings_mock_count(), 3);
+
+	CheckDevice(storage, 0, "Renamed");
+
+	/* The list is deleted together with the last device. */
+	zassert_true(storage.RemoveBridgedDevice(0));
+	zassert_equal(stats.writes, 6);
+	zassert_equal(stats.deletes, 3);
+	zassert_equal(settings_mock_count(), 1);
+}
+
+ZTEST(bridge_storage_manager, test_transaction)
+{
+	BridgeStorageManager storage;
+	TestDevice device;
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	zassert_true(storage.Init());
+	settings_mock_reset_stats();
+
+	/* Within a transaction only the records are written, and the list is written once it is committed. */
+	storage.StartTransaction();
+
+	for (uint8_t index = 0; index < kMaxDevices; index++) {
+		MakeDevice(index, device);
+		zassert_true(storage.StoreBridgedDevice(device.mDevice, index));
+	}
+
+	zassert_true(storage.RemoveBridgedDevice(0));
+	zassert_true(storage.RemoveBridgedDevice(kMaxDevices - 1));
+	zassert_equal(stats.writes, kMaxDevices);
+	zassert_equal(stats.deletes, 2);
+
+	zassert_true(storage.CommitTransaction());
+	zassert_equal(stats.writes, kMaxDevices + 1);
+
+	TC_PRINT("Flash writes to store %u bridged devices: %u\n", kMaxDevices, stats.writes);
+
+	/* Nested transactions write the list once the outermost one is committed. */
+	storage.StartTransaction();
+	storage.StartTransaction();
+	MakeDevice(0, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	zassert_true(storage.CommitTransaction());
+	zassert_equal(stats.writes, kMaxDevices + 2);
+	zassert_true(storage.CommitTransaction());
+	zassert_equal(stats.writes, kMaxDevices + 3);
+
+	/* A transaction that does not add or remove devices does not write the list. */
+	storage.StartTransaction();
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	MakeDevice(1, device, "Renamed");
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 1));
+	zassert_true(storage.CommitTransaction());
+	zassert_equal(stats.writes, kMaxDevices + 4);
+
+	zassert_false(storage.CommitTransaction());
+
+	uint8_t count = 0;
+
+	zassert_true(storage.LoadBridgedDevicesCount(count));
+	zassert_equal(count, kMaxDevices - 1);
+
+	/* The capacity is limited by the number of dynamic endpoints. */
+	MakeDevice(kMaxDevices - 1, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, kMaxDevices - 1));
+	MakeDevice(kMaxDevices, device);
+	zassert_false(storage.StoreBridgedDevice(device.mDevice, kMaxDevices));
+}
+
+ZTEST(bridge_storage_manager, test_provisioning_time)
+{
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	/* Provision the maximum number of devices one by one and as a bulk update, which stores the devices within
+	 * a single transaction. */
+	for (const bool bulk : { false, true }) {
+		BridgeStorageManager storage;
+		TestDevice device;
+
+		settings_mock_clear();
+		zassert_true(storage.Init());
+		settings_mock_reset_stats();
+
+		const uint32_t start = k_cycle_get_32();
+
+		if (bulk) {
+			storage.StartTransaction();
+		}
+
+		for (uint8_t index = 0; index < kMaxDevices; index++) {
+			MakeDevice(index, device);
+			zassert_true(storage.StoreBridgedDevice(device.mDevice, index));
+		}
+
+		if (bulk) {
+			zassert_true(storage.CommitTransaction());
+		}
+
+		const uint32_t elapsedUs = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+		TC_PRINT("%s provisioning of %u bridged devices: %u flash writes, %u us\n", bulk ? "Bulk" : "Single",
+			 kMaxDevices, stats.writes, elapsedUs);
+		zassert_equal(stats.writes, bulk ? kMaxDevices + 1 : 2 * kMaxDevices);
+	}
+}
+
+ZTEST(bridge_storage_manager, test_transaction_add_and_remove)
+{
+	BridgeStorageManager storage;
+	TestDevice device;
+	uint8_t count = 0;
+
+	zassert_true(storage.Init());
+
+	/* The list that has never been stored does not need to be removed. */
+	storage.StartTransaction();
+	MakeDevice(0, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	zassert_true(storage.RemoveBridgedDevice(0));
+	zassert_true(storage.CommitTransaction());
+
+	zassert_false(storage.LoadBridgedDevicesCount(count));
+	zassert_equal(settings_mock_count(), 1);
+}
+
+ZTEST(bridge_storage_manager, test_boot_load)
+{
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	{
+		BridgeStorageManager storage;
+
+		zassert_true(storage.Init());
+		StoreDevices(storage, kMaxDevices);
+	}
+
+	settings_mock_reset_stats();
+
+	/* Loading all devices on boot costs the initial settings load and a single pass over the bridge keys,
+	 * whatever the number of devices. */
+	BridgeStorageManager storage;
+	uint8_t indexes[kMaxDevices];
+	size_t indexesCount = 0;
+	uint8_t count = 0;
+
+	zassert_true(storage.Init());
+	zassert_equal(stats.scans, 2);
+	zassert_equal(stats.writes, 0);
+	zassert_equal(stats.deletes, 0);
+
+	TC_PRINT("Storage scans to load %u bridged devices on boot: %u\n", kMaxDevices, stats.scans);
+
+	zassert_true(storage.LoadBridgedDevicesCount(count));
+	zassert_equal(count, kMaxDevices);
+	zassert_true(storage.LoadBridgedDevicesIndexes(indexes, sizeof(indexes), indexesCount));
+	zassert_equal(indexesCount, kMaxDevices);
+
+	for (uint8_t i = 0; i < kMaxDevices; i++) {
+		zassert_equal(indexes[i], i);
+		CheckDevice(storage, i);
+	}
+
+	/* Loading the devices from the cached records does not access the storage. */
+	zassert_equal(stats.scans, 2);
+}
+
+ZTEST(bridge_storage_manager, test_boot_load_interrupted)
+{
+	const uint8_t list[] = { 0, 1 };
+	uint8_t indexes[kMaxDevices];
+	size_t indexesCount = 0;
+
+	{
+		BridgeStorageManager storage;
+
+		zassert_true(storage.Init());
+		StoreDevices(storage, 3);
+	}
+
+	/* The device 2 was added, but the list was not written, and the device 0 was removed, but the list was not
+	 * updated, before a reset. */
+	zassert_ok(settings_save_one("br/brd_idx", list, sizeof(list)));
+	zassert_ok(settings_delete("br/brd_rec/0"));
+
+	/* The device without a record is dropped from the list, and the record missing from the list is removed. */
+	BridgeStorageManager storage;
+
+	zassert_true(storage.Init());
+	zassert_true(storage.LoadBridgedDevicesIndexes(indexes, sizeof(indexes), indexesCount));
+	zassert_equal(indexesCount, 1);
+	zassert_equal(indexes[0], 1);
+	CheckDevice(storage, 1);
+	zassert_equal(settings_mock_count(), 3);
+}
+
+ZTEST(bridge_storage_manager, test_boot_load_corrupted)
+{
+	/* The record claims a longer unique ID than it contains. */
+	const uint8_t record[] = { 3, 0, 4, 1, 40, 1, 2, 3 };
+	const uint8_t list[] = { 0 };
+	const uint8_t version = BridgeStorageManager::kCurrentVersion;
+	BridgeStorageManager storage;
+	TestDevice device{};
+
+	zassert_ok(settings_save_one("br/ver", &version, sizeof(version)));
+	zassert_ok(settings_save_one("br/brd_idx", list, sizeof(list)));
+	zassert_ok(settings_save_one("br/brd_rec/0", record, sizeof(record)));
+
+	/* The corrupted device is reported when it is loaded. */
+	device.mDevice.mUserData = device.mUserData;
+	device.mDevice.mUserDataSize = sizeof(device.mUserData);
+	zassert_true(storage.Init());
+	zassert_false(storage.LoadBridgedDevice(device.mDevice, 0));
+}
+
+ZTEST(bridge_storage_manager, test_boot_load_oversized)
+{
+	/* The list and the record do not fit in the buffers, for example when they were stored with larger limits. */
+	static uint8_t list[kMaxDevices + 1];
+	static uint8_t record[BridgeStorageManager::kMaxRecordSize + 1];
+	const uint8_t version = BridgeStorageManager::kCurrentVersion;
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+	const std::pair<const char *, size_t> values[] = {
+		{ "br/brd_idx", sizeof(list) },
+		{ "br/brd_rec/0", sizeof(record) },
+	};
+
+	for (const auto &[key, size] : values) {
+		BridgeStorageManager storage;
+		uint8_t count = 0;
+
+		settings_mock_clear();
+		zassert_ok(settings_save_one("br/ver", &version, sizeof(version)));
+		zassert_ok(settings_save_one("br/brd_idx", list, 1));
+		zassert_ok(settings_save_one("br/brd_rec/0", record, 1));
+		zassert_ok(settings_save_one(key, key == values[0].first ? list : record, size));
+		settings_mock_reset_stats();
+
+		/* The initialization fails instead of treating the devices as missing, and the stored ones are kept. */
+		zassert_false(storage.Init());
+		zassert_false(storage.LoadBridgedDevicesCount(count));
+		zassert_equal(stats.writes, 0);
+		zassert_equal(stats.deletes, 0);
+	}
+}
+
+ZTEST(bridge_storage_manager, test_factory_reset_in_transaction)
+{
+	BridgeStorageManager storage;
+	TestDevice device;
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	zassert_true(storage.Init());
+	storage.StartTransaction();
+	storage.FactoryReset();
+	settings_mock_reset_stats();
+
+	/* The reset ends the transaction, so the list is written right away. */
+	MakeDevice(0, device);
+	zassert_true(storage.StoreBridgedDevice(device.mDevice, 0));
+	zassert_equal(stats.writes, 2);
+	zassert_false(storage.CommitTransaction());
+}
+
+ZTEST(bridge_storage_manager, test_migrate_version_2)
+{
+	constexpr uint8_t kLegacyDevices = 4;
+	const uint8_t version = 2;
+	uint8_t indexes[kLegacyDevices];
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+
+	for (uint8_t i = 0; i < kLegacyDevices; i++) {
+		indexes[i] = i;
+		StoreLegacyDevice(i);
+	}
+
+	zassert_ok(settings_save_one("br/ver", &version, sizeof(version)));
+	zassert_ok(settings_save_one("br/brd_cnt", &kLegacyDevices, sizeof(kLegacyDevices)));
+	zassert_ok(settings_save_one("br/brd_ids", indexes, sizeof(indexes)));
+	settings_mock_reset_stats();
+
+	{
+		BridgeStorageManager storage;
+
+		/* The migrated devices are listed at once, and the legacy keys are removed. */
+		zassert_true(storage.Init());
+		zassert_equal(stats.writes, kLegacyDevices + 2);
+		zassert_equal(stats.deletes, kLegacyDevices + 2);
+		zassert_equal(settings_mock_count(), kLegacyDevices + 2);
+
+		for (uint8_t i = 0; i < kLegacyDevices; i++) {
+			CheckDevice(storage, i);
+		}
+	}
+
+	settings_mock_reset_stats();
+
+	/* The migration is done only once. */
+	BridgeStorageManager storage;
+
+	zassert_true(storage.Init());
+	zassert_equal(stats.writes, 0);
+	CheckDevice(storage, kLegacyDevices - 1);
+}
+
+ZTEST(bridge_storage_manager, test_migrate_version_2_oversized_user_data)
+{
+	constexpr uint8_t kLegacyDevices = 3;
+	constexpr uint8_t kOversizedIndex = 1;
+	const uint8_t version = 2;
+	uint8_t indexes[kLegacyDevices];
+
+	for (uint8_t i = 0; i < kLegacyDevices; i++) {
+		indexes[i] = i;
+		StoreLegacyDevice(i, i == kOversizedIndex ? BridgeStorageManager::kMaxRecordUserDataSize + 1 :
+							     kUserDataSize);
+	}
+
+	zassert_ok(settings_save_one("br/ver", &version, sizeof(version)));
+	zassert_ok(settings_save_one("br/brd_cnt", &kLegacyDevices, sizeof(kLegacyDevices)));
+	zassert_ok(settings_save_one("br/brd_ids", indexes, sizeof(indexes)));
+
+	/* The device with user data that does not fit the record is migrated without the user data. */
+	BridgeStorageManager storage;
+	TestDevice loaded{};
+
+	zassert_true(storage.Init());
+	CheckDevice(storage, 0);
+	CheckDevice(storage, kLegacyDevices - 1);
+
+	loaded.mDevice.mUserData = loaded.mUserData;
+	loaded.mDevice.mUserDataSize = sizeof(loaded.mUserData);
+	zassert_true(storage.LoadBridgedDevice(loaded.mDevice, kOversizedIndex));
+	zassert_equal(loaded.mDevice.mEndpointId, 3 + kOversizedIndex);
+	zassert_equal(loaded.mDevice.mUserDataSize, 0);
+}
+
+ZTEST(bridge_storage_manager, test_gatt_cache)
+{
+	const settings_mock_stats &stats = *settings_mock_get_stats();
+	const BridgeStorageManager::GattCacheEntry first = MakeGattCacheEntry(1, 4);
+	const BridgeStorageManager::GattCacheEntry second = MakeGattCacheEntry(2, 1);
+
+	{
+		BridgeStorageManager storage;
+
+		zassert_true(storage.Init());
+		settings_mock_reset_stats();
+
+		zassert_true(storage.StoreGattCache(first));
+		zassert_true(storage.StoreGattCache(second));
+		zassert_equal(stats.writes, 2);
+
+		/* Only the used handles are compared, so an unchanged entry is not written again. */
+		BridgeStorageManager::GattCacheEntry unchanged = second;
+
+		unchanged.mHandles[1] = 0xFFFF;
+		zassert_true(storage.StoreGattCache(unchanged));
+		zassert_equal(stats.writes, 2);
+
+		/* There is no room for more devices than the Bluetooth LE connections. */
+		zassert_false(storage.StoreGattCache(MakeGattCacheEntry(3, 1)));
+		zassert_equal(stats.writes, 2);
+	}
+
+	/* The entries are restored from the record on init. */
+	BridgeStorageManager storage;
+
+	zassert_true(storage.Init());
+	CheckGattCacheEntry(storage, first);
+	CheckGattCacheEntry(storage, second);
+
+	BridgeStorageManager::GattCacheEntry loaded;
+
+	zassert_true(storage.RemoveGattCache(first.mAddr));
+	zassert_false(storage.LoadGattCache(first.mAddr, loaded));
+	CheckGattCacheEntry(storage, second);
+}
+
+ZTEST(bridge_storage_manager, test_gatt_cache_record)
+{
+	const uint8_t version = BridgeStorageManager::kCurrentVersion;
+	const BridgeStorageManager::GattCacheEntry entry = MakeGattCacheEntry(1, 2);
+	uint8_t record[BridgeStorageManager::kGattCacheMaxRecordSize + 1] = { 0 };
+	const size_t size = MakeGattCacheRecord(entry, record);
+
+	zassert_ok(settings_save_one("br/ver", &version, sizeof(version)));
+
+	{
+		BridgeStorageManager storage;
+
+		zassert_ok(settings_save_one("br/gatt", record, size));
+		zassert_true(storage.Init());
+		CheckGattCacheEntry(storage, entry);
+	}
+
+	/* A truncated record and one with trailing data are dropped, but the bridged devices are still loaded. */
+	const size_t corruptedSizes[] = { 1, size - 1, size + 1 };
+
+	for (size_t corruptedSize : corruptedSizes) {
+		BridgeStorageManager storage;
+		BridgeStorageManager::GattCacheEntry loaded;
+
+		zassert_ok(settings_save_one("br/gatt", record, corruptedSize));
+		zassert_true(storage.Init());
+		zassert_false(storage.LoadGattCache(entry.mAddr, loaded));
+	}
+
+	/* So is a record of another version, and one with more handles than can be cached. */
+	const size_t handlesCountOffset = BridgeStorageManager::kGattCacheHeaderSize +
+					  BridgeStorageManager::kGattCacheEntryHeaderSize - sizeof(uint8_t);
+	const std::pair<size_t, uint8_t> corruptedFields[] = {
+		{ 0, BridgeStorageManager::kGattCacheVersion + 1 },
+		{ handlesCountOffset, BridgeStorageManager::kGattCacheMaxHandles + 1 },
+	};
+
+	for (const auto &[offset, value] : corruptedFields) {
+		BridgeStorageManager storage;
+		BridgeStorageManager::GattCacheEntry loaded;
+		uint8_t corrupted[sizeof(record)];
+
+		memcpy(corrupted, record, size);
+		corrupted[offset] = value;
+
+		zassert_ok(settings_save_one("br/gatt", corrupted, size));
+		zassert_true(storage.Init());
+		zassert_false(storage.LoadGattCache(entry.mAddr, loaded));
+	}
+}
+
+ZTEST_SUITE(bridge_storage_manager, NULL, NULL, Before, NULL, NULL);
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SETTINGS_MOCK_H_
+#define SETTINGS_MOCK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of operations on the settings store, each of them costs a flash access with the real backends. */
+struct settings_mock_stats {
+	/* Values written. */
+	uint32_t writes;
+	/* Values deleted. */
+	uint32_t deletes;
+	/* Passes over the whole store, done for every settings load. */
+	uint32_t scans;
+};
+
+void settings_mock_clear(void);
+void settings_mock_reset_stats(void);
+const struct settings_mock_stats *settings_mock_get_stats(void);
+size_t settings_mock_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SETTINGS_MOCK_H_ */
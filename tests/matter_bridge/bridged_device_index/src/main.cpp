@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bridged_device_index.h"
+#include "finite_map.h"
+#include "host_clock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+using Nrf::BridgedDeviceIndex;
+using Nrf::FiniteMap;
+
+namespace
+{
+/* Limits of the index used by the BridgeManager. */
+constexpr uint8_t kMaxDevices = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
+constexpr uint8_t kMaxProviders = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER;
+constexpr uint8_t kMaxDevicesPerProvider = CONFIG_BRIDGE_MAX_BRIDGED_DEVICES_NUMBER_PER_PROVIDER;
+/* Every provider bridges two devices, like a Bluetooth LE sensor with two endpoints. */
+constexpr uint8_t kDevicesPerProvider = 2;
+constexpr uint8_t kProviders = kMaxDevices / kDevicesPerProvider;
+static_assert(kDevicesPerProvider <= kMaxDevicesPerProvider, "Too many devices per provider");
+constexpr size_t kBenchmarkRounds = 20000;
+
+struct TestProvider {
+	uint8_t mBridgeSlot{ UINT8_MAX };
+};
+
+struct TestDevice {
+	uint8_t mIndex;
+};
+
+uint32_t sReleasedDevices;
+uint32_t sReleasedProviders;
+
+/* Pair with the ownership semantics of the BridgeManager's pair, counting released objects instead of deleting them. */
+struct TestPair {
+	TestPair() : mDevice(nullptr), mProvider(nullptr) {}
+	TestPair(TestDevice *device, TestProvider *provider) : mDevice(device), mProvider(provider) {}
+	~TestPair() { Release(); }
+
+	TestPair(const TestPair &other) = delete;
+	TestPair &operator=(const TestPair &other) = delete;
+
+	TestPair(TestPair &&other) : mDevice(other.mDevice), mProvider(other.mProvider)
+	{
+		other.mDevice = nullptr;
+		other.mProvider = nullptr;
+	}
+
+	TestPair &operator=(TestPair &&other)
+	{
+		if (this != &other) {
+			Release();
+			mDevice = other.mDevice;
+			mProvider = other.mProvider;
+			other.mDevice = nullptr;
+			other.mProvider = nullptr;
+		}
+		return *this;
+	}
+
+	operator bool() const { return mDevice || mProvider; }
+
+	void Release()
+	{
+		sReleasedDevices += mDevice != nullptr;
+		sReleasedProviders += mProvider != nullptr;
+		mDevice = nullptr;
+		mProvider = nullptr;
+	}
+
+	TestDevice *mDevice;
+	TestProvider *mProvider;
+};
+
+using Index = BridgedDeviceIndex<TestPair, TestProvider, kMaxDevices, kMaxProviders, kMaxDevicesPerProvider>;
+using Map = FiniteMap<uint16_t, TestPair, kMaxDevices>;
+
+TestDevice sDevices[kMaxDevices];
+TestProvider sProviders[kMaxProviders + 1];
+
+/* Bridges kDevicesPerProvider devices with each of kProviders providers, like the BridgeManager does. */
+void FillIndex(Index &index)
+{
+	for (uint8_t i = 0; i < kMaxDevices; i++) {
+		TestProvider *provider = &sProviders[i / kDevicesPerProvider];
+
+		sDevices[i].mIndex = i;
+
+		if (!index.GetProviderEntry(*provider)) {
+			zassert_true(index.RegisterProvider(provider));
+		}
+		zassert_true(index.InsertDevicePair(i, TestPair(&sDevices[i], provider)));
+	}
+}
+
+void FillMap(Map &map)
+{
+	for (uint8_t i = 0; i < kMaxDevices; i++) {
+		zassert_true(map.Insert(i, TestPair(&sDevices[i], &sProviders[i / kDevicesPerProvider])));
+	}
+}
+
+/* Returns the number of operations per second for the given time. */
+uint32_t Rate(uint64_t operations, uint64_t elapsed)
+{
+	return static_cast<uint32_t>(operations * NSEC_PER_SEC / MAX(elapsed, 1U));
+}
+
+/* Looks up every endpoint index and the same number of unused indexes. */
+template <typename LookupFunction> uint32_t BenchmarkEndpointLookup(LookupFunction lookup)
+{
+	uint32_t found = 0;
+	const uint64_t start = host_clock_time_ns();
+
+	for (size_t round = 0; round < kBenchmarkRounds; round++) {
+		for (uint16_t i = 0; i < 2 * kMaxDevices; i++) {
+			TestDevice *device = lookup(i);
+
+			found += device && device->mIndex == i;
+		}
+	}
+
+	const uint64_t elapsed = host_clock_time_ns() - start;
+
+	zassert_equal(found, kBenchmarkRounds * kMaxDevices);
+
+	return Rate(2 * kBenchmarkRounds * kMaxDevices, elapsed);
+}
+
+/* Finds the devices of every provider, as done for every attribute update reported by the provider. */
+template <typename VisitFunction> uint32_t BenchmarkProviderLookup(VisitFunction visit)
+{
+	uint32_t found = 0;
+	const uint64_t start = host_clock_time_ns();
+
+	for (size_t round = 0; round < kBenchmarkRounds; round++) {
+		for (uint8_t i = 0; i < kProviders; i++) {
+			found += visit(sProviders[i]);
+		}
+	}
+
+	const uint64_t elapsed = host_clock_time_ns() - start;
+
+	zassert_equal(found, kBenchmarkRounds * kMaxDevices);
+
+	return Rate(kBenchmarkRounds * kProviders, elapsed);
+}
+
+void Before(void *)
+{
+	for (auto &provider : sProviders) {
+		provider.mBridgeSlot = UINT8_MAX;
+	}
+	sReleasedDevices = 0;
+	sReleasedProviders = 0;
+}
+} /* namespace */
+
+ZTEST(bridged_device_index, test_lookup)
+{
+	Index index;
+
+	FillIndex(index);
+
+	zassert_equal(index.GetProvidersCount(), kProviders);
+
+	for (uint8_t i = 0; i < kMaxDevices; i++) {
+		TestPair *pair = index.GetDevicePair(i);
+
+		zassert_not_null(pair);
+		zassert_equal(pair->mDevice, &sDevices[i]);
+	}
+
+	zassert_is_null(index.GetDevicePair(kMaxDevices));
+	zassert_is_null(index.GetDevicePair(UINT16_MAX));
+
+	for (uint8_t i = 0; i < kProviders; i++) {
+		Index::ProviderEntry *entry = index.GetProviderEntry(sProviders[i]);
+
+		zassert_not_null(entry);
+		zassert_equal(entry->mDevicesCount, kDevicesPerProvider);
+
+		for (uint8_t j = 0; j < entry->mDevicesCount; j++) {
+			zassert_equal(index.At(entry->mDeviceIndexes[j]).mProvider, &sProviders[i]);
+		}
+	}
+
+	/* Provider not bridged, and a provider whose slot was taken over by another one. */
+	zassert_is_null(index.GetProviderEntry(sProviders[kProviders]));
+	sProviders[kProviders].mBridgeSlot = 0;
+	zassert_is_null(index.GetProviderEntry(sProviders[kProviders]));
+}
+
+ZTEST(bridged_device_index, test_insert)
+{
+	Index index;
+	TestProvider &provider = sProviders[0];
+	TestProvider &unregistered = sProviders[1];
+
+	zassert_true(index.RegisterProvider(&provider));
+	zassert_true(index.InsertDevicePair(0, TestPair(&sDevices[0], &provider)));
+
+	/* Used index, index out of range and provider that was not registered. */
+	TestPair used(&sDevices[1], &provider);
+	zassert_false(index.InsertDevicePair(0, std::move(used)));
+	zassert_true(used);
+	TestPair outOfRange(&sDevices[1], &provider);
+	zassert_false(index.InsertDevicePair(kMaxDevices, std::move(outOfRange)));
+	TestPair notRegistered(&sDevices[1], &unregistered);
+	zassert_false(index.InsertDevicePair(1, std::move(notRegistered)));
+
+	/* The provider cannot take more devices than its entry can hold. */
+	for (uint8_t i = 1; i < kMaxDevicesPerProvider; i++) {
+		zassert_true(index.InsertDevicePair(i, TestPair(&sDevices[i], &provider)));
+	}
+	TestPair full(&sDevices[kMaxDevicesPerProvider], &provider);
+	zassert_false(index.InsertDevicePair(kMaxDevicesPerProvider, std::move(full)));
+	zassert_is_null(index.GetDevicePair(kMaxDevicesPerProvider));
+
+	/* The pairs that were not stored keep their objects. */
+	used.mProvider = nullptr;
+	outOfRange.mProvider = nullptr;
+	full.mProvider = nullptr;
+	notRegistered.mProvider = nullptr;
+}
+
+ZTEST(bridged_device_index, test_register_limit)
+{
+	Index index;
+	TestProvider extra;
+
+	for (uint8_t i = 0; i < kMaxProviders; i++) {
+		zassert_true(index.RegisterProvider(&sProviders[i]));
+		zassert_equal(sProviders[i].mBridgeSlot, i);
+	}
+
+	zassert_false(index.RegisterProvider(&extra));
+	zassert_equal(extra.mBridgeSlot, UINT8_MAX);
+	zassert_equal(index.GetProvidersCount(), kMaxProviders);
+
+	/* Release the slot in the middle and check that it is reused. */
+	TestPair pair(nullptr, &sProviders[5]);
+	index.ReleaseUnboundProvider(pair);
+	zassert_equal(index.GetProvidersCount(), kMaxProviders - 1);
+	zassert_true(index.RegisterProvider(&extra));
+	zassert_equal(extra.mBridgeSlot, 5);
+	pair.mProvider = nullptr;
+}
+
+ZTEST(bridged_device_index, test_erase)
+{
+	Index index;
+
+	FillIndex(index);
+
+	/* The provider is released together with the last of its devices. */
+	zassert_true(index.EraseDevicePair(0));
+	zassert_equal(sReleasedDevices, 1);
+	zassert_equal(sReleasedProviders, 0);
+	zassert_not_null(index.GetProviderEntry(sProviders[0]));
+	zassert_equal(index.GetProviderEntry(sProviders[0])->mDeviceIndexes[0], 1);
+
+	zassert_true(index.EraseDevicePair(1));
+	zassert_equal(sReleasedDevices, 2);
+	zassert_equal(sReleasedProviders, 1);
+	zassert_is_null(index.GetProviderEntry(sProviders[0]));
+	zassert_equal(index.GetProvidersCount(), kProviders - 1);
+
+	zassert_false(index.EraseDevicePair(0));
+	zassert_false(index.EraseDevicePair(kMaxDevices));
+	zassert_equal(sReleasedDevices, 2);
+
+	/* The erased index can be used again. */
+	zassert_true(index.RegisterProvider(&sProviders[kProviders]));
+	zassert_true(index.InsertDevicePair(0, TestPair(&sDevices[0], &sProviders[kProviders])));
+	zassert_equal(index.GetDevicePair(0)->mProvider, &sProviders[kProviders]);
+}
+
+ZTEST(bridged_device_index, test_release_unbound_provider)
+{
+	Index index;
+	TestProvider &provider = sProviders[0];
+
+	zassert_true(index.RegisterProvider(&provider));
+	zassert_true(index.InsertDevicePair(0, TestPair(&sDevices[0], &provider)));
+
+	/* The provider is still bound with the stored device, so it is detached from the pair. */
+	TestPair shared(&sDevices[1], &provider);
+	index.ReleaseUnboundProvider(shared);
+	zassert_is_null(shared.mProvider);
+	zassert_not_null(index.GetProviderEntry(provider));
+
+	/* A provider registered only for the pair is released together with it. */
+	TestPair single(&sDevices[2], &sProviders[1]);
+	zassert_true(index.RegisterProvider(&sProviders[1]));
+	index.ReleaseUnboundProvider(single);
+	zassert_equal(single.mProvider, &sProviders[1]);
+	zassert_is_null(index.GetProviderEntry(sProviders[1]));
+	zassert_equal(index.GetProvidersCount(), 1);
+
+	single.Release();
+	zassert_equal(sReleasedProviders, 1);
+}
+
+ZTEST(bridged_device_index, test_benchmark)
+{
+	static Index index;
+	static Map map;
+
+	FillIndex(index);
+	FillMap(map);
+
+	const uint32_t indexEndpointRate = BenchmarkEndpointLookup([](uint16_t i) -> TestDevice * {
+		TestPair *pair = index.GetDevicePair(i);
+		return pair ? pair->mDevice : nullptr;
+	});
+	/* The previous endpoint lookup: Contains() followed by operator[]. */
+	const uint32_t mapEndpointRate = BenchmarkEndpointLookup(
+		[](uint16_t i) -> TestDevice * { return map.Contains(i) ? map[i].mDevice : nullptr; });
+
+	const uint32_t indexProviderRate = BenchmarkProviderLookup([](const TestProvider &provider) {
+		Index::ProviderEntry *entry = index.GetProviderEntry(provider);
+		uint32_t count = 0;
+
+		for (uint8_t i = 0; entry && i < entry->mDevicesCount; i++) {
+			count += index.At(entry->mDeviceIndexes[i]).mDevice != nullptr;
+		}
+		return count;
+	});
+	/* The previous provider lookup: a scan of the whole map on every attribute update. */
+	const uint32_t mapProviderRate = BenchmarkProviderLookup([](const TestProvider &provider) {
+		uint32_t count = 0;
+
+		for (auto &item : map.mMap) {
+			count += item.value.mProvider == &provider && item.value.mDevice != nullptr;
+		}
+		return count;
+	});
+
+	TC_PRINT("Endpoint lookups per second with %u devices: index %u, finite map %u\n", kMaxDevices,
+		 indexEndpointRate, mapEndpointRate);
+	TC_PRINT("Provider lookups per second with %u providers: index %u, finite map %u\n", kProviders,
+		 indexProviderRate, mapProviderRate);
+}
+
+ZTEST_SUITE(bridged_device_index, NULL, NULL, Before, NULL, NULL);
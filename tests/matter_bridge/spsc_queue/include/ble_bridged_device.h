@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Bluetooth LE bridged device, providing only the method called by the notification
+ * queue. */
+
+#include <lib/core/DataModelTypes.h>
+
+#include <cstddef>
+
+namespace Nrf
+{
+class BLEBridgedDeviceProvider {
+public:
+	virtual ~BLEBridgedDeviceProvider() = default;
+
+	virtual void NotifyUpdateState(chip::ClusterId clusterId, chip::AttributeId attributeId, void *data,
+				       size_t dataSize) = 0;
+};
+} /* namespace Nrf */
@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter data model types used by the notification queue. */
+
+#include <cstdint>
+
+namespace chip
+{
+using ClusterId = uint32_t;
+using AttributeId = uint32_t;
+} /* namespace chip */
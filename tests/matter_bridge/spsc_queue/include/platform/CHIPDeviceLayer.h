@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#pragma once
+
+/* Minimal replacement of the Matter platform manager. The scheduled work is kept until the test runs it, which takes
+ * the place of the Matter thread. */
+
+#include <cstddef>
+#include <cstdint>
+
+using CHIP_ERROR = int32_t;
+
+#define CHIP_NO_ERROR 0
+#define CHIP_ERROR_NO_MEMORY 11
+
+namespace chip
+{
+namespace DeviceLayer
+{
+using AsyncWorkFunct = void (*)(intptr_t arg);
+
+class PlatformManager {
+public:
+	CHIP_ERROR ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
+
+	/**
+	 * @brief Run the work scheduled so far, including the work scheduled by it.
+	 *
+	 * @return number of the works that have been run
+	 */
+	size_t RunScheduledWork();
+
+	size_t GetScheduledWorkCount() const { return mCount; }
+
+	/* Makes ScheduleWork() fail, like when the Matter event queue is full. */
+	void SetScheduleWorkFailure(bool fail) { mFail = fail; }
+
+	void Reset();
+
+private:
+	static constexpr size_t kMaxWorks = 32;
+
+	struct Work {
+		AsyncWorkFunct mFunct;
+		intptr_t mArg;
+	};
+
+	Work mWorks[kMaxWorks];
+	size_t mHead{ 0 };
+	size_t mCount{ 0 };
+	bool mFail{ false };
+};
+
+PlatformManager &PlatformMgr();
+} /* namespace DeviceLayer */
+} /* namespace chip */
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "ble_bridged_device.h"
+#include "ble_notification_queue.h"
+#include "spsc_queue.h"
+
+#include <platform/CHIPDeviceLayer.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/ztest.h>
+
+#include <cstring>
+
+LOG_MODULE_REGISTER(app, CONFIG_CHIP_APP_LOG_LEVEL);
+
+using namespace ::chip;
+using Nrf::BLEBridgedDeviceProvider;
+using Nrf::BLENotificationQueue;
+using Nrf::SpscQueue;
+
+namespace
+{
+constexpr size_t kCapacity = CONFIG_BRIDGE_BT_NOTIFICATION_QUEUE_SIZE;
+/* Number of values handled by a single work of the notification queue. */
+constexpr size_t kMaxBatch = kCapacity / 2;
+constexpr uint32_t kProviders = 10;
+constexpr uint32_t kBenchmarkNotifications = 20000;
+constexpr ClusterId kClusterId = 0x0402;
+constexpr AttributeId kAttributeId = 0x0000;
+
+/* Provider that checks that it receives its values in the order in which they were sent. */
+class TestProvider : public BLEBridgedDeviceProvider {
+public:
+	void NotifyUpdateState(ClusterId clusterId, AttributeId attributeId, void *data, size_t dataSize) override
+	{
+		uint32_t sequence;
+
+		zassert_equal(clusterId, kClusterId);
+		zassert_equal(attributeId, kAttributeId);
+		zassert_equal(dataSize, sizeof(sequence));
+
+		memcpy(&sequence, data, sizeof(sequence));
+		if (sequence != mReceived) {
+			mOutOfOrder++;
+		}
+		mReceived++;
+	}
+
+	bool Push(BLENotificationQueue &queue)
+	{
+		const bool pushed = queue.Push(this, kClusterId, kAttributeId, &mSent, sizeof(mSent));
+
+		if (pushed) {
+			mSent++;
+		}
+
+		return pushed;
+	}
+
+	uint32_t mSent{ 0 };
+	uint32_t mReceived{ 0 };
+	uint32_t mOutOfOrder{ 0 };
+};
+
+/* Context of the reference path that schedules a separate work for every value, like the bridge did before. */
+struct ReferenceContext {
+	TestProvider *mProvider;
+	uint32_t mValue;
+};
+
+void ReferenceWork(intptr_t context)
+{
+	ReferenceContext *reference = reinterpret_cast<ReferenceContext *>(context);
+
+	reference->mProvider->NotifyUpdateState(kClusterId, kAttributeId, &reference->mValue,
+						sizeof(reference->mValue));
+	k_free(reference);
+}
+
+void ReferencePush(TestProvider &provider)
+{
+	ReferenceContext *reference = static_cast<ReferenceContext *>(k_malloc(sizeof(ReferenceContext)));
+
+	zassert_not_null(reference, "Heap too small. Increase heap size.");
+	reference->mProvider = &provider;
+	reference->mValue = provider.mSent++;
+	zassert_equal(DeviceLayer::PlatformMgr().ScheduleWork(ReferenceWork, reinterpret_cast<intptr_t>(reference)),
+		      CHIP_NO_ERROR);
+}
+
+/* Returns the number of operations per second for the given number of cycles. */
+uint32_t Rate(uint64_t operations, uint32_t cycles)
+{
+	return static_cast<uint32_t>(operations * sys_clock_hw_cycles_per_sec() / MAX(cycles, 1U));
+}
+
+void Before(void *)
+{
+	DeviceLayer::PlatformMgr().Reset();
+}
+} /* namespace */
+
+ZTEST(spsc_queue, test_fifo_order)
+{
+	SpscQueue<uint32_t, 4> queue;
+	uint32_t expected = 0;
+
+	zassert_true(queue.IsEmpty());
+
+	for (uint32_t i = 0; i < 4; i++) {
+		zassert_true(queue.Push([i](uint32_t &value) { value = i; }));
+	}
+
+	zassert_false(queue.Push([](uint32_t &value) { value = 4; }), "Full queue accepted an element");
+
+	zassert_equal(queue.Pop([&expected](uint32_t &value) { zassert_equal(value, expected++); }), 4);
+	zassert_true(queue.IsEmpty());
+}
+
+ZTEST(spsc_queue, test_wrap_around)
+{
+	SpscQueue<uint32_t, 4> queue;
+	uint32_t pushed = 0;
+	uint32_t popped = 0;
+
+	/* Push three and pop two elements in every round, so the indexes wrap around the slots many times. */
+	for (uint32_t round = 0; round < 100; round++) {
+		while (queue.Push([&pushed](uint32_t &value) { value = pushed; })) {
+			pushed++;
+		}
+
+		queue.Pop([&popped](uint32_t &value) { zassert_equal(value, popped++); }, 2);
+	}
+
+	queue.Pop([&popped](uint32_t &value) { zassert_equal(value, popped++); });
+
+	zassert_equal(pushed, popped);
+	zassert_true(queue.IsEmpty());
+}
+
+ZTEST(spsc_queue, test_batch_limit)
+{
+	SpscQueue<uint32_t, 8> queue;
+
+	for (uint32_t i = 0; i < 8; i++) {
+		queue.Push([i](uint32_t &value) { value = i; });
+	}
+
+	zassert_equal(queue.Pop([](uint32_t &) {}, 3), 3);
+	zassert_equal(queue.Pop([](uint32_t &) {}, 3), 3);
+	zassert_equal(queue.Pop([](uint32_t &) {}, 3), 2);
+	zassert_equal(queue.Pop([](uint32_t &) {}, 3), 0);
+}
+
+ZTEST(spsc_queue, test_notification_order)
+{
+	BLENotificationQueue queue;
+	TestProvider providers[3];
+
+	for (uint32_t i = 0; i < kMaxBatch; i++) {
+		zassert_true(providers[i % ARRAY_SIZE(providers)].Push(queue));
+	}
+
+	/* A single work is scheduled for all values queued before it runs. */
+	zassert_equal(DeviceLayer::PlatformMgr().GetScheduledWorkCount(), 1);
+	zassert_equal(DeviceLayer::PlatformMgr().RunScheduledWork(), 1);
+
+	for (auto &provider : providers) {
+		zassert_equal(provider.mReceived, provider.mSent);
+		zassert_equal(provider.mOutOfOrder, 0);
+	}
+
+	/* A value queued after the queue has been drained schedules a new work. */
+	zassert_true(providers[0].Push(queue));
+	zassert_equal(DeviceLayer::PlatformMgr().RunScheduledWork(), 1);
+	zassert_equal(providers[0].mReceived, providers[0].mSent);
+
+	const BLENotificationQueue::Statistics &statistics = queue.GetStatistics();
+
+	zassert_equal(statistics.mPushed, kMaxBatch + 1);
+	zassert_equal(statistics.mDropped, 0);
+	zassert_equal(statistics.mBatches, 2);
+	zassert_equal(statistics.mMaxBatch, kMaxBatch);
+}
+
+ZTEST(spsc_queue, test_overflow)
+{
+	BLENotificationQueue queue;
+	TestProvider provider;
+	uint8_t tooBig[BLENotificationQueue::kMaxValueSize + 1] = {};
+
+	for (uint32_t i = 0; i < kCapacity; i++) {
+		zassert_true(provider.Push(queue));
+	}
+
+	/* The values received when the queue is full are dropped and counted. */
+	zassert_false(provider.Push(queue));
+	zassert_false(provider.Push(queue));
+
+	/* Invalid values are rejected without being counted as dropped. */
+	zassert_false(queue.Push(&provider, kClusterId, kAttributeId, tooBig, sizeof(tooBig)));
+	zassert_false(queue.Push(nullptr, kClusterId, kAttributeId, &provider.mSent, sizeof(provider.mSent)));
+
+	zassert_equal(queue.GetStatistics().mPushed, kCapacity);
+	zassert_equal(queue.GetStatistics().mDropped, 2);
+
+	/* The work handles at most a batch of values and schedules another work for the rest. */
+	zassert_equal(DeviceLayer::PlatformMgr().RunScheduledWork(), kCapacity / kMaxBatch);
+	zassert_equal(queue.GetStatistics().mBatches, kCapacity / kMaxBatch);
+	zassert_equal(queue.GetStatistics().mMaxBatch, kMaxBatch);
+
+	/* The dropped values do not break the order of the values that were queued. */
+	zassert_equal(provider.mReceived, kCapacity);
+	zassert_equal(provider.mOutOfOrder, 0);
+
+	zassert_true(provider.Push(queue));
+}
+
+ZTEST(spsc_queue, test_remove_provider)
+{
+	BLENotificationQueue queue;
+	TestProvider removed;
+	TestProvider kept;
+
+	for (uint32_t i = 0; i < 6; i++) {
+		zassert_true(((i % 2) ? removed : kept).Push(queue));
+	}
+
+	queue.RemoveProvider(&removed);
+	DeviceLayer::PlatformMgr().RunScheduledWork();
+
+	zassert_equal(removed.mReceived, 0);
+	zassert_equal(kept.mReceived, 3);
+	zassert_equal(kept.mOutOfOrder, 0);
+}
+
+ZTEST(spsc_queue, test_schedule_failure)
+{
+	BLENotificationQueue queue;
+	TestProvider provider;
+
+	DeviceLayer::PlatformMgr().SetScheduleWorkFailure(true);
+	zassert_true(provider.Push(queue));
+	zassert_equal(DeviceLayer::PlatformMgr().GetScheduledWorkCount(), 0);
+
+	/* The value stays queued and the next value schedules the work again. */
+	DeviceLayer::PlatformMgr().SetScheduleWorkFailure(false);
+	zassert_true(provider.Push(queue));
+	zassert_equal(DeviceLayer::PlatformMgr().RunScheduledWork(), 1);
+	zassert_equal(provider.mReceived, 2);
+	zassert_equal(provider.mOutOfOrder, 0);
+}
+
+ZTEST(spsc_queue, test_throughput)
+{
+	BLENotificationQueue queue;
+	TestProvider providers[kProviders];
+	TestProvider referenceProviders[kProviders];
+
+	/* Queue a batch of values from the providers in turn and let the Matter thread handle them. */
+	uint32_t start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < kBenchmarkNotifications; i++) {
+		zassert_true(providers[i % kProviders].Push(queue));
+		if ((i + 1) % kMaxBatch == 0) {
+			DeviceLayer::PlatformMgr().RunScheduledWork();
+		}
+	}
+	DeviceLayer::PlatformMgr().RunScheduledWork();
+
+	const uint32_t queueRate = Rate(kBenchmarkNotifications, k_cycle_get_32() - start);
+
+	start = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < kBenchmarkNotifications; i++) {
+		ReferencePush(referenceProviders[i % kProviders]);
+		if ((i + 1) % kMaxBatch == 0) {
+			DeviceLayer::PlatformMgr().RunScheduledWork();
+		}
+	}
+	DeviceLayer::PlatformMgr().RunScheduledWork();
+
+	const uint32_t referenceRate = Rate(kBenchmarkNotifications, k_cycle_get_32() - start);
+
+	for (uint32_t i = 0; i < kProviders; i++) {
+		zassert_equal(providers[i].mReceived, providers[i].mSent);
+		zassert_equal(providers[i].mOutOfOrder, 0);
+		zassert_equal(referenceProviders[i].mReceived, referenceProviders[i].mSent);
+	}
+	zassert_equal(queue.GetStatistics().mDropped, 0);
+
+	TC_PRINT("Notifications of %u providers handled per second: notification queue %u (%u batches), work per "
+		 "notification %u\n",
+		 kProviders, queueRate, queue.GetStatistics().mBatches, referenceRate);
+}
+
+ZTEST_SUITE(spsc_queue, NULL, NULL, Before, NULL, NULL);
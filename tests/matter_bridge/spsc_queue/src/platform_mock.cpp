@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip
+{
+namespace DeviceLayer
+{
+CHIP_ERROR PlatformManager::ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg)
+{
+	if (mFail || mCount == kMaxWorks) {
+		return CHIP_ERROR_NO_MEMORY;
+	}
+
+	mWorks[(mHead + mCount) % kMaxWorks] = { workFunct, arg };
+	mCount++;
+
+	return CHIP_NO_ERROR;
+}
+
+size_t PlatformManager::RunScheduledWork()
+{
+	size_t count = 0;
+
+	while (mCount > 0) {
+		const Work work = mWorks[mHead];
+
+		mHead = (mHead + 1) % kMaxWorks;
+		mCount--;
+		work.mFunct(work.mArg);
+		count++;
+	}
+
+	return count;
+}
+
+void PlatformManager::Reset()
+{
+	mHead = 0;
+	mCount = 0;
+	mFail = false;
+}
+
+PlatformManager &PlatformMgr()
+{
+	static PlatformManager sInstance;
+	return sInstance;
+}
+} /* namespace DeviceLayer */
+} /* namespace chip */
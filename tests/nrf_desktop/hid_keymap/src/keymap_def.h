@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <caf/key_id.h>
+
+#include "hid_keymap.h"
+#include "fn_key_id.h"
+
+/* Keymap of a keyboard with 8 columns and 14 rows, and an Fn layer. It is included both by
+ * the utility and by the test, which uses it as a reference.
+ */
+static const struct hid_keymap hid_keymap[] = {
+	{ KEY_ID(0x00, 0x00), 0x0004, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x01), 0x0005, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x02), 0x0006, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x03), 0x0007, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x04), 0x0008, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x05), 0x0009, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x06), 0x000A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x07), 0x000B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x08), 0x000C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x09), 0x000D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x0A), 0x000E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x0B), 0x000F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x0C), 0x0010, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x00, 0x0D), 0x0011, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x00), 0x0012, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x01), 0x0013, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x02), 0x0014, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x03), 0x0015, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x04), 0x0016, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x05), 0x0017, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x06), 0x0018, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x07), 0x0019, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x08), 0x001A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x09), 0x001B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x0A), 0x001C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x0B), 0x001D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x0C), 0x001E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x01, 0x0D), 0x001F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x00), 0x0020, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x01), 0x0021, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x02), 0x0022, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x03), 0x0023, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x04), 0x0024, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x05), 0x0025, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x06), 0x0026, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x07), 0x0027, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x08), 0x0028, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x09), 0x0029, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x0A), 0x002A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x0B), 0x002B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x0C), 0x002C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x02, 0x0D), 0x002D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x00), 0x002E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x01), 0x002F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x02), 0x0030, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x03), 0x0031, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x04), 0x0032, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x05), 0x0033, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x06), 0x0034, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x07), 0x0035, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x08), 0x0036, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x09), 0x0037, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x0A), 0x0038, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x0B), 0x0039, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x0C), 0x003A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x03, 0x0D), 0x003B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x00), 0x003C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x01), 0x003D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x02), 0x003E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x03), 0x003F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x04), 0x0040, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x05), 0x0041, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x06), 0x0042, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x07), 0x0043, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x08), 0x0044, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x09), 0x0045, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x0A), 0x0046, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x0B), 0x0047, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x0C), 0x0048, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x04, 0x0D), 0x0049, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x00), 0x004A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x01), 0x004B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x02), 0x004C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x03), 0x004D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x04), 0x004E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x05), 0x004F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x06), 0x0050, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x07), 0x0051, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x08), 0x0052, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x09), 0x0053, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x0A), 0x0054, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x0B), 0x0055, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x0C), 0x0056, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x05, 0x0D), 0x0057, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x00), 0x0058, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x01), 0x0059, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x02), 0x005A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x03), 0x005B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x04), 0x005C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x05), 0x005D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x06), 0x005E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x07), 0x005F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x08), 0x0060, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x09), 0x0061, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x0A), 0x0062, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x0B), 0x0063, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x0C), 0x0064, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x06, 0x0D), 0x0065, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x00), 0x0066, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x01), 0x0067, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x02), 0x0068, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x03), 0x0069, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x04), 0x006A, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x05), 0x006B, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x06), 0x006C, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x07), 0x006D, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x08), 0x006E, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x09), 0x006F, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x0A), 0x0070, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x0B), 0x0071, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x0C), 0x0072, REPORT_ID_KEYBOARD_KEYS },
+	{ KEY_ID(0x07, 0x0D), 0x0073, REPORT_ID_KEYBOARD_KEYS },
+	{ FN_KEY_ID(0x00, 0x00), 0x00B5, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x01), 0x00B6, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x02), 0x00CD, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x03), 0x00E2, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x04), 0x00E9, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x05), 0x00EA, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x00, 0x06), 0x0192, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x01, 0x00), 0x0194, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x01, 0x01), 0x0196, REPORT_ID_CONSUMER_CTRL },
+	{ FN_KEY_ID(0x01, 0x02), 0x0223, REPORT_ID_CONSUMER_CTRL },
+};
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "hid_keymap.h"
+#include "host_clock.h"
+#include "keymap_def.h"
+
+/* Key IDs use 7 bits for the column, 7 bits for the row and a bit for the Fn layer. */
+#define KEY_ID_SPACE		BIT(15)
+
+#define TRACE_KEY_EVENT_CNT	200000
+#define TRACE_KRO		6
+/* Share of key presses on keys that are not mapped (in percent). */
+#define TRACE_UNMAPPED_PCT	5
+
+static uint16_t trace[TRACE_KEY_EVENT_CNT];
+
+
+static int bsearch_keymap_compare(const void *a, const void *b)
+{
+	const struct hid_keymap *p_a = a;
+	const struct hid_keymap *p_b = b;
+
+	return (p_a->key_id - p_b->key_id);
+}
+
+/* The lookup used before the hash table: binary search with a single-entry cache. */
+static const struct hid_keymap *bsearch_keymap_get(uint16_t key_id)
+{
+	static const struct hid_keymap *map_cache = &hid_keymap[0];
+
+	if (map_cache->key_id == key_id) {
+		return map_cache;
+	}
+
+	struct hid_keymap key = {
+		.key_id = key_id
+	};
+
+	const struct hid_keymap *map = bsearch(&key, hid_keymap, ARRAY_SIZE(hid_keymap),
+					       sizeof(key), bsearch_keymap_compare);
+
+	if (map) {
+		map_cache = map;
+	}
+
+	return map;
+}
+
+static uint32_t trace_rand(uint32_t *state)
+{
+	/* xorshift32, so that the trace is the same in every run. */
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+
+	return *state;
+}
+
+/* Fast typing with up to TRACE_KRO keys held down. Every key press is followed by its release,
+ * but the releases of the held keys are interleaved with the following presses.
+ */
+static void trace_generate(void)
+{
+	uint16_t held[TRACE_KRO];
+	size_t held_cnt = 0;
+	uint32_t state = 0x2545F491;
+	size_t i = 0;
+
+	while (i < ARRAY_SIZE(trace)) {
+		bool press = (held_cnt == 0) ||
+			     ((held_cnt < TRACE_KRO) && (trace_rand(&state) % 2));
+
+		if (press) {
+			uint16_t key_id;
+
+			if ((trace_rand(&state) % 100) < TRACE_UNMAPPED_PCT) {
+				key_id = KEY_ID(0x7F, trace_rand(&state) % 0x80);
+			} else {
+				key_id = hid_keymap[trace_rand(&state) % ARRAY_SIZE(hid_keymap)].key_id;
+			}
+
+			held[held_cnt++] = key_id;
+			trace[i++] = key_id;
+		} else {
+			size_t idx = trace_rand(&state) % held_cnt;
+
+			trace[i++] = held[idx];
+			held[idx] = held[--held_cnt];
+		}
+	}
+}
+
+static void *test_init(void)
+{
+	hid_keymap_init();
+	trace_generate();
+
+	return NULL;
+}
+
+ZTEST(hid_keymap, test_lookup)
+{
+	for (uint32_t key_id = 0; key_id < KEY_ID_SPACE; key_id++) {
+		const struct hid_keymap *ref = bsearch_keymap_get(key_id);
+		const struct hid_keymap *map = hid_keymap_get(key_id);
+
+		if (!ref) {
+			zassert_is_null(map, "Unexpected mapping of key ID 0x%x", key_id);
+			continue;
+		}
+
+		zassert_not_null(map, "Missing mapping of key ID 0x%x", key_id);
+		zassert_equal(map->key_id, ref->key_id);
+		zassert_equal(map->usage_id, ref->usage_id);
+		zassert_equal(map->report_id, ref->report_id);
+	}
+}
+
+ZTEST(hid_keymap, test_benchmark)
+{
+	uint32_t bsearch_found = 0;
+	uint32_t hash_found = 0;
+	uint64_t start;
+	uint64_t bsearch_ns;
+	uint64_t hash_ns;
+
+	start = host_clock_time_ns();
+	for (size_t i = 0; i < ARRAY_SIZE(trace); i++) {
+		bsearch_found += (bsearch_keymap_get(trace[i]) != NULL);
+	}
+	bsearch_ns = host_clock_time_ns() - start;
+
+	start = host_clock_time_ns();
+	for (size_t i = 0; i < ARRAY_SIZE(trace); i++) {
+		hash_found += (hid_keymap_get(trace[i]) != NULL);
+	}
+	hash_ns = host_clock_time_ns() - start;
+
+	zassert_equal(bsearch_found, hash_found);
+
+	TC_PRINT("Keymap entries: %zu, key events: %zu (%u%% unmapped presses, %u-key rollover)\n",
+		 ARRAY_SIZE(hid_keymap), ARRAY_SIZE(trace), TRACE_UNMAPPED_PCT, TRACE_KRO);
+	TC_PRINT("bsearch with cache: %u.%u ns/lookup\n",
+		 (uint32_t)(bsearch_ns * 10 / ARRAY_SIZE(trace) / 10),
+		 (uint32_t)(bsearch_ns * 10 / ARRAY_SIZE(trace) % 10));
+	TC_PRINT("hash table:         %u.%u ns/lookup\n",
+		 (uint32_t)(hash_ns * 10 / ARRAY_SIZE(trace) / 10),
+		 (uint32_t)(hash_ns * 10 / ARRAY_SIZE(trace) % 10));
+}
+
+ZTEST_SUITE(hid_keymap, NULL, test_init, NULL, NULL, NULL);
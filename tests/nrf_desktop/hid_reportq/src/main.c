@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <app_event_manager.h>
+
+#include "hid_reportq.h"
+#include "hid_event.h"
+#include "host_clock.h"
+
+#define MODULE test_hid_reportq
+
+/* Every peripheral sends a HID input report per interval, like a BLE LLPM connection. */
+#define PERIPHERAL_CNT		4
+#define REPORT_INTERVAL_US	1000
+#define SIM_DURATION_US		(2 * USEC_PER_SEC)
+
+/* The subscriber handles up to two HID reports at a time and sends one of them per poll. */
+#define REPORT_MAX		2
+#define POLL_INTERVAL_HS_US	125
+#define POLL_INTERVAL_FS_US	1000
+
+#define LATENCY_STEP_US		10
+#define LATENCY_BUCKET_CNT	1000
+
+struct sim_peripheral {
+	uint8_t report_id;
+	uint8_t size;
+	uint32_t next_us;
+};
+
+struct inflight_report {
+	uint32_t timestamp_us;
+	uint8_t report_id;
+};
+
+struct load_result {
+	uint32_t added_cnt;
+	uint32_t delivered_cnt;
+	uint64_t host_ns;
+	struct hid_reportq_stats stats;
+};
+
+static const uint8_t usb_sub;
+static struct inflight_report inflight[REPORT_MAX];
+static uint8_t inflight_head;
+static uint8_t inflight_cnt;
+static uint32_t latency_hist[LATENCY_BUCKET_CNT];
+
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_hid_report_event(aeh)) {
+		const struct hid_report_event *event = cast_hid_report_event(aeh);
+
+		zassert_equal_ptr(event->subscriber, &usb_sub, "Wrong subscriber");
+		zassert_true(inflight_cnt < REPORT_MAX, "Too many HID reports in flight");
+
+		struct inflight_report *r = &inflight[(inflight_head + inflight_cnt) % REPORT_MAX];
+
+		r->report_id = event->dyndata.data[0];
+		r->timestamp_us = sys_get_le32(&event->dyndata.data[1]);
+		inflight_cnt++;
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, hid_report_event);
+
+
+static uint32_t sim_time_us(void)
+{
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+static void latency_record(uint32_t latency_us)
+{
+	latency_hist[MIN(latency_us / LATENCY_STEP_US, LATENCY_BUCKET_CNT - 1)]++;
+}
+
+static uint32_t latency_percentile(uint32_t total_cnt, uint32_t pct)
+{
+	uint32_t threshold = DIV_ROUND_UP(total_cnt * pct, 100);
+	uint32_t cnt = 0;
+
+	for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+		cnt += latency_hist[i];
+		if (cnt >= threshold) {
+			return (i + 1) * LATENCY_STEP_US;
+		}
+	}
+
+	return LATENCY_BUCKET_CNT * LATENCY_STEP_US;
+}
+
+static uint32_t latency_max(void)
+{
+	for (size_t i = LATENCY_BUCKET_CNT; i > 0; i--) {
+		if (latency_hist[i - 1] > 0) {
+			return i * LATENCY_STEP_US;
+		}
+	}
+
+	return 0;
+}
+
+static bool poll(struct hid_reportq *q, uint32_t now_us)
+{
+	if (inflight_cnt == 0) {
+		return false;
+	}
+
+	struct inflight_report *r = &inflight[inflight_head];
+
+	inflight_head = (inflight_head + 1) % REPORT_MAX;
+	inflight_cnt--;
+
+	latency_record(now_us - r->timestamp_us);
+	hid_reportq_report_sent(q, r->report_id, false);
+
+	return true;
+}
+
+static void run_load(uint32_t poll_interval_us, struct load_result *res)
+{
+	struct sim_peripheral peripherals[PERIPHERAL_CNT];
+	struct hid_reportq *q = hid_reportq_alloc(&usb_sub, REPORT_MAX);
+
+	/* Run as a cooperative thread, like the Bluetooth RX thread that forwards HID reports.
+	 * The HID report events are then processed only while the thread sleeps.
+	 */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(1));
+
+	zassert_not_null(q, "Cannot allocate HID report queue");
+	zassert_ok(hid_reportq_subscribe(q, REPORT_ID_MOUSE));
+	zassert_ok(hid_reportq_subscribe(q, REPORT_ID_KEYBOARD_KEYS));
+
+	uint32_t start_us = sim_time_us();
+	uint32_t end_us = start_us + SIM_DURATION_US;
+	uint32_t next_poll_us = start_us + poll_interval_us;
+
+	/* Mix mouse and keyboard peripherals with evenly spread connection events. */
+	for (size_t i = 0; i < ARRAY_SIZE(peripherals); i++) {
+		struct sim_peripheral *p = &peripherals[i];
+		bool mouse = ((i % 2) == 0);
+
+		p->report_id = mouse ? REPORT_ID_MOUSE : REPORT_ID_KEYBOARD_KEYS;
+		p->size = mouse ? REPORT_SIZE_MOUSE : REPORT_SIZE_KEYBOARD_KEYS;
+		p->next_us = start_us + LATENCY_STEP_US +
+			     i * REPORT_INTERVAL_US / ARRAY_SIZE(peripherals);
+	}
+
+	memset(res, 0, sizeof(*res));
+
+	uint64_t host_start = host_clock_time_ns();
+
+	while (true) {
+		uint32_t next_us = next_poll_us;
+
+		for (size_t i = 0; i < ARRAY_SIZE(peripherals); i++) {
+			next_us = MIN(next_us, peripherals[i].next_us);
+		}
+
+		if (next_us >= end_us) {
+			break;
+		}
+
+		k_sleep(K_USEC(next_us - sim_time_us()));
+
+		uint32_t now_us = sim_time_us();
+
+		for (size_t i = 0; i < ARRAY_SIZE(peripherals); i++) {
+			struct sim_peripheral *p = &peripherals[i];
+			uint8_t data[REPORT_BUFFER_SIZE_INPUT_REPORT];
+
+			if (p->next_us > now_us) {
+				continue;
+			}
+
+			BUILD_ASSERT(REPORT_SIZE_MOUSE >= sizeof(uint32_t));
+			memset(data, i, sizeof(data));
+			sys_put_le32(now_us, data);
+
+			zassert_ok(hid_reportq_report_add(q, p, p->report_id, data, p->size));
+			res->added_cnt++;
+			p->next_us += REPORT_INTERVAL_US;
+		}
+
+		if (next_poll_us <= now_us) {
+			if (poll(q, now_us)) {
+				res->delivered_cnt++;
+			}
+			next_poll_us += poll_interval_us;
+		}
+	}
+
+	/* Let the last submitted HID report events reach the subscriber. */
+	k_sleep(K_USEC(LATENCY_STEP_US));
+
+	res->host_ns = host_clock_time_ns() - host_start;
+	hid_reportq_stats_get(q, &res->stats);
+
+	zassert_equal(res->stats.submitted_cnt, res->delivered_cnt + inflight_cnt,
+		      "Submitted reports were lost");
+	zassert_equal(res->stats.submitted_cnt + res->stats.depth + res->stats.drop_cnt,
+		      res->added_cnt, "Reports were not accounted for");
+	zassert_true(res->stats.max_depth <= 2 * CONFIG_DESKTOP_HID_REPORTQ_MAX_ENQUEUED_REPORTS,
+		     "Queue exceeded its limit");
+
+	hid_reportq_free(q);
+}
+
+static void print_result(const char *name, uint32_t poll_interval_us,
+			 const struct load_result *res)
+{
+	TC_PRINT("%s: %u peripherals, poll interval %u us\n",
+		 name, PERIPHERAL_CNT, poll_interval_us);
+	TC_PRINT("  Reports added: %u, delivered: %u, dropped: %u, max queue depth: %u\n",
+		 res->added_cnt, res->delivered_cnt, res->stats.drop_cnt,
+		 res->stats.max_depth);
+	TC_PRINT("  Forwarding rate: %u reports/s (host CPU time)\n",
+		 (uint32_t)((uint64_t)res->delivered_cnt * NSEC_PER_SEC / MAX(res->host_ns, 1)));
+	TC_PRINT("  Latency: p50 %u us, p99 %u us, max %u us\n",
+		 latency_percentile(res->delivered_cnt, 50),
+		 latency_percentile(res->delivered_cnt, 99), latency_max());
+}
+
+static void *test_init(void)
+{
+	zassert_false(app_event_manager_init(), "Error when initializing");
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	inflight_head = 0;
+	inflight_cnt = 0;
+	memset(latency_hist, 0, sizeof(latency_hist));
+}
+
+ZTEST(hid_reportq, test_load_high_speed)
+{
+	struct load_result res;
+
+	run_load(POLL_INTERVAL_HS_US, &res);
+	print_result("USB High-Speed", POLL_INTERVAL_HS_US, &res);
+
+	/* The subscriber polls faster than the peripherals send reports. */
+	zassert_equal(res.stats.drop_cnt, 0, "Reports were dropped");
+	zassert_true(latency_percentile(res.delivered_cnt, 99) <= 2 * REPORT_INTERVAL_US,
+		     "Latency too high");
+}
+
+ZTEST(hid_reportq, test_load_full_speed)
+{
+	struct load_result res;
+
+	run_load(POLL_INTERVAL_FS_US, &res);
+	print_result("USB Full-Speed", POLL_INTERVAL_FS_US, &res);
+
+	/* The peripherals send four times more reports than the subscriber can handle. The
+	 * oldest enqueued reports are dropped, so the latency stays bounded.
+	 */
+	zassert_true(res.stats.drop_cnt > 0, "Reports were not dropped");
+	zassert_true(res.delivered_cnt >= (SIM_DURATION_US / POLL_INTERVAL_FS_US) - REPORT_MAX,
+		     "Subscriber was not kept busy");
+}
+
+ZTEST_SUITE(hid_reportq, NULL, test_init, test_before, NULL, NULL);
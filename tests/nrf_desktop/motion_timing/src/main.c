@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "motion_latency.h"
+#include "motion_sample_align.h"
+
+/* Bluetooth LE connection interval of 7.5 ms. */
+#define REPORT_PERIOD_US	7500
+#define LEAD_US			1500
+
+static struct motion_sample_align sa;
+static struct motion_latency ml;
+
+
+static uint32_t report_sent(int64_t *now_us, uint32_t period_us)
+{
+	*now_us += period_us;
+
+	return motion_sample_align_delay_get(&sa, *now_us, LEAD_US);
+}
+
+static void sample_align_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_sample_align_reset(&sa);
+}
+
+ZTEST(motion_sample_align, test_no_timing)
+{
+	/* The period is unknown until the second HID report is sent. */
+	zassert_equal(motion_sample_align_delay_get(&sa, 1000, LEAD_US), 0);
+	zassert_equal(motion_sample_align_delay_get(&sa, 1000 + REPORT_PERIOD_US, LEAD_US),
+		      REPORT_PERIOD_US - LEAD_US);
+}
+
+ZTEST(motion_sample_align, test_first_report_at_boot)
+{
+	/* The time of the first HID report is not compared against the time of boot. */
+	zassert_equal(motion_sample_align_delay_get(&sa, 20000, LEAD_US), 0);
+}
+
+ZTEST(motion_sample_align, test_delay)
+{
+	int64_t now_us = 0;
+
+	report_sent(&now_us, 0);
+
+	for (size_t i = 0; i < 2 * MOTION_SAMPLE_ALIGN_WINDOW; i++) {
+		zassert_equal(report_sent(&now_us, REPORT_PERIOD_US), REPORT_PERIOD_US - LEAD_US);
+	}
+
+	/* The sensor is sampled right away if there is not enough time before the transmission. */
+	zassert_equal(motion_sample_align_delay_get(&sa, now_us + REPORT_PERIOD_US,
+						    REPORT_PERIOD_US), 0);
+	zassert_equal(motion_sample_align_delay_get(&sa, now_us + 2 * REPORT_PERIOD_US,
+						    REPORT_PERIOD_US + 1), 0);
+}
+
+ZTEST(motion_sample_align, test_missed_opportunity)
+{
+	int64_t now_us = 0;
+
+	report_sent(&now_us, 0);
+	report_sent(&now_us, REPORT_PERIOD_US);
+
+	/* A HID report that missed its transmission opportunity does not delay the sample. */
+	zassert_equal(report_sent(&now_us, 2 * REPORT_PERIOD_US), REPORT_PERIOD_US - LEAD_US);
+	zassert_equal(report_sent(&now_us, REPORT_PERIOD_US), REPORT_PERIOD_US - LEAD_US);
+}
+
+ZTEST(motion_sample_align, test_short_period)
+{
+	int64_t now_us = 0;
+
+	report_sent(&now_us, 0);
+	report_sent(&now_us, REPORT_PERIOD_US);
+
+	/* HID reports sent in a single connection event are not taken into account. */
+	zassert_equal(report_sent(&now_us, MOTION_SAMPLE_ALIGN_PERIOD_MIN_US - 1),
+		      REPORT_PERIOD_US - LEAD_US);
+	zassert_equal(report_sent(&now_us, 0), REPORT_PERIOD_US - LEAD_US);
+}
+
+ZTEST(motion_sample_align, test_stream_break)
+{
+	int64_t now_us = 0;
+
+	report_sent(&now_us, 0);
+	report_sent(&now_us, REPORT_PERIOD_US);
+
+	/* The period is measured again after a break in the HID report stream. */
+	zassert_equal(report_sent(&now_us, MOTION_SAMPLE_ALIGN_PERIOD_MAX_US + 1), 0);
+	zassert_equal(report_sent(&now_us, 2 * REPORT_PERIOD_US), 2 * REPORT_PERIOD_US - LEAD_US);
+}
+
+ZTEST(motion_sample_align, test_window_wrap)
+{
+	int64_t now_us = 0;
+
+	report_sent(&now_us, 0);
+	report_sent(&now_us, REPORT_PERIOD_US);
+
+	/* The shortest period is used until it drops out of the window. */
+	for (size_t i = 0; i < MOTION_SAMPLE_ALIGN_WINDOW - 1; i++) {
+		zassert_equal(report_sent(&now_us, 2 * REPORT_PERIOD_US),
+			      REPORT_PERIOD_US - LEAD_US);
+	}
+
+	for (size_t i = 0; i < 2 * MOTION_SAMPLE_ALIGN_WINDOW; i++) {
+		zassert_equal(report_sent(&now_us, 2 * REPORT_PERIOD_US),
+			      2 * REPORT_PERIOD_US - LEAD_US);
+	}
+}
+
+ZTEST(motion_sample_align, test_time_wrap)
+{
+	/* The period is measured across the wrap of a 32-bit microsecond counter. */
+	int64_t now_us = (int64_t)UINT32_MAX - REPORT_PERIOD_US / 2;
+
+	report_sent(&now_us, 0);
+	zassert_equal(report_sent(&now_us, REPORT_PERIOD_US), REPORT_PERIOD_US - LEAD_US);
+	zassert_equal(report_sent(&now_us, REPORT_PERIOD_US), REPORT_PERIOD_US - LEAD_US);
+}
+
+ZTEST_SUITE(motion_sample_align, NULL, NULL, sample_align_before, NULL, NULL);
+
+static void latency_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_latency_reset(&ml, 0);
+}
+
+ZTEST(motion_latency, test_latency)
+{
+	uint32_t latency_us;
+
+	/* Only the oldest motion included in the HID report is taken into account. */
+	motion_latency_motion_received(&ml, 1000);
+	motion_latency_motion_received(&ml, 1500);
+	motion_latency_report_submitted(&ml, false);
+
+	zassert_true(motion_latency_report_sent(&ml, 3000, false, &latency_us));
+	zassert_equal(latency_us, 2000);
+}
+
+ZTEST(motion_latency, test_no_motion)
+{
+	uint32_t latency_us;
+
+	zassert_false(motion_latency_report_sent(&ml, 1000, false, &latency_us));
+
+	motion_latency_report_submitted(&ml, false);
+	zassert_false(motion_latency_report_sent(&ml, 2000, false, &latency_us));
+
+	/* Motion received at time zero is tracked. */
+	motion_latency_motion_received(&ml, 0);
+	motion_latency_report_submitted(&ml, false);
+	zassert_true(motion_latency_report_sent(&ml, 3000, false, &latency_us));
+	zassert_equal(latency_us, 3000);
+}
+
+ZTEST(motion_latency, test_error)
+{
+	uint32_t latency_us;
+
+	motion_latency_motion_received(&ml, 1000);
+	motion_latency_report_submitted(&ml, false);
+	motion_latency_motion_received(&ml, 2000);
+	motion_latency_report_submitted(&ml, false);
+
+	zassert_false(motion_latency_report_sent(&ml, 3000, true, &latency_us));
+	zassert_true(motion_latency_report_sent(&ml, 4000, false, &latency_us));
+	zassert_equal(latency_us, 2000);
+}
+
+ZTEST(motion_latency, test_motion_left)
+{
+	uint32_t latency_us;
+
+	/* Motion that did not fit in the first HID report keeps its receive time. */
+	motion_latency_motion_received(&ml, 1000);
+	motion_latency_report_submitted(&ml, true);
+	motion_latency_motion_received(&ml, 2000);
+	motion_latency_report_submitted(&ml, false);
+
+	zassert_true(motion_latency_report_sent(&ml, 3000, false, &latency_us));
+	zassert_equal(latency_us, 2000);
+	zassert_true(motion_latency_report_sent(&ml, 4000, false, &latency_us));
+	zassert_equal(latency_us, 3000);
+}
+
+ZTEST(motion_latency, test_reset_in_flight)
+{
+	uint32_t latency_us;
+
+	motion_latency_motion_received(&ml, 1000);
+	motion_latency_report_submitted(&ml, false);
+
+	/* HID reports in flight during the reset contain no tracked motion. */
+	motion_latency_reset(&ml, 2);
+	motion_latency_motion_received(&ml, 2000);
+	motion_latency_report_submitted(&ml, false);
+
+	zassert_false(motion_latency_report_sent(&ml, 3000, false, &latency_us));
+	zassert_false(motion_latency_report_sent(&ml, 4000, false, &latency_us));
+	zassert_true(motion_latency_report_sent(&ml, 5000, false, &latency_us));
+	zassert_equal(latency_us, 3000);
+	zassert_false(motion_latency_report_sent(&ml, 6000, false, &latency_us));
+}
+
+ZTEST(motion_latency, test_fifo_wrap)
+{
+	uint32_t latency_us;
+	int64_t now_us = 0;
+
+	/* Keep two HID reports in flight, so that the FIFO wraps multiple times. */
+	motion_latency_motion_received(&ml, now_us);
+	motion_latency_report_submitted(&ml, false);
+
+	for (size_t i = 0; i < 3 * MOTION_LATENCY_FIFO_SIZE; i++) {
+		now_us += REPORT_PERIOD_US;
+		motion_latency_motion_received(&ml, now_us);
+		motion_latency_report_submitted(&ml, false);
+
+		zassert_true(motion_latency_report_sent(&ml, now_us + LEAD_US, false,
+							&latency_us));
+		zassert_equal(latency_us, REPORT_PERIOD_US + LEAD_US);
+	}
+
+	zassert_true(motion_latency_report_sent(&ml, now_us + LEAD_US, false, &latency_us));
+	zassert_equal(latency_us, LEAD_US);
+	zassert_false(motion_latency_report_sent(&ml, now_us + LEAD_US, false, &latency_us));
+}
+
+ZTEST_SUITE(motion_latency, NULL, NULL, latency_before, NULL, NULL);
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <diagnostic/diagnostic_logs_compression.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <cstdio>
+
+using Nrf::Matter::LogBlockCompressor;
+
+namespace
+{
+constexpr size_t kBlockSize = 1024;
+/* Size of the network logs retention partition in the Matter diagnostic logs snippet. */
+constexpr size_t kPartitionSize = 6144;
+/* Sizes of the retention RAM header and the block header of the diagnostic logs retention. */
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kBlockHeaderSize = 4;
+constexpr size_t kBenchmarkBlocks = 64;
+
+LogBlockCompressor sCompressor;
+uint8_t sInput[kBlockSize];
+/* Incompressible data grows by the literal run tokens. */
+uint8_t sCompressed[kBlockSize + kBlockSize / LogBlockCompressor::kMaxLiterals + 1];
+uint8_t sOutput[kBlockSize];
+
+/* Generates log lines in the format of the Zephyr text log output, as redirected to the diagnostic logs. */
+class LogGenerator {
+public:
+	size_t Fill(uint8_t *buffer, size_t size)
+	{
+		size_t filled = 0;
+
+		while (filled < size) {
+			if (mLineOffset == mLineSize) {
+				NextLine();
+			}
+
+			const size_t chunkSize = size - filled < mLineSize - mLineOffset ? size - filled :
+												   mLineSize - mLineOffset;
+
+			memcpy(buffer + filled, mLine + mLineOffset, chunkSize);
+			mLineOffset += chunkSize;
+			filled += chunkSize;
+		}
+
+		return filled;
+	}
+
+private:
+	uint32_t Random()
+	{
+		mSeed = mSeed * 1103515245u + 12345u;
+		return mSeed >> 16;
+	}
+
+	void NextLine()
+	{
+		mTimeMs += Random() % 2000;
+		mExchange++;
+
+		int length = snprintf(mLine, sizeof(mLine), "[%02u:%02u:%02u.%03u,%03u] ", mTimeMs / 3600000,
+				      mTimeMs / 60000 % 60, mTimeMs / 1000 % 60, mTimeMs % 1000, Random() % 1000);
+		const size_t left = sizeof(mLine) - length;
+
+		switch (Random() % 5) {
+		case 0:
+			length += snprintf(mLine + length, left,
+					   "<inf> chip: [DMG]Received Command Response Data, Endpoint=%u "
+					   "Cluster=0x0000_0006 Command=0x0000_%04X",
+					   1 + Random() % 3, Random() % 3);
+			break;
+		case 1:
+			length += snprintf(mLine + length, left,
+					   "<dbg> chip: [EM]>>> [E:%uu S:%u M:%u] (S) Msg RX from 1:00000000F5A3D4E1 [BC5F] "
+					   "--- Type 0001:05 (IM:ReportData)",
+					   mExchange, 17 + Random() % 2, Random());
+			break;
+		case 2:
+			length += snprintf(mLine + length, left,
+					   "<inf> chip: [DMG]Refresh Subscribe Sync Timer with min %u seconds and max %u "
+					   "seconds",
+					   1 + Random() % 10, 60 + Random() % 60);
+			break;
+		case 3:
+			length += snprintf(mLine + length, left,
+					   "<inf> chip: [EM]<<< [E:%ui S:%u M:%u] (S) Msg TX to 1:00000000F5A3D4E1 [BC5F] "
+					   "--- Type 0000:10 (SecureChannel:StandaloneAck)",
+					   mExchange, 17 + Random() % 2, Random());
+			break;
+		default:
+			length += snprintf(mLine + length, left, "<inf> app: Temperature changed to %u.%02u C",
+					   20 + Random() % 5, Random() % 100);
+			break;
+		}
+
+		length += snprintf(mLine + length, sizeof(mLine) - length, "\r\n");
+
+		mLineSize = length;
+		mLineOffset = 0;
+	}
+
+	char mLine[200];
+	size_t mLineSize = 0;
+	size_t mLineOffset = 0;
+	uint32_t mTimeMs = 0;
+	uint32_t mExchange = 4242;
+	uint32_t mSeed = 1;
+};
+
+void VerifyRoundTrip(const uint8_t *input, size_t size)
+{
+	const size_t compressedSize = sCompressor.Compress(input, size, sCompressed, sizeof(sCompressed));
+
+	zassert_true(compressedSize > 0, "Compression failed");
+	zassert_equal(LogBlockCompressor::Decompress(sCompressed, compressedSize, sOutput, sizeof(sOutput)), size);
+	zassert_mem_equal(sOutput, input, size);
+}
+} /* namespace */
+
+ZTEST(diagnostic_logs_compression, test_round_trip_logs)
+{
+	LogGenerator generator;
+
+	for (size_t block = 0; block < 16; block++) {
+		VerifyRoundTrip(sInput, generator.Fill(sInput, sizeof(sInput)));
+	}
+}
+
+ZTEST(diagnostic_logs_compression, test_overlapping_match)
+{
+	/* A run of the same byte is encoded as a match overlapping the bytes it produces. */
+	memset(sInput, 'a', sizeof(sInput));
+
+	const size_t compressedSize = sCompressor.Compress(sInput, sizeof(sInput), sCompressed, sizeof(sCompressed));
+
+	zassert_true(compressedSize > 0 && compressedSize < sizeof(sInput) / 8, "Run not compressed: %zu B", compressedSize);
+	VerifyRoundTrip(sInput, sizeof(sInput));
+}
+
+ZTEST(diagnostic_logs_compression, test_short_and_incompressible)
+{
+	uint32_t seed = 7;
+
+	VerifyRoundTrip(reinterpret_cast<const uint8_t *>("ab"), 2);
+
+	for (size_t i = 0; i < sizeof(sInput); i++) {
+		seed = seed * 1103515245u + 12345u;
+		sInput[i] = static_cast<uint8_t>(seed >> 16);
+	}
+
+	/* Random data does not get smaller, so the block shall be rejected when it would not be worth storing. */
+	zassert_equal(sCompressor.Compress(sInput, sizeof(sInput), sCompressed, sizeof(sInput) - 1), 0);
+	VerifyRoundTrip(sInput, sizeof(sInput));
+}
+
+ZTEST(diagnostic_logs_compression, test_dictionary)
+{
+	const char line[] = "<inf> chip: [DMG]Endpoint=1 Cluster=0x0000_0006\r\n";
+	const size_t size = sizeof(line) - 1;
+
+	memcpy(sInput, line, size);
+
+	/* The block starts with an empty history, so the line is compressed only thanks to the dictionary. */
+	const size_t compressedSize = sCompressor.Compress(sInput, size, sCompressed, sizeof(sCompressed));
+
+	zassert_true(compressedSize > 0 && compressedSize < size / 2, "Line not compressed: %zu B", compressedSize);
+	VerifyRoundTrip(sInput, size);
+}
+
+ZTEST(diagnostic_logs_compression, test_corrupted_input)
+{
+	/* Match referring to data before the beginning of the dictionary that precedes the block. */
+	constexpr size_t kInvalidDistance = LogBlockCompressor::kDictionarySize + 2;
+	const uint8_t invalidDistance[] = { 0x00, 'a', static_cast<uint8_t>(0x80 | (kInvalidDistance >> 8)),
+					    static_cast<uint8_t>(kInvalidDistance) };
+	/* Literal run longer than the remaining input. */
+	const uint8_t truncatedLiterals[] = { 0x05, 'a', 'b' };
+	/* Match without the distance. */
+	const uint8_t truncatedMatch[] = { 0x00, 'a', 0x80 };
+
+	zassert_equal(LogBlockCompressor::Decompress(invalidDistance, sizeof(invalidDistance), sOutput,
+						     sizeof(sOutput)),
+		      0);
+	zassert_equal(LogBlockCompressor::Decompress(truncatedLiterals, sizeof(truncatedLiterals), sOutput,
+						     sizeof(sOutput)),
+		      0);
+	zassert_equal(LogBlockCompressor::Decompress(truncatedMatch, sizeof(truncatedMatch), sOutput,
+						     sizeof(sOutput)),
+		      0);
+	zassert_equal(LogBlockCompressor::Decompress(invalidDistance, 2, sOutput, 0), 0,
+		      "Output buffer overflow not detected");
+}
+
+ZTEST(diagnostic_logs_compression, test_bytes_kept)
+{
+	LogGenerator generator;
+	size_t storedSizes[kBenchmarkBlocks];
+	size_t logsSizes[kBenchmarkBlocks];
+
+	for (size_t block = 0; block < kBenchmarkBlocks; block++) {
+		logsSizes[block] = generator.Fill(sInput, sizeof(sInput));
+
+		const size_t compressedSize =
+			sCompressor.Compress(sInput, logsSizes[block], sCompressed, logsSizes[block] - 1);
+
+		storedSizes[block] = kBlockHeaderSize + (compressedSize > 0 ? compressedSize : logsSizes[block]);
+	}
+
+	/* Count the logs kept in the partition, starting from the newest block, as the oldest ones are overwritten. */
+	const size_t capacity = kPartitionSize - kHeaderSize;
+	size_t storedSize = 0;
+	size_t keptSize = 0;
+	size_t totalStoredSize = 0;
+	size_t totalLogsSize = 0;
+
+	for (size_t block = kBenchmarkBlocks; block > 0; block--) {
+		totalStoredSize += storedSizes[block - 1];
+		totalLogsSize += logsSizes[block - 1];
+
+		if (storedSize + storedSizes[block - 1] <= capacity) {
+			storedSize += storedSizes[block - 1];
+			keptSize += logsSizes[block - 1];
+		}
+	}
+
+	TC_PRINT("Compression ratio of %zu B blocks: %zu.%02zu\n", kBlockSize, totalLogsSize / totalStoredSize,
+		 totalLogsSize * 100 / totalStoredSize % 100);
+	TC_PRINT("Logs kept in a %zu B partition: %zu B compressed, %zu B uncompressed\n", kPartitionSize, keptSize,
+		 capacity);
+
+	zassert_true(keptSize > capacity, "Compression does not keep more logs: %zu B", keptSize);
+}
+
+ZTEST_SUITE(diagnostic_logs_compression, NULL, NULL, NULL, NULL, NULL);
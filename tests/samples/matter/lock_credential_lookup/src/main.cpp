@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "credential_lookup.h"
+#include "host_clock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <cstdio>
+
+using DoorLockData::CredentialLookup;
+
+namespace
+{
+constexpr uint16_t kCredentials = 4096;
+constexpr size_t kMaxCredentialLength = 10;
+constexpr size_t kBenchmarkRounds = 4;
+
+/* Credential slots of a single type, in the layout of the lock credential secrets. */
+struct Secret {
+	uint8_t mData[kMaxCredentialLength];
+	size_t mDataLength;
+};
+
+using Lookup = CredentialLookup<kCredentials>;
+
+Secret sSecrets[kCredentials];
+Lookup sLookup;
+
+constexpr uint8_t kKey[Lookup::kKeySize] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+constexpr uint8_t kOtherKey[Lookup::kKeySize] = { 0x10, 0x32, 0x54, 0x76, 0x98, 0xba, 0xdc, 0xfe };
+
+/* Fills the secret with 8 pseudo-random PIN digits, unique for every credential index. */
+void MakePin(uint16_t credentialIndex, Secret &secret)
+{
+	uint32_t value = credentialIndex * 2654435761u % 100000000u;
+
+	for (size_t i = 0; i < 8; i++) {
+		secret.mData[7 - i] = '0' + value % 10;
+		value /= 10;
+	}
+	secret.mDataLength = 8;
+}
+
+void FillCredentials()
+{
+	sLookup.Clear(kKey);
+
+	for (uint16_t index = 1; index <= kCredentials; index++) {
+		MakePin(index, sSecrets[index - 1]);
+		zassert_true(sLookup.Insert(index, sSecrets[index - 1].mData, sSecrets[index - 1].mDataLength));
+	}
+}
+
+uint16_t Find(const Lookup &lookup, const Secret &pin)
+{
+	return lookup.Find(pin.mData, pin.mDataLength, [&pin](uint16_t index) {
+		const Secret &secret = sSecrets[index - 1];
+		return Lookup::ConstantTimeEqual(secret.mData, secret.mDataLength, pin.mData, pin.mDataLength);
+	});
+}
+
+/* Reference path that walks all slots like the previous PIN validation. */
+uint16_t FindLinear(const Secret &pin)
+{
+	for (uint16_t index = 1; index <= kCredentials; index++) {
+		const Secret &secret = sSecrets[index - 1];
+
+		if (secret.mDataLength == pin.mDataLength && memcmp(secret.mData, pin.mData, pin.mDataLength) == 0) {
+			return index;
+		}
+	}
+
+	return 0;
+}
+
+/* Looks up every stored PIN and as many wrong PINs, and returns the number of lookups per second. */
+template <typename FindFunction> uint32_t RunBenchmark(FindFunction find)
+{
+	Secret wrong = {};
+	uint32_t found = 0;
+
+	memcpy(wrong.mData, "99999999X", 9);
+	wrong.mDataLength = 9;
+
+	const uint64_t start = host_clock_time_ns();
+
+	for (size_t round = 0; round < kBenchmarkRounds; round++) {
+		for (uint16_t index = 1; index <= kCredentials; index++) {
+			found += find(sSecrets[index - 1]) == index;
+			wrong.mData[8] = static_cast<uint8_t>(index);
+			found += find(wrong) != 0;
+		}
+	}
+
+	const uint64_t elapsed = host_clock_time_ns() - start;
+
+	zassert_equal(found, kBenchmarkRounds * kCredentials);
+
+	return static_cast<uint32_t>(static_cast<uint64_t>(2 * kBenchmarkRounds * kCredentials) * NSEC_PER_SEC /
+				     MAX(elapsed, 1U));
+}
+} /* namespace */
+
+ZTEST(lock_credential_lookup, test_hash_vector)
+{
+	/* Test vectors of the HalfSipHash-2-4 reference implementation with the 0x00-0x07 key. */
+	static const uint8_t kMessage[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+	Lookup lookup;
+
+	lookup.Clear(kKey);
+
+	zassert_equal(lookup.Hash(kMessage, 0), 0x5b9f35a9);
+	zassert_equal(lookup.Hash(kMessage, 1), 0xb85a4727);
+}
+
+ZTEST(lock_credential_lookup, test_find)
+{
+	Secret unknown = {};
+
+	FillCredentials();
+
+	for (uint16_t index = 1; index <= kCredentials; index++) {
+		zassert_equal(Find(sLookup, sSecrets[index - 1]), index);
+	}
+
+	memcpy(unknown.mData, "1234", 4);
+	unknown.mDataLength = 4;
+	zassert_equal(Find(sLookup, unknown), 0);
+
+	/* A prefix of the stored PIN must not match it. */
+	unknown = sSecrets[0];
+	unknown.mDataLength--;
+	zassert_equal(Find(sLookup, unknown), 0);
+}
+
+ZTEST(lock_credential_lookup, test_remove)
+{
+	FillCredentials();
+
+	/* Removing every other credential shifts back the entries that collided with the removed ones. */
+	for (uint16_t index = 1; index <= kCredentials; index += 2) {
+		zassert_true(sLookup.Remove(index, sSecrets[index - 1].mData, sSecrets[index - 1].mDataLength));
+	}
+
+	for (uint16_t index = 1; index <= kCredentials; index++) {
+		zassert_equal(Find(sLookup, sSecrets[index - 1]), (index % 2) ? 0 : index);
+	}
+
+	zassert_false(sLookup.Remove(1, sSecrets[0].mData, sSecrets[0].mDataLength));
+
+	/* Modify the credential by removing its old secret and adding the new one. */
+	Secret modified = sSecrets[1];
+
+	modified.mData[0] = 'X';
+	zassert_true(sLookup.Remove(2, sSecrets[1].mData, sSecrets[1].mDataLength));
+	sSecrets[1] = modified;
+	zassert_true(sLookup.Insert(2, sSecrets[1].mData, sSecrets[1].mDataLength));
+
+	MakePin(2, modified);
+	zassert_equal(Find(sLookup, modified), 0);
+	zassert_equal(Find(sLookup, sSecrets[1]), 2);
+}
+
+ZTEST(lock_credential_lookup, test_duplicate_secret)
+{
+	Lookup lookup;
+	const Secret &pin = sSecrets[0];
+
+	FillCredentials();
+	lookup.Clear(kKey);
+
+	/* The door lock server does not allow duplicates, but the lookup must still find one of the credentials. */
+	zassert_true(lookup.Insert(1, pin.mData, pin.mDataLength));
+	zassert_true(lookup.Insert(2, pin.mData, pin.mDataLength));
+	zassert_equal(Find(lookup, pin), 1);
+	zassert_true(lookup.Remove(1, pin.mData, pin.mDataLength));
+	zassert_equal(lookup.Find(pin.mData, pin.mDataLength, [](uint16_t) { return true; }), 2);
+}
+
+ZTEST(lock_credential_lookup, test_key)
+{
+	Lookup lookup;
+	const Secret &pin = sSecrets[0];
+
+	lookup.Clear(kKey);
+	const uint32_t hash = lookup.Hash(pin.mData, pin.mDataLength);
+
+	lookup.Clear(kOtherKey);
+	zassert_not_equal(lookup.Hash(pin.mData, pin.mDataLength), hash);
+
+	zassert_false(lookup.Insert(0, pin.mData, pin.mDataLength));
+	zassert_false(lookup.Insert(kCredentials + 1, pin.mData, pin.mDataLength));
+}
+
+ZTEST(lock_credential_lookup, test_constant_time_equal)
+{
+	static const uint8_t kPin[] = { '1', '2', '3', '4', '5', '6' };
+	static const uint8_t kOther[] = { '1', '2', '3', '4', '5', '7' };
+
+	zassert_true(Lookup::ConstantTimeEqual(kPin, sizeof(kPin), kPin, sizeof(kPin)));
+	zassert_false(Lookup::ConstantTimeEqual(kPin, sizeof(kPin), kOther, sizeof(kOther)));
+	zassert_false(Lookup::ConstantTimeEqual(kPin, sizeof(kPin), kPin, sizeof(kPin) - 1));
+	zassert_true(Lookup::ConstantTimeEqual(kPin, 0, kOther, 0));
+}
+
+ZTEST(lock_credential_lookup, test_benchmark)
+{
+	FillCredentials();
+
+	const uint32_t lookupRate = RunBenchmark([](const Secret &pin) { return Find(sLookup, pin); });
+	const uint32_t linearRate = RunBenchmark(FindLinear);
+
+	TC_PRINT("PIN lookups per second with %u credentials: hashed index %u, linear scan %u\n", kCredentials,
+		 lookupRate, linearRate);
+
+	zassert_true(lookupRate > linearRate, "Hashed index is slower than the linear scan");
+}
+
+ZTEST_SUITE(lock_credential_lookup, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "host_clock.h"
+#include "schedule_index.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+using DoorLockData::IntervalIndex;
+using DoorLockData::ScheduleRestriction;
+using DoorLockData::ScheduleTime;
+using DoorLockData::UserScheduleIndex;
+
+namespace
+{
+constexpr size_t kUsers = 10;
+constexpr size_t kWeekDaySchedules = 32;
+constexpr size_t kYearDaySchedules = 32;
+constexpr uint32_t kSecondsPerDay = 24 * 60 * 60;
+constexpr uint32_t kBenchmarkQueries = 200000;
+
+/* Schedule fields in the layout of the lock schedules. */
+struct WeekDaySchedule {
+	uint8_t mDaysMask;
+	uint8_t mStartHour;
+	uint8_t mStartMinute;
+	uint8_t mEndHour;
+	uint8_t mEndMinute;
+	bool mAvailable;
+};
+
+struct YearDaySchedule {
+	uint32_t mLocalStartTime;
+	uint32_t mLocalEndTime;
+	bool mAvailable;
+};
+
+/* Same as AccessManager::ScheduleIndex. */
+using Index = UserScheduleIndex<kWeekDaySchedules, kYearDaySchedules>;
+
+WeekDaySchedule sWeekDay[kUsers][kWeekDaySchedules];
+YearDaySchedule sYearDay[kUsers][kYearDaySchedules];
+Index sIndex[kUsers];
+
+uint32_t sSeed = 1;
+
+uint32_t Random()
+{
+	sSeed = sSeed * 1103515245u + 12345u;
+	return sSeed >> 8;
+}
+
+/* Same as AccessManager::RebuildScheduleIndex(). */
+void RebuildIndex(size_t user)
+{
+	Index::WeekDayIndex::Interval weekDay[7 * kWeekDaySchedules];
+	Index::YearDayIndex::Interval yearDay[kYearDaySchedules];
+	size_t weekDayCount = 0;
+	size_t yearDayCount = 0;
+
+	for (auto &schedule : sWeekDay[user]) {
+		if (schedule.mAvailable) {
+			continue;
+		}
+
+		for (uint8_t day = 0; day < 7; day++) {
+			if (schedule.mDaysMask & (1 << day)) {
+				weekDay[weekDayCount++] = {
+					ScheduleTime::MinuteOfWeek(day, schedule.mStartHour, schedule.mStartMinute),
+					ScheduleTime::MinuteOfWeek(day, schedule.mEndHour, schedule.mEndMinute)
+				};
+			}
+		}
+	}
+
+	for (auto &schedule : sYearDay[user]) {
+		if (!schedule.mAvailable) {
+			yearDay[yearDayCount++] = { schedule.mLocalStartTime, schedule.mLocalEndTime };
+		}
+	}
+
+	sIndex[user].mWeekDay.Build(weekDay, weekDayCount);
+	sIndex[user].mYearDay.Build(yearDay, yearDayCount);
+}
+
+/* Same as AccessManager::IsUserAllowed() for a Schedule Restricted User. */
+bool IsAllowed(size_t user, uint32_t localTime)
+{
+	return sIndex[user].IsAllowed(ScheduleRestriction::Any, localTime);
+}
+
+/* Reference evaluation that checks every schedule of the user. */
+bool IsAllowedLinear(size_t user, uint32_t localTime)
+{
+	const uint32_t minutes = localTime / 60;
+	const uint8_t day = (minutes / ScheduleTime::kMinutesPerDay + ScheduleTime::kEpochDayOfWeek) % 7;
+	const uint32_t minuteOfDay = minutes % ScheduleTime::kMinutesPerDay;
+
+	for (auto &schedule : sWeekDay[user]) {
+		if (!schedule.mAvailable && (schedule.mDaysMask & (1 << day)) &&
+		    minuteOfDay >= schedule.mStartHour * 60u + schedule.mStartMinute &&
+		    minuteOfDay < schedule.mEndHour * 60u + schedule.mEndMinute) {
+			return true;
+		}
+	}
+
+	for (auto &schedule : sYearDay[user]) {
+		if (!schedule.mAvailable && localTime >= schedule.mLocalStartTime &&
+		    localTime < schedule.mLocalEndTime) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Fills all schedule slots of all users, like a fully populated lock. */
+void FillSchedules()
+{
+	for (size_t user = 0; user < kUsers; user++) {
+		for (auto &schedule : sWeekDay[user]) {
+			const uint8_t start = Random() % 23;
+
+			schedule = { static_cast<uint8_t>(Random() & 0x7F),
+				     start,
+				     static_cast<uint8_t>(Random() % 60),
+				     static_cast<uint8_t>(start + 1 + Random() % (23 - start)),
+				     static_cast<uint8_t>(Random() % 60),
+				     false };
+		}
+
+		for (auto &schedule : sYearDay[user]) {
+			const uint32_t start = Random() % (365 * kSecondsPerDay);
+
+			schedule = { start, start + Random() % (7 * kSecondsPerDay), false };
+		}
+
+		RebuildIndex(user);
+	}
+}
+
+template <typename Check> uint32_t RunBenchmark(Check check, uint32_t &allowed)
+{
+	const uint64_t start = host_clock_time_ns();
+
+	sSeed = 7;
+	allowed = 0;
+
+	for (uint32_t query = 0; query < kBenchmarkQueries; query++) {
+		allowed += check(query % kUsers, Random() % (365 * kSecondsPerDay));
+	}
+
+	const uint64_t elapsed = host_clock_time_ns() - start;
+
+	return static_cast<uint32_t>(static_cast<uint64_t>(kBenchmarkQueries) * NSEC_PER_SEC / MAX(elapsed, 1U));
+}
+} /* namespace */
+
+ZTEST(lock_schedule_index, test_merge)
+{
+	IntervalIndex<uint32_t, 8> index;
+	IntervalIndex<uint32_t, 8>::Interval intervals[] = {
+		{ 50, 60 }, { 10, 20 }, { 15, 30 }, { 30, 35 }, { 40, 40 }, { 70, 65 },
+	};
+
+	index.Build(intervals, ARRAY_SIZE(intervals));
+
+	/* Overlapping and adjacent intervals are merged, empty ones are skipped. */
+	zassert_equal(index.Count(), 2);
+	zassert_false(index.Contains(9));
+	zassert_true(index.Contains(10));
+	zassert_true(index.Contains(25));
+	zassert_true(index.Contains(34));
+	zassert_false(index.Contains(35));
+	zassert_false(index.Contains(40));
+	zassert_true(index.Contains(50));
+	zassert_false(index.Contains(60));
+	zassert_false(index.Contains(67));
+
+	index.Clear();
+	zassert_true(index.IsEmpty());
+	zassert_false(index.Contains(10));
+}
+
+ZTEST(lock_schedule_index, test_minute_of_week)
+{
+	/* January 1, 2000 was a Saturday. */
+	zassert_equal(ScheduleTime::MinuteOfWeek(0u), ScheduleTime::MinuteOfWeek(6, 0, 0));
+	zassert_equal(ScheduleTime::MinuteOfWeek(kSecondsPerDay + 9 * 3600 + 30 * 60 + 59),
+		      ScheduleTime::MinuteOfWeek(0, 9, 30));
+	zassert_equal(ScheduleTime::MinuteOfWeek(7 * kSecondsPerDay - 1), ScheduleTime::MinuteOfWeek(5, 23, 59));
+}
+
+ZTEST(lock_schedule_index, test_incremental_update)
+{
+	memset(sWeekDay, 0, sizeof(sWeekDay));
+	memset(sYearDay, 0, sizeof(sYearDay));
+
+	for (size_t user = 0; user < kUsers; user++) {
+		for (auto &schedule : sWeekDay[user]) {
+			schedule.mAvailable = true;
+		}
+		for (auto &schedule : sYearDay[user]) {
+			schedule.mAvailable = true;
+		}
+		RebuildIndex(user);
+	}
+
+	/* Monday 9:00 - 17:00 for the first user only. */
+	const uint32_t monday = 2 * kSecondsPerDay;
+
+	sWeekDay[0][0] = { 0x02, 9, 0, 17, 0, false };
+	RebuildIndex(0);
+
+	zassert_true(IsAllowed(0, monday + 9 * 3600));
+	zassert_true(IsAllowed(0, monday + 17 * 3600 - 1));
+	zassert_false(IsAllowed(0, monday + 17 * 3600));
+	zassert_false(IsAllowed(0, monday + 7 * kSecondsPerDay - 3600));
+	zassert_true(IsAllowed(0, monday + 7 * kSecondsPerDay + 12 * 3600));
+	zassert_false(IsAllowed(1, monday + 12 * 3600));
+
+	/* The Year Day schedule allows the access outside the Week Day schedule. */
+	sYearDay[0][3] = { monday + 20 * 3600, monday + 22 * 3600, false };
+	RebuildIndex(0);
+	zassert_true(IsAllowed(0, monday + 21 * 3600));
+
+	sWeekDay[0][0].mAvailable = true;
+	RebuildIndex(0);
+	zassert_false(IsAllowed(0, monday + 12 * 3600));
+	zassert_true(IsAllowed(0, monday + 21 * 3600));
+}
+
+ZTEST(lock_schedule_index, test_user_type_restriction)
+{
+	Index index;
+	Index::WeekDayIndex::Interval weekDay[] = { { ScheduleTime::MinuteOfWeek(1, 8, 0),
+						     ScheduleTime::MinuteOfWeek(1, 16, 0) } };
+	const uint32_t monday = 2 * kSecondsPerDay;
+	const uint32_t sunday = 8 * kSecondsPerDay;
+	Index::YearDayIndex::Interval yearDay[] = { { sunday, sunday + kSecondsPerDay } };
+
+	/* Monday 8:00 - 16:00 and the whole next Sunday. */
+	index.mWeekDay.Build(weekDay, ARRAY_SIZE(weekDay));
+	index.mYearDay.Build(yearDay, ARRAY_SIZE(yearDay));
+
+	/* A Week Day Schedule User is not let in by the Year Day schedules. */
+	zassert_true(index.IsAllowed(ScheduleRestriction::WeekDay, monday + 12 * 3600));
+	zassert_false(index.IsAllowed(ScheduleRestriction::WeekDay, sunday + 12 * 3600));
+
+	/* A Year Day Schedule User is not let in by the Week Day schedules. */
+	zassert_false(index.IsAllowed(ScheduleRestriction::YearDay, monday + 12 * 3600));
+	zassert_true(index.IsAllowed(ScheduleRestriction::YearDay, sunday + 12 * 3600));
+
+	/* A Schedule Restricted User is let in by either of them. */
+	zassert_true(index.IsAllowed(ScheduleRestriction::Any, monday + 12 * 3600));
+	zassert_true(index.IsAllowed(ScheduleRestriction::Any, sunday + 12 * 3600));
+	zassert_false(index.IsAllowed(ScheduleRestriction::Any, monday + 17 * 3600));
+}
+
+ZTEST(lock_schedule_index, test_benchmark)
+{
+	uint32_t indexAllowed;
+	uint32_t linearAllowed;
+
+	FillSchedules();
+
+	/* Both evaluations must give the same answers. */
+	for (uint32_t query = 0; query < 10000; query++) {
+		const size_t user = query % kUsers;
+		const uint32_t localTime = Random() % (365 * kSecondsPerDay);
+
+		zassert_equal(IsAllowed(user, localTime), IsAllowedLinear(user, localTime));
+	}
+
+	const uint64_t start = host_clock_time_ns();
+
+	for (size_t user = 0; user < kUsers; user++) {
+		RebuildIndex(user);
+	}
+
+	const uint64_t rebuildTime = host_clock_time_ns() - start;
+	const uint32_t indexRate = RunBenchmark(IsAllowed, indexAllowed);
+	const uint32_t linearRate = RunBenchmark(IsAllowedLinear, linearAllowed);
+
+	zassert_equal(indexAllowed, linearAllowed);
+
+	TC_PRINT("Access checks per second with %zu users, %zu week day and %zu year day schedules per user: "
+		 "interval index %u, linear evaluation %u\n",
+		 kUsers, kWeekDaySchedules, kYearDaySchedules, indexRate, linearRate);
+	TC_PRINT("Rebuilding the index of all users took %u us\n",
+		 static_cast<uint32_t>(rebuildTime / NSEC_PER_USEC));
+}
+
+ZTEST_SUITE(lock_schedule_index, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <persistent_storage/persistent_storage_common.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <cstdio>
+#include <new>
+
+using Nrf::PersistentStorageNode;
+
+namespace
+{
+constexpr size_t kTestThreadStackSize = 2048;
+/* Worst-case stack usage of building the key of the deepest possible node, on top of the thread entry. */
+constexpr size_t kMaxGetKeyStackUsage = 192;
+constexpr uint32_t kBenchmarkIterations = 10000;
+
+K_THREAD_STACK_DEFINE(sTestThreadStack, kTestThreadStackSize);
+struct k_thread sTestThread;
+bool sTestThreadResult;
+
+/* Recursive key building used before the key was cached in the node, kept as the benchmark reference. */
+class LegacyNode {
+public:
+	LegacyNode(const char *keyName, size_t keyNameLength, LegacyNode *parent = nullptr) : mParent(parent)
+	{
+		if (keyNameLength < sizeof(mKeyName)) {
+			memcpy(mKeyName, keyName, keyNameLength);
+		}
+	}
+
+	bool GetKey(char *key)
+	{
+		if (mParent != nullptr) {
+			char parentKey[PersistentStorageNode::kMaxKeyNameLength];
+
+			if (!mParent->GetKey(parentKey)) {
+				return false;
+			}
+
+			constexpr auto kMaxLength = PersistentStorageNode::kMaxKeyNameLength;
+			int result = snprintf(key, kMaxLength, "%s/%s", parentKey, mKeyName);
+
+			return result >= 0 && result + 1 <= kMaxLength;
+		}
+
+		strncpy(key, mKeyName, PersistentStorageNode::kMaxKeyNameLength);
+		return true;
+	}
+
+private:
+	LegacyNode *mParent;
+	char mKeyName[PersistentStorageNode::kMaxKeyNameLength] = { 0 };
+};
+
+/* Chain of single-character nodes as deep as the maximum key length allows: "a/a/a/a/a/a/a/a/a". */
+template <class Node> struct DeepChain {
+	DeepChain()
+	{
+		for (uint8_t i = 0; i < PersistentStorageNode::kMaxDepth; i++) {
+			new (&mNodes[i]) Node("a", 1, i > 0 ? Leaf(i - 1) : nullptr);
+		}
+	}
+
+	Node *Leaf(uint8_t level = PersistentStorageNode::kMaxDepth - 1)
+	{
+		return reinterpret_cast<Node *>(&mNodes[level]);
+	}
+
+	alignas(Node) uint8_t mNodes[PersistentStorageNode::kMaxDepth][sizeof(Node)];
+};
+
+void EmptyEntry(void *, void *, void *)
+{
+	sTestThreadResult = true;
+}
+
+void GetKeyEntry(void *node, void *, void *)
+{
+	sTestThreadResult = static_cast<PersistentStorageNode *>(node)->GetKey() != nullptr;
+}
+
+void LegacyGetKeyEntry(void *node, void *, void *)
+{
+	char key[PersistentStorageNode::kMaxKeyNameLength];
+
+	sTestThreadResult = static_cast<LegacyNode *>(node)->GetKey(key);
+}
+
+size_t MeasureStackUsage(k_thread_entry_t entry, void *arg)
+{
+	size_t unused = 0;
+
+	sTestThreadResult = false;
+	k_thread_create(&sTestThread, sTestThreadStack, K_THREAD_STACK_SIZEOF(sTestThreadStack), entry, arg, nullptr,
+			nullptr, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_thread_join(&sTestThread, K_FOREVER);
+	zassert_true(sTestThreadResult);
+	zassert_ok(k_thread_stack_space_get(&sTestThread, &unused));
+
+	return K_THREAD_STACK_SIZEOF(sTestThreadStack) - unused;
+}
+
+uint32_t CyclesPerCall(uint32_t start)
+{
+	return (k_cycle_get_32() - start) / kBenchmarkIterations;
+}
+} /* namespace */
+
+ZTEST(persistent_storage_node, test_key_with_parents)
+{
+	PersistentStorageNode bridge("br", 2);
+	PersistentStorageNode device("brd", 3, &bridge);
+	PersistentStorageNode index("3", 1, &device);
+	PersistentStorageNode bt("bt", 2, &index);
+	PersistentStorageNode address("addr", 4, &bt);
+	char key[PersistentStorageNode::kMaxKeyNameLength];
+
+	zassert_str_equal(address.GetKey(), "br/brd/3/bt/addr");
+	zassert_equal(address.GetKeyLength(), strlen("br/brd/3/bt/addr"));
+	zassert_str_equal(bt.GetKey(), "br/brd/3/bt");
+	zassert_str_equal(bridge.GetKey(), "br");
+
+	zassert_true(index.GetKey(key));
+	zassert_str_equal(key, "br/brd/3");
+}
+
+ZTEST(persistent_storage_node, test_key_name_with_terminator)
+{
+	/* Some callers pass the name length including the terminating null. */
+	PersistentStorageNode node("cr/usr", sizeof("cr/usr"));
+
+	zassert_str_equal(node.GetKey(), "cr/usr");
+	zassert_equal(node.GetKeyLength(), strlen("cr/usr"));
+}
+
+ZTEST(persistent_storage_node, test_parent_constructed_after_child)
+{
+	struct Nodes {
+		PersistentStorageNode mChild{ "ver", 3, &mParent };
+		PersistentStorageNode mParent{ "br", 2 };
+	};
+	static Nodes sNodes;
+
+	zassert_str_equal(sNodes.mChild.GetKey(), "br/ver");
+}
+
+ZTEST(persistent_storage_node, test_invalid_keys)
+{
+	PersistentStorageNode empty("", 0);
+	PersistentStorageNode tooLongName("0123456789abcdefghij", 20);
+	PersistentStorageNode parent("0123456789", 10);
+	PersistentStorageNode tooLongKey("0123456", 7, &parent);
+	PersistentStorageNode child("a", 1, &tooLongKey);
+	char key[PersistentStorageNode::kMaxKeyNameLength];
+
+	zassert_is_null(empty.GetKey());
+	zassert_is_null(tooLongName.GetKey());
+	zassert_is_null(tooLongKey.GetKey());
+	zassert_is_null(child.GetKey());
+	zassert_equal(child.GetKeyLength(), 0);
+	zassert_false(child.GetKey(key));
+}
+
+ZTEST(persistent_storage_node, test_build_key)
+{
+	static constexpr auto kKey = PersistentStorageNode::BuildKey({ "br", "brd", "bt" });
+	static constexpr auto kTooLong = PersistentStorageNode::BuildKey({ "0123456789", "0123456" });
+	static constexpr auto kEmptyName = PersistentStorageNode::BuildKey({ "br", "" });
+
+	static_assert(kKey.IsValid() && kKey.mLength == sizeof("br/brd/bt") - 1);
+	static_assert(!kTooLong.IsValid());
+	static_assert(!kEmptyName.IsValid());
+
+	PersistentStorageNode node(kKey);
+	PersistentStorageNode child("1", 1, &node);
+	PersistentStorageNode invalid(kTooLong);
+
+	zassert_str_equal(node.GetKey(), "br/brd/bt");
+	zassert_str_equal(child.GetKey(), "br/brd/bt/1");
+	zassert_is_null(invalid.GetKey());
+}
+
+ZTEST(persistent_storage_node, test_deepest_key)
+{
+	DeepChain<PersistentStorageNode> chain;
+	PersistentStorageNode tooDeep("a", 1, chain.Leaf());
+
+	zassert_equal(chain.Leaf()->GetKeyLength(), 2 * PersistentStorageNode::kMaxDepth - 1);
+	zassert_is_null(tooDeep.GetKey());
+}
+
+ZTEST(persistent_storage_node, test_get_key_stack_usage)
+{
+	DeepChain<PersistentStorageNode> chain;
+	DeepChain<LegacyNode> legacyChain;
+
+	const size_t baseline = MeasureStackUsage(EmptyEntry, nullptr);
+	/* None of the keys is built yet, so this measures the worst case: building keys of all levels. */
+	const size_t getKey = MeasureStackUsage(GetKeyEntry, chain.Leaf()) - baseline;
+	const size_t legacyGetKey = MeasureStackUsage(LegacyGetKeyEntry, legacyChain.Leaf()) - baseline;
+
+	TC_PRINT("GetKey() stack usage for depth %u: %zu B (recursive: %zu B)\n", PersistentStorageNode::kMaxDepth,
+		 getKey, legacyGetKey);
+
+	zassert_true(getKey <= kMaxGetKeyStackUsage, "GetKey() used %zu B of stack", getKey);
+}
+
+ZTEST(persistent_storage_node, test_get_key_benchmark)
+{
+	LegacyNode legacyBridge("br", 2);
+	LegacyNode legacyDevice("brd", 3, &legacyBridge);
+	LegacyNode legacyIndex("3", 1, &legacyDevice);
+	LegacyNode legacyBt("bt", 2, &legacyIndex);
+	LegacyNode legacyAddress("addr", 4, &legacyBt);
+	PersistentStorageNode bridge("br", 2);
+	PersistentStorageNode device("brd", 3, &bridge);
+	PersistentStorageNode index("3", 1, &device);
+	PersistentStorageNode bt("bt", 2, &index);
+	PersistentStorageNode address("addr", 4, &bt);
+	char key[PersistentStorageNode::kMaxKeyNameLength];
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < kBenchmarkIterations; i++) {
+		zassert_true(legacyAddress.GetKey(key));
+	}
+	const uint32_t legacyCycles = CyclesPerCall(start);
+
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < kBenchmarkIterations; i++) {
+		zassert_true(address.GetKey(key));
+	}
+	const uint32_t cachedCycles = CyclesPerCall(start);
+
+	/* Temporary node created for every access, like the nodes of bridged device indexes. */
+	start = k_cycle_get_32();
+	for (uint32_t i = 0; i < kBenchmarkIterations; i++) {
+		PersistentStorageNode temporary("addr", 4, &bt);
+		zassert_true(temporary.GetKey(key));
+	}
+	const uint32_t temporaryCycles = CyclesPerCall(start);
+
+	TC_PRINT("Key of depth 5, cycles per call: recursive %u, cached %u, temporary node %u\n", legacyCycles,
+		 cachedCycles, temporaryCycles);
+
+	zassert_str_equal(key, "br/brd/3/bt/addr");
+}
+
+ZTEST_SUITE(persistent_storage_node, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef PROTECTED_STORAGE_MOCK_H_
+#define PROTECTED_STORAGE_MOCK_H_
+
+/* Subset of the PSA Protected Storage API used by the secure persistent storage backend. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int32_t psa_status_t;
+typedef uint64_t psa_storage_uid_t;
+typedef uint32_t psa_storage_create_flags_t;
+
+typedef struct psa_storage_info_t {
+	size_t capacity;
+	size_t size;
+	psa_storage_create_flags_t flags;
+} psa_storage_info_t;
+
+#define PSA_SUCCESS ((psa_status_t)0)
+#define PSA_ERROR_INSUFFICIENT_STORAGE ((psa_status_t)-142)
+#define PSA_ERROR_DOES_NOT_EXIST ((psa_status_t)-140)
+#define PSA_STORAGE_FLAG_NONE 0u
+
+psa_status_t psa_ps_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+			psa_storage_create_flags_t create_flags);
+psa_status_t psa_ps_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+			size_t *p_data_length);
+psa_status_t psa_ps_get_info(psa_storage_uid_t uid, psa_storage_info_t *p_info);
+psa_status_t psa_ps_remove(psa_storage_uid_t uid);
+
+/* Remove all the assets. */
+void protected_storage_mock_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROTECTED_STORAGE_MOCK_H_ */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <persistent_storage/backends/persistent_storage_secure.h>
+
+#include <psa/protected_storage.h>
+
+#include <zephyr/ztest.h>
+
+using Nrf::PersistentStorageNode;
+using Nrf::PSErrorCode;
+using Nrf::PSReadFunction;
+
+namespace
+{
+constexpr size_t kMaxVisited = 8;
+
+class TestStorage : public Nrf::PersistentStorageSecure {
+public:
+	using PersistentStorageSecure::_SecureFactoryReset;
+	using PersistentStorageSecure::_SecureLoadSubtree;
+	using PersistentStorageSecure::_SecureRemove;
+	using PersistentStorageSecure::_SecureStore;
+};
+
+struct VisitedEntries {
+	char mNames[kMaxVisited][PersistentStorageNode::kMaxKeyNameLength];
+	uint8_t mValues[kMaxVisited];
+	size_t mCount;
+
+	bool Contains(const char *name, uint8_t value) const
+	{
+		for (size_t i = 0; i < mCount; i++) {
+			if (strcmp(mNames[i], name) == 0 && mValues[i] == value) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
+TestStorage sStorage;
+PersistentStorageNode sBridge("br", 2);
+PersistentStorageNode sOther("ot", 2);
+
+bool CollectEntry(const char *name, size_t dataSize, PSReadFunction read, void *readContext, void *context)
+{
+	auto *visited = static_cast<VisitedEntries *>(context);
+
+	zassert_true(visited->mCount < kMaxVisited);
+	zassert_equal(dataSize, sizeof(uint8_t));
+	zassert_equal(read(readContext, &visited->mValues[visited->mCount], sizeof(uint8_t)), sizeof(uint8_t));
+	strcpy(visited->mNames[visited->mCount], name);
+	visited->mCount++;
+
+	return true;
+}
+
+void Store(PersistentStorageNode &parent, const char *name, uint8_t value)
+{
+	PersistentStorageNode node(name, strlen(name), &parent);
+
+	zassert_equal(sStorage._SecureStore(&node, &value, sizeof(value)), PSErrorCode::Success);
+}
+
+void Remove(PersistentStorageNode &parent, const char *name)
+{
+	PersistentStorageNode node(name, strlen(name), &parent);
+
+	zassert_equal(sStorage._SecureRemove(&node), PSErrorCode::Success);
+}
+
+void Before(void *)
+{
+	sStorage._SecureFactoryReset();
+	protected_storage_mock_clear();
+}
+} /* namespace */
+
+ZTEST(persistent_storage_secure, test_load_subtree)
+{
+	VisitedEntries visited{};
+
+	Store(sBridge, "a", 1);
+	Store(sOther, "b", 2);
+	Store(sBridge, "c", 3);
+
+	zassert_equal(sStorage._SecureLoadSubtree(&sBridge, CollectEntry, &visited), PSErrorCode::Success);
+	zassert_equal(visited.mCount, 2);
+	zassert_true(visited.Contains("a", 1));
+	zassert_true(visited.Contains("c", 3));
+}
+
+ZTEST(persistent_storage_secure, test_load_subtree_after_remove)
+{
+	VisitedEntries visited{};
+
+	Store(sBridge, "a", 1);
+	Store(sBridge, "b", 2);
+	Store(sBridge, "c", 3);
+	Store(sBridge, "d", 4);
+
+	/* Removing the first keys leaves free slots before the remaining ones. */
+	Remove(sBridge, "a");
+	Remove(sBridge, "b");
+
+	zassert_equal(sStorage._SecureLoadSubtree(&sBridge, CollectEntry, &visited), PSErrorCode::Success);
+	zassert_equal(visited.mCount, 2);
+	zassert_true(visited.Contains("c", 3));
+	zassert_true(visited.Contains("d", 4));
+
+	/* The new key takes the first free slot, before the existing keys. */
+	visited = {};
+	Store(sBridge, "e", 5);
+
+	zassert_equal(sStorage._SecureLoadSubtree(&sBridge, CollectEntry, &visited), PSErrorCode::Success);
+	zassert_equal(visited.mCount, 3);
+	zassert_true(visited.Contains("c", 3));
+	zassert_true(visited.Contains("d", 4));
+	zassert_true(visited.Contains("e", 5));
+}
+
+ZTEST_SUITE(persistent_storage_secure, NULL, NULL, Before, NULL, NULL);
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <psa/protected_storage.h>
+
+#include <zephyr/sys/util.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define MAX_ASSETS 16
+#define MAX_ASSET_SIZE 256
+
+struct asset {
+	bool used;
+	psa_storage_uid_t uid;
+	size_t size;
+	uint8_t data[MAX_ASSET_SIZE];
+};
+
+static struct asset assets[MAX_ASSETS];
+
+static struct asset *find_asset(psa_storage_uid_t uid)
+{
+	for (size_t i = 0; i < MAX_ASSETS; i++) {
+		if (assets[i].used && assets[i].uid == uid) {
+			return &assets[i];
+		}
+	}
+
+	return NULL;
+}
+
+void protected_storage_mock_clear(void)
+{
+	memset(assets, 0, sizeof(assets));
+}
+
+psa_status_t psa_ps_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+			psa_storage_create_flags_t create_flags)
+{
+	struct asset *asset = find_asset(uid);
+
+	(void)create_flags;
+
+	if (data_length > MAX_ASSET_SIZE) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	for (size_t i = 0; !asset && i < MAX_ASSETS; i++) {
+		if (!assets[i].used) {
+			asset = &assets[i];
+		}
+	}
+
+	if (!asset) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	asset->used = true;
+	asset->uid = uid;
+	asset->size = data_length;
+	memcpy(asset->data, p_data, data_length);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+			size_t *p_data_length)
+{
+	struct asset *asset = find_asset(uid);
+
+	if (!asset || data_offset > asset->size) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	*p_data_length = MIN(data_size, asset->size - data_offset);
+	memcpy(p_data, asset->data + data_offset, *p_data_length);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_get_info(psa_storage_uid_t uid, psa_storage_info_t *p_info)
+{
+	struct asset *asset = find_asset(uid);
+
+	if (!asset) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	p_info->capacity = asset->size;
+	p_info->size = asset->size;
+	p_info->flags = PSA_STORAGE_FLAG_NONE;
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_remove(psa_storage_uid_t uid)
+{
+	struct asset *asset = find_asset(uid);
+
+	if (!asset) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	asset->used = false;
+
+	return PSA_SUCCESS;
+}
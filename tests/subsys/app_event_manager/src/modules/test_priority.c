@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "priority_events.h"
+
+#include "test_config.h"
+
+#define MODULE test_priority
+
+static int received_cnt;
+
+
+static void check_order(int pos, bool high_priority, int val)
+{
+	/* The high priority event is submitted while the first normal priority event is
+	 * processed. With priority lanes, it is processed before the remaining normal
+	 * priority events, even though they were submitted earlier.
+	 */
+	int high_priority_pos = IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES) ?
+				1 : TEST_EVENT_ORDER_CNT;
+
+	if (high_priority) {
+		zassert_equal(pos, high_priority_pos, "Wrong high priority event position");
+	} else {
+		zassert_equal(pos, (pos < high_priority_pos) ? val : val + 1,
+			      "Wrong normal priority event position");
+	}
+}
+
+static void end_test(void)
+{
+	struct test_end_event *te = new_test_end_event();
+
+	te->test_id = TEST_PRIORITY;
+	APP_EVENT_SUBMIT(te);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_PRIORITY) {
+			received_cnt = 0;
+
+			for (size_t i = 0; i < TEST_EVENT_ORDER_CNT; i++) {
+				struct normal_priority_event *event = new_normal_priority_event();
+
+				event->val = i;
+				APP_EVENT_SUBMIT(event);
+			}
+		}
+
+		return false;
+	}
+
+	if (is_normal_priority_event(aeh)) {
+		struct normal_priority_event *event = cast_normal_priority_event(aeh);
+
+		check_order(received_cnt, false, event->val);
+
+		if (event->val == 0) {
+			struct high_priority_event *hp_event = new_high_priority_event();
+
+			hp_event->val = 0;
+			APP_EVENT_SUBMIT(hp_event);
+		}
+
+		received_cnt++;
+		if (received_cnt == TEST_EVENT_ORDER_CNT + 1) {
+			end_test();
+		}
+
+		return false;
+	}
+
+	if (is_high_priority_event(aeh)) {
+		check_order(received_cnt, true, 0);
+
+		received_cnt++;
+		if (received_cnt == TEST_EVENT_ORDER_CNT + 1) {
+			end_test();
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, normal_priority_event);
+APP_EVENT_SUBSCRIBE(MODULE, high_priority_event);
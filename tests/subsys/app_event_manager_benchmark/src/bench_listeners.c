@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "bench_events.h"
+#include "bench_listeners.h"
+#include "host_clock.h"
+
+static K_SEM_DEFINE(fanout_done_sem, 0, 1);
+static uint32_t fanout_expected_cnt;
+static uint32_t fanout_received_cnt;
+static uint64_t fanout_latency_ns;
+
+
+void bench_fanout_expect(uint32_t listener_cnt)
+{
+	fanout_expected_cnt = listener_cnt;
+	fanout_received_cnt = 0;
+	k_sem_reset(&fanout_done_sem);
+}
+
+int bench_fanout_wait(k_timeout_t timeout, uint64_t *latency_ns)
+{
+	int err = k_sem_take(&fanout_done_sem, timeout);
+
+	*latency_ns = fanout_latency_ns;
+
+	return err;
+}
+
+static uint64_t fanout_submit_ns(const struct app_event_header *aeh)
+{
+	if (is_fanout_1_event(aeh)) {
+		return cast_fanout_1_event(aeh)->submit_ns;
+	} else if (is_fanout_4_event(aeh)) {
+		return cast_fanout_4_event(aeh)->submit_ns;
+	} else if (is_fanout_16_event(aeh)) {
+		return cast_fanout_16_event(aeh)->submit_ns;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return 0;
+}
+
+static bool fanout_handler(const struct app_event_header *aeh)
+{
+	/* Every listener reads the event, like a module checking a field of a common event. */
+	uint64_t submit_ns = fanout_submit_ns(aeh);
+
+	fanout_received_cnt++;
+	if (fanout_received_cnt == fanout_expected_cnt) {
+		fanout_latency_ns = host_clock_time_ns() - submit_ns;
+		k_sem_give(&fanout_done_sem);
+	}
+
+	return false;
+}
+
+/* The listeners are registered as separate modules, so the Application Event Manager calls each
+ * of them separately.
+ */
+#define FANOUT_LISTENER_DEFINE(idx, _)						\
+	APP_EVENT_LISTENER(fanout_listener_##idx, fanout_handler);		\
+	APP_EVENT_SUBSCRIBE(fanout_listener_##idx, fanout_16_event);
+
+LISTIFY(BENCH_FANOUT_LISTENER_CNT, FANOUT_LISTENER_DEFINE, ())
+
+APP_EVENT_SUBSCRIBE(fanout_listener_0, fanout_4_event);
+APP_EVENT_SUBSCRIBE(fanout_listener_1, fanout_4_event);
+APP_EVENT_SUBSCRIBE(fanout_listener_2, fanout_4_event);
+APP_EVENT_SUBSCRIBE(fanout_listener_3, fanout_4_event);
+
+APP_EVENT_SUBSCRIBE(fanout_listener_0, fanout_1_event);
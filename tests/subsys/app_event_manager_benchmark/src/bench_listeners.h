@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_LISTENERS_H_
+#define _BENCH_LISTENERS_H_
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of listeners subscribed to the fanout_16_event. */
+#define BENCH_FANOUT_LISTENER_CNT	16
+
+/* Prepare for a fan-out event that is delivered to listener_cnt listeners. */
+void bench_fanout_expect(uint32_t listener_cnt);
+
+/* Wait until the last listener receives the event and return the time that elapsed between
+ * the event submission and the last listener call.
+ */
+int bench_fanout_wait(k_timeout_t timeout, uint64_t *latency_ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BENCH_LISTENERS_H_ */
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#include "bench_events.h"
+#include "bench_listeners.h"
+#include "host_clock.h"
+
+#define MODULE bench_main
+
+#define BENCH_OP_CNT		10000
+#define BENCH_BATCH_SIZE	32
+#define BENCH_TIMEOUT		K_SECONDS(10)
+
+BUILD_ASSERT((BENCH_OP_CNT % BENCH_BATCH_SIZE) == 0);
+BUILD_ASSERT(!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS) ||
+	     (CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT >= BENCH_BATCH_SIZE));
+
+static K_SEM_DEFINE(bench_done_sem, 0, 1);
+static uint32_t bench_expected_cnt;
+static uint32_t bench_received_cnt;
+static uint64_t bench_latency_ns;
+
+/* Every sample is stored, so that the percentiles are exact. */
+static uint32_t samples[BENCH_OP_CNT];
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)
+static uint32_t submit_hook_cnt;
+
+static void bench_submit_hook(const struct app_event_header *aeh)
+{
+	ARG_UNUSED(aeh);
+	submit_hook_cnt++;
+}
+
+APP_EVENT_HOOK_ON_SUBMIT_REGISTER(bench_submit_hook);
+#endif /* CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)
+static uint32_t preprocess_hook_cnt;
+
+static void bench_preprocess_hook(const struct app_event_header *aeh)
+{
+	ARG_UNUSED(aeh);
+	preprocess_hook_cnt++;
+}
+
+APP_EVENT_HOOK_PREPROCESS_REGISTER(bench_preprocess_hook);
+#endif /* CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)
+static uint32_t postprocess_hook_cnt;
+
+static void bench_postprocess_hook(const struct app_event_header *aeh)
+{
+	ARG_UNUSED(aeh);
+	postprocess_hook_cnt++;
+}
+
+APP_EVENT_HOOK_POSTPROCESS_REGISTER(bench_postprocess_hook);
+#endif /* CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS */
+
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_event(aeh)) {
+		const struct bench_event *event = cast_bench_event(aeh);
+
+		bench_received_cnt++;
+		if (bench_received_cnt == bench_expected_cnt) {
+			bench_latency_ns = host_clock_time_ns() - event->submit_ns;
+			k_sem_give(&bench_done_sem);
+		}
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, bench_event);
+
+
+static int sample_cmp(const void *a, const void *b)
+{
+	uint32_t sa = *(const uint32_t *)a;
+	uint32_t sb = *(const uint32_t *)b;
+
+	return (sa > sb) - (sa < sb);
+}
+
+static uint32_t sample_percentile(uint32_t cnt, uint32_t pct)
+{
+	/* Nearest-rank percentile of the sorted samples. */
+	return samples[DIV_ROUND_UP(cnt * pct, 100) - 1];
+}
+
+/* Print the result in the format parsed by the Twister record harness. The samples include the
+ * cost of reading the host clock.
+ */
+static void bench_report(const char *name, uint32_t cnt, uint64_t total_ns)
+{
+	qsort(samples, cnt, sizeof(samples[0]), sample_cmp);
+
+	TC_PRINT("BENCH %s ops=%u ns_per_op=%u p50_ns=%u p99_ns=%u\n",
+		 name, cnt, (uint32_t)(total_ns / cnt),
+		 sample_percentile(cnt, 50), sample_percentile(cnt, 99));
+}
+
+static void bench_wait(uint32_t expected_cnt)
+{
+	zassert_ok(k_sem_take(&bench_done_sem, BENCH_TIMEOUT), "Events were not processed");
+	zassert_equal(bench_received_cnt, expected_cnt, "Wrong number of events processed");
+}
+
+static void bench_dispatch(const char *name)
+{
+	uint64_t start = host_clock_time_ns();
+
+	/* Submit one event at a time and measure the time until the listener is called. This
+	 * includes the work item scheduling and the context switch to the workqueue thread.
+	 */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		struct bench_event *event = new_bench_event();
+
+		bench_expected_cnt = i + 1;
+		event->submit_ns = host_clock_time_ns();
+		APP_EVENT_SUBMIT(event);
+
+		bench_wait(i + 1);
+		samples[i] = bench_latency_ns;
+	}
+
+	bench_report(name, BENCH_OP_CNT, host_clock_time_ns() - start);
+}
+
+static void *test_init(void)
+{
+	zassert_false(app_event_manager_init(), "Error when initializing");
+
+	TC_PRINT("Hooks: %s, event slabs: %s, priority lanes: %s\n",
+		 (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS) ||
+		  IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS) ||
+		  IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) ? "yes" : "no",
+		 IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS) ? "yes" : "no",
+		 IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PRIORITY_LANES) ? "yes" : "no");
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bench_received_cnt = 0;
+	bench_expected_cnt = 0;
+	k_sem_reset(&bench_done_sem);
+}
+
+ZTEST(app_event_manager_benchmark, test_alloc)
+{
+	static const uint8_t dyndata_sizes[] = {16, 64};
+	uint64_t start = host_clock_time_ns();
+
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		uint64_t op_start = host_clock_time_ns();
+		struct bench_event *event = new_bench_event();
+
+		app_event_manager_free(event);
+		samples[i] = host_clock_time_ns() - op_start;
+	}
+
+	bench_report("alloc_free", BENCH_OP_CNT, host_clock_time_ns() - start);
+
+	for (size_t s = 0; s < ARRAY_SIZE(dyndata_sizes); s++) {
+		char name[sizeof("alloc_free_dyndata_XXX")];
+
+		start = host_clock_time_ns();
+
+		for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+			uint64_t op_start = host_clock_time_ns();
+			struct bench_data_event *event = new_bench_data_event(dyndata_sizes[s]);
+
+			app_event_manager_free(event);
+			samples[i] = host_clock_time_ns() - op_start;
+		}
+
+		snprintk(name, sizeof(name), "alloc_free_dyndata_%u", dyndata_sizes[s]);
+		bench_report(name, BENCH_OP_CNT, host_clock_time_ns() - start);
+	}
+}
+
+ZTEST(app_event_manager_benchmark, test_submit)
+{
+	struct bench_event *events[BENCH_BATCH_SIZE];
+	uint64_t total_ns = 0;
+
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i += BENCH_BATCH_SIZE) {
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			events[j] = new_bench_event();
+			events[j]->submit_ns = 0;
+		}
+
+		bench_expected_cnt = i + BENCH_BATCH_SIZE;
+
+		/* Keep the workqueue from running, so that only the submission is measured. */
+		k_sched_lock();
+
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			uint64_t op_start = host_clock_time_ns();
+
+			APP_EVENT_SUBMIT(events[j]);
+			samples[i + j] = host_clock_time_ns() - op_start;
+			total_ns += samples[i + j];
+		}
+
+		k_sched_unlock();
+
+		bench_wait(bench_expected_cnt);
+	}
+
+	bench_report("submit", BENCH_OP_CNT, total_ns);
+}
+
+ZTEST(app_event_manager_benchmark, test_dispatch_latency)
+{
+	bench_dispatch("dispatch");
+}
+
+ZTEST(app_event_manager_benchmark, test_throughput)
+{
+	uint64_t start = host_clock_time_ns();
+
+	/* Submit bursts of events, like a HID peripheral forwarding reports, and measure the
+	 * average cost of allocating, submitting and processing an event.
+	 */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i += BENCH_BATCH_SIZE) {
+		uint64_t burst_start = host_clock_time_ns();
+
+		bench_expected_cnt = i + BENCH_BATCH_SIZE;
+
+		for (size_t j = 0; j < BENCH_BATCH_SIZE; j++) {
+			struct bench_event *event = new_bench_event();
+
+			event->submit_ns = burst_start;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		bench_wait(bench_expected_cnt);
+
+		uint32_t event_ns = (host_clock_time_ns() - burst_start) /
+				    BENCH_BATCH_SIZE;
+
+		for (size_t j = 0; j < BENCH_BATCH_SIZE; j++) {
+			samples[i + j] = event_ns;
+		}
+	}
+
+	bench_report("throughput", BENCH_OP_CNT, host_clock_time_ns() - start);
+}
+
+static void bench_fanout(const char *name, uint32_t listener_cnt)
+{
+	uint64_t start = host_clock_time_ns();
+
+	/* Measure the time from the submission until the last listener is called. */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		uint64_t latency_ns;
+
+		bench_fanout_expect(listener_cnt);
+
+		if (listener_cnt == 1) {
+			struct fanout_1_event *event = new_fanout_1_event();
+
+			event->submit_ns = host_clock_time_ns();
+			APP_EVENT_SUBMIT(event);
+		} else if (listener_cnt == 4) {
+			struct fanout_4_event *event = new_fanout_4_event();
+
+			event->submit_ns = host_clock_time_ns();
+			APP_EVENT_SUBMIT(event);
+		} else {
+			struct fanout_16_event *event = new_fanout_16_event();
+
+			event->submit_ns = host_clock_time_ns();
+			APP_EVENT_SUBMIT(event);
+		}
+
+		zassert_ok(bench_fanout_wait(BENCH_TIMEOUT, &latency_ns),
+			   "Event was not delivered to all listeners");
+		samples[i] = latency_ns;
+	}
+
+	bench_report(name, BENCH_OP_CNT, host_clock_time_ns() - start);
+}
+
+ZTEST(app_event_manager_benchmark, test_fanout)
+{
+	bench_fanout("fanout_1", 1);
+	bench_fanout("fanout_4", 4);
+	bench_fanout("fanout_16", BENCH_FANOUT_LISTENER_CNT);
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS) &&	\
+	IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS) &&	\
+	IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)
+ZTEST(app_event_manager_benchmark, test_hooks)
+{
+	submit_hook_cnt = 0;
+	preprocess_hook_cnt = 0;
+	postprocess_hook_cnt = 0;
+
+	/* Compare with the dispatch result of the configuration without hooks. */
+	bench_dispatch("dispatch_hooks");
+
+	/* The postprocess hook of the last event runs after its listener wakes up the test. */
+	k_sleep(K_MSEC(1));
+
+	zassert_equal(submit_hook_cnt, BENCH_OP_CNT, "Submit hook not called for every event");
+	zassert_equal(preprocess_hook_cnt, BENCH_OP_CNT,
+		      "Preprocess hook not called for every event");
+	zassert_equal(postprocess_hook_cnt, BENCH_OP_CNT,
+		      "Postprocess hook not called for every event");
+}
+#endif
+
+ZTEST_SUITE(app_event_manager_benchmark, NULL, test_init, test_before, NULL, NULL);
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#include "bench_events.h"
+#include "host_clock.h"
+
+#define MODULE test_slabs
+
+#define BENCH_EVENT_CNT		(12500 * SLAB_BLOCK_CNT)
+#define BENCH_REPORT_SIZE	16
+
+/* Bucket i counts allocations that took less than (LATENCY_MIN_NS << i) nanoseconds,
+ * the last bucket counts all the slower ones.
+ */
+#define LATENCY_MIN_NS		64U
+#define LATENCY_BUCKET_CNT	10
+
+#define SLAB_BLOCK_CNT COND_CODE_1(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS,		\
+				  (CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_BLOCK_CNT), (16))
+
+/* Slab size of the event type that does not use the Kconfig defaults. */
+#define REPORT_SLAB_BLOCK_CNT		2
+#define REPORT_SLAB_DYNDATA_SIZE	64
+
+BUILD_ASSERT(REPORT_SLAB_DYNDATA_SIZE > CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE);
+
+/* Event with dynamic data that sets its own slab size, like the HID report event. */
+struct report_event {
+	struct app_event_header header;
+
+	struct event_dyndata dyndata;
+};
+
+APP_EVENT_TYPE_DYNDATA_DECLARE(report_event);
+APP_EVENT_TYPE_SLAB_DEFINE(report_event,
+			   NULL,
+			   NULL,
+			   APP_EVENT_FLAGS_CREATE(),
+			   REPORT_SLAB_BLOCK_CNT,
+			   REPORT_SLAB_DYNDATA_SIZE);
+
+static K_SEM_DEFINE(bench_done_sem, 0, 1);
+static uint32_t bench_expected_cnt;
+static uint32_t bench_received_cnt;
+static uint32_t latency_hist[LATENCY_BUCKET_CNT];
+
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_event(aeh) || is_bench_data_event(aeh)) {
+		bench_received_cnt++;
+		if (bench_received_cnt == bench_expected_cnt) {
+			k_sem_give(&bench_done_sem);
+		}
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, bench_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_data_event);
+
+
+static void latency_record(uint64_t ns)
+{
+	size_t bucket = 0;
+
+	while ((bucket < LATENCY_BUCKET_CNT - 1) && (ns >= ((uint64_t)LATENCY_MIN_NS << bucket))) {
+		bucket++;
+	}
+
+	latency_hist[bucket]++;
+}
+
+static void latency_print(void)
+{
+	for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+		if (i < LATENCY_BUCKET_CNT - 1) {
+			TC_PRINT("  < %6u ns: %u\n", LATENCY_MIN_NS << i, latency_hist[i]);
+		} else {
+			TC_PRINT(" >= %6u ns: %u\n", LATENCY_MIN_NS << (i - 1), latency_hist[i]);
+		}
+	}
+}
+
+static void *test_init(void)
+{
+	zassert_false(app_event_manager_init(), "Error when initializing");
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bench_received_cnt = 0;
+	bench_expected_cnt = 0;
+	k_sem_reset(&bench_done_sem);
+	memset(latency_hist, 0, sizeof(latency_hist));
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS)
+ZTEST(app_event_manager_slabs, test_slab_alloc)
+{
+	struct bench_event *events[SLAB_BLOCK_CNT + 1];
+	struct app_event_manager_slab_stats stats;
+	const struct event_type *et = _EVENT_ID(bench_event);
+	uint32_t fallback_cnt;
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_true(stats.block_size >= sizeof(struct bench_event));
+	zassert_equal(stats.num_blocks, SLAB_BLOCK_CNT);
+	zassert_equal(stats.num_used, 0);
+	fallback_cnt = stats.fallback_cnt;
+
+	for (size_t i = 0; i < SLAB_BLOCK_CNT; i++) {
+		events[i] = new_bench_event();
+		zassert_not_null(events[i]);
+		zassert_true(is_bench_event(&events[i]->header));
+	}
+
+	/* The slab is exhausted, so the next event comes from the heap. */
+	events[SLAB_BLOCK_CNT] = new_bench_event();
+	zassert_not_null(events[SLAB_BLOCK_CNT]);
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_equal(stats.num_used, SLAB_BLOCK_CNT);
+	zassert_equal(stats.max_used, SLAB_BLOCK_CNT);
+	zassert_equal(stats.fallback_cnt, fallback_cnt + 1);
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		app_event_manager_free(events[i]);
+	}
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_equal(stats.num_used, 0);
+	zassert_equal(stats.max_used, SLAB_BLOCK_CNT);
+}
+
+ZTEST(app_event_manager_slabs, test_slab_dyndata)
+{
+	struct app_event_manager_slab_stats stats;
+	const struct event_type *et = _EVENT_ID(bench_data_event);
+	struct bench_data_event *small;
+	struct bench_data_event *large;
+	uint32_t fallback_cnt;
+
+	app_event_manager_slab_stats_get(et, &stats);
+	fallback_cnt = stats.fallback_cnt;
+
+	small = new_bench_data_event(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE);
+	large = new_bench_data_event(CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE + 1);
+	zassert_not_null(small);
+	zassert_not_null(large);
+	zassert_equal(large->dyndata.size, CONFIG_APP_EVENT_MANAGER_EVENT_SLAB_DYNDATA_SIZE + 1);
+
+	/* Only the event with dynamic data that fits the block is allocated from the slab. */
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_equal(stats.num_used, 1);
+	zassert_equal(stats.fallback_cnt, fallback_cnt + 1);
+
+	zassert_true(app_event_manager_slab_free(small));
+	zassert_false(app_event_manager_slab_free(large));
+	app_event_manager_free(large);
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_equal(stats.num_used, 0);
+}
+
+ZTEST(app_event_manager_slabs, test_slab_type_size)
+{
+	struct report_event *events[REPORT_SLAB_BLOCK_CNT];
+	struct app_event_manager_slab_stats stats;
+	const struct event_type *et = _EVENT_ID(report_event);
+	struct report_event *large;
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_true(stats.block_size >= sizeof(struct report_event) + REPORT_SLAB_DYNDATA_SIZE);
+	zassert_equal(stats.num_blocks, REPORT_SLAB_BLOCK_CNT);
+
+	/* The event type uses its own slab size instead of the Kconfig defaults. */
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		events[i] = new_report_event(REPORT_SLAB_DYNDATA_SIZE);
+		zassert_not_null(events[i]);
+	}
+
+	large = new_report_event(REPORT_SLAB_DYNDATA_SIZE + 1);
+	zassert_not_null(large);
+
+	app_event_manager_slab_stats_get(et, &stats);
+	zassert_equal(stats.num_used, REPORT_SLAB_BLOCK_CNT);
+	zassert_equal(stats.fallback_cnt, 1);
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		zassert_true(app_event_manager_slab_free(events[i]));
+	}
+
+	zassert_false(app_event_manager_slab_free(large));
+	app_event_manager_free(large);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_SLABS */
+
+ZTEST(app_event_manager_slabs, test_benchmark)
+{
+	uint64_t alloc_ns = 0;
+	uint64_t start;
+
+	start = host_clock_time_ns();
+
+	for (uint32_t i = 0; i < BENCH_EVENT_CNT; i++) {
+		uint64_t alloc_start = host_clock_time_ns();
+		uint64_t alloc_end;
+
+		/* Let the events be processed in batches, so that the slabs are not exhausted. */
+		if ((i % SLAB_BLOCK_CNT) == 0) {
+			bench_expected_cnt = i + SLAB_BLOCK_CNT;
+		}
+
+		/* Every fourth event is a report, like in a HID device sending mouse motion. */
+		if ((i % 4) == 3) {
+			struct bench_data_event *event = new_bench_data_event(BENCH_REPORT_SIZE);
+
+			alloc_end = host_clock_time_ns();
+			zassert_not_null(event);
+			memset(event->dyndata.data, i, BENCH_REPORT_SIZE);
+			APP_EVENT_SUBMIT(event);
+		} else {
+			struct bench_event *event = new_bench_event();
+
+			alloc_end = host_clock_time_ns();
+			zassert_not_null(event);
+			event->seq = i;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		alloc_ns += alloc_end - alloc_start;
+		latency_record(alloc_end - alloc_start);
+
+		if ((i + 1) == bench_expected_cnt) {
+			zassert_ok(k_sem_take(&bench_done_sem, K_SECONDS(30)),
+				   "Events were not processed");
+		}
+	}
+
+	uint64_t total_ns = host_clock_time_ns() - start;
+
+	TC_PRINT("Allocator: %s\n", IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_SLABS) ?
+		 "event slabs" : "system heap");
+	TC_PRINT("Submitted and processed %u events in %u us: %u events/s\n",
+		 BENCH_EVENT_CNT, (uint32_t)(total_ns / NSEC_PER_USEC),
+		 (uint32_t)((uint64_t)BENCH_EVENT_CNT * NSEC_PER_SEC / MAX(total_ns, 1)));
+	TC_PRINT("Average allocation time: %u ns\n", (uint32_t)(alloc_ns / BENCH_EVENT_CNT));
+	TC_PRINT("Allocation time histogram (including the clock read):\n");
+	latency_print();
+}
+
+ZTEST_SUITE(app_event_manager_slabs, NULL, test_init, test_before, NULL, NULL);
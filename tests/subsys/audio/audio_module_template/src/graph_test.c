@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+
+#include "audio_module.h"
+#include "audio_module/audio_module_graph.h"
+#include "audio_module_template.h"
+
+#define TEST_GRAPH_RX_TIMEOUT	     (K_NO_WAIT)
+#define TEST_GRAPH_MSG_QUEUE_SIZE    (4)
+#define TEST_GRAPH_THREAD_STACK_SIZE (1024)
+#define TEST_GRAPH_THREAD_PRIORITY   (4)
+#define TEST_GRAPH_MODULES_NUM	     (4)
+#define TEST_GRAPH_DATA_SIZE	     (40)
+#define TEST_GRAPH_MSG_SIZE	     (sizeof(struct audio_module_message))
+#define TEST_GRAPH_ITEMS_NUM	     (20)
+
+/* A chain needs two buffers and fan-out one more per extra output, plus one for each tap. */
+#define TEST_GRAPH_BUFFERS_NUM (TEST_GRAPH_MODULES_NUM + 2)
+
+BUILD_ASSERT(TEST_GRAPH_MODULES_NUM <= CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX);
+
+K_THREAD_STACK_ARRAY_DEFINE(graph_stack, TEST_GRAPH_MODULES_NUM, TEST_GRAPH_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_tx0, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_rx0, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_tx1, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_rx1, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_tx2, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_rx2, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_tx3, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+DATA_FIFO_DEFINE(graph_fifo_rx3, TEST_GRAPH_MSG_QUEUE_SIZE, TEST_GRAPH_MSG_SIZE);
+K_MEM_SLAB_DEFINE(graph_data_slab, TEST_GRAPH_DATA_SIZE, TEST_GRAPH_MSG_QUEUE_SIZE, 4);
+AUDIO_MODULE_BUFFER_POOL_DEFINE(graph_pool, TEST_GRAPH_BUFFERS_NUM, TEST_GRAPH_DATA_SIZE);
+
+static struct data_fifo *graph_fifo_tx_array[TEST_GRAPH_MODULES_NUM] = {
+	&graph_fifo_tx0, &graph_fifo_tx1, &graph_fifo_tx2, &graph_fifo_tx3};
+static struct data_fifo *graph_fifo_rx_array[TEST_GRAPH_MODULES_NUM] = {
+	&graph_fifo_rx0, &graph_fifo_rx1, &graph_fifo_rx2, &graph_fifo_rx3};
+
+static struct audio_module_handle handle[TEST_GRAPH_MODULES_NUM];
+static struct audio_module_template_context context[TEST_GRAPH_MODULES_NUM];
+static struct audio_module_graph graph;
+
+static uint8_t test_data_in[TEST_GRAPH_DATA_SIZE];
+static uint8_t test_data_out[TEST_GRAPH_DATA_SIZE];
+
+static struct audio_metadata test_graph_metadata = {.data_coding = PCM,
+						    .data_len_us = 10000,
+						    .sample_rate_hz = 48000,
+						    .bits_per_sample = 16,
+						    .carried_bits_per_sample = 16,
+						    .locations = 0x00000003,
+						    .ref_ts_us = 0,
+						    .data_rx_ts_us = 0,
+						    .bad_data = false};
+
+static void graph_modules_open(void)
+{
+	int ret;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Graph"};
+
+	memset(handle, 0, sizeof(handle));
+	memset(context, 0, sizeof(context));
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		mod_parameters.description = audio_module_template_description;
+		mod_parameters.thread.stack = graph_stack[i];
+		mod_parameters.thread.stack_size = TEST_GRAPH_THREAD_STACK_SIZE;
+		mod_parameters.thread.priority = TEST_GRAPH_THREAD_PRIORITY;
+		mod_parameters.thread.data_slab = &graph_data_slab;
+		mod_parameters.thread.data_size = TEST_GRAPH_DATA_SIZE;
+		mod_parameters.thread.msg_rx = graph_fifo_rx_array[i];
+		mod_parameters.thread.msg_tx = graph_fifo_tx_array[i];
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(const struct audio_module_configuration *const)&configuration, "Graph",
+			(struct audio_module_context *)&context[i], &handle[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+	}
+
+	ret = audio_module_buffer_pool_init(&graph_pool);
+	zassert_equal(ret, 0, "Pool init did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_init(&graph, &graph_pool);
+	zassert_equal(ret, 0, "Graph init did not return successfully (0): ret %d", ret);
+}
+
+static void graph_modules_add_and_start(void)
+{
+	int ret;
+
+	/* Add the modules in reverse, so that the run order must come from the connections. */
+	for (int i = TEST_GRAPH_MODULES_NUM - 1; i >= 0; i--) {
+		ret = audio_module_graph_add(&graph, &handle[i]);
+		zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+	}
+
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, 0, "Graph build did not return successfully (0): ret %d", ret);
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_start(&handle[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+static void graph_modules_close(void)
+{
+	int ret;
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		if (handle[i].state == AUDIO_MODULE_STATE_RUNNING) {
+			ret = audio_module_stop(&handle[i]);
+			zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d",
+				      ret);
+		}
+
+		ret = audio_module_graph_remove(&graph, &handle[i]);
+		zassert_equal(ret, 0, "Graph remove did not return successfully (0): ret %d", ret);
+
+		ret = audio_module_close(&handle[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+static void graph_frame_process(int frame)
+{
+	int ret;
+	struct audio_data audio_data_in;
+
+	memset(test_data_in, frame, sizeof(test_data_in));
+	audio_data_in.data = test_data_in;
+	audio_data_in.data_size = TEST_GRAPH_DATA_SIZE;
+	memcpy(&audio_data_in.meta, &test_graph_metadata, sizeof(struct audio_metadata));
+
+	ret = audio_module_graph_process(&graph, &audio_data_in);
+	zassert_equal(ret, 0, "Graph process did not return successfully (0): ret %d", ret);
+}
+
+static void graph_output_check(struct audio_module_handle *handle_rx)
+{
+	int ret;
+	struct audio_data audio_data_out;
+
+	memset(test_data_out, 0xFF, sizeof(test_data_out));
+	audio_data_out.data = test_data_out;
+	audio_data_out.data_size = TEST_GRAPH_DATA_SIZE;
+
+	ret = audio_module_data_rx(handle_rx, &audio_data_out, TEST_GRAPH_RX_TIMEOUT);
+	zassert_equal(ret, 0, "Data RX function did not return successfully (0): ret %d", ret);
+	zassert_equal(audio_data_out.data_size, TEST_GRAPH_DATA_SIZE,
+		      "Failed to process data, sizes differ");
+	zassert_mem_equal(test_data_in, test_data_out, TEST_GRAPH_DATA_SIZE,
+			  "Failed to process data");
+	zassert_mem_equal(&test_graph_metadata, &audio_data_out.meta,
+			  sizeof(struct audio_metadata),
+			  "Failed to process data, meta data differs");
+}
+
+static void graph_pool_free_check(void)
+{
+	zassert_equal(k_mem_slab_num_free_get(&graph_pool.slab), TEST_GRAPH_BUFFERS_NUM,
+		      "Not all buffers were returned to the pool");
+}
+
+ZTEST(suite_audio_module_template, test_graph_chain)
+{
+	int ret;
+	struct audio_module_graph_stats stats;
+
+	graph_modules_open();
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM - 1; i++) {
+		ret = audio_module_connect(&handle[i], &handle[i + 1], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	ret = audio_module_connect(&handle[TEST_GRAPH_MODULES_NUM - 1], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	graph_modules_add_and_start();
+
+	zassert_equal(graph.order[0], TEST_GRAPH_MODULES_NUM - 1,
+		      "First module of the chain does not run first");
+
+	for (int i = 0; i < TEST_GRAPH_ITEMS_NUM; i++) {
+		graph_frame_process(i);
+		graph_output_check(&handle[TEST_GRAPH_MODULES_NUM - 1]);
+		graph_pool_free_check();
+	}
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_graph_stats_get(&graph, &handle[i], &stats);
+		zassert_equal(ret, 0, "Stats get did not return successfully (0): ret %d", ret);
+		zassert_equal(stats.frames, TEST_GRAPH_ITEMS_NUM,
+			      "Module %d processed %d frames, not %d", i, stats.frames,
+			      TEST_GRAPH_ITEMS_NUM);
+		zassert_true(stats.max_ns >= stats.last_ns, "Max time is less than the last");
+	}
+
+	audio_module_graph_stats_reset(&graph);
+
+	ret = audio_module_graph_stats_get(&graph, &handle[0], &stats);
+	zassert_equal(ret, 0, "Stats get did not return successfully (0): ret %d", ret);
+	zassert_equal(stats.frames, 0, "Stats were not reset");
+
+	graph_modules_close();
+}
+
+ZTEST(suite_audio_module_template, test_graph_fan_out)
+{
+	int ret;
+
+	graph_modules_open();
+
+	/* Module 0 sends to modules 1 and 2, and module 1 sends to module 3 */
+	ret = audio_module_connect(&handle[0], &handle[1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[0], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[1], &handle[3], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[2], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[3], NULL, true);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	graph_modules_add_and_start();
+
+	for (int i = 0; i < TEST_GRAPH_ITEMS_NUM; i++) {
+		graph_frame_process(i);
+		graph_output_check(&handle[2]);
+		graph_output_check(&handle[3]);
+		graph_pool_free_check();
+	}
+
+	graph_modules_close();
+}
+
+ZTEST(suite_audio_module_template, test_graph_stopped_module)
+{
+	int ret;
+	struct audio_module_graph_stats stats;
+
+	graph_modules_open();
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM - 1; i++) {
+		ret = audio_module_connect(&handle[i], &handle[i + 1], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	graph_modules_add_and_start();
+
+	ret = audio_module_stop(&handle[1]);
+	zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+
+	graph_frame_process(0);
+	graph_pool_free_check();
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_graph_stats_get(&graph, &handle[i], &stats);
+		zassert_equal(ret, 0, "Stats get did not return successfully (0): ret %d", ret);
+		zassert_equal(stats.frames, (i == 0) ? 1 : 0,
+			      "Module %d processed %d frames after module 1 stopped", i,
+			      stats.frames);
+	}
+
+	graph_modules_close();
+}
+
+ZTEST(suite_audio_module_template, test_graph_invalid)
+{
+	int ret;
+
+	graph_modules_open();
+
+	ret = audio_module_graph_add(&graph, &handle[0]);
+	zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_add(&graph, &handle[0]);
+	zassert_equal(ret, -EALREADY, "Graph add of the same module did not fail: ret %d", ret);
+
+	ret = audio_module_graph_process(&graph, NULL);
+	zassert_equal(ret, -ECANCELED, "Graph process before build did not fail: ret %d", ret);
+
+	/* Modules 0 and 1 both send to module 2 */
+	ret = audio_module_connect(&handle[0], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_connect(&handle[1], &handle[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d", ret);
+
+	for (int i = 1; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_graph_add(&graph, &handle[i]);
+		zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+	}
+
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, -ENOTSUP, "Graph build with fan-in did not fail: ret %d", ret);
+
+	ret = audio_module_graph_remove(&graph, &handle[1]);
+	zassert_equal(ret, 0, "Graph remove did not return successfully (0): ret %d", ret);
+
+	/* A connection from a module outside the graph is ignored */
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, 0, "Graph build did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_start(&handle[1]);
+	zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_add(&graph, &handle[1]);
+	zassert_equal(ret, -ECANCELED, "Graph add of a running module did not fail: ret %d", ret);
+
+	ret = audio_module_stop(&handle[1]);
+	zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+
+	ret = audio_module_graph_add(&graph, &handle[1]);
+	zassert_equal(ret, 0, "Graph add did not return successfully (0): ret %d", ret);
+
+	graph_modules_close();
+}
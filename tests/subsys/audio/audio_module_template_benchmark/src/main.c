@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "audio_module.h"
+#include "audio_module/audio_module_graph.h"
+#include "audio_module_template.h"
+#include "host_clock.h"
+
+#define BENCH_OP_CNT		 2000
+#define BENCH_MODULES_NUM	 4
+#define BENCH_TIMEOUT		 K_SECONDS(10)
+#define BENCH_STACK_SIZE	 2048
+#define BENCH_TEST_PRIO		 K_PRIO_PREEMPT(5)
+#define BENCH_MODULE_PRIO	 K_PRIO_PREEMPT(4)
+#define BENCH_MSG_QUEUE_SIZE	 4
+#define BENCH_MSG_SIZE		 (sizeof(struct audio_module_message))
+
+/* 960 bytes is one 10 ms block of 48 kHz 16-bit stereo audio. */
+#define BENCH_DATA_SIZE		 960
+
+/* Every module holds at most one output block while the next one processes it. */
+#define BENCH_DATA_BLOCKS_NUM	 (2 * BENCH_MODULES_NUM)
+
+BUILD_ASSERT(BENCH_MODULES_NUM <= CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX);
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_stack, BENCH_MODULES_NUM, BENCH_STACK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_tx0, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx0, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_tx1, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx1, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_tx2, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx2, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_tx3, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx3, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+K_MEM_SLAB_DEFINE(bench_data_slab, BENCH_DATA_SIZE, BENCH_DATA_BLOCKS_NUM, 4);
+
+/* A chain only needs two buffers, and one more for the output read by the test. */
+AUDIO_MODULE_BUFFER_POOL_DEFINE(bench_pool, 3, BENCH_DATA_SIZE);
+
+static struct data_fifo *bench_fifo_tx_array[BENCH_MODULES_NUM] = {
+	&bench_fifo_tx0, &bench_fifo_tx1, &bench_fifo_tx2, &bench_fifo_tx3};
+static struct data_fifo *bench_fifo_rx_array[BENCH_MODULES_NUM] = {
+	&bench_fifo_rx0, &bench_fifo_rx1, &bench_fifo_rx2, &bench_fifo_rx3};
+
+static struct audio_module_handle handle[BENCH_MODULES_NUM];
+static struct audio_module_template_context context[BENCH_MODULES_NUM];
+static struct audio_module_graph graph;
+
+static uint8_t data_in[BENCH_DATA_SIZE];
+static uint8_t data_out[BENCH_DATA_SIZE];
+
+/* Every sample is stored, so that the percentiles are exact. */
+static uint32_t samples[BENCH_OP_CNT];
+
+static int sample_cmp(const void *a, const void *b)
+{
+	uint32_t sa = *(const uint32_t *)a;
+	uint32_t sb = *(const uint32_t *)b;
+
+	return (sa > sb) - (sa < sb);
+}
+
+static uint32_t sample_percentile(const uint32_t *sorted, uint32_t cnt, uint32_t pct)
+{
+	/* Nearest-rank percentile of the sorted samples. */
+	return sorted[DIV_ROUND_UP(cnt * pct, 100) - 1];
+}
+
+/* Print the result in the format parsed by the Twister record harness. The samples include the
+ * cost of reading the host clock.
+ */
+static void bench_report(const char *name, uint32_t *buf, uint32_t cnt)
+{
+	uint64_t total_ns = 0;
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		total_ns += buf[i];
+	}
+
+	qsort(buf, cnt, sizeof(buf[0]), sample_cmp);
+
+	TC_PRINT("BENCH audio_module_%s ops=%u ns_per_op=%u p50_ns=%u p99_ns=%u\n", name, cnt,
+		 (uint32_t)(total_ns / cnt), sample_percentile(buf, cnt, 50),
+		 sample_percentile(buf, cnt, 99));
+}
+
+static void bench_chain_open(void)
+{
+	int ret;
+	struct audio_module_parameters mod_parameters;
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Bench"};
+
+	memset(handle, 0, sizeof(handle));
+	memset(context, 0, sizeof(context));
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		AUDIO_MODULE_PARAMETERS(mod_parameters, audio_module_template_description,
+					bench_stack[i], BENCH_STACK_SIZE, BENCH_MODULE_PRIO,
+					bench_fifo_rx_array[i], bench_fifo_tx_array[i],
+					&bench_data_slab, BENCH_DATA_SIZE);
+
+		ret = audio_module_open(
+			&mod_parameters,
+			(const struct audio_module_configuration *const)&configuration, "Bench",
+			(struct audio_module_context *)&context[i], &handle[i]);
+		zassert_ok(ret, "Failed to open module %d", i);
+	}
+
+	for (int i = 0; i < BENCH_MODULES_NUM - 1; i++) {
+		zassert_ok(audio_module_connect(&handle[i], &handle[i + 1], false),
+			   "Failed to connect module %d", i);
+	}
+
+	zassert_ok(audio_module_connect(&handle[BENCH_MODULES_NUM - 1], NULL, true),
+		   "Failed to connect the last module");
+}
+
+static void bench_chain_start(void)
+{
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		zassert_ok(audio_module_start(&handle[i]), "Failed to start module %d", i);
+	}
+}
+
+static void bench_chain_close(void)
+{
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		zassert_ok(audio_module_stop(&handle[i]), "Failed to stop module %d", i);
+		zassert_ok(audio_module_close(&handle[i]), "Failed to close module %d", i);
+	}
+}
+
+static void bench_audio_data_init(struct audio_data *audio_data_in,
+				  struct audio_data *audio_data_out)
+{
+	memset(audio_data_in, 0, sizeof(struct audio_data));
+	audio_data_in->data = data_in;
+	audio_data_in->data_size = BENCH_DATA_SIZE;
+	audio_data_in->meta.data_coding = PCM;
+
+	memset(audio_data_out, 0, sizeof(struct audio_data));
+	audio_data_out->data = data_out;
+	audio_data_out->data_size = BENCH_DATA_SIZE;
+}
+
+ZTEST(suite_audio_module_template_benchmark, test_bench_threaded)
+{
+	int ret;
+	struct audio_data audio_data_in;
+	struct audio_data audio_data_out;
+
+	k_thread_priority_set(k_current_get(), BENCH_TEST_PRIO);
+
+	bench_chain_open();
+	bench_chain_start();
+
+	/* Every block is queued to the first module and passed on by each module thread, and is
+	 * measured until it has been read from the TX FIFO of the last module.
+	 */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		bench_audio_data_init(&audio_data_in, &audio_data_out);
+
+		uint64_t start = host_clock_time_ns();
+
+		ret = audio_module_data_tx(&handle[0], &audio_data_in, NULL);
+		zassert_ok(ret, "Failed to send a block");
+
+		ret = audio_module_data_rx(&handle[BENCH_MODULES_NUM - 1], &audio_data_out,
+					   BENCH_TIMEOUT);
+		zassert_ok(ret, "Failed to receive a block");
+
+		samples[i] = host_clock_time_ns() - start;
+	}
+
+	bench_report("threaded_chain", samples, BENCH_OP_CNT);
+
+	bench_chain_close();
+}
+
+ZTEST(suite_audio_module_template_benchmark, test_bench_graph)
+{
+	int ret;
+	struct audio_data audio_data_in;
+	struct audio_data audio_data_out;
+
+	k_thread_priority_set(k_current_get(), BENCH_TEST_PRIO);
+
+	bench_chain_open();
+
+	zassert_ok(audio_module_buffer_pool_init(&bench_pool), "Failed to init the pool");
+	zassert_ok(audio_module_graph_init(&graph, &bench_pool), "Failed to init the graph");
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		zassert_ok(audio_module_graph_add(&graph, &handle[i]), "Failed to add module %d",
+			   i);
+	}
+
+	zassert_ok(audio_module_graph_build(&graph), "Failed to build the graph");
+
+	bench_chain_start();
+
+	/* The same chain, run by the test thread and measured until the output has been read
+	 * from the TX FIFO of the last module.
+	 */
+	for (uint32_t i = 0; i < BENCH_OP_CNT; i++) {
+		bench_audio_data_init(&audio_data_in, &audio_data_out);
+
+		uint64_t start = host_clock_time_ns();
+
+		ret = audio_module_graph_process(&graph, &audio_data_in);
+		zassert_ok(ret, "Failed to process the graph");
+
+		ret = audio_module_data_rx(&handle[BENCH_MODULES_NUM - 1], &audio_data_out,
+					   K_NO_WAIT);
+		zassert_ok(ret, "Failed to receive a block");
+
+		samples[i] = host_clock_time_ns() - start;
+	}
+
+	bench_report("graph_chain", samples, BENCH_OP_CNT);
+
+	for (int i = 0; i < BENCH_MODULES_NUM; i++) {
+		zassert_ok(audio_module_graph_remove(&graph, &handle[i]),
+			   "Failed to remove module %d", i);
+	}
+
+	bench_chain_close();
+}
+
+ZTEST_SUITE(suite_audio_module_template_benchmark, NULL, NULL, NULL, NULL, NULL);
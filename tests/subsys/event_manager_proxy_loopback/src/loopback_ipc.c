@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+
+#include "loopback_ipc.h"
+
+#define LOOPBACK_BUF_CNT		16
+#define LOOPBACK_BUF_SIZE		512
+#define LOOPBACK_THREAD_STACK_SIZE	2048
+#define LOOPBACK_THREAD_PRIORITY	K_PRIO_PREEMPT(0)
+
+struct loopback_buf {
+	void *fifo_reserved;
+	/* The buffer is freed when both the loopback thread and the endpoint drop it. */
+	atomic_t ref_cnt;
+	size_t len;
+	uint64_t data[LOOPBACK_BUF_SIZE / sizeof(uint64_t)];
+};
+
+K_MEM_SLAB_DEFINE_STATIC(loopback_buf_slab, sizeof(struct loopback_buf), LOOPBACK_BUF_CNT,
+			 sizeof(uint64_t));
+static K_FIFO_DEFINE(loopback_rx_fifo);
+
+static const struct ipc_ept_cfg *loopback_ept_cfg;
+static atomic_t msg_cnt;
+static atomic_t held_cnt;
+
+
+static void buf_unref(struct loopback_buf *buf)
+{
+	if (atomic_dec(&buf->ref_cnt) == 1) {
+		k_mem_slab_free(&loopback_buf_slab, buf);
+	}
+}
+
+static struct loopback_buf *buf_from_data(void *data)
+{
+	return CONTAINER_OF(data, struct loopback_buf, data);
+}
+
+static int loopback_open_instance(const struct device *instance)
+{
+	return 0;
+}
+
+static int loopback_register_endpoint(const struct device *instance,
+				      const struct ipc_ept_cfg *cfg,
+				      void **token)
+{
+	if (loopback_ept_cfg) {
+		return -EBUSY;
+	}
+
+	loopback_ept_cfg = cfg;
+	*token = (void *)cfg;
+
+	/* The other end of the loopback is always ready. */
+	if (cfg->cb.bound) {
+		cfg->cb.bound(cfg->priv);
+	}
+
+	return 0;
+}
+
+static int loopback_send(const struct device *instance, void *token, const void *data, size_t len)
+{
+	int ret = loopback_ipc_inject(data, len);
+
+	if (ret >= 0) {
+		atomic_inc(&msg_cnt);
+	}
+
+	return ret;
+}
+
+static int loopback_hold_rx_buffer(const struct device *instance, void *token, void *data)
+{
+	struct loopback_buf *buf = buf_from_data(data);
+
+	atomic_inc(&buf->ref_cnt);
+	atomic_inc(&held_cnt);
+
+	return 0;
+}
+
+static int loopback_release_rx_buffer(const struct device *instance, void *token, void *data)
+{
+	buf_unref(buf_from_data(data));
+
+	return 0;
+}
+
+static const struct ipc_service_backend loopback_backend = {
+	.open_instance = loopback_open_instance,
+	.register_endpoint = loopback_register_endpoint,
+	.send = loopback_send,
+	.hold_rx_buffer = loopback_hold_rx_buffer,
+	.release_rx_buffer = loopback_release_rx_buffer,
+};
+
+DEVICE_DEFINE(loopback_ipc, "loopback_ipc", NULL, NULL, NULL, NULL,
+	      POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &loopback_backend);
+
+static void loopback_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct loopback_buf *buf = k_fifo_get(&loopback_rx_fifo, K_FOREVER);
+
+		loopback_ept_cfg->cb.received(buf->data, buf->len, loopback_ept_cfg->priv);
+		buf_unref(buf);
+	}
+}
+
+K_THREAD_DEFINE(loopback_thread, LOOPBACK_THREAD_STACK_SIZE, loopback_thread_fn,
+		NULL, NULL, NULL, LOOPBACK_THREAD_PRIORITY, 0, 0);
+
+const struct device *loopback_ipc_instance(void)
+{
+	return DEVICE_GET(loopback_ipc);
+}
+
+int loopback_ipc_inject(const void *data, size_t len)
+{
+	struct loopback_buf *buf;
+
+	if (len > sizeof(buf->data)) {
+		return -EMSGSIZE;
+	}
+
+	if (k_mem_slab_alloc(&loopback_buf_slab, (void **)&buf, K_NO_WAIT)) {
+		return -ENOMEM;
+	}
+
+	atomic_set(&buf->ref_cnt, 1);
+	buf->len = len;
+	memcpy(buf->data, data, len);
+	k_fifo_put(&loopback_rx_fifo, buf);
+
+	return len;
+}
+
+bool loopback_ipc_rx_buffer_owns(const void *addr)
+{
+	const char *ptr = addr;
+
+	return (ptr >= loopback_buf_slab.buffer) &&
+	       (ptr < loopback_buf_slab.buffer +
+		      (size_t)loopback_buf_slab.info.num_blocks * loopback_buf_slab.info.block_size);
+}
+
+void loopback_ipc_stats_get(struct loopback_ipc_stats *stats)
+{
+	stats->msg_cnt = atomic_get(&msg_cnt);
+	stats->held_cnt = atomic_get(&held_cnt);
+}
+
+void loopback_ipc_stats_reset(void)
+{
+	atomic_clear(&msg_cnt);
+	atomic_clear(&held_cnt);
+}
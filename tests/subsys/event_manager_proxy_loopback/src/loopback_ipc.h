@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _LOOPBACK_IPC_H_
+#define _LOOPBACK_IPC_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Loopback IPC statistics. */
+struct loopback_ipc_stats {
+	/** Number of messages sent through the loopback. */
+	uint32_t msg_cnt;
+	/** Number of received buffers held by the endpoint. */
+	uint32_t held_cnt;
+};
+
+/** @brief Get the loopback IPC instance.
+ *
+ * Every message sent by the endpoint registered on the instance is received back
+ * by the same endpoint, from the loopback thread.
+ *
+ * @return Pointer to the IPC instance.
+ */
+const struct device *loopback_ipc_instance(void);
+
+/** @brief Deliver the message to the endpoint as if it was sent by the remote core.
+ *
+ * @param data Pointer to the message.
+ * @param len  Length of the message.
+ *
+ * @retval len On success.
+ * @retval -EMSGSIZE The message does not fit into the receive buffer.
+ * @retval -ENOMEM No free receive buffer.
+ */
+int loopback_ipc_inject(const void *data, size_t len);
+
+/** @brief Check if the address is placed in a receive buffer of the loopback.
+ *
+ * @param addr Address to check.
+ *
+ * @retval true If the address is placed in a receive buffer.
+ * @retval false Otherwise.
+ */
+bool loopback_ipc_rx_buffer_owns(const void *addr);
+
+/** @brief Get the loopback IPC statistics.
+ *
+ * @param stats Pointer to the structure filled with the statistics.
+ */
+void loopback_ipc_stats_get(struct loopback_ipc_stats *stats);
+
+/** @brief Reset the loopback IPC statistics. */
+void loopback_ipc_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOOPBACK_IPC_H_ */
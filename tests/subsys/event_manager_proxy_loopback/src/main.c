@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+#include <event_manager_proxy.h>
+
+#include "bench_events.h"
+#include "host_clock.h"
+#include "loopback_ipc.h"
+
+#define MODULE test_loopback
+
+#define ROUNDTRIP_EVENT_CNT	8
+#define BENCH_EVENT_CNT		40000
+#define BENCH_BURST_CNT		8
+
+/* Bucket i counts round trips that took less than (LATENCY_MIN_NS << i) nanoseconds,
+ * the last bucket counts all the slower ones.
+ */
+#define LATENCY_MIN_NS		1024U
+#define LATENCY_BUCKET_CNT	10
+
+/* Layout of the subscribe command sent by the Event Manager Proxy of the remote core. */
+#define REMOTE_CMD_SUBSCRIBE	0
+
+struct remote_subscribe_cmd {
+	int code;
+	const struct event_type *id;
+	char name[sizeof("bench_event")];
+};
+
+static K_SEM_DEFINE(echo_sem, 0, 1);
+static uint32_t echo_expected_cnt;
+static uint32_t echo_cnt;
+static uint32_t in_place_cnt;
+static uint32_t next_seq;
+static uint32_t latency_hist[LATENCY_BUCKET_CNT];
+
+
+static void latency_record(uint64_t ns)
+{
+	size_t bucket = 0;
+
+	while ((bucket < LATENCY_BUCKET_CNT - 1) && (ns >= ((uint64_t)LATENCY_MIN_NS << bucket))) {
+		bucket++;
+	}
+
+	latency_hist[bucket]++;
+}
+
+static void latency_print(void)
+{
+	uint32_t total = 0;
+	uint32_t sum = 0;
+	size_t p99_bucket = 0;
+
+	for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+		total += latency_hist[i];
+	}
+
+	for (size_t i = 0; i < LATENCY_BUCKET_CNT; i++) {
+		if (i < LATENCY_BUCKET_CNT - 1) {
+			TC_PRINT("  < %7u ns: %u\n", LATENCY_MIN_NS << i, latency_hist[i]);
+		} else {
+			TC_PRINT(" >= %7u ns: %u\n", LATENCY_MIN_NS << (i - 1), latency_hist[i]);
+		}
+
+		if ((uint64_t)sum * 100 < (uint64_t)total * 99) {
+			p99_bucket = i;
+		}
+		sum += latency_hist[i];
+	}
+
+	if (p99_bucket < LATENCY_BUCKET_CNT - 1) {
+		TC_PRINT("99th percentile below %u ns\n", LATENCY_MIN_NS << p99_bucket);
+	} else {
+		TC_PRINT("99th percentile at or above %u ns\n",
+			 LATENCY_MIN_NS << (LATENCY_BUCKET_CNT - 2));
+	}
+}
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_bench_event(aeh)) {
+		return false;
+	}
+
+	if (is_bench_echo_event(aeh)) {
+		const struct bench_echo_event *event = cast_bench_echo_event(aeh);
+
+		latency_record(host_clock_time_ns() - event->submit_ns);
+		zassert_equal(event->seq, echo_cnt, "Events reordered");
+
+		if (loopback_ipc_rx_buffer_owns(event)) {
+			in_place_cnt++;
+		}
+
+		echo_cnt++;
+		if (echo_cnt == echo_expected_cnt) {
+			k_sem_give(&echo_sem);
+		}
+
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, bench_event);
+APP_EVENT_SUBSCRIBE(MODULE, bench_echo_event);
+
+
+static void submit_burst(uint32_t cnt)
+{
+	echo_expected_cnt += cnt;
+
+	/* Queue the whole burst before the events are processed, like events submitted
+	 * from an interrupt.
+	 */
+	k_sched_lock();
+
+	for (uint32_t i = 0; i < cnt; i++) {
+		struct bench_event *event = new_bench_event();
+
+		event->seq = next_seq++;
+		event->submit_ns = host_clock_time_ns();
+		APP_EVENT_SUBMIT(event);
+	}
+
+	k_sched_unlock();
+}
+
+static void *test_init(void)
+{
+	/* The remote core subscribes for the bench_event and receives it as the
+	 * bench_echo_event. The loopback passes it back to this core.
+	 */
+	const struct remote_subscribe_cmd cmd = {
+		.code = REMOTE_CMD_SUBSCRIBE,
+		.id = APP_EVENT_ID(bench_echo_event),
+		.name = "bench_event",
+	};
+	const struct device *instance = loopback_ipc_instance();
+
+	zassert_ok(app_event_manager_init(), "Error when initializing");
+	zassert_ok(event_manager_proxy_add_remote(instance), "Cannot add remote");
+	zassert_true(loopback_ipc_inject(&cmd, sizeof(cmd)) >= 0, "Cannot subscribe");
+	zassert_ok(event_manager_proxy_start(), "Cannot start proxy");
+	zassert_ok(event_manager_proxy_wait_for_remotes(K_SECONDS(1)), "Remote not started");
+
+	return NULL;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	echo_expected_cnt = 0;
+	echo_cnt = 0;
+	in_place_cnt = 0;
+	next_seq = 0;
+	k_sem_reset(&echo_sem);
+	memset(latency_hist, 0, sizeof(latency_hist));
+	loopback_ipc_stats_reset();
+}
+
+ZTEST(event_manager_proxy_loopback, test_roundtrip)
+{
+	struct loopback_ipc_stats stats;
+
+	submit_burst(ROUNDTRIP_EVENT_CNT);
+	zassert_ok(k_sem_take(&echo_sem, K_SECONDS(5)), "Events were not passed back");
+
+	loopback_ipc_stats_get(&stats);
+
+	if (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH)) {
+		zassert_true(stats.msg_cnt < ROUNDTRIP_EVENT_CNT, "Events were not batched");
+	} else {
+		zassert_equal(stats.msg_cnt, ROUNDTRIP_EVENT_CNT);
+	}
+
+	if (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX)) {
+		/* The events of a received buffer are copied only if the proxy already holds
+		 * too many buffers.
+		 */
+		zassert_true(in_place_cnt > 0, "Events were copied");
+		zassert_true(stats.held_cnt > 0);
+	} else {
+		zassert_equal(in_place_cnt, 0);
+		zassert_equal(stats.held_cnt, 0);
+	}
+}
+
+ZTEST(event_manager_proxy_loopback, test_benchmark)
+{
+	struct loopback_ipc_stats stats;
+	uint64_t start = host_clock_time_ns();
+
+	for (uint32_t i = 0; i < BENCH_EVENT_CNT; i += BENCH_BURST_CNT) {
+		submit_burst(BENCH_BURST_CNT);
+		zassert_ok(k_sem_take(&echo_sem, K_SECONDS(30)), "Events were not passed back");
+	}
+
+	uint64_t total_ns = host_clock_time_ns() - start;
+
+	loopback_ipc_stats_get(&stats);
+
+	TC_PRINT("Batching: %s, zero-copy receive: %s\n",
+		 IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCH) ? "on" : "off",
+		 IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_ZERO_COPY_RX) ? "on" : "off");
+	TC_PRINT("Passed %u events to the remote and back in %u us: %u events/s\n",
+		 BENCH_EVENT_CNT, (uint32_t)(total_ns / NSEC_PER_USEC),
+		 (uint32_t)((uint64_t)BENCH_EVENT_CNT * NSEC_PER_SEC / MAX(total_ns, 1)));
+	TC_PRINT("IPC messages: %u (%u events per message), processed in place: %u\n",
+		 stats.msg_cnt, BENCH_EVENT_CNT / MAX(stats.msg_cnt, 1), in_place_cnt);
+	TC_PRINT("Round trip latency histogram (bursts of %u events):\n", BENCH_BURST_CNT);
+	latency_print();
+}
+
+ZTEST_SUITE(event_manager_proxy_loopback, NULL, test_init, test_before, NULL, NULL);